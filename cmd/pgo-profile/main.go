@@ -0,0 +1,231 @@
+// Command pgo-profile runs a representative codec workload under the CPU
+// profiler and writes the profile used for profile-guided optimization:
+//
+//	go run ./cmd/pgo-profile
+//
+// The workload encodes and repeatedly decodes synthetic CT, MR, radiograph
+// and colour frames through the registered JPEG 2000 (lossless and lossy),
+// HTJ2K, JPEG Baseline, JPEG Lossless SV1, JPEG-LS and RLE codecs, the same
+// entry points a DICOM application calls. The profile is written as
+// default.pgo into the main package directories listed by -out, where
+// `go build` (-pgo=auto) picks it up; binaries outside this module copy the
+// file next to their own main package. Regenerate it after changing a hot
+// path; main_test.go fails when the profile names functions that no longer
+// exist or misses one of the hot paths.
+package main
+
+import (
+	"flag"
+	"fmt"
+	"math"
+	"math/rand"
+	"os"
+	"path/filepath"
+	"runtime/pprof"
+	"strings"
+	"time"
+
+	testpixels "github.com/cocosip/go-dicom-codecs/codec"
+	"github.com/cocosip/go-dicom-codecs/jpeg/baseline"
+	"github.com/cocosip/go-dicom-codecs/jpeg/lossless14sv1"
+	"github.com/cocosip/go-dicom-codecs/jpeg2000/htj2k"
+	j2klossless "github.com/cocosip/go-dicom-codecs/jpeg2000/lossless"
+	"github.com/cocosip/go-dicom-codecs/jpeg2000/lossy"
+	jlslossless "github.com/cocosip/go-dicom-codecs/jpegls/lossless"
+	"github.com/cocosip/go-dicom-codecs/rle"
+	"github.com/cocosip/go-dicom/pkg/imaging/codec"
+	"github.com/cocosip/go-dicom/pkg/imaging/imagetypes"
+)
+
+// profileDirs are the main packages of this module that build with the
+// profile.
+const profileDirs = "cmd/dicom-interop-validation"
+
+// hotPaths are functions the workload must exercise; they rely on inlining
+// and devirtualization that PGO provides, so a profile without them is
+// stale.
+var hotPaths = []string{
+	"jpeg2000/mqc.(*MQDecoder).Decode",
+	"jpeg2000/t1.(*Decoder).decodeCleanupPass",
+	"jpeg2000/wavelet.Inverse53_1DWithParity",
+	"jpeg2000/htj2k.decodeOpenJPHCleanup",
+	"jpeg/standard.(*HuffmanDecoder).Decode",
+	"jpegls/lossless.(*GolombReader).DecodeValue",
+}
+
+// job is one codec applied to one frame.
+type job struct {
+	name    string
+	codec   codec.Codec
+	frame   *frame
+	decodes int // decodes per encode
+}
+
+// frame is a synthetic native frame.
+type frame struct {
+	info *imagetypes.FrameInfo
+	data []byte
+}
+
+func main() {
+	root := flag.String("root", ".", "repository root")
+	out := flag.String("out", profileDirs, "comma-separated main package directories the profile is written to")
+	duration := flag.Duration("duration", 30*time.Second, "profiling time")
+	flag.Parse()
+
+	if err := run(*root, strings.Split(*out, ","), *duration); err != nil {
+		fmt.Fprintln(os.Stderr, "pgo-profile:", err)
+		os.Exit(1)
+	}
+}
+
+func run(root string, dirs []string, duration time.Duration) error {
+	jobs := workload()
+
+	tmp, err := os.CreateTemp("", "pgo-profile-*.pprof")
+	if err != nil {
+		return err
+	}
+	defer os.Remove(tmp.Name())
+	if err := pprof.StartCPUProfile(tmp); err != nil {
+		tmp.Close()
+		return err
+	}
+	rounds := 0
+	start := time.Now()
+	for time.Since(start) < duration {
+		for _, j := range jobs {
+			if err := j.run(); err != nil {
+				pprof.StopCPUProfile()
+				tmp.Close()
+				return err
+			}
+		}
+		rounds++
+	}
+	pprof.StopCPUProfile()
+	if err := tmp.Close(); err != nil {
+		return err
+	}
+	profile, err := os.ReadFile(tmp.Name())
+	if err != nil {
+		return err
+	}
+
+	for _, dir := range dirs {
+		path := filepath.Join(root, strings.TrimSpace(dir), "default.pgo")
+		if err := os.WriteFile(path, profile, 0o644); err != nil {
+			return err
+		}
+		fmt.Printf("%s: %d rounds, %d bytes\n", path, rounds, len(profile))
+	}
+	return nil
+}
+
+// workload returns the codec mix: lossless archives dominated by CT and MR,
+// lossy JPEG 2000 and Baseline for radiographs and colour, HTJ2K for
+// streaming viewers.
+func workload() []job {
+	ct := grayFrame(512, 512, 16, 12, 1)
+	mr := grayFrame(256, 256, 16, 12, 2)
+	xr := grayFrame(1024, 1024, 8, 8, 3)
+	rgb := colorFrame(512, 512, 4)
+	return []job{
+		{"j2k lossless ct", j2klossless.NewCodec(), ct, 4},
+		{"j2k lossless mr", j2klossless.NewCodec(), mr, 4},
+		{"j2k lossy xr", lossy.NewCodec(), xr, 4},
+		{"htj2k lossless ct", htj2k.NewLosslessCodec(), ct, 4},
+		{"jpeg baseline xr", baseline.NewBaselineCodec(90), xr, 4},
+		{"jpeg baseline rgb", baseline.NewBaselineCodec(90), rgb, 4},
+		{"jpeg lossless sv1 ct", lossless14sv1.NewLosslessSV1Codec(), ct, 4},
+		{"jpeg-ls ct", jlslossless.NewJPEGLSLosslessCodec(), ct, 4},
+		{"jpeg-ls mr", jlslossless.NewJPEGLSLosslessCodec(), mr, 4},
+		{"rle ct", rle.NewRLECodec(), ct, 4},
+	}
+}
+
+// run encodes the frame once and decodes the result j.decodes times.
+func (j job) run() error {
+	src := testpixels.NewTestPixelData(j.frame.info)
+	if err := src.AddFrame(j.frame.data); err != nil {
+		return err
+	}
+	encoded := testpixels.NewTestPixelData(j.frame.info)
+	if err := j.codec.Encode(src, encoded, nil); err != nil {
+		return fmt.Errorf("%s: encode: %w", j.name, err)
+	}
+	for i := 0; i < j.decodes; i++ {
+		decoded := testpixels.NewTestPixelData(j.frame.info)
+		if err := j.codec.Decode(encoded, decoded, nil); err != nil {
+			return fmt.Errorf("%s: decode: %w", j.name, err)
+		}
+	}
+	return nil
+}
+
+// grayFrame returns a monochrome frame resembling a cross-sectional slice:
+// an elliptical body of smoothly varying tissue with a few dense structures
+// and acquisition noise on a constant background.
+func grayFrame(width, height, bitsAllocated, bitsStored int, seed int64) *frame {
+	rng := rand.New(rand.NewSource(seed))
+	maxVal := float64(int(1)<<bitsStored - 1)
+	bytesPerSample := bitsAllocated / 8
+	data := make([]byte, width*height*bytesPerSample)
+	cx, cy := float64(width)/2, float64(height)/2
+	for y := 0; y < height; y++ {
+		for x := 0; x < width; x++ {
+			dx, dy := (float64(x)-cx)/(0.45*float64(width)), (float64(y)-cy)/(0.4*float64(height))
+			r := dx*dx + dy*dy
+			v := 0.02
+			if r < 1 {
+				v = 0.35 + 0.1*math.Sin(float64(x)/23)*math.Cos(float64(y)/17)
+				if (dx-0.3)*(dx-0.3)+dy*dy < 0.02 || (dx+0.35)*(dx+0.35)+(dy-0.1)*(dy-0.1) < 0.015 {
+					v = 0.85
+				}
+				v += rng.NormFloat64() * 0.01
+			}
+			s := int(math.Max(0, math.Min(maxVal, v*maxVal)))
+			i := (y*width + x) * bytesPerSample
+			data[i] = byte(s)
+			if bytesPerSample == 2 {
+				data[i+1] = byte(s >> 8)
+			}
+		}
+	}
+	return &frame{
+		info: &imagetypes.FrameInfo{
+			Width: uint16(width), Height: uint16(height),
+			BitsAllocated: uint16(bitsAllocated), BitsStored: uint16(bitsStored), HighBit: uint16(bitsStored - 1),
+			SamplesPerPixel: 1, PhotometricInterpretation: "MONOCHROME2",
+		},
+		data: data,
+	}
+}
+
+// colorFrame returns an 8-bit RGB frame with smooth gradients, edges and
+// sensor noise, like a photograph or a secondary capture.
+func colorFrame(width, height int, seed int64) *frame {
+	rng := rand.New(rand.NewSource(seed))
+	data := make([]byte, width*height*3)
+	for y := 0; y < height; y++ {
+		for x := 0; x < width; x++ {
+			base := [3]float64{
+				128 + 90*math.Sin(float64(x)/41),
+				128 + 90*math.Cos(float64(y)/29),
+				float64((x/64+y/64)%2) * 160,
+			}
+			for c, v := range base {
+				v += rng.NormFloat64() * 4
+				data[(y*width+x)*3+c] = byte(math.Max(0, math.Min(255, v)))
+			}
+		}
+	}
+	return &frame{
+		info: &imagetypes.FrameInfo{
+			Width: uint16(width), Height: uint16(height),
+			BitsAllocated: 8, BitsStored: 8, HighBit: 7,
+			SamplesPerPixel: 3, PhotometricInterpretation: "RGB",
+		},
+		data: data,
+	}
+}
@@ -0,0 +1,228 @@
+package main
+
+import (
+	"bytes"
+	"compress/gzip"
+	"encoding/binary"
+	"errors"
+	"go/ast"
+	"go/parser"
+	"go/token"
+	"io"
+	"os"
+	"path/filepath"
+	"strings"
+	"testing"
+)
+
+const modulePath = "github.com/cocosip/go-dicom-codecs"
+
+// TestProfileFresh fails when a checked-in profile names a function of this
+// module that no longer exists, or misses one of the hot paths. Either means
+// the profile no longer matches the code and has to be regenerated with
+// `go run ./cmd/pgo-profile`.
+func TestProfileFresh(t *testing.T) {
+	root := filepath.Join("..", "..")
+	for _, dir := range strings.Split(profileDirs, ",") {
+		path := filepath.Join(root, dir, "default.pgo")
+		names, err := profileFunctions(path)
+		if err != nil {
+			t.Fatalf("%s: %v", path, err)
+		}
+
+		for _, hot := range hotPaths {
+			if !names[modulePath+"/"+hot] {
+				t.Errorf("%s: hot path %s has no samples", path, hot)
+			}
+		}
+
+		decls := map[string]*packageDecls{}
+		for name := range names {
+			pkg, sym, ok := splitFunction(name)
+			if !ok {
+				continue
+			}
+			d, ok := decls[pkg]
+			if !ok {
+				if d, err = parsePackage(filepath.Join(root, filepath.FromSlash(pkg))); err != nil {
+					t.Fatalf("%s: %v", name, err)
+				}
+				decls[pkg] = d
+			}
+			if d == nil || !d.declares(sym) {
+				t.Errorf("%s: %s no longer exists", path, name)
+			}
+		}
+	}
+}
+
+// profileFunctions returns the function names of a gzipped pprof profile.
+func profileFunctions(path string) (map[string]bool, error) {
+	data, err := os.ReadFile(path)
+	if err != nil {
+		return nil, err
+	}
+	zr, err := gzip.NewReader(bytes.NewReader(data))
+	if err != nil {
+		return nil, err
+	}
+	if data, err = io.ReadAll(zr); err != nil {
+		return nil, err
+	}
+
+	// Profile.function is field 5 and Profile.string_table field 6;
+	// Function.name is field 2, an index into the string table.
+	var strs []string
+	var nameIndexes []uint64
+	err = protoFields(data, func(field int, value uint64, payload []byte) error {
+		switch field {
+		case 5:
+			return protoFields(payload, func(field int, value uint64, _ []byte) error {
+				if field == 2 {
+					nameIndexes = append(nameIndexes, value)
+				}
+				return nil
+			})
+		case 6:
+			strs = append(strs, string(payload))
+		}
+		return nil
+	})
+	if err != nil {
+		return nil, err
+	}
+	names := make(map[string]bool, len(nameIndexes))
+	for _, i := range nameIndexes {
+		if i >= uint64(len(strs)) {
+			return nil, errors.New("function name outside the string table")
+		}
+		names[strs[i]] = true
+	}
+	return names, nil
+}
+
+// protoFields calls fn for every top-level field of a protobuf message with
+// the value of varint fields or the payload of length-delimited ones.
+func protoFields(msg []byte, fn func(field int, value uint64, payload []byte) error) error {
+	for len(msg) > 0 {
+		key, n := binary.Uvarint(msg)
+		if n <= 0 {
+			return errors.New("malformed profile")
+		}
+		msg = msg[n:]
+		var value uint64
+		var payload []byte
+		switch key & 7 {
+		case 0:
+			if value, n = binary.Uvarint(msg); n <= 0 {
+				return errors.New("malformed profile")
+			}
+			msg = msg[n:]
+		case 1, 5:
+			size := 8
+			if key&7 == 5 {
+				size = 4
+			}
+			if len(msg) < size {
+				return errors.New("malformed profile")
+			}
+			msg = msg[size:]
+		case 2:
+			size, n := binary.Uvarint(msg)
+			if n <= 0 || uint64(len(msg)-n) < size {
+				return errors.New("malformed profile")
+			}
+			payload, msg = msg[n:n+int(size)], msg[n+int(size):]
+		default:
+			return errors.New("malformed profile")
+		}
+		if err := fn(int(key>>3), value, payload); err != nil {
+			return err
+		}
+	}
+	return nil
+}
+
+// splitFunction splits a function name of this module into its package
+// directory and symbol, e.g. "jpeg2000/t1" and "(*Decoder).decodeCleanupPass".
+func splitFunction(name string) (pkg, sym string, ok bool) {
+	rest, ok := strings.CutPrefix(name, modulePath+"/")
+	if !ok {
+		return "", "", false
+	}
+	slash := strings.LastIndex(rest, "/")
+	dot := strings.Index(rest[slash+1:], ".")
+	if dot < 0 {
+		return "", "", false
+	}
+	return rest[:slash+1+dot], rest[slash+2+dot:], true
+}
+
+// packageDecls holds the top-level functions, types and methods declared by
+// the non-test files of a package.
+type packageDecls struct {
+	funcs, types, methods map[string]bool
+}
+
+// parsePackage returns the declarations in dir, or nil when dir holds no Go
+// package.
+func parsePackage(dir string) (*packageDecls, error) {
+	entries, err := os.ReadDir(dir)
+	if errors.Is(err, os.ErrNotExist) {
+		return nil, nil
+	}
+	if err != nil {
+		return nil, err
+	}
+	d := &packageDecls{funcs: map[string]bool{}, types: map[string]bool{}, methods: map[string]bool{}}
+	fset := token.NewFileSet()
+	for _, e := range entries {
+		if !strings.HasSuffix(e.Name(), ".go") || strings.HasSuffix(e.Name(), "_test.go") {
+			continue
+		}
+		f, err := parser.ParseFile(fset, filepath.Join(dir, e.Name()), nil, parser.SkipObjectResolution)
+		if err != nil {
+			return nil, err
+		}
+		for _, decl := range f.Decls {
+			switch decl := decl.(type) {
+			case *ast.FuncDecl:
+				if decl.Recv != nil {
+					d.methods[decl.Name.Name] = true
+				} else {
+					d.funcs[decl.Name.Name] = true
+				}
+			case *ast.GenDecl:
+				for _, spec := range decl.Specs {
+					if ts, ok := spec.(*ast.TypeSpec); ok {
+						d.types[ts.Name.Name] = true
+					}
+				}
+			}
+		}
+	}
+	return d, nil
+}
+
+// declares reports whether sym, as the runtime names it, is declared: "F",
+// "F.func1", "(*T).M", "T.M" and the package initializers.
+func (d *packageDecls) declares(sym string) bool {
+	if i := strings.Index(sym, "["); i >= 0 {
+		if j := strings.Index(sym[i:], "]"); j >= 0 {
+			sym = sym[:i] + sym[i+j+1:]
+		}
+	}
+	parts := strings.Split(sym, ".")
+	head := parts[0]
+	switch {
+	case head == "init" || head == "glob":
+		return true
+	case strings.HasPrefix(head, "("):
+		typ := strings.TrimSuffix(strings.TrimPrefix(strings.TrimPrefix(head, "("), "*"), ")")
+		return d.types[typ] && len(parts) > 1 && d.methods[parts[1]]
+	case d.funcs[head]:
+		return true
+	default:
+		return d.types[head] && len(parts) > 1 && d.methods[parts[1]]
+	}
+}
@@ -0,0 +1,95 @@
+// Package layout names the codec parameters that select the sample layout of
+// decoded frames, and those through which decoders report the layout of the
+// frames they wrote, so that a caller can update the Image Pixel attributes
+// of the dataset to match. A decoder reports at least every attribute in
+// which its frames differ from the source: the size after a reduced-resolution
+// JPEG 2000 decode, the 8-bit samples of a rendered decode (codec/voi), the
+// planar configuration and the photometric interpretation.
+package layout
+
+// Parameters read by decoders.
+const (
+	// PlanarOutputParameter carries a bool asking for one plane per
+	// component (Planar Configuration 1) instead of interleaved samples.
+	PlanarOutputParameter = "planarOutput"
+	// SkipColorTransformParameter carries a bool asking the decoder to keep
+	// the colour space of the codestream (YBR_FULL for JPEG, YBR_ICT for
+	// lossy JPEG 2000) instead of converting to RGB.
+	SkipColorTransformParameter = "skipColorTransform"
+)
+
+// Parameters set by decoders.
+const (
+	// PlanarConfigurationParameter is set to 1 when the frames are planar.
+	PlanarConfigurationParameter = "planarConfiguration"
+	// PhotometricInterpretationParameter is set to the photometric
+	// interpretation of the frames when colour conversion was skipped.
+	PhotometricInterpretationParameter = "photometricInterpretation"
+
+	// RowsParameter and ColumnsParameter are set to the frame size.
+	RowsParameter    = "rows"
+	ColumnsParameter = "columns"
+
+	// BitsAllocatedParameter, BitsStoredParameter, HighBitParameter and
+	// PixelRepresentationParameter are set to the sample format.
+	BitsAllocatedParameter       = "bitsAllocated"
+	BitsStoredParameter          = "bitsStored"
+	HighBitParameter             = "highBit"
+	PixelRepresentationParameter = "pixelRepresentation"
+)
+
+// ParameterGetter is the part of codec.Parameters read by Bool.
+type ParameterGetter interface {
+	GetParameter(name string) interface{}
+}
+
+// Bool returns the boolean codec parameter name, or false when it is absent
+// or not a bool.
+func Bool(parameters ParameterGetter, name string) bool {
+	if parameters == nil {
+		return false
+	}
+	v, _ := parameters.GetParameter(name).(bool)
+	return v
+}
+
+// ParameterSetter is the part of codec.Parameters written by the Report
+// functions.
+type ParameterSetter interface {
+	SetParameter(name string, value interface{})
+}
+
+// ReportSize records the size of the decoded frames.
+func ReportSize(parameters ParameterSetter, rows, columns int) {
+	if parameters == nil {
+		return
+	}
+	parameters.SetParameter(RowsParameter, rows)
+	parameters.SetParameter(ColumnsParameter, columns)
+}
+
+// ReportSamples records the sample format of the decoded frames: bitsStored
+// bits held in 8 bits allocated up to 8 bits stored and 16 above, with the
+// high bit at bitsStored-1.
+func ReportSamples(parameters ParameterSetter, bitsStored int, signed bool) {
+	if parameters == nil {
+		return
+	}
+	bitsAllocated, pixelRepresentation := 8, 0
+	if bitsStored > 8 {
+		bitsAllocated = 16
+	}
+	if signed {
+		pixelRepresentation = 1
+	}
+	parameters.SetParameter(BitsAllocatedParameter, bitsAllocated)
+	parameters.SetParameter(BitsStoredParameter, bitsStored)
+	parameters.SetParameter(HighBitParameter, bitsStored-1)
+	parameters.SetParameter(PixelRepresentationParameter, pixelRepresentation)
+}
+
+// ReportRendered records that the decoded frames hold the unsigned 8-bit
+// display values written when voi rendering was requested.
+func ReportRendered(parameters ParameterSetter) {
+	ReportSamples(parameters, 8, false)
+}
@@ -0,0 +1,42 @@
+package layout
+
+import "testing"
+
+type parameters map[string]interface{}
+
+func (p parameters) GetParameter(name string) interface{}        { return p[name] }
+func (p parameters) SetParameter(name string, value interface{}) { p[name] = value }
+
+func TestBool(t *testing.T) {
+	p := parameters{PlanarOutputParameter: true, SkipColorTransformParameter: 1}
+	if !Bool(p, PlanarOutputParameter) {
+		t.Errorf("planarOutput=true read as false")
+	}
+	if Bool(p, SkipColorTransformParameter) {
+		t.Errorf("a non-bool value read as true")
+	}
+	if Bool(p, "missing") || Bool(nil, PlanarOutputParameter) {
+		t.Errorf("absent parameters read as true")
+	}
+}
+
+func TestReport(t *testing.T) {
+	p := parameters{}
+	ReportSize(p, 64, 80)
+	ReportSamples(p, 12, true)
+	want := parameters{
+		RowsParameter: 64, ColumnsParameter: 80,
+		BitsAllocatedParameter: 16, BitsStoredParameter: 12, HighBitParameter: 11, PixelRepresentationParameter: 1,
+	}
+	for name, v := range want {
+		if p[name] != v {
+			t.Errorf("%s = %v, want %v", name, p[name], v)
+		}
+	}
+	ReportRendered(p)
+	if p[BitsAllocatedParameter] != 8 || p[BitsStoredParameter] != 8 || p[HighBitParameter] != 7 || p[PixelRepresentationParameter] != 0 {
+		t.Errorf("rendered format = %v", p)
+	}
+	ReportSize(nil, 1, 1)
+	ReportRendered(nil)
+}
@@ -0,0 +1,127 @@
+// Package limits bounds the resources a decoder commits to a frame.
+//
+// Every decoder checks the sizes declared by its headers (SIZ/COD for JPEG
+// 2000, SOF for JPEG, SOF55 for JPEG-LS, the frame attributes for RLE)
+// against a DecodeLimits before it allocates image buffers or runs the
+// entropy decoder, so a crafted or corrupt header that declares a huge image,
+// millions of tiles or code-blocks is rejected up front instead of
+// allocating gigabytes or stalling a worker.
+package limits
+
+import (
+	"errors"
+	"fmt"
+)
+
+// ParameterName is the codec parameter that carries DecodeLimits (or
+// *DecodeLimits) for a decode request.
+const ParameterName = "decodeLimits"
+
+// ErrExceeded is wrapped by every error reporting a limit violation.
+var ErrExceeded = errors.New("decode limit exceeded")
+
+// DecodeLimits caps what a codestream may declare. A zero field selects the
+// default from Defaults and a negative field disables that check, so the
+// zero DecodeLimits is the default policy.
+type DecodeLimits struct {
+	MaxPixels       int64 // width x height of a frame
+	MaxComponents   int   // components (samples per pixel)
+	MaxTiles        int   // JPEG 2000 tiles
+	MaxCodeBlocks   int64 // JPEG 2000 code-blocks over all tiles and components
+	MaxCodingPasses int64 // JPEG 2000 coding passes signalled over all code-blocks
+	MaxLayers       int   // JPEG 2000 quality layers
+	MaxBytes        int64 // estimated peak bytes of the decoder's working buffers and output
+}
+
+// Defaults returns the limits applied to fields left at zero. They admit
+// every frame a DICOM object can describe up to 2^30 pixels and 4 GiB of
+// working memory.
+func Defaults() DecodeLimits {
+	return DecodeLimits{
+		MaxPixels:       1 << 30,
+		MaxComponents:   256,
+		MaxTiles:        65535,
+		MaxCodeBlocks:   1 << 24,
+		MaxCodingPasses: 1 << 28,
+		MaxLayers:       1024,
+		MaxBytes:        1 << 32,
+	}
+}
+
+// ParameterGetter is the part of codec.Parameters read by FromParameters.
+type ParameterGetter interface {
+	GetParameter(name string) interface{}
+}
+
+// FromParameters returns the limits carried by the ParameterName codec
+// parameter, or the defaults when it is absent.
+func FromParameters(parameters ParameterGetter) DecodeLimits {
+	if parameters == nil {
+		return DecodeLimits{}
+	}
+	switch v := parameters.GetParameter(ParameterName).(type) {
+	case DecodeLimits:
+		return v
+	case *DecodeLimits:
+		if v != nil {
+			return *v
+		}
+	}
+	return DecodeLimits{}
+}
+
+func check(what string, value, limit, def int64) error {
+	if limit == 0 {
+		limit = def
+	}
+	if limit > 0 && value > limit {
+		return fmt.Errorf("%w: %s %d exceeds %d", ErrExceeded, what, value, limit)
+	}
+	return nil
+}
+
+// CheckFrame checks the frame size, the component count and the estimated
+// peak memory of a decode.
+func (l DecodeLimits) CheckFrame(width, height, components int, peakBytes int64) error {
+	def := Defaults()
+	if err := check("pixels", int64(width)*int64(height), l.MaxPixels, def.MaxPixels); err != nil {
+		return err
+	}
+	if err := check("components", int64(components), int64(l.MaxComponents), int64(def.MaxComponents)); err != nil {
+		return err
+	}
+	return check("estimated peak bytes", peakBytes, l.MaxBytes, def.MaxBytes)
+}
+
+// CheckTiles checks a JPEG 2000 tile count.
+func (l DecodeLimits) CheckTiles(n int64) error {
+	return check("tiles", n, int64(l.MaxTiles), int64(Defaults().MaxTiles))
+}
+
+// CheckCodeBlocks checks a JPEG 2000 code-block count.
+func (l DecodeLimits) CheckCodeBlocks(n int64) error {
+	return check("code-blocks", n, l.MaxCodeBlocks, Defaults().MaxCodeBlocks)
+}
+
+// CheckCodingPasses checks a JPEG 2000 coding pass count.
+func (l DecodeLimits) CheckCodingPasses(n int64) error {
+	return check("coding passes", n, l.MaxCodingPasses, Defaults().MaxCodingPasses)
+}
+
+// CheckLayers checks a JPEG 2000 quality layer count.
+func (l DecodeLimits) CheckLayers(n int) error {
+	return check("layers", int64(n), int64(l.MaxLayers), int64(Defaults().MaxLayers))
+}
+
+// RemainingCodingPasses returns how many coding passes may still be decoded
+// after used ones, or -1 when passes are not limited.
+func (l DecodeLimits) RemainingCodingPasses(used int64) int64 {
+	limit := l.MaxCodingPasses
+	if limit == 0 {
+		limit = Defaults().MaxCodingPasses
+	}
+	if limit < 0 {
+		return -1
+	}
+	return max(0, limit-used)
+}
@@ -0,0 +1,58 @@
+package limits
+
+import (
+	"errors"
+	"testing"
+)
+
+type parameters map[string]interface{}
+
+func (p parameters) GetParameter(name string) interface{} { return p[name] }
+
+func TestDecodeLimitsDefaults(t *testing.T) {
+	var l DecodeLimits
+	def := Defaults()
+	if err := l.CheckFrame(1<<15, 1<<15, 3, 1<<31); err != nil {
+		t.Fatalf("CheckFrame within defaults: %v", err)
+	}
+	if err := l.CheckFrame(1<<16, 1<<15, 1, 0); !errors.Is(err, ErrExceeded) {
+		t.Fatalf("CheckFrame over default pixels = %v, want ErrExceeded", err)
+	}
+	if err := l.CheckTiles(int64(def.MaxTiles) + 1); !errors.Is(err, ErrExceeded) {
+		t.Fatalf("CheckTiles over default = %v, want ErrExceeded", err)
+	}
+	if got := l.RemainingCodingPasses(10); got != def.MaxCodingPasses-10 {
+		t.Fatalf("RemainingCodingPasses = %d, want %d", got, def.MaxCodingPasses-10)
+	}
+}
+
+func TestDecodeLimitsNegativeDisables(t *testing.T) {
+	l := DecodeLimits{MaxPixels: -1, MaxBytes: -1, MaxTiles: -1, MaxCodingPasses: -1}
+	if err := l.CheckFrame(1<<20, 1<<20, 1, 1<<50); err != nil {
+		t.Fatalf("CheckFrame with disabled limits: %v", err)
+	}
+	if err := l.CheckTiles(1 << 40); err != nil {
+		t.Fatalf("CheckTiles with disabled limit: %v", err)
+	}
+	if got := l.RemainingCodingPasses(1 << 40); got != -1 {
+		t.Fatalf("RemainingCodingPasses = %d, want -1", got)
+	}
+	if err := l.CheckLayers(1 << 20); !errors.Is(err, ErrExceeded) {
+		t.Fatalf("CheckLayers left at default = %v, want ErrExceeded", err)
+	}
+}
+
+func TestFromParameters(t *testing.T) {
+	want := DecodeLimits{MaxPixels: 100}
+	for _, p := range []ParameterGetter{parameters{ParameterName: want}, parameters{ParameterName: &want}} {
+		if got := FromParameters(p); got != want {
+			t.Fatalf("FromParameters = %+v, want %+v", got, want)
+		}
+	}
+	if got := FromParameters(parameters{}); got != (DecodeLimits{}) {
+		t.Fatalf("FromParameters without parameter = %+v, want zero", got)
+	}
+	if got := FromParameters(nil); got != (DecodeLimits{}) {
+		t.Fatalf("FromParameters(nil) = %+v, want zero", got)
+	}
+}
@@ -0,0 +1,602 @@
+// Package probe estimates how well a frame compresses with each lossless
+// codec from a sparse sample of its rows, so that a transfer syntax can be
+// chosen without trial encodes.
+//
+// A probe reads a few evenly spaced bands of rows and models each codec with
+// the statistic its entropy coder actually sees: PackBits runs for RLE,
+// predictor residuals for JPEG-LS (MED, conditioned on local gradient
+// activity) and JPEG lossless (selection value 1), and 5/3 DWT subband
+// coefficients for JPEG 2000 and HTJ2K. Sizes are extrapolated from the
+// sampled rows and encode cost is derived from a per-codec throughput model,
+// so the result is meant for ranking codecs, not for exact sizing.
+package probe
+
+import (
+	"fmt"
+	"math"
+	"math/bits"
+	"time"
+
+	jpeglossless "github.com/cocosip/go-dicom-codecs/jpeg/lossless"
+	"github.com/cocosip/go-dicom-codecs/jpeg2000/colorspace"
+	"github.com/cocosip/go-dicom-codecs/jpeg2000/wavelet"
+	jpeglslossless "github.com/cocosip/go-dicom-codecs/jpegls/lossless"
+)
+
+// Codec identifies a lossless codec covered by the probe.
+type Codec int
+
+const (
+	// RLE is DICOM RLE Lossless.
+	RLE Codec = iota
+	// JPEGLS is JPEG-LS Lossless.
+	JPEGLS
+	// JPEGLossless is JPEG Lossless, first-order prediction (selection value 1).
+	JPEGLossless
+	// JPEG2000 is JPEG 2000 Lossless (5/3 DWT, EBCOT).
+	JPEG2000
+	// HTJ2K is High-Throughput JPEG 2000 Lossless (5/3 DWT, HT block coder).
+	HTJ2K
+
+	numCodecs = iota
+)
+
+// String returns the codec name.
+func (c Codec) String() string {
+	switch c {
+	case RLE:
+		return "RLE Lossless"
+	case JPEGLS:
+		return "JPEG-LS Lossless"
+	case JPEGLossless:
+		return "JPEG Lossless SV1"
+	case JPEG2000:
+		return "JPEG 2000 Lossless"
+	case HTJ2K:
+		return "HTJ2K Lossless"
+	default:
+		return fmt.Sprintf("Codec(%d)", int(c))
+	}
+}
+
+// Frame describes the uncompressed frame to probe.
+type Frame struct {
+	Data          []byte // native samples; 16-bit samples are little-endian
+	Width         int
+	Height        int
+	Components    int  // samples per pixel (1 or 3)
+	BitsAllocated int  // 8 or 16
+	BitsStored    int  // 0 means BitsAllocated
+	Signed        bool // pixel representation 1
+	Planar        bool // planar configuration 1 (colour-by-plane)
+}
+
+// Options controls how much of the frame is sampled.
+type Options struct {
+	// Bands is the number of evenly spaced row bands read. 0 selects one band
+	// per 128 rows, between 4 and 32, so about 6% of the rows are read.
+	Bands int
+	// BandRows is the height of each band (default 8, at least 2). It also
+	// bounds the number of vertical DWT levels of the JPEG 2000 model.
+	BandRows int
+}
+
+// Estimate is the predicted outcome of encoding the frame with one codec.
+type Estimate struct {
+	Codec      Codec
+	Bytes      int           // estimated encoded size including headers
+	Ratio      float64       // uncompressed size / Bytes
+	BitsPerPix float64       // estimated coded bits per pixel (all components)
+	EncodeCost time.Duration // estimated single-core encode time
+}
+
+// Probe estimates the encoded size and encode cost of f for every codec, in
+// Codec order.
+func Probe(f Frame, opts *Options) ([]Estimate, error) {
+	if err := f.validate(); err != nil {
+		return nil, err
+	}
+	o := Options{Bands: min(max(f.Height/128, 4), 32), BandRows: 8}
+	if opts != nil {
+		if opts.Bands > 0 {
+			o.Bands = opts.Bands
+		}
+		if opts.BandRows > 0 {
+			o.BandRows = max(2, opts.BandRows)
+		}
+	}
+	o.BandRows = min(o.BandRows, f.Height)
+
+	p := newSampler(f)
+	for _, y := range bandStarts(f.Height, o.Bands, o.BandRows) {
+		p.addBand(y, o.BandRows)
+	}
+
+	pixels := float64(f.Width * f.Height)
+	rawBytes := f.Width * f.Height * f.Components * f.bytesPerSample()
+	estimates := make([]Estimate, numCodecs)
+	for c := Codec(0); c < numCodecs; c++ {
+		bitsPerPixel := p.bitsPerPixel(c)
+		size := int(math.Ceil(bitsPerPixel*pixels/8)) + headerBytes(c, f)
+		if c == RLE {
+			size = min(size, rawBytes+headerBytes(c, f)+f.Components*f.bytesPerSample()*(f.Width*f.Height/128+1))
+		}
+		model := codecCosts[c]
+		samples := pixels * float64(f.Components)
+		cost := samples*model.nsPerSample + float64(rawBytes)*model.nsPerByte + bitsPerPixel*pixels*model.nsPerBit
+		estimates[c] = Estimate{
+			Codec:      c,
+			Bytes:      size,
+			Ratio:      float64(rawBytes) / float64(size),
+			BitsPerPix: bitsPerPixel,
+			EncodeCost: time.Duration(cost),
+		}
+	}
+	return estimates, nil
+}
+
+// Smallest returns the estimate with the fewest bytes; ties favour the lower
+// encode cost.
+func Smallest(estimates []Estimate) Estimate {
+	best := estimates[0]
+	for _, e := range estimates[1:] {
+		if e.Bytes < best.Bytes || (e.Bytes == best.Bytes && e.EncodeCost < best.EncodeCost) {
+			best = e
+		}
+	}
+	return best
+}
+
+func (f Frame) validate() error {
+	if f.Width <= 0 || f.Height <= 0 {
+		return fmt.Errorf("probe: invalid dimensions %dx%d", f.Width, f.Height)
+	}
+	if f.Components != 1 && f.Components != 3 {
+		return fmt.Errorf("probe: unsupported samples per pixel %d", f.Components)
+	}
+	if f.BitsAllocated != 8 && f.BitsAllocated != 16 {
+		return fmt.Errorf("probe: unsupported bits allocated %d", f.BitsAllocated)
+	}
+	if f.BitsStored < 0 || f.BitsStored > f.BitsAllocated {
+		return fmt.Errorf("probe: invalid bits stored %d", f.BitsStored)
+	}
+	if need := f.Width * f.Height * f.Components * f.bytesPerSample(); len(f.Data) < need {
+		return fmt.Errorf("probe: frame data too short: %d bytes, need %d", len(f.Data), need)
+	}
+	return nil
+}
+
+func (f Frame) bytesPerSample() int {
+	return f.BitsAllocated / 8
+}
+
+func (f Frame) bitsStored() int {
+	if f.BitsStored == 0 {
+		return f.BitsAllocated
+	}
+	return f.BitsStored
+}
+
+// bandStarts spreads n bands of rows evenly over the frame; when they would
+// overlap the whole frame is read instead.
+func bandStarts(height, n, rows int) []int {
+	if n*rows >= height {
+		starts := make([]int, 0, (height+rows-1)/rows)
+		for y := 0; y < height; y += rows {
+			starts = append(starts, min(y, height-rows))
+		}
+		return starts
+	}
+	// Centre each band in its stratum so that image borders are not
+	// over-represented.
+	starts := make([]int, n)
+	for i := range starts {
+		starts[i] = min(max((2*i+1)*height/(2*n)-rows/2, 0), height-rows)
+	}
+	return starts
+}
+
+// headerBytes approximates the fixed marker and table overhead of a codec.
+func headerBytes(c Codec, f Frame) int {
+	switch c {
+	case RLE:
+		return 64
+	case JPEGLS:
+		return 32 + 3*f.Components
+	case JPEGLossless:
+		return 150 + 36*f.Components
+	default:
+		return 100 + 10*f.Components
+	}
+}
+
+// codecCost models encode time as work per sample, per uncompressed byte and
+// per coded bit.
+type codecCost struct {
+	nsPerSample float64
+	nsPerByte   float64
+	nsPerBit    float64
+}
+
+// codecCosts were fitted to this module's encoders on one core over gray 8-
+// and 16-bit and RGB frames from flat to noise-like. Only their ratios matter
+// for ranking.
+var codecCosts = [numCodecs]codecCost{
+	RLE:          {nsPerByte: 8},
+	JPEGLS:       {nsPerSample: 25, nsPerBit: 14},
+	JPEGLossless: {nsPerSample: 25, nsPerBit: 10},
+	JPEG2000:     {nsPerSample: 150, nsPerBit: 65},
+	HTJ2K:        {nsPerSample: 70, nsPerBit: 3},
+}
+
+// maxCategory bounds the magnitude categories tracked: 16-bit residuals of
+// 16-bit data, plus the DWT gain and the RCT chroma bit.
+const maxCategory = 20
+
+// numActivityClasses is the number of local-gradient classes JPEG-LS
+// residuals are conditioned on, approximating its context modelling.
+const numActivityClasses = 12
+
+// sampler accumulates per-codec statistics over the sampled bands.
+type sampler struct {
+	f      Frame
+	mask   int32 // bits stored mask
+	shift  int32 // sign bit flipped for signed data
+	planes [][]int32
+
+	pixels int // sampled pixels
+
+	rleBytes int
+
+	predSamples int // samples with a full causal neighbourhood
+	lsHist      [numActivityClasses][maxCategory + 1]int
+	lsRunHist   [maxCategory + 1]int // run interruption samples
+	lsRunBits   float64
+	sv1Hist     [maxCategory + 1]int
+
+	// dwtHist holds one histogram per subband (index 0 is the final LL).
+	dwtHist    [][maxCategory + 1]int
+	dwtSamples int
+	htBits     float64
+}
+
+func newSampler(f Frame) *sampler {
+	s := &sampler{f: f, planes: make([][]int32, f.Components)}
+	s.mask = 1<<f.bitsStored() - 1
+	if f.Signed {
+		s.shift = 1 << (f.bitsStored() - 1)
+	}
+	return s
+}
+
+// readRow appends row y of component c to dst. Signed samples are flipped to
+// offset binary, which is the bit pattern the lossless coders see modulo the
+// sample range.
+func (s *sampler) readRow(dst []int32, c, y int) []int32 {
+	f := s.f
+	idx, step := (y*f.Width)*f.Components+c, f.Components
+	if f.Planar {
+		idx, step = (c*f.Height+y)*f.Width, 1
+	}
+	if f.BitsAllocated == 8 {
+		for x := 0; x < f.Width; x++ {
+			dst = append(dst, (int32(f.Data[idx])&s.mask)^s.shift)
+			idx += step
+		}
+		return dst
+	}
+	for x := 0; x < f.Width; x++ {
+		v := int32(f.Data[2*idx]) | int32(f.Data[2*idx+1])<<8
+		dst = append(dst, (v&s.mask)^s.shift)
+		idx += step
+	}
+	return dst
+}
+
+// addBand reads rows [y0, y0+rows) and updates every codec model.
+func (s *sampler) addBand(y0, rows int) {
+	w := s.f.Width
+	for c := range s.planes {
+		plane := s.planes[c][:0]
+		for y := y0; y < y0+rows; y++ {
+			plane = s.readRow(plane, c, y)
+		}
+		s.planes[c] = plane
+		for b := 0; b < s.f.bytesPerSample(); b++ {
+			s.rleBytes += packBitsLength(plane, uint(8*b))
+		}
+		s.addPredictors(plane, w, rows)
+	}
+	s.pixels += w * rows
+	s.addDWT(w, rows)
+}
+
+// packBitsLength returns the PackBits-coded length of one byte of each sample,
+// as DICOM RLE codes one segment per byte: runs of three or more identical
+// bytes cost two bytes per 128, literals one header byte per 128.
+func packBitsLength(plane []int32, shift uint) int {
+	length, literal := 0, 0
+	n := len(plane)
+	for i := 0; i < n; {
+		b := byte(plane[i] >> shift)
+		j := i + 1
+		for j < n && byte(plane[j]>>shift) == b {
+			j++
+		}
+		if run := j - i; run >= 3 {
+			if literal > 0 {
+				length += literal + (literal+127)/128
+				literal = 0
+			}
+			length += 2 * ((run + 127) / 128)
+		} else {
+			literal += run
+		}
+		i = j
+	}
+	if literal > 0 {
+		length += literal + (literal+127)/128
+	}
+	return length
+}
+
+// addPredictors accumulates residual categories for the JPEG-LS MED predictor
+// (per activity class, with run mode in flat areas) and the JPEG lossless SV1
+// predictor. The first row and column of the band only serve as context.
+func (s *sampler) addPredictors(plane []int32, w, rows int) {
+	rangeBits := s.f.bitsStored()
+	for y := 1; y < rows; y++ {
+		cur := plane[y*w : (y+1)*w]
+		prev := plane[(y-1)*w : y*w]
+		run := 0
+		inRun := false
+		for x := 1; x < w; x++ {
+			a, b, c := int(cur[x-1]), int(prev[x]), int(prev[x-1])
+			d := b
+			if x+1 < w {
+				d = int(prev[x+1])
+			}
+			v := int(cur[x])
+
+			sv1 := moduloResidual(v-jpeglossless.Predictor(1, a, b, c), rangeBits)
+			s.sv1Hist[category(sv1)]++
+
+			if inRun || (a == b && b == c && c == d) {
+				// Run mode: the run length is coded with an adaptive
+				// Golomb-like code and ends at a differing sample.
+				if v == a {
+					inRun = true
+					run++
+					continue
+				}
+				s.lsRunBits += runLengthBits(run)
+				inRun, run = false, 0
+				pred := a
+				if a != b {
+					pred = b
+				}
+				s.lsRunHist[category(moduloResidual(v-pred, rangeBits))]++
+				continue
+			}
+
+			med := moduloResidual(v-jpeglslossless.Predict(a, b, c), rangeBits)
+			activity := abs(d-b) + abs(b-c) + abs(c-a)
+			class := min(bits.Len(uint(activity)), numActivityClasses-1)
+			s.lsHist[class][category(med)]++
+		}
+		if inRun {
+			s.lsRunBits += runLengthBits(run)
+		}
+	}
+	s.predSamples += (rows - 1) * (w - 1)
+}
+
+// runLengthBits approximates the JPEG-LS run-length code, whose adaptive
+// order tracks the typical run so that a run costs about its bit length.
+func runLengthBits(run int) float64 {
+	return 1 + float64(bits.Len(uint(run)))
+}
+
+// addDWT transforms the band with the reversible 5/3 DWT (after RCT for
+// colour) and accumulates coefficient statistics per subband. Horizontal and
+// vertical levels are limited by the band height.
+func (s *sampler) addDWT(w, rows int) {
+	levels := max(1, bits.Len(uint(rows))-1)
+	if len(s.planes) == 3 {
+		r, g, b := s.planes[0], s.planes[1], s.planes[2]
+		for i := range r {
+			r[i], g[i], b[i] = colorspace.RCTForward(r[i], g[i], b[i])
+		}
+	}
+	if s.dwtHist == nil {
+		s.dwtHist = make([][maxCategory + 1]int, 1+3*levels)
+	}
+	levels = min(levels, (len(s.dwtHist)-1)/3)
+	dcShift := int32(1) << (s.f.bitsStored() - 1)
+	for c, plane := range s.planes {
+		if c == 0 || len(s.planes) == 1 {
+			for i := range plane {
+				plane[i] -= dcShift
+			}
+		}
+		wavelet.ForwardMultilevel(plane, w, rows, levels)
+		cw, ch := w, rows
+		for l := 0; l < levels; l++ {
+			lw, lh := (cw+1)/2, (ch+1)/2
+			s.addSubband(1+3*l, plane, w, lw, cw, 0, lh)  // HL
+			s.addSubband(2+3*l, plane, w, 0, lw, lh, ch)  // LH
+			s.addSubband(3+3*l, plane, w, lw, cw, lh, ch) // HH
+			cw, ch = lw, lh
+		}
+		s.addSubband(0, plane, w, 0, cw, 0, ch)
+	}
+	s.dwtSamples += w * rows * len(s.planes)
+}
+
+// addSubband accumulates the statistics of one subband region in chunks of
+// zeroChunk columns. All-zero chunks are skipped, as both block coders code
+// all-zero code-blocks (and EBCOT zero runs) at almost no cost.
+func (s *sampler) addSubband(band int, plane []int32, stride, x0, x1, y0, y1 int) {
+	for cx := x0; cx < x1; cx += zeroChunk {
+		ex := min(cx+zeroChunk, x1)
+		for y := y0; y < y1; y++ {
+			if !allZero(plane[y*stride+cx : y*stride+ex]) {
+				s.addQuads(band, plane, stride, cx, ex, y0, y1)
+				break
+			}
+		}
+	}
+}
+
+// zeroChunk is the width of the subband chunks tested for being all zero.
+const zeroChunk = 32
+
+func allZero(coeffs []int32) bool {
+	for _, v := range coeffs {
+		if v != 0 {
+			return false
+		}
+	}
+	return true
+}
+
+// addQuads accumulates the coefficient categories of a subband region and
+// the HT cleanup cost of its 2x2 quads: a quad with significant samples pays
+// for its significance pattern and an exponent code that grows with the
+// quad's largest magnitude category, then every significant sample spends
+// that category in raw bits.
+func (s *sampler) addQuads(band int, plane []int32, stride, x0, x1, y0, y1 int) {
+	hist := &s.dwtHist[band]
+	for y := y0; y < y1; y += 2 {
+		row0 := plane[y*stride : y*stride+x1]
+		row1 := row0
+		if y+1 < y1 {
+			row1 = plane[(y+1)*stride : (y+1)*stride+x1]
+		}
+		for x := x0; x < x1; x += 2 {
+			k0, k1 := category(int(row0[x])), 0
+			var k2, k3 int
+			if x+1 < x1 {
+				k1 = category(int(row0[x+1]))
+			}
+			hist[k0]++
+			if x+1 < x1 {
+				hist[k1]++
+			}
+			if y+1 < y1 {
+				k2 = category(int(row1[x]))
+				hist[k2]++
+				if x+1 < x1 {
+					k3 = category(int(row1[x+1]))
+					hist[k3]++
+				}
+			}
+			emax := max(k0, k1, k2, k3)
+			if emax == 0 {
+				s.htBits += htEmptyQuadBits
+				continue
+			}
+			sig := 0
+			for _, k := range [4]int{k0, k1, k2, k3} {
+				if k > 0 {
+					sig++
+				}
+			}
+			s.htBits += htQuadBits + float64(emax)/2 + float64(sig*emax)
+		}
+	}
+}
+
+// HT cleanup pass cost model: MEL-coded empty quads, and VLC significance
+// plus U-VLC exponent bits for quads with significant samples.
+const (
+	htEmptyQuadBits = 0.3
+	htQuadBits      = 4
+)
+
+// bitsPerPixel converts the sampled statistics of codec c into coded bits per
+// pixel for all components together.
+func (s *sampler) bitsPerPixel(c Codec) float64 {
+	pixels := float64(s.pixels)
+	switch c {
+	case RLE:
+		return 8 * float64(s.rleBytes) / pixels
+	case JPEGLS:
+		// Golomb coding with adaptive parameters lands close to the
+		// context-conditional entropy.
+		total := s.lsRunBits + categoryBits(s.lsRunHist[:], 0)
+		for i := range s.lsHist {
+			total += categoryBits(s.lsHist[i][:], 0)
+		}
+		return s.perPixel(total, s.predSamples)
+	case JPEGLossless:
+		// Huffman codes spend at least one bit per residual category.
+		return s.perPixel(categoryBits(s.sv1Hist[:], 1), s.predSamples)
+	case JPEG2000:
+		// EBCOT's context modelling recovers about 6% over zero-order
+		// subband entropy, net of packet headers.
+		total := 0.0
+		for i := range s.dwtHist {
+			total += categoryBits(s.dwtHist[i][:], 0)
+		}
+		return 0.94 * s.perPixel(total, s.dwtSamples)
+	case HTJ2K:
+		return s.perPixel(s.htBits, s.dwtSamples)
+	}
+	return 0
+}
+
+// perPixel scales bits measured over samples to bits per pixel.
+func (s *sampler) perPixel(totalBits float64, samples int) float64 {
+	if samples == 0 {
+		return 0
+	}
+	return totalBits * float64(s.f.Components) / float64(samples)
+}
+
+// categoryBits returns the total bits to code the samples of hist, where
+// category k carries k raw magnitude/sign bits plus an entropy-coded category
+// symbol costing at least minSymbolBits.
+func categoryBits(hist []int, minSymbolBits float64) float64 {
+	n := 0
+	for _, count := range hist {
+		n += count
+	}
+	if n == 0 {
+		return 0
+	}
+	entropy, raw := 0.0, 0.0
+	for k, count := range hist {
+		if count == 0 {
+			continue
+		}
+		p := float64(count) / float64(n)
+		entropy -= p * math.Log2(p)
+		raw += float64(k) * float64(count)
+	}
+	return max(entropy, minSymbolBits)*float64(n) + raw
+}
+
+// moduloResidual reduces a prediction residual to the range the lossless
+// coders transmit (modulo 2^rangeBits, centred on zero).
+func moduloResidual(e, rangeBits int) int {
+	half := 1 << (rangeBits - 1)
+	mask := 1<<rangeBits - 1
+	e &= mask
+	if e >= half {
+		e -= mask + 1
+	}
+	return e
+}
+
+// category is the JPEG magnitude category SSSS: the bit length of |v|.
+func category(v int) int {
+	return min(bits.Len(uint(abs(v))), maxCategory)
+}
+
+func abs(v int) int {
+	if v < 0 {
+		return -v
+	}
+	return v
+}
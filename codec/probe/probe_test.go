@@ -0,0 +1,189 @@
+package probe
+
+import (
+	"math/rand"
+	"testing"
+
+	"github.com/cocosip/go-dicom-codecs/codec"
+	jpeglossless "github.com/cocosip/go-dicom-codecs/jpeg/lossless"
+	"github.com/cocosip/go-dicom-codecs/jpeg2000"
+	"github.com/cocosip/go-dicom-codecs/jpeg2000/htj2k"
+	jpeglslossless "github.com/cocosip/go-dicom-codecs/jpegls/lossless"
+	"github.com/cocosip/go-dicom-codecs/rle"
+	"github.com/cocosip/go-dicom/pkg/imaging/imagetypes"
+)
+
+// ctFrame builds a 12-bit CT-like slice: a noisy disc of tissue on air.
+func ctFrame(size int) Frame {
+	r := rand.New(rand.NewSource(1))
+	data := make([]byte, 2*size*size)
+	for y := 0; y < size; y++ {
+		for x := 0; x < size; x++ {
+			dx, dy := x-size/2, y-size/2
+			v := 0
+			if dx*dx+dy*dy < size*size/6 {
+				v = 1000 + 200*((x/20+y/30)%3) + r.Intn(40)
+			}
+			data[2*(y*size+x)] = byte(v)
+			data[2*(y*size+x)+1] = byte(v >> 8)
+		}
+	}
+	return Frame{Data: data, Width: size, Height: size, Components: 1, BitsAllocated: 16, BitsStored: 12}
+}
+
+// rgbFrame builds an 8-bit interleaved colour gradient with mild noise.
+func rgbFrame(size int) Frame {
+	r := rand.New(rand.NewSource(2))
+	data := make([]byte, 3*size*size)
+	for y := 0; y < size; y++ {
+		for x := 0; x < size; x++ {
+			for c := 0; c < 3; c++ {
+				data[3*(y*size+x)+c] = byte(x/2 + y/3 + c*30 + r.Intn(10))
+			}
+		}
+	}
+	return Frame{Data: data, Width: size, Height: size, Components: 3, BitsAllocated: 8}
+}
+
+// encodedSize encodes f with codec c through the package encoders.
+func encodedSize(t *testing.T, f Frame, c Codec) int {
+	t.Helper()
+	bitDepth := f.bitsStored()
+	var out []byte
+	var err error
+	switch c {
+	case RLE:
+		info := &imagetypes.FrameInfo{
+			Width: uint16(f.Width), Height: uint16(f.Height),
+			BitsAllocated: uint16(f.BitsAllocated), BitsStored: uint16(bitDepth), HighBit: uint16(bitDepth - 1),
+			SamplesPerPixel: uint16(f.Components), PhotometricInterpretation: "MONOCHROME2",
+		}
+		src := codec.NewTestPixelData(info)
+		_ = src.AddFrame(f.Data)
+		dst := codec.NewTestPixelData(info)
+		if err = rle.NewRLECodec().Encode(src, dst, nil); err == nil {
+			out, err = dst.GetFrame(0)
+		}
+	case JPEGLS:
+		out, err = jpeglslossless.Encode(f.Data, f.Width, f.Height, f.Components, bitDepth)
+	case JPEGLossless:
+		out, err = jpeglossless.Encode(f.Data, f.Width, f.Height, f.Components, bitDepth, 1)
+	case JPEG2000, HTJ2K:
+		params := jpeg2000.DefaultEncodeParams(f.Width, f.Height, f.Components, bitDepth, false)
+		params.Lossless = true
+		if c == HTJ2K {
+			params.HTJ2KMode = true
+			params.BlockEncoderFactory = func(w, h int) jpeg2000.BlockEncoder { return htj2k.NewHTEncoder(w, h) }
+		}
+		out, err = jpeg2000.NewEncoder(params).Encode(f.Data)
+	}
+	if err != nil {
+		t.Fatalf("%v encode failed: %v", c, err)
+	}
+	return len(out)
+}
+
+// TestProbeTracksEncodedSize checks the sampled estimates against real
+// encodes of the whole frame.
+func TestProbeTracksEncodedSize(t *testing.T) {
+	frames := []struct {
+		name  string
+		frame Frame
+	}{
+		{"ct 16-bit", ctFrame(384)},
+		{"rgb 8-bit", rgbFrame(256)},
+	}
+	for _, tt := range frames {
+		t.Run(tt.name, func(t *testing.T) {
+			estimates, err := Probe(tt.frame, nil)
+			if err != nil {
+				t.Fatalf("Probe failed: %v", err)
+			}
+			if len(estimates) != numCodecs {
+				t.Fatalf("got %d estimates, want %d", len(estimates), numCodecs)
+			}
+			for _, e := range estimates {
+				actual := encodedSize(t, tt.frame, e.Codec)
+				ratio := float64(e.Bytes) / float64(actual)
+				t.Logf("%-20v estimated %7d actual %7d (%.2f), cost %v", e.Codec, e.Bytes, actual, ratio, e.EncodeCost)
+				if ratio < 0.75 || ratio > 1.3 {
+					t.Errorf("%v: estimate %d is off from actual %d by %.2fx", e.Codec, e.Bytes, actual, ratio)
+				}
+				if e.EncodeCost <= 0 {
+					t.Errorf("%v: no encode cost estimate", e.Codec)
+				}
+			}
+			if est := estimates[HTJ2K].EncodeCost; est >= estimates[JPEG2000].EncodeCost {
+				t.Errorf("HTJ2K cost %v should be below JPEG 2000 cost %v", est, estimates[JPEG2000].EncodeCost)
+			}
+		})
+	}
+}
+
+// TestProbeLayouts checks that planar and signed frames are read as the
+// same samples as their interleaved and unsigned counterparts.
+func TestProbeLayouts(t *testing.T) {
+	interleaved := rgbFrame(64)
+	planar := interleaved
+	planar.Planar = true
+	planar.Data = make([]byte, len(interleaved.Data))
+	n := interleaved.Width * interleaved.Height
+	for i := 0; i < n; i++ {
+		for c := 0; c < 3; c++ {
+			planar.Data[c*n+i] = interleaved.Data[3*i+c]
+		}
+	}
+	a, err := Probe(interleaved, nil)
+	if err != nil {
+		t.Fatalf("Probe failed: %v", err)
+	}
+	b, err := Probe(planar, nil)
+	if err != nil {
+		t.Fatalf("Probe planar failed: %v", err)
+	}
+	for i := range a {
+		if a[i].Bytes != b[i].Bytes {
+			t.Errorf("%v: planar estimate %d differs from interleaved %d", a[i].Codec, b[i].Bytes, a[i].Bytes)
+		}
+	}
+
+	unsigned := ctFrame(64)
+	signed := unsigned
+	signed.Signed = true
+	signed.Data = make([]byte, len(unsigned.Data))
+	for i := 0; i < len(unsigned.Data); i += 2 {
+		v := (int(unsigned.Data[i]) | int(unsigned.Data[i+1])<<8) - 2048
+		signed.Data[i], signed.Data[i+1] = byte(v), byte(v>>8)
+	}
+	a, _ = Probe(unsigned, nil)
+	b, err = Probe(signed, nil)
+	if err != nil {
+		t.Fatalf("Probe signed failed: %v", err)
+	}
+	for _, c := range []Codec{JPEGLS, JPEGLossless, JPEG2000, HTJ2K} {
+		if a[c].Bytes != b[c].Bytes {
+			t.Errorf("%v: signed estimate %d differs from unsigned %d", c, b[c].Bytes, a[c].Bytes)
+		}
+	}
+	if best := Smallest(a); best.Bytes > a[RLE].Bytes {
+		t.Errorf("Smallest returned %v with %d bytes", best.Codec, best.Bytes)
+	}
+}
+
+func TestProbeErrors(t *testing.T) {
+	valid := Frame{Data: make([]byte, 16), Width: 4, Height: 4, Components: 1, BitsAllocated: 8}
+	if _, err := Probe(valid, &Options{Bands: 1, BandRows: 2}); err != nil {
+		t.Fatalf("Probe of a tiny frame failed: %v", err)
+	}
+	invalid := []Frame{
+		{Data: valid.Data, Width: 0, Height: 4, Components: 1, BitsAllocated: 8},
+		{Data: valid.Data, Width: 4, Height: 4, Components: 2, BitsAllocated: 8},
+		{Data: valid.Data, Width: 4, Height: 4, Components: 1, BitsAllocated: 12},
+		{Data: valid.Data, Width: 4, Height: 4, Components: 1, BitsAllocated: 16},
+	}
+	for i, f := range invalid {
+		if _, err := Probe(f, nil); err == nil {
+			t.Errorf("case %d: invalid frame accepted", i)
+		}
+	}
+}
@@ -0,0 +1,127 @@
+package sched
+
+import "fmt"
+
+// ParameterGetter is the part of codec.Parameters read by
+// PriorityFromParameters.
+type ParameterGetter interface {
+	GetParameter(name string) interface{}
+}
+
+// PriorityFromParameters returns the priority carried by the ParameterName
+// codec parameter, or Normal when it is absent.
+func PriorityFromParameters(parameters ParameterGetter) Priority {
+	if parameters == nil {
+		return Normal
+	}
+	switch v := parameters.GetParameter(ParameterName).(type) {
+	case Priority:
+		return v
+	case int:
+		return Priority(v)
+	}
+	return Normal
+}
+
+// FrameSource and FrameSink are the parts of a pixel data container used by
+// FrameReader and FrameWriter.
+type (
+	FrameSource interface {
+		GetFrame(index int) ([]byte, error)
+	}
+	FrameSink interface {
+		AddFrame(frame []byte) error
+	}
+)
+
+// FrameReader returns a Frames read function that fetches frames from src
+// and rejects empty ones.
+func FrameReader(src FrameSource) func(frame int) ([]byte, error) {
+	return func(frame int) ([]byte, error) {
+		data, err := src.GetFrame(frame)
+		if err != nil {
+			return nil, fmt.Errorf("failed to get frame %d: %w", frame, err)
+		}
+		if len(data) == 0 {
+			return nil, fmt.Errorf("frame %d pixel data is empty", frame)
+		}
+		return data, nil
+	}
+}
+
+// FrameWriter returns a Frames emit function that appends frames to dst.
+func FrameWriter(dst FrameSink) func(frame int, data []byte) error {
+	return func(frame int, data []byte) error {
+		if err := dst.AddFrame(data); err != nil {
+			return fmt.Errorf("failed to add frame %d: %w", frame, err)
+		}
+		return nil
+	}
+}
+
+// framesInFlight is the number of frames per scheduler slot that may be
+// coded ahead of the frame being emitted.
+const framesInFlight = 2
+
+// Frames codes n frames on the default scheduler and hands the results to
+// emit in frame order.
+//
+// read and emit run on the calling goroutine, so the source and destination
+// pixel data are never accessed concurrently; code runs as scheduler tasks of
+// one request with the given priority and must be safe to call concurrently
+// for different frames. Only a window of frames proportional to the scheduler
+// limit is read ahead of emit, so memory stays bounded for long series. The
+// first error in frame order stops the pipeline and is returned.
+func Frames(priority Priority, n int, read func(frame int) ([]byte, error), code func(frame int, src []byte) ([]byte, error), emit func(frame int, data []byte) error) error {
+	return Default().Frames(priority, n, read, code, emit)
+}
+
+// Frames is the package-level Frames on scheduler s.
+func (s *Scheduler) Frames(priority Priority, n int, read func(frame int) ([]byte, error), code func(frame int, src []byte) ([]byte, error), emit func(frame int, data []byte) error) error {
+	type result struct {
+		data []byte
+		err  error
+		done chan struct{}
+	}
+	group := s.NewGroup(priority)
+	window := max(1, s.Limit()*framesInFlight)
+	results := make([]*result, n)
+	submitted, readFailed := 0, false
+	submit := func(limit int) {
+		for ; !readFailed && submitted < min(n, limit); submitted++ {
+			frame := submitted
+			r := &result{done: make(chan struct{})}
+			results[frame] = r
+			src, err := read(frame)
+			if err != nil {
+				r.err = err
+				close(r.done)
+				readFailed = true // stop reading ahead of a failed frame
+				continue
+			}
+			group.Go(func() error {
+				defer close(r.done)
+				r.err = run(func() (err error) {
+					r.data, err = code(frame, src)
+					return err
+				})
+				return r.err // drops frames still queued behind a failure
+			})
+		}
+	}
+
+	var err error
+	for frame := 0; frame < n && err == nil; frame++ {
+		submit(frame + window)
+		r := results[frame]
+		<-r.done
+		results[frame] = nil
+		if err = r.err; err == nil {
+			err = emit(frame, r.data)
+		}
+	}
+	// Let frames already submitted finish before returning so that code is
+	// never running after Frames has returned.
+	_ = group.Wait()
+	return err
+}
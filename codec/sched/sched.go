@@ -0,0 +1,257 @@
+// Package sched provides the shared scheduler that codecs submit parallel
+// work to, so that frame, tile and code-block parallelism across every codec
+// in the process is bounded by one concurrency limit.
+//
+// Work is submitted through a Group, which stands for one request (a decode
+// for a viewer, a bulk transcode). Groups belong to a priority class; a free
+// slot always goes to the highest class with queued work, and groups within a
+// class take turns task by task, so a 2000-frame encode and a single-frame
+// decode of the same class progress at the same rate. Background work never
+// takes the last free slot while the limit is above one, which keeps a slot
+// available for an interactive request arriving during a bulk job.
+package sched
+
+import (
+	"fmt"
+	"runtime"
+	"sync"
+)
+
+// Priority is the class of a request. Lower values are dispatched first.
+type Priority int
+
+const (
+	// Interactive is for latency-sensitive work such as viewer decodes.
+	Interactive Priority = iota
+	// Normal is the default class.
+	Normal
+	// Background is for bulk work such as archival transcodes; it only runs
+	// when no higher class is waiting.
+	Background
+
+	numPriorities
+)
+
+// ParameterName is the codec parameter that carries the Priority (or an int)
+// of an encode or decode request.
+const ParameterName = "priority"
+
+// Scheduler runs submitted tasks on at most Limit goroutines at a time.
+type Scheduler struct {
+	mu      sync.Mutex
+	limit   int
+	running int
+	classes [numPriorities][]*Group // groups with queued tasks, in turn order
+}
+
+type task struct {
+	fn    func() error
+	owner *Group
+}
+
+var defaultScheduler = New(0)
+
+// Default returns the process-wide scheduler used by the codecs. Its limit
+// starts at GOMAXPROCS and can be changed with SetLimit.
+func Default() *Scheduler {
+	return defaultScheduler
+}
+
+// New returns a scheduler running at most limit tasks concurrently; a limit
+// of 0 or less means GOMAXPROCS.
+func New(limit int) *Scheduler {
+	s := &Scheduler{}
+	s.SetLimit(limit)
+	return s
+}
+
+// SetLimit changes the concurrency limit (0 or less means GOMAXPROCS).
+// Lowering it takes effect as running tasks finish.
+func (s *Scheduler) SetLimit(limit int) {
+	if limit <= 0 {
+		limit = runtime.GOMAXPROCS(0)
+	}
+	s.mu.Lock()
+	s.limit = limit
+	s.startWorkersLocked()
+	s.mu.Unlock()
+}
+
+// Limit returns the concurrency limit.
+func (s *Scheduler) Limit() int {
+	s.mu.Lock()
+	defer s.mu.Unlock()
+	return s.limit
+}
+
+// Group is a set of tasks belonging to one request.
+type Group struct {
+	s        *Scheduler
+	priority Priority
+	root     *Group // group whose turn the tasks share; itself for requests
+	nested   bool
+
+	tasks []task // queued tasks of the root and its subgroups
+	head  int
+	ready bool // root is listed in s.classes
+
+	pending int // submitted tasks not yet finished
+	err     error
+	done    *sync.Cond
+}
+
+// NewGroup starts a request of the given priority. Out-of-range priorities
+// are treated as Normal.
+func (s *Scheduler) NewGroup(priority Priority) *Group {
+	if priority < Interactive || priority >= numPriorities {
+		priority = Normal
+	}
+	g := &Group{s: s, priority: priority, done: sync.NewCond(&s.mu)}
+	g.root = g
+	return g
+}
+
+// Sub returns a group for work fanned out by a task of g (tiles of a frame,
+// code-blocks of a tile). Its tasks share g's turn and priority, and its Wait
+// lends the caller's slot to the scheduler while blocked, so nested waits
+// cannot exhaust the limit. Sub groups must only be waited on from inside a
+// task of g.
+func (g *Group) Sub() *Group {
+	return &Group{s: g.s, priority: g.priority, root: g.root, nested: true, done: sync.NewCond(&g.s.mu)}
+}
+
+// Go queues fn. Once a task of the group has failed, further tasks are
+// dropped.
+func (g *Group) Go(fn func() error) {
+	s := g.s
+	s.mu.Lock()
+	defer s.mu.Unlock()
+	if g.err != nil {
+		return
+	}
+	g.pending++
+	root := g.root
+	root.tasks = append(root.tasks, task{fn: fn, owner: g})
+	if !root.ready {
+		root.ready = true
+		s.classes[root.priority] = append(s.classes[root.priority], root)
+	}
+	s.startWorkersLocked()
+}
+
+// Wait blocks until every task submitted to the group has finished and
+// returns the first error.
+func (g *Group) Wait() error {
+	s := g.s
+	s.mu.Lock()
+	defer s.mu.Unlock()
+	if g.nested && g.pending > 0 {
+		// The caller is a task holding a slot; free it while blocked.
+		s.running--
+		s.startWorkersLocked()
+		defer func() { s.running++ }()
+	}
+	for g.pending > 0 {
+		g.done.Wait()
+	}
+	return g.err
+}
+
+// startWorkersLocked starts a worker per free slot while tasks are queued.
+func (s *Scheduler) startWorkersLocked() {
+	for s.running < s.limit {
+		t, ok := s.nextLocked()
+		if !ok {
+			return
+		}
+		s.running++
+		go s.work(t)
+	}
+}
+
+// nextLocked pops the next task: highest class first, and the group at the
+// front of that class, which then moves to the back.
+func (s *Scheduler) nextLocked() (task, bool) {
+	for p := Interactive; p < numPriorities; p++ {
+		if p == Background && s.limit > 1 && s.running >= s.limit-1 {
+			break
+		}
+		for len(s.classes[p]) > 0 {
+			root := s.classes[p][0]
+			s.classes[p] = s.classes[p][1:]
+			t, ok := root.popLocked()
+			if root.head < len(root.tasks) {
+				s.classes[p] = append(s.classes[p], root)
+			} else {
+				root.ready = false
+			}
+			if ok {
+				return t, true
+			}
+		}
+	}
+	return task{}, false
+}
+
+// popLocked returns the root's next runnable task, finishing tasks whose
+// group has already failed without running them.
+func (g *Group) popLocked() (task, bool) {
+	for g.head < len(g.tasks) {
+		t := g.tasks[g.head]
+		g.tasks[g.head] = task{}
+		g.head++
+		if g.head == len(g.tasks) {
+			g.tasks, g.head = g.tasks[:0], 0
+		}
+		if t.owner.err != nil {
+			t.owner.finishLocked(nil)
+			continue
+		}
+		return t, true
+	}
+	return task{}, false
+}
+
+func (g *Group) finishLocked(err error) {
+	if err != nil && g.err == nil {
+		g.err = err
+	}
+	g.pending--
+	if g.pending == 0 {
+		g.done.Broadcast()
+	}
+}
+
+// work runs t and then keeps taking queued tasks until none are left or the
+// limit has been lowered.
+func (s *Scheduler) work(t task) {
+	for {
+		err := run(t.fn)
+		s.mu.Lock()
+		t.owner.finishLocked(err)
+		next, ok := task{}, false
+		if s.running <= s.limit {
+			s.running--
+			next, ok = s.nextLocked()
+			s.running++
+		}
+		if !ok {
+			s.running--
+			s.mu.Unlock()
+			return
+		}
+		s.mu.Unlock()
+		t = next
+	}
+}
+
+// run calls fn, turning a panic into an error so one bad frame cannot take
+// down the process from a worker goroutine.
+func run(fn func() error) (err error) {
+	defer func() {
+		if r := recover(); r != nil {
+			err = fmt.Errorf("sched: task panicked: %v", r)
+		}
+	}()
+	return fn()
+}
@@ -0,0 +1,239 @@
+package sched
+
+import (
+	"errors"
+	"fmt"
+	"sync"
+	"sync/atomic"
+	"testing"
+	"time"
+)
+
+func TestLimit(t *testing.T) {
+	s := New(3)
+	var running, peak atomic.Int32
+	g := s.NewGroup(Normal)
+	for i := 0; i < 40; i++ {
+		g.Go(func() error {
+			n := running.Add(1)
+			for {
+				p := peak.Load()
+				if n <= p || peak.CompareAndSwap(p, n) {
+					break
+				}
+			}
+			time.Sleep(time.Millisecond)
+			running.Add(-1)
+			return nil
+		})
+	}
+	if err := g.Wait(); err != nil {
+		t.Fatalf("Wait: %v", err)
+	}
+	if p := peak.Load(); p != 3 {
+		t.Fatalf("peak concurrency %d, want 3", p)
+	}
+}
+
+// recorder returns tasks that block until released and log their label in
+// start order, so tests can observe dispatch decisions on a 1-slot scheduler.
+type recorder struct {
+	mu    sync.Mutex
+	order []string
+}
+
+func (r *recorder) task(label string, gate <-chan struct{}) func() error {
+	return func() error {
+		if gate != nil {
+			<-gate
+		}
+		r.mu.Lock()
+		r.order = append(r.order, label)
+		r.mu.Unlock()
+		return nil
+	}
+}
+
+func TestPriorityAndFairness(t *testing.T) {
+	s := New(1)
+	rec := &recorder{}
+	gate := make(chan struct{})
+
+	// Occupy the only slot so everything below is queued before dispatch.
+	blocker := s.NewGroup(Normal)
+	blocker.Go(rec.task("block", gate))
+
+	bulk := s.NewGroup(Background)
+	for i := 0; i < 3; i++ {
+		bulk.Go(rec.task(fmt.Sprintf("bg%d", i), nil))
+	}
+	a := s.NewGroup(Normal)
+	b := s.NewGroup(Normal)
+	for i := 0; i < 3; i++ {
+		a.Go(rec.task(fmt.Sprintf("a%d", i), nil))
+	}
+	b.Go(rec.task("b0", nil))
+	b.Go(rec.task("b1", nil))
+	viewer := s.NewGroup(Interactive)
+	viewer.Go(rec.task("view", nil))
+
+	close(gate)
+	for _, g := range []*Group{blocker, bulk, a, b, viewer} {
+		if err := g.Wait(); err != nil {
+			t.Fatalf("Wait: %v", err)
+		}
+	}
+	got := fmt.Sprint(rec.order)
+	want := "[block view a0 b0 a1 b1 a2 bg0 bg1 bg2]"
+	if got != want {
+		t.Fatalf("dispatch order %s, want %s", got, want)
+	}
+}
+
+func TestBackgroundLeavesSlotFree(t *testing.T) {
+	s := New(2)
+	release := make(chan struct{})
+	var running, peak atomic.Int32
+	bulk := s.NewGroup(Background)
+	for i := 0; i < 4; i++ {
+		bulk.Go(func() error {
+			n := running.Add(1)
+			if n > peak.Load() {
+				peak.Store(n)
+			}
+			<-release
+			running.Add(-1)
+			return nil
+		})
+	}
+
+	viewer := s.NewGroup(Interactive)
+	started := make(chan struct{})
+	viewer.Go(func() error {
+		close(started)
+		return nil
+	})
+	select {
+	case <-started:
+	case <-time.After(5 * time.Second):
+		t.Fatalf("interactive task did not start while background work was running")
+	}
+	close(release)
+	if err := bulk.Wait(); err != nil {
+		t.Fatalf("Wait: %v", err)
+	}
+	if p := peak.Load(); p != 1 {
+		t.Fatalf("background used %d slots of 2, want 1", p)
+	}
+}
+
+func TestNestedGroupsDoNotDeadlock(t *testing.T) {
+	s := New(1)
+	var leaves atomic.Int32
+	g := s.NewGroup(Normal)
+	for frame := 0; frame < 4; frame++ {
+		g.Go(func() error {
+			tiles := g.Sub()
+			for tile := 0; tile < 4; tile++ {
+				tiles.Go(func() error {
+					leaves.Add(1)
+					return nil
+				})
+			}
+			return tiles.Wait()
+		})
+	}
+	done := make(chan error)
+	go func() { done <- g.Wait() }()
+	select {
+	case err := <-done:
+		if err != nil {
+			t.Fatalf("Wait: %v", err)
+		}
+	case <-time.After(5 * time.Second):
+		t.Fatalf("nested groups deadlocked")
+	}
+	if n := leaves.Load(); n != 16 {
+		t.Fatalf("ran %d nested tasks, want 16", n)
+	}
+}
+
+func TestErrorsAndPanics(t *testing.T) {
+	s := New(1)
+	errBoom := errors.New("boom")
+	g := s.NewGroup(Normal)
+	var ran atomic.Int32
+	g.Go(func() error { return errBoom })
+	for i := 0; i < 5; i++ {
+		g.Go(func() error {
+			ran.Add(1)
+			return nil
+		})
+	}
+	if err := g.Wait(); !errors.Is(err, errBoom) {
+		t.Fatalf("Wait error %v, want %v", err, errBoom)
+	}
+	if n := ran.Load(); n != 0 {
+		t.Fatalf("%d tasks ran after the group failed", n)
+	}
+
+	p := s.NewGroup(Normal)
+	p.Go(func() error { panic("bad frame") })
+	if err := p.Wait(); err == nil {
+		t.Fatalf("panicking task should report an error")
+	}
+}
+
+func TestFrames(t *testing.T) {
+	s := New(4)
+	const n = 50
+	var emitted []int
+	read := func(frame int) ([]byte, error) { return []byte{byte(frame)}, nil }
+	err := s.Frames(Interactive, n, read, func(frame int, src []byte) ([]byte, error) {
+		time.Sleep(time.Duration(n-frame) * 20 * time.Microsecond)
+		return src, nil
+	}, func(frame int, data []byte) error {
+		if int(data[0]) != frame {
+			return fmt.Errorf("frame %d got data of frame %d", frame, data[0])
+		}
+		emitted = append(emitted, frame)
+		return nil
+	})
+	if err != nil {
+		t.Fatalf("Frames: %v", err)
+	}
+	for i, frame := range emitted {
+		if frame != i {
+			t.Fatalf("emit order %v", emitted)
+		}
+	}
+	if len(emitted) != n {
+		t.Fatalf("emitted %d frames, want %d", len(emitted), n)
+	}
+
+	errBad := errors.New("bad frame")
+	for _, failRead := range []bool{false, true} {
+		count, reads := 0, 0
+		err = s.Frames(Normal, n, func(frame int) ([]byte, error) {
+			reads++
+			if failRead && frame == 7 {
+				return nil, errBad
+			}
+			return nil, nil
+		}, func(frame int, _ []byte) ([]byte, error) {
+			if !failRead && frame == 7 {
+				return nil, errBad
+			}
+			return nil, nil
+		}, func(int, []byte) error {
+			count++
+			return nil
+		})
+		if !errors.Is(err, errBad) || count != 7 {
+			t.Fatalf("failRead=%v: Frames error %v after %d frames, want %v after 7", failRead, err, count, errBad)
+		}
+		if failRead && reads != 8 {
+			t.Fatalf("read %d frames, want reading to stop at the failed frame", reads)
+		}
+	}
+}
@@ -0,0 +1,314 @@
+// Package stats computes per-frame pixel statistics in one pass so that
+// encoders do not each scan a frame to learn the same facts.
+//
+// A Stats records, per component, the sample range, which bits of the raw
+// sample words vary, and how many samples are zero or lie in long runs of
+// zeros. RLE uses it for constant byte planes, and reversible JPEG 2000 and
+// baseline JPEG for constant components. When one frame is encoded to
+// several transfer syntaxes, a Cache passed under ParameterName lets these
+// codecs reuse the statistics computed by the first.
+package stats
+
+import (
+	"encoding/binary"
+	"fmt"
+	"math/bits"
+	"sync"
+
+	"github.com/cocosip/go-dicom/pkg/imaging/imagetypes"
+)
+
+// ParameterName is the codec parameter that carries a *Cache. Encoders that
+// can use frame statistics look them up in it, and compute them only when it
+// is set.
+const ParameterName = "frameStats"
+
+// MinZeroRun is the shortest run of zero samples counted by ZeroRunSamples.
+const MinZeroRun = 8
+
+// Frame describes an uncompressed frame.
+type Frame struct {
+	Data          []byte // native samples; 16-bit samples are little-endian
+	Width         int
+	Height        int
+	Components    int  // samples per pixel
+	BitsAllocated int  // 8 or 16
+	BitsStored    int  // 0 means BitsAllocated
+	Signed        bool // pixel representation 1
+	Planar        bool // planar configuration 1 (colour-by-plane)
+}
+
+// FrameOf describes data laid out as info specifies.
+func FrameOf(info *imagetypes.FrameInfo, data []byte) Frame {
+	return Frame{
+		Data:          data,
+		Width:         int(info.Width),
+		Height:        int(info.Height),
+		Components:    int(info.SamplesPerPixel),
+		BitsAllocated: int(info.BitsAllocated),
+		BitsStored:    int(info.BitsStored),
+		Signed:        info.PixelRepresentation == 1,
+		Planar:        info.PlanarConfiguration == 1,
+	}
+}
+
+// Component holds the statistics of one component.
+type Component struct {
+	// Min and Max are the smallest and largest stored values, masked to
+	// BitsStored and sign-extended for signed frames.
+	Min, Max int32
+	// First is the first raw sample word and Varying has a bit set for every
+	// bit of the raw words that differs from First, high bits included.
+	First, Varying uint16
+	// Zeros counts stored values equal to 0 and ZeroRunSamples those among
+	// them that lie in runs of at least MinZeroRun in raster order.
+	Zeros, ZeroRunSamples int
+}
+
+// Constant reports whether every raw sample word of the component is equal.
+func (c *Component) Constant() bool {
+	return c.Varying == 0
+}
+
+// Stats holds the statistics of a frame.
+type Stats struct {
+	Components []Component
+	Min, Max   int32 // over all components
+	// Bits is the effective bit depth: the fewest bits that represent every
+	// stored value (two's complement for signed frames), at least 1.
+	Bits    int
+	Samples int // width x height x components
+}
+
+// Constant reports whether every component is constant.
+func (s *Stats) Constant() bool {
+	for i := range s.Components {
+		if !s.Components[i].Constant() {
+			return false
+		}
+	}
+	return true
+}
+
+// ZeroRunCoverage returns the fraction of samples that lie in runs of at
+// least MinZeroRun zeros.
+func (s *Stats) ZeroRunCoverage() float64 {
+	if s.Samples == 0 {
+		return 0
+	}
+	n := 0
+	for i := range s.Components {
+		n += s.Components[i].ZeroRunSamples
+	}
+	return float64(n) / float64(s.Samples)
+}
+
+func (f Frame) validate() error {
+	if f.Width <= 0 || f.Height <= 0 {
+		return fmt.Errorf("stats: invalid dimensions %dx%d", f.Width, f.Height)
+	}
+	if f.Components <= 0 {
+		return fmt.Errorf("stats: invalid samples per pixel %d", f.Components)
+	}
+	if f.BitsAllocated != 8 && f.BitsAllocated != 16 {
+		return fmt.Errorf("stats: unsupported bits allocated %d", f.BitsAllocated)
+	}
+	if f.BitsStored < 0 || f.BitsStored > f.BitsAllocated {
+		return fmt.Errorf("stats: invalid bits stored %d", f.BitsStored)
+	}
+	if need := f.Width * f.Height * f.Components * f.BitsAllocated / 8; len(f.Data) < need {
+		return fmt.Errorf("stats: frame data too short: %d bytes, need %d", len(f.Data), need)
+	}
+	return nil
+}
+
+// layout returns where the samples of component c start and the distance
+// between consecutive ones, in samples.
+func (f Frame) layout(c int) (start, stride int) {
+	if f.Planar {
+		return c * f.Width * f.Height, 1
+	}
+	return c, f.Components
+}
+
+// Compute scans f once and returns its statistics.
+func Compute(f Frame) (*Stats, error) {
+	if err := f.validate(); err != nil {
+		return nil, err
+	}
+	stored := f.BitsStored
+	if stored == 0 {
+		stored = f.BitsAllocated
+	}
+	n := f.Width * f.Height
+	s := &Stats{Components: make([]Component, f.Components), Samples: n * f.Components}
+	for c := range s.Components {
+		start, stride := f.layout(c)
+		if f.BitsAllocated == 8 {
+			scan8(&s.Components[c], f.Data[start:], n, stride, stored, f.Signed)
+		} else {
+			scan16(&s.Components[c], f.Data[2*start:], n, stride, stored, f.Signed)
+		}
+	}
+
+	s.Min, s.Max = s.Components[0].Min, s.Components[0].Max
+	for _, c := range s.Components[1:] {
+		s.Min, s.Max = min(s.Min, c.Min), max(s.Max, c.Max)
+	}
+	if f.Signed {
+		// n bits hold [-2^(n-1), 2^(n-1)-1].
+		s.Bits = max(bits.Len32(uint32(max(s.Max, 0))), bits.Len32(uint32(^min(s.Min, -1)))) + 1
+	} else {
+		s.Bits = max(bits.Len32(uint32(s.Max)), 1)
+	}
+	return s, nil
+}
+
+// The scan loops are written out per sample size so that the compiler keeps
+// the running state in registers.
+
+// valueMask returns the mask that keeps the stored bits and, for signed
+// frames, their sign bit: (raw&mask ^ flip) - flip sign-extends a sample
+// without a data-dependent branch.
+func valueMask(stored int, signed bool) (mask, flip uint32) {
+	mask = 1<<uint(stored) - 1
+	if signed {
+		flip = 1 << uint(stored-1)
+	}
+	return mask, flip
+}
+
+func scan8(c *Component, data []byte, n, stride, stored int, signed bool) {
+	mask, flip := valueMask(stored, signed)
+	first := data[0]
+	var varying byte
+	lo, hi := int32(1<<31-1), int32(-1<<31)
+	zeros, runSamples, run := 0, 0, 0
+	for i, p := 0, 0; i < n; i, p = i+1, p+stride {
+		raw := data[p]
+		varying |= raw ^ first
+		v := int32(uint32(raw)&mask^flip) - int32(flip)
+		lo, hi = min(lo, v), max(hi, v)
+		if v == 0 {
+			zeros++
+			run++
+			continue
+		}
+		if run >= MinZeroRun {
+			runSamples += run
+		}
+		run = 0
+	}
+	if run >= MinZeroRun {
+		runSamples += run
+	}
+	*c = Component{Min: lo, Max: hi, First: uint16(first), Varying: uint16(varying), Zeros: zeros, ZeroRunSamples: runSamples}
+}
+
+func scan16(c *Component, data []byte, n, stride, stored int, signed bool) {
+	mask, flip := valueMask(stored, signed)
+	first := binary.LittleEndian.Uint16(data)
+	var varying uint16
+	lo, hi := int32(1<<31-1), int32(-1<<31)
+	zeros, runSamples, run := 0, 0, 0
+	for i, p := 0, 0; i < n; i, p = i+1, p+2*stride {
+		raw := binary.LittleEndian.Uint16(data[p:])
+		varying |= raw ^ first
+		v := int32(uint32(raw)&mask^flip) - int32(flip)
+		lo, hi = min(lo, v), max(hi, v)
+		if v == 0 {
+			zeros++
+			run++
+			continue
+		}
+		if run >= MinZeroRun {
+			runSamples += run
+		}
+		run = 0
+	}
+	if run >= MinZeroRun {
+		runSamples += run
+	}
+	*c = Component{Min: lo, Max: hi, First: first, Varying: varying, Zeros: zeros, ZeroRunSamples: runSamples}
+}
+
+// Cache holds the statistics of the frames of one encode request, keyed by
+// the frame data. Frame data must not be modified while its statistics are
+// cached. A Cache is safe for concurrent use.
+type Cache struct {
+	mu      sync.Mutex
+	entries map[cacheKey]*Stats
+}
+
+type cacheKey struct {
+	data                      *byte
+	length                    int
+	width, height, components int
+	bitsAllocated, bitsStored int
+	signed, planar            bool
+}
+
+// NewCache returns an empty Cache.
+func NewCache() *Cache {
+	return &Cache{entries: make(map[cacheKey]*Stats)}
+}
+
+// Get returns the statistics of f, computing them on first use.
+func (c *Cache) Get(f Frame) (*Stats, error) {
+	if len(f.Data) == 0 {
+		return Compute(f)
+	}
+	key := cacheKey{
+		data: &f.Data[0], length: len(f.Data),
+		width: f.Width, height: f.Height, components: f.Components,
+		bitsAllocated: f.BitsAllocated, bitsStored: f.BitsStored,
+		signed: f.Signed, planar: f.Planar,
+	}
+
+	c.mu.Lock()
+	s, ok := c.entries[key]
+	c.mu.Unlock()
+	if ok {
+		return s, nil
+	}
+	s, err := Compute(f)
+	if err != nil {
+		return nil, err
+	}
+	c.mu.Lock()
+	if c.entries == nil {
+		c.entries = make(map[cacheKey]*Stats)
+	}
+	c.entries[key] = s
+	c.mu.Unlock()
+	return s, nil
+}
+
+// ParameterGetter is the part of codec.Parameters read by FromParameters.
+type ParameterGetter interface {
+	GetParameter(name string) interface{}
+}
+
+// CacheFromParameters returns the Cache carried by the ParameterName codec
+// parameter, or nil.
+func CacheFromParameters(parameters ParameterGetter) *Cache {
+	if parameters == nil {
+		return nil
+	}
+	cache, _ := parameters.GetParameter(ParameterName).(*Cache)
+	return cache
+}
+
+// FromParameters returns the statistics of f from the Cache carried by
+// parameters, or nil when no Cache is set or f cannot be described.
+func FromParameters(parameters ParameterGetter, f Frame) *Stats {
+	cache := CacheFromParameters(parameters)
+	if cache == nil {
+		return nil
+	}
+	s, err := cache.Get(f)
+	if err != nil {
+		return nil
+	}
+	return s
+}
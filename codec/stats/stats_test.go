@@ -0,0 +1,176 @@
+package stats
+
+import (
+	"math"
+	"sync"
+	"testing"
+)
+
+type parameters map[string]interface{}
+
+func (p parameters) GetParameter(name string) interface{} { return p[name] }
+
+func frame16(values []int16, width, components, stored int, signed, planar bool) Frame {
+	data := make([]byte, 2*len(values))
+	for i, v := range values {
+		data[2*i], data[2*i+1] = byte(v), byte(uint16(v)>>8)
+	}
+	return Frame{
+		Data: data, Width: width, Height: len(values) / width / components,
+		Components: components, BitsAllocated: 16, BitsStored: stored,
+		Signed: signed, Planar: planar,
+	}
+}
+
+func TestComputeRangeAndBits(t *testing.T) {
+	tests := []struct {
+		name     string
+		values   []int16
+		stored   int
+		signed   bool
+		min, max int32
+		bits     int
+	}{
+		{"unsigned 12-bit", []int16{0, 5, 4095, 17}, 12, false, 0, 4095, 12},
+		{"unsigned small", []int16{3, 200, 7, 9}, 12, false, 3, 200, 8},
+		{"high bits masked", []int16{0x7005, 0x0003, 0x1002, 0x0001}, 12, false, 1, 5, 3},
+		{"signed", []int16{-1024, 3071, 0, -1}, 16, true, -1024, 3071, 13},
+		{"signed 12-bit", []int16{0x0FFF, 0x0800, 0x07FF, 0}, 12, true, -2048, 2047, 12},
+		{"signed zeros", []int16{0, 0, 0, 0}, 16, true, 0, 0, 1},
+		{"signed negative", []int16{-1, -1, -2, -1}, 16, true, -2, -1, 2},
+	}
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			s, err := Compute(frame16(tt.values, 2, 1, tt.stored, tt.signed, false))
+			if err != nil {
+				t.Fatal(err)
+			}
+			if s.Min != tt.min || s.Max != tt.max || s.Bits != tt.bits {
+				t.Errorf("min=%d max=%d bits=%d, want %d %d %d", s.Min, s.Max, s.Bits, tt.min, tt.max, tt.bits)
+			}
+		})
+	}
+}
+
+func TestComputeComponentsAndZeroRuns(t *testing.T) {
+	// Interleaved RGB, 16x1: R constant, G has a 10-sample zero run, B varies
+	// only in the low byte.
+	values := make([]int16, 48)
+	for i := 0; i < 16; i++ {
+		values[3*i] = 0x0140
+		if i < 3 || i > 12 {
+			values[3*i+1] = int16(i + 1)
+		}
+		values[3*i+2] = int16(0x0300 + i)
+	}
+	for _, planar := range []bool{false, true} {
+		f := frame16(values, 16, 3, 16, false, false)
+		if planar {
+			planes := make([]int16, 48)
+			for i := 0; i < 16; i++ {
+				for c := 0; c < 3; c++ {
+					planes[c*16+i] = values[3*i+c]
+				}
+			}
+			f = frame16(planes, 16, 3, 16, false, true)
+		}
+		s, err := Compute(f)
+		if err != nil {
+			t.Fatal(err)
+		}
+		r, g, b := s.Components[0], s.Components[1], s.Components[2]
+		if !r.Constant() || r.First != 0x0140 || g.Constant() || s.Constant() {
+			t.Errorf("planar=%v: constant flags r=%+v g=%+v", planar, r, g)
+		}
+		if b.Varying != 0x000F || b.First != 0x0300 {
+			t.Errorf("planar=%v: b varying=%#x first=%#x", planar, b.Varying, b.First)
+		}
+		if g.Zeros != 10 || g.ZeroRunSamples != 10 || r.Zeros != 0 {
+			t.Errorf("planar=%v: g zeros=%d runs=%d", planar, g.Zeros, g.ZeroRunSamples)
+		}
+		if got, want := s.ZeroRunCoverage(), 10.0/48; math.Abs(got-want) > 1e-12 {
+			t.Errorf("planar=%v: ZeroRunCoverage = %v, want %v", planar, got, want)
+		}
+	}
+}
+
+func TestCompute8Bit(t *testing.T) {
+	data := make([]byte, 64)
+	for i := 32; i < 64; i++ {
+		data[i] = byte(i)
+	}
+	s, err := Compute(Frame{Data: data, Width: 8, Height: 8, Components: 1, BitsAllocated: 8})
+	if err != nil {
+		t.Fatal(err)
+	}
+	c := s.Components[0]
+	if c.Min != 0 || c.Max != 63 || s.Bits != 6 || c.Zeros != 32 || c.ZeroRunSamples != 32 || c.Varying != 0x3F {
+		t.Errorf("stats = %+v bits=%d", c, s.Bits)
+	}
+}
+
+func TestComputeInvalid(t *testing.T) {
+	for _, f := range []Frame{
+		{Data: make([]byte, 8), Width: 0, Height: 2, Components: 1, BitsAllocated: 8},
+		{Data: make([]byte, 8), Width: 2, Height: 2, Components: 1, BitsAllocated: 32},
+		{Data: make([]byte, 7), Width: 2, Height: 2, Components: 1, BitsAllocated: 16},
+		{Data: make([]byte, 8), Width: 2, Height: 2, Components: 1, BitsAllocated: 8, BitsStored: 9},
+	} {
+		if _, err := Compute(f); err == nil {
+			t.Errorf("Compute(%dx%d, %d bits) succeeded", f.Width, f.Height, f.BitsAllocated)
+		}
+	}
+}
+
+func TestCache(t *testing.T) {
+	f := frame16([]int16{1, 2, 3, 4}, 2, 1, 16, false, false)
+	cache := NewCache()
+	p := parameters{ParameterName: cache}
+
+	var wg sync.WaitGroup
+	got := make([]*Stats, 4)
+	for i := range got {
+		wg.Add(1)
+		go func(i int) {
+			defer wg.Done()
+			got[i] = FromParameters(p, f)
+		}(i)
+	}
+	wg.Wait()
+	first := FromParameters(p, f)
+	if first == nil || first.Max != 4 {
+		t.Fatalf("FromParameters = %+v", first)
+	}
+	for _, s := range got {
+		if s == nil || s.Max != 4 {
+			t.Fatalf("concurrent FromParameters = %+v", s)
+		}
+	}
+	if again, _ := cache.Get(f); again != first {
+		t.Error("second lookup recomputed the statistics")
+	}
+	other := f
+	other.Width, other.Height = 4, 1
+	if s, _ := cache.Get(other); s == first {
+		t.Error("a different layout of the same buffer shared its statistics")
+	}
+
+	if FromParameters(parameters{}, f) != nil || FromParameters(nil, f) != nil {
+		t.Error("FromParameters without a cache returned statistics")
+	}
+}
+
+func BenchmarkCompute(b *testing.B) {
+	values := make([]int16, 512*512)
+	for i := range values {
+		values[i] = int16(i*37%4096 - 1024)
+	}
+	f := frame16(values, 512, 1, 12, true, false)
+	b.SetBytes(int64(len(f.Data)))
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		if _, err := Compute(f); err != nil {
+			b.Fatal(err)
+		}
+	}
+}
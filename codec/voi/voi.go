@@ -0,0 +1,206 @@
+// Package voi renders stored pixel values to 8-bit display values.
+//
+// A Renderer applies the Modality LUT (rescale slope/intercept) followed by a
+// VOI window (LINEAR, LINEAR_EXACT or SIGMOID, DICOM PS3.3 C.11.2.1.2) or a
+// VOI LUT, and is evaluated once per possible stored value so that decoders
+// can map samples with a single table lookup inside their final pack loop.
+package voi
+
+import (
+	"fmt"
+	"math"
+	"math/bits"
+)
+
+// ParameterName is the codec parameter that carries *Options (or Options).
+// When it is set, decoders write one 8-bit display sample per stored sample
+// instead of the stored pixel representation.
+const ParameterName = "voiRender"
+
+// Function selects the VOI LUT Function used with a window.
+type Function int
+
+const (
+	// FunctionLinear is the default LINEAR window.
+	FunctionLinear Function = iota
+	// FunctionLinearExact is the LINEAR_EXACT window.
+	FunctionLinearExact
+	// FunctionSigmoid is the SIGMOID window.
+	FunctionSigmoid
+)
+
+// Options describes the rendering pipeline.
+type Options struct {
+	RescaleSlope     float64 // Modality LUT slope; 0 is treated as 1
+	RescaleIntercept float64 // Modality LUT intercept
+
+	WindowCenter float64  // VOI window center
+	WindowWidth  float64  // VOI window width; <= 0 maps the full rescaled range
+	Function     Function // VOI LUT Function applied to the window
+
+	LUT           []uint16 // VOI LUT Data; takes precedence over the window
+	LUTFirstValue int      // first input value mapped by LUT
+	LUTBits       int      // bits per LUT entry; 0 derives it from the largest entry
+
+	Invert bool // invert the output (MONOCHROME1)
+}
+
+// Renderer maps stored values to display values through a precomputed table.
+type Renderer struct {
+	table      []uint8
+	minValue   int32
+	bitsStored int
+	signed     bool
+}
+
+// NewRenderer evaluates opts for every value representable with bitsStored
+// bits (1-16), signed or unsigned.
+func NewRenderer(opts Options, bitsStored int, signed bool) (*Renderer, error) {
+	if bitsStored < 1 || bitsStored > 16 {
+		return nil, fmt.Errorf("voi: unsupported bits stored %d (must be 1-16)", bitsStored)
+	}
+	if len(opts.LUT) == 0 && opts.WindowWidth > 0 && opts.Function == FunctionLinear && opts.WindowWidth < 1 {
+		return nil, fmt.Errorf("voi: LINEAR window width must be >= 1, got %g", opts.WindowWidth)
+	}
+	slope := opts.RescaleSlope
+	if slope == 0 {
+		slope = 1
+	}
+
+	size := 1 << bitsStored
+	r := &Renderer{
+		table:      make([]uint8, size),
+		bitsStored: bitsStored,
+		signed:     signed,
+	}
+	if signed {
+		r.minValue = -int32(size / 2)
+	}
+
+	// Full-range mapping when neither a LUT nor a window is supplied.
+	lo := float64(r.minValue)*slope + opts.RescaleIntercept
+	hi := float64(r.minValue+int32(size)-1)*slope + opts.RescaleIntercept
+	if lo > hi {
+		lo, hi = hi, lo
+	}
+
+	lutScale := 0.0
+	if len(opts.LUT) > 0 {
+		lutBits := opts.LUTBits
+		if lutBits <= 0 {
+			var maxEntry uint16
+			for _, v := range opts.LUT {
+				maxEntry = max(maxEntry, v)
+			}
+			lutBits = max(1, bits.Len16(maxEntry))
+		}
+		lutScale = 255 / float64(uint32(1)<<min(lutBits, 16)-1)
+	}
+
+	for i := range r.table {
+		x := float64(r.minValue+int32(i))*slope + opts.RescaleIntercept
+		var y float64
+		switch {
+		case len(opts.LUT) > 0:
+			idx := int(math.Round(x)) - opts.LUTFirstValue
+			idx = max(0, min(idx, len(opts.LUT)-1))
+			y = float64(opts.LUT[idx]) * lutScale
+		case opts.WindowWidth > 0:
+			y = window(x, opts.WindowCenter, opts.WindowWidth, opts.Function)
+		case hi > lo:
+			y = (x - lo) / (hi - lo) * 255
+		}
+		y = math.Round(max(0, min(255, y)))
+		if opts.Invert {
+			y = 255 - y
+		}
+		r.table[i] = uint8(y)
+	}
+	return r, nil
+}
+
+// window evaluates a VOI window function with an output range of 0-255.
+func window(x, c, w float64, fn Function) float64 {
+	switch fn {
+	case FunctionSigmoid:
+		return 255 / (1 + math.Exp(-4*(x-c)/w))
+	case FunctionLinearExact:
+		if x <= c-w/2 {
+			return 0
+		}
+		if x > c+w/2 {
+			return 255
+		}
+		return (x-c)/w*255 + 127.5
+	default:
+		if x <= c-0.5-(w-1)/2 {
+			return 0
+		}
+		if x > c-0.5+(w-1)/2 {
+			return 255
+		}
+		return ((x-(c-0.5))/(w-1) + 0.5) * 255
+	}
+}
+
+// Matches reports whether the renderer was built for the given sample format.
+func (r *Renderer) Matches(bitsStored int, signed bool) bool {
+	return r != nil && r.bitsStored == bitsStored && r.signed == signed
+}
+
+// Map returns the display value for a sample given as a signed integer
+// (e.g. after the JPEG 2000 inverse DC level shift). Out-of-range values clamp.
+func (r *Renderer) Map(v int32) uint8 {
+	i := v - r.minValue
+	if i < 0 {
+		i = 0
+	} else if int(i) >= len(r.table) {
+		i = int32(len(r.table) - 1)
+	}
+	return r.table[i]
+}
+
+// MapStored returns the display value for a raw stored bit pattern, as
+// produced by decoders that output the pixel representation directly
+// (two's complement within bitsStored bits for signed data).
+func (r *Renderer) MapStored(v int) uint8 {
+	v &= len(r.table) - 1
+	if r.signed && v >= len(r.table)/2 {
+		v -= len(r.table)
+	}
+	return r.table[int32(v)-r.minValue]
+}
+
+// ParameterGetter is the subset of codec.Parameters used to look up options.
+type ParameterGetter interface {
+	GetParameter(name string) interface{}
+}
+
+// OptionsFromParameters returns the render options carried by parameters
+// under ParameterName, or nil when rendering is not requested.
+func OptionsFromParameters(parameters ParameterGetter) *Options {
+	if parameters == nil {
+		return nil
+	}
+	switch v := parameters.GetParameter(ParameterName).(type) {
+	case *Options:
+		return v
+	case Options:
+		return &v
+	}
+	return nil
+}
+
+// RendererFromParameters builds a renderer from the options carried by
+// parameters, or returns nil when rendering is not requested.
+func RendererFromParameters(parameters ParameterGetter, bitsStored int, signed bool) (*Renderer, error) {
+	opts := OptionsFromParameters(parameters)
+	if opts == nil {
+		return nil, nil
+	}
+	r, err := NewRenderer(*opts, bitsStored, signed)
+	if err != nil {
+		return nil, fmt.Errorf("invalid render options: %w", err)
+	}
+	return r, nil
+}
@@ -0,0 +1,98 @@
+package voi
+
+import "testing"
+
+type testParams map[string]interface{}
+
+func (p testParams) GetParameter(name string) interface{} { return p[name] }
+
+func TestLinearWindow(t *testing.T) {
+	// Stored 12-bit CT values with slope 1, intercept -1024; window 40/400.
+	r, err := NewRenderer(Options{
+		RescaleSlope:     1,
+		RescaleIntercept: -1024,
+		WindowCenter:     40,
+		WindowWidth:      400,
+	}, 12, false)
+	if err != nil {
+		t.Fatalf("NewRenderer failed: %v", err)
+	}
+	tests := []struct {
+		stored int32
+		want   uint8
+	}{
+		{0, 0},            // -1024 HU, below the window
+		{1024, 102},       // 0 HU: ((0-39.5)/399+0.5)*255
+		{1064, 128},       // window center
+		{1024 + 240, 255}, // above c-0.5+(w-1)/2
+		{4095, 255},
+	}
+	for _, tt := range tests {
+		if got := r.Map(tt.stored); got != tt.want {
+			t.Errorf("Map(%d) = %d, want %d", tt.stored, got, tt.want)
+		}
+	}
+	// Clamping outside the stored domain.
+	if r.Map(-5) != r.Map(0) || r.Map(9000) != r.Map(4095) {
+		t.Errorf("out-of-range values must clamp to the stored domain")
+	}
+}
+
+func TestSignedStoredPatterns(t *testing.T) {
+	r, err := NewRenderer(Options{}, 16, true)
+	if err != nil {
+		t.Fatalf("NewRenderer failed: %v", err)
+	}
+	if got := r.MapStored(0x8000); got != 0 {
+		t.Errorf("MapStored(-32768) = %d, want 0", got)
+	}
+	if got := r.MapStored(0x7FFF); got != 255 {
+		t.Errorf("MapStored(32767) = %d, want 255", got)
+	}
+	if r.MapStored(0xFFFF) != r.Map(-1) {
+		t.Errorf("MapStored(0xFFFF) must equal Map(-1)")
+	}
+	if !r.Matches(16, true) || r.Matches(16, false) || r.Matches(12, true) {
+		t.Errorf("Matches reported the wrong format")
+	}
+}
+
+func TestSigmoidLUTAndInvert(t *testing.T) {
+	sig, err := NewRenderer(Options{WindowCenter: 128, WindowWidth: 64, Function: FunctionSigmoid}, 8, false)
+	if err != nil {
+		t.Fatalf("NewRenderer failed: %v", err)
+	}
+	if got := sig.Map(128); got != 128 {
+		t.Errorf("sigmoid center = %d, want 128", got)
+	}
+	if sig.Map(0) >= sig.Map(100) || sig.Map(100) >= sig.Map(160) {
+		t.Errorf("sigmoid must be increasing")
+	}
+
+	lut := []uint16{0, 1000, 2000, 4095}
+	r, err := NewRenderer(Options{LUT: lut, LUTFirstValue: 10, LUTBits: 12, Invert: true}, 8, false)
+	if err != nil {
+		t.Fatalf("NewRenderer failed: %v", err)
+	}
+	for stored, want := range map[int32]uint8{0: 255, 10: 255, 11: 255 - 62, 13: 0, 200: 0} {
+		if got := r.Map(stored); got != want {
+			t.Errorf("LUT Map(%d) = %d, want %d", stored, got, want)
+		}
+	}
+}
+
+func TestRendererFromParameters(t *testing.T) {
+	if r, err := RendererFromParameters(testParams{}, 12, false); r != nil || err != nil {
+		t.Fatalf("no options: got %v, %v", r, err)
+	}
+	if r, err := RendererFromParameters(nil, 12, false); r != nil || err != nil {
+		t.Fatalf("nil parameters: got %v, %v", r, err)
+	}
+	r, err := RendererFromParameters(testParams{ParameterName: Options{WindowCenter: 100, WindowWidth: 50}}, 12, false)
+	if err != nil || r == nil {
+		t.Fatalf("value options: got %v, %v", r, err)
+	}
+	if _, err := RendererFromParameters(testParams{ParameterName: &Options{}}, 20, false); err == nil {
+		t.Fatalf("20-bit stored values should be rejected")
+	}
+}
@@ -0,0 +1,15 @@
+package replay
+
+// Hooks through which cmd/replay-record observes the real entropy decoders.
+// They are nil except while the recorder runs, which decodes on a single
+// goroutine.
+var (
+	// MQDecision, when set, is called by every MQ decoder created afterwards
+	// with the context and value of each decision it decodes.
+	MQDecision func(context, decision int)
+
+	// GolombValue, when set, is called by the JPEG-LS lossless decoder with
+	// the Golomb parameter k and the mapped error value of every
+	// regular-mode sample.
+	GolombValue func(k, value int)
+)
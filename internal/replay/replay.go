@@ -0,0 +1,115 @@
+// Package replay stores recorded inputs of the entropy-coding kernels (MQ
+// decisions, Tier-1 and HT code-blocks, Huffman scans, Golomb bitstreams) so
+// benchmarks can replay one kernel in isolation on data taken from real
+// images. Corpora are written by cmd/replay-record into the testdata/replay
+// directory of the package that owns the kernel.
+//
+// A corpus file is a gzip stream holding a magic, a record count and, per
+// record, a list of integer parameters followed by a byte payload, all
+// length-prefixed with uvarints. What the parameters mean is defined by the
+// recorder and the benchmark of each kernel.
+package replay
+
+import (
+	"bufio"
+	"compress/gzip"
+	"encoding/binary"
+	"errors"
+	"fmt"
+	"hash/fnv"
+	"io"
+	"os"
+	"path/filepath"
+)
+
+const magic = "GDCREPLAY1"
+
+// Record is one recorded kernel input.
+type Record struct {
+	Params []int64
+	Data   []byte
+}
+
+// Write stores records at path, creating its directory.
+func Write(path string, records []Record) error {
+	if err := os.MkdirAll(filepath.Dir(path), 0o755); err != nil {
+		return err
+	}
+	f, err := os.Create(path)
+	if err != nil {
+		return err
+	}
+	zw := gzip.NewWriter(f)
+	w := bufio.NewWriter(zw)
+	var buf [binary.MaxVarintLen64]byte
+	putUvarint := func(v uint64) {
+		w.Write(buf[:binary.PutUvarint(buf[:], v)])
+	}
+	w.WriteString(magic)
+	putUvarint(uint64(len(records)))
+	for _, r := range records {
+		putUvarint(uint64(len(r.Params)))
+		for _, p := range r.Params {
+			w.Write(buf[:binary.PutVarint(buf[:], p)])
+		}
+		putUvarint(uint64(len(r.Data)))
+		w.Write(r.Data)
+	}
+	err = errors.Join(w.Flush(), zw.Close())
+	return errors.Join(err, f.Close())
+}
+
+// Read loads the records stored at path.
+func Read(path string) ([]Record, error) {
+	f, err := os.Open(path)
+	if err != nil {
+		return nil, err
+	}
+	defer f.Close()
+	zr, err := gzip.NewReader(f)
+	if err != nil {
+		return nil, fmt.Errorf("replay corpus %s: %w", path, err)
+	}
+	r := bufio.NewReader(zr)
+	header := make([]byte, len(magic))
+	if _, err := io.ReadFull(r, header); err != nil || string(header) != magic {
+		return nil, fmt.Errorf("replay corpus %s: bad header", path)
+	}
+	count, err := binary.ReadUvarint(r)
+	if err != nil {
+		return nil, fmt.Errorf("replay corpus %s: %w", path, err)
+	}
+	records := make([]Record, count)
+	for i := range records {
+		n, err := binary.ReadUvarint(r)
+		if err != nil {
+			return nil, fmt.Errorf("replay corpus %s: record %d: %w", path, i, err)
+		}
+		records[i].Params = make([]int64, n)
+		for j := range records[i].Params {
+			if records[i].Params[j], err = binary.ReadVarint(r); err != nil {
+				return nil, fmt.Errorf("replay corpus %s: record %d: %w", path, i, err)
+			}
+		}
+		if n, err = binary.ReadUvarint(r); err != nil {
+			return nil, fmt.Errorf("replay corpus %s: record %d: %w", path, i, err)
+		}
+		records[i].Data = make([]byte, n)
+		if _, err := io.ReadFull(r, records[i].Data); err != nil {
+			return nil, fmt.Errorf("replay corpus %s: record %d: %w", path, i, err)
+		}
+	}
+	return records, nil
+}
+
+// Checksum returns a 63-bit FNV-1a hash of values, used by recorders to store
+// the expected kernel output alongside each input.
+func Checksum(values []int32) int64 {
+	h := fnv.New64a()
+	var buf [4]byte
+	for _, v := range values {
+		binary.LittleEndian.PutUint32(buf[:], uint32(v))
+		h.Write(buf[:])
+	}
+	return int64(h.Sum64() >> 1)
+}
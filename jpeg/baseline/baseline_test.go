@@ -3,8 +3,11 @@ package baseline
 
 import (
 	"bytes"
+	"errors"
 	"testing"
 
+	"github.com/cocosip/go-dicom-codecs/codec/limits"
+	"github.com/cocosip/go-dicom-codecs/codec/stats"
 	"github.com/cocosip/go-dicom-codecs/jpeg/standard"
 )
 
@@ -267,6 +270,158 @@ func TestEncodeDecodeRGB(t *testing.T) {
 	}
 }
 
+// TestPlanarAndYCbCrLayouts checks that planar and YCbCr inputs encode to the
+// same codestream as interleaved RGB, and that the native output options only
+// change the layout and colour conversion of the decoded samples.
+func TestPlanarAndYCbCrLayouts(t *testing.T) {
+	width, height := 37, 21
+	numPixels := width * height
+	rgb := make([]byte, numPixels*3)
+	for i := 0; i < numPixels; i++ {
+		x, y := i%width, i/width
+		rgb[i*3+0] = byte(x * 6)
+		rgb[i*3+1] = byte(y * 11)
+		rgb[i*3+2] = byte((x*y + 40) % 256)
+	}
+	planar := make([]byte, len(rgb))
+	for i := 0; i < numPixels; i++ {
+		for c := 0; c < 3; c++ {
+			planar[c*numPixels+i] = rgb[i*3+c]
+		}
+	}
+
+	want, err := Encode(rgb, width, height, 3, 90)
+	if err != nil {
+		t.Fatalf("Encode failed: %v", err)
+	}
+	got, err := EncodeWithOptions(planar, width, height, 3, 90, EncodeOptions{PlanarInput: true})
+	if err != nil {
+		t.Fatalf("planar Encode failed: %v", err)
+	}
+	if !bytes.Equal(got, want) {
+		t.Fatalf("planar input produced a different codestream")
+	}
+
+	// Pre-converted YCbCr planes must skip the colour transform entirely.
+	ref := &Encoder{width: width, height: height}
+	ycc := ref.rgbToYCbCr(rgb)
+	stride := standard.DivCeil(width, 8) * 8
+	yccPlanar := make([]byte, len(rgb))
+	for i := 0; i < numPixels; i++ {
+		idx := (i/width)*stride + i%width
+		yccPlanar[i] = ycc.Y[idx]
+		yccPlanar[numPixels+i] = ycc.Cb[idx]
+		yccPlanar[2*numPixels+i] = ycc.Cr[idx]
+	}
+	got, err = EncodeWithOptions(yccPlanar, width, height, 3, 90, EncodeOptions{PlanarInput: true, YCbCrInput: true})
+	if err != nil {
+		t.Fatalf("YCbCr Encode failed: %v", err)
+	}
+	if !bytes.Equal(got, want) {
+		t.Fatalf("YCbCr input produced a different codestream")
+	}
+
+	interleaved, _, _, _, err := Decode(want)
+	if err != nil {
+		t.Fatalf("Decode failed: %v", err)
+	}
+	native, _, _, _, err := DecodeWithOptions(want, DecodeOptions{PlanarOutput: true, YCbCrOutput: true})
+	if err != nil {
+		t.Fatalf("native Decode failed: %v", err)
+	}
+	for i := 0; i < numPixels; i++ {
+		r, g, b := ycbcrToRGB(native[i], native[numPixels+i], native[2*numPixels+i])
+		if r != interleaved[i*3] || g != interleaved[i*3+1] || b != interleaved[i*3+2] {
+			t.Fatalf("pixel %d: native YCbCr converts to (%d,%d,%d), want (%d,%d,%d)",
+				i, r, g, b, interleaved[i*3], interleaved[i*3+1], interleaved[i*3+2])
+		}
+	}
+}
+
+// TestChromaSubsampling encodes 4:2:2 and 4:2:0 images whose size is not a
+// multiple of the MCU and checks the SOF factors, the size reduction and
+// the fused upsample + colour conversion on decode.
+func TestDecodeLimitsRejectSOF(t *testing.T) {
+	encoded, err := Encode(make([]byte, 40*30), 40, 30, 1, 90)
+	if err != nil {
+		t.Fatalf("Encode failed: %v", err)
+	}
+	_, _, _, _, err = DecodeWithOptions(encoded, DecodeOptions{Limits: limits.DecodeLimits{MaxPixels: 40*30 - 1}})
+	if !errors.Is(err, limits.ErrExceeded) {
+		t.Fatalf("Decode error = %v, want %v", err, limits.ErrExceeded)
+	}
+	if _, _, _, _, err = DecodeWithOptions(encoded, DecodeOptions{Limits: limits.DecodeLimits{MaxPixels: 40 * 30}}); err != nil {
+		t.Fatalf("Decode at the pixel limit failed: %v", err)
+	}
+}
+
+func TestChromaSubsampling(t *testing.T) {
+	width, height := 45, 27
+	rgb := make([]byte, width*height*3)
+	for y := 0; y < height; y++ {
+		for x := 0; x < width; x++ {
+			offset := (y*width + x) * 3
+			rgb[offset+0] = byte(60 + x*3)
+			rgb[offset+1] = byte(40 + y*5)
+			rgb[offset+2] = byte(200 - x - y)
+		}
+	}
+
+	full, err := Encode(rgb, width, height, 3, 90)
+	if err != nil {
+		t.Fatalf("Encode failed: %v", err)
+	}
+
+	tests := []struct {
+		name        string
+		subsampling Subsampling
+		factor      byte
+	}{
+		{"4:2:2", Subsampling422, 0x21},
+		{"4:2:0", Subsampling420, 0x22},
+	}
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			jpegData, err := EncodeWithOptions(rgb, width, height, 3, 90, EncodeOptions{Subsampling: tt.subsampling})
+			if err != nil {
+				t.Fatalf("Encode failed: %v", err)
+			}
+			sofOffset := bytes.Index(jpegData, []byte{0xff, 0xc0})
+			if sofOffset < 0 || jpegData[sofOffset+11] != tt.factor {
+				t.Fatalf("luma sampling factor missing or not 0x%02x", tt.factor)
+			}
+			for component := 1; component < 3; component++ {
+				if f := jpegData[sofOffset+11+component*3]; f != 0x11 {
+					t.Errorf("chroma component %d sampling factor = 0x%02x, want 0x11", component+1, f)
+				}
+			}
+			if len(jpegData) >= len(full) {
+				t.Errorf("subsampled size %d not below 4:4:4 size %d", len(jpegData), len(full))
+			}
+
+			decoded, w, h, components, err := Decode(jpegData)
+			if err != nil {
+				t.Fatalf("Decode failed: %v", err)
+			}
+			if w != width || h != height || components != 3 {
+				t.Fatalf("decoded %dx%dx%d, want %dx%dx3", w, h, components, width, height)
+			}
+			maxError := 0
+			for i := range rgb {
+				diff := int(rgb[i]) - int(decoded[i])
+				maxError = max(maxError, diff, -diff)
+			}
+			if maxError > 24 {
+				t.Errorf("maximum pixel error %d too large", maxError)
+			}
+		})
+	}
+
+	if _, err := EncodeWithOptions(rgb, width, height, 3, 90, EncodeOptions{Subsampling: 7}); err == nil {
+		t.Errorf("invalid subsampling accepted")
+	}
+}
+
 func TestEncodeInvalidParameters(t *testing.T) {
 	pixelData := make([]byte, 64*64)
 
@@ -401,3 +556,83 @@ func BenchmarkDecodeRGB(b *testing.B) {
 		}
 	}
 }
+
+func TestIDCTISlowDCMatchesIDCTISlow(t *testing.T) {
+	var qtable [64]int32
+	for i := range qtable {
+		qtable[i] = 1
+	}
+	var coef [64]int32
+	var want, got [64]byte
+	for dc := int32(-1<<15 + 1); dc < 1<<15; dc++ {
+		coef[0] = dc
+		standard.IDCTISlow(coef[:], qtable, want[:], 8)
+		standard.IDCTISlowDC(dc, got[:], 8)
+		if got != want {
+			t.Fatalf("dc %d: IDCTISlowDC = %v, IDCTISlow = %v", dc, got[:8], want[:8])
+		}
+	}
+}
+
+func TestTransformBlockFlatMatchesDCT(t *testing.T) {
+	for v := 0; v < 256; v++ {
+		block := bytes.Repeat([]byte{byte(v)}, 8*8)
+		var want [64]int32
+		standard.DCTISlow(block, 8, want[:])
+		if got := transformBlock(block, 0, 0, 8); got != want {
+			t.Fatalf("flat block %d: transformBlock = %v, DCTISlow = %v", v, got, want)
+		}
+	}
+}
+
+// TestEncodeWithStatsMatches checks that frame statistics only skip work:
+// the encoded stream is the same with and without them.
+func TestEncodeWithStatsMatches(t *testing.T) {
+	tests := []struct {
+		name        string
+		components  int
+		subsampling Subsampling
+		fill        func(i int) byte
+	}{
+		{"gray constant", 1, Subsampling444, func(int) byte { return 200 }},
+		{"gray varying", 1, Subsampling444, func(i int) byte { return byte(i) }},
+		{"rgb constant", 3, Subsampling444, func(i int) byte { return byte(30 + 70*(i%3)) }},
+		{"rgb constant 4:2:2", 3, Subsampling422, func(i int) byte { return byte(30 + 70*(i%3)) }},
+	}
+	width, height := 37, 21
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			pixels := make([]byte, width*height*tt.components)
+			for i := range pixels {
+				pixels[i] = tt.fill(i)
+			}
+			opts := EncodeOptions{Subsampling: tt.subsampling}
+			want, err := EncodeWithOptions(pixels, width, height, tt.components, 85, opts)
+			if err != nil {
+				t.Fatalf("encode: %v", err)
+			}
+			opts.Stats, err = stats.Compute(stats.Frame{
+				Data: pixels, Width: width, Height: height,
+				Components: tt.components, BitsAllocated: 8,
+			})
+			if err != nil {
+				t.Fatalf("stats: %v", err)
+			}
+			got, err := EncodeWithOptions(pixels, width, height, tt.components, 85, opts)
+			if err != nil {
+				t.Fatalf("encode with stats: %v", err)
+			}
+			if !bytes.Equal(got, want) {
+				t.Fatal("encoded stream differs when frame statistics are given")
+			}
+		})
+	}
+}
+
+func TestUnzigInvertsZigZag(t *testing.T) {
+	for i, natural := range standard.ZigZag {
+		if standard.Unzig[natural] != i {
+			t.Errorf("Unzig[%d] = %d, want %d", natural, standard.Unzig[natural], i)
+		}
+	}
+}
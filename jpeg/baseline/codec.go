@@ -3,6 +3,9 @@ package baseline
 import (
 	"fmt"
 
+	"github.com/cocosip/go-dicom-codecs/codec/layout"
+	"github.com/cocosip/go-dicom-codecs/codec/limits"
+	"github.com/cocosip/go-dicom-codecs/codec/stats"
 	"github.com/cocosip/go-dicom/pkg/dicom/transfer"
 	"github.com/cocosip/go-dicom/pkg/imaging/codec"
 	"github.com/cocosip/go-dicom/pkg/imaging/imagetypes"
@@ -76,6 +79,12 @@ func (c *Codec) Encode(oldPixelData imagetypes.PixelData, newPixelData imagetype
 					baselineParams.Quality = qInt
 				}
 			}
+			if v := parameters.GetParameter("subsampling"); v != nil {
+				baselineParams.SetParameter("subsampling", v)
+			}
+			if v, ok := parameters.GetParameter("targetSize").(int); ok {
+				baselineParams.TargetSize = v
+			}
 		}
 	} else {
 		// Use codec defaults
@@ -87,7 +96,19 @@ func (c *Codec) Encode(oldPixelData imagetypes.PixelData, newPixelData imagetype
 	if err := baselineParams.Validate(); err != nil {
 		return fmt.Errorf("invalid JPEG Baseline parameters: %w", err)
 	}
+	// DICOM defines YBR_FULL_422 for horizontally subsampled chroma but no
+	// photometric interpretation for 4:2:0; that layout stays available
+	// through EncodeWithOptions only.
+	if baselineParams.Subsampling == Subsampling420 {
+		return fmt.Errorf("JPEG Baseline 4:2:0 chroma subsampling has no DICOM photometric interpretation")
+	}
 	quality := baselineParams.Quality
+	minQuality := 100
+	encodeOpts := EncodeOptions{
+		PlanarInput: frameInfo.PlanarConfiguration == 1,
+		YCbCrInput:  frameInfo.PhotometricInterpretation == "YBR_FULL",
+		Subsampling: baselineParams.Subsampling,
+	}
 
 	// Process all frames
 	frameCount := oldPixelData.FrameCount()
@@ -106,13 +127,17 @@ func (c *Codec) Encode(oldPixelData imagetypes.PixelData, newPixelData imagetype
 		}
 
 		// Encode using the baseline encoder
-		jpegData, err := Encode(
-			frameData,
-			int(frameInfo.Width),
-			int(frameInfo.Height),
-			int(frameInfo.SamplesPerPixel),
-			quality,
-		)
+		encodeOpts.Stats = stats.FromParameters(parameters, stats.FrameOf(frameInfo, frameData))
+		width, height := int(frameInfo.Width), int(frameInfo.Height)
+		components := int(frameInfo.SamplesPerPixel)
+		var jpegData []byte
+		if baselineParams.TargetSize > 0 {
+			var frameQuality int
+			jpegData, frameQuality, err = EncodeToSize(frameData, width, height, components, baselineParams.TargetSize, encodeOpts)
+			minQuality = min(minQuality, frameQuality)
+		} else {
+			jpegData, err = EncodeWithOptions(frameData, width, height, components, quality, encodeOpts)
+		}
 		if err != nil {
 			return fmt.Errorf("JPEG Baseline encode failed for frame %d: %w", frameIndex, err)
 		}
@@ -123,11 +148,21 @@ func (c *Codec) Encode(oldPixelData imagetypes.PixelData, newPixelData imagetype
 		}
 	}
 
+	// In target-size mode report the lowest quality chosen for any frame.
+	if baselineParams.TargetSize > 0 && parameters != nil {
+		parameters.SetParameter("quality", minQuality)
+	}
+
+	// Report the photometric interpretation of subsampled colour frames
+	if parameters != nil && frameInfo.SamplesPerPixel == 3 && baselineParams.Subsampling != Subsampling444 {
+		parameters.SetParameter(layout.PhotometricInterpretationParameter, "YBR_FULL_422")
+	}
+
 	return nil
 }
 
 // Decode decodes JPEG Baseline data to uncompressed pixel data
-func (c *Codec) Decode(oldPixelData imagetypes.PixelData, newPixelData imagetypes.PixelData, _ codec.Parameters) error {
+func (c *Codec) Decode(oldPixelData imagetypes.PixelData, newPixelData imagetypes.PixelData, parameters codec.Parameters) error {
 	if oldPixelData == nil || newPixelData == nil {
 		return fmt.Errorf("source and destination PixelData cannot be nil")
 	}
@@ -143,6 +178,12 @@ func (c *Codec) Decode(oldPixelData imagetypes.PixelData, newPixelData imagetype
 	if frameCount == 0 {
 		return fmt.Errorf("source pixel data is empty (no frames)")
 	}
+	decodeOpts := DecodeOptions{
+		PlanarOutput: layout.Bool(parameters, layout.PlanarOutputParameter),
+		YCbCrOutput:  layout.Bool(parameters, layout.SkipColorTransformParameter),
+		Limits:       limits.FromParameters(parameters),
+	}
+	components := 0
 	for frameIndex := 0; frameIndex < frameCount; frameIndex++ {
 		// Get encoded frame data
 		frameData, err := oldPixelData.GetFrame(frameIndex)
@@ -155,7 +196,7 @@ func (c *Codec) Decode(oldPixelData imagetypes.PixelData, newPixelData imagetype
 		}
 
 		// Decode using the baseline decoder
-		pixelData, width, height, _, err := Decode(frameData)
+		pixelData, width, height, comps, err := DecodeWithOptions(frameData, decodeOpts)
 		if err != nil {
 			return fmt.Errorf("JPEG Baseline decode failed for frame %d: %w", frameIndex, err)
 		}
@@ -168,12 +209,24 @@ func (c *Codec) Decode(oldPixelData imagetypes.PixelData, newPixelData imagetype
 			return fmt.Errorf("decoded height (%d) doesn't match expected (%d)", height, frameInfo.Height)
 		}
 
+		components = comps
+
 		// Add decoded frame to destination
 		if err := newPixelData.AddFrame(pixelData); err != nil {
 			return fmt.Errorf("failed to add decoded frame %d: %w", frameIndex, err)
 		}
 	}
 
+	// Report the layout of the decoded frames
+	if parameters != nil && components == 3 {
+		if decodeOpts.PlanarOutput {
+			parameters.SetParameter(layout.PlanarConfigurationParameter, 1)
+		}
+		if decodeOpts.YCbCrOutput {
+			parameters.SetParameter(layout.PhotometricInterpretationParameter, "YBR_FULL")
+		}
+	}
+
 	return nil
 }
 
@@ -4,7 +4,9 @@ import (
 	"bytes"
 	"fmt"
 	"io"
+	"sync"
 
+	"github.com/cocosip/go-dicom-codecs/codec/limits"
 	"github.com/cocosip/go-dicom-codecs/jpeg/standard"
 )
 
@@ -27,21 +29,82 @@ type Decoder struct {
 	width      int          // Image width
 	height     int          // Image height
 	components []*Component // Color components
-	qtables    [4][64]int32 // Quantization tables
+	qtables    [4]*standard.QuantTable
 	dcTables   [4]*standard.HuffmanTable
 	acTables   [4]*standard.HuffmanTable
 	mcuWidth   int // MCU width in blocks
 	mcuHeight  int // MCU height in blocks
 	restartInt int // Restart interval
 	precision  int // Sample precision (bits)
+	opts       DecodeOptions
+
+	// Table and block storage, kept by Reset.
+	tableStore [2][4]standard.HuffmanTable // DC and AC tables by slot
+	quantStore [4]standard.QuantTable      // quantization tables by slot
+	compData   [3][]byte                   // component block buffers
+	scanData   bytes.Buffer
+}
+
+// NewDecoder creates a JPEG Baseline decoder. A decoder may be reused for any
+// number of codestreams; each decode starts with a Reset.
+func NewDecoder() *Decoder {
+	return &Decoder{}
+}
+
+// Reset clears the codestream state of d while keeping its Huffman and
+// quantization tables, component buffers and scan buffer for the next decode.
+// A following codestream that redefines a table identically reuses the built
+// table instead of rebuilding it.
+func (d *Decoder) Reset() {
+	d.width, d.height = 0, 0
+	d.components = nil
+	d.qtables = [4]*standard.QuantTable{}
+	d.dcTables = [4]*standard.HuffmanTable{}
+	d.acTables = [4]*standard.HuffmanTable{}
+	d.mcuWidth, d.mcuHeight = 0, 0
+	d.restartInt, d.precision = 0, 0
+	d.opts = DecodeOptions{}
+	d.scanData.Reset()
+}
+
+// decoderPool holds decoders together with their quantization and Huffman
+// tables and their component block buffers.
+var decoderPool = sync.Pool{New: func() any { return NewDecoder() }}
+
+// DecodeOptions selects the sample layout produced by DecodeWithOptions.
+type DecodeOptions struct {
+	// PlanarOutput returns one plane per component (DICOM
+	// PlanarConfiguration=1) instead of interleaved samples.
+	PlanarOutput bool
+	// YCbCrOutput skips the YCbCr to RGB conversion of 3-component images;
+	// chroma is still upsampled to full resolution (DICOM YBR_FULL).
+	YCbCrOutput bool
+	// Limits bounds the frame declared by SOF; it is checked before the
+	// component buffers are allocated. The zero value applies the defaults.
+	Limits limits.DecodeLimits
 }
 
 // Decode decodes JPEG Baseline data
 func Decode(jpegData []byte) (pixelData []byte, width, height, components int, err error) {
+	return DecodeWithOptions(jpegData, DecodeOptions{})
+}
+
+// DecodeWithOptions decodes JPEG Baseline data into the layout selected by opts.
+func DecodeWithOptions(jpegData []byte, opts DecodeOptions) (pixelData []byte, width, height, components int, err error) {
+	decoder := decoderPool.Get().(*Decoder)
+	defer decoderPool.Put(decoder)
+	return decoder.DecodeWithOptions(jpegData, opts)
+}
+
+// DecodeWithOptions resets d and decodes one codestream into the layout
+// selected by opts. The returned pixel data is newly allocated and not
+// retained by d.
+func (d *Decoder) DecodeWithOptions(jpegData []byte, opts DecodeOptions) (pixelData []byte, width, height, components int, err error) {
 	r := bytes.NewReader(jpegData)
 	reader := standard.NewReader(r)
 
-	decoder := &Decoder{}
+	d.Reset()
+	d.opts = opts
 
 	// Read SOI marker
 	marker, err := reader.ReadMarker()
@@ -61,42 +124,42 @@ func Decode(jpegData []byte) (pixelData []byte, width, height, components int, e
 
 		switch marker {
 		case standard.MarkerSOF0:
-			if err := decoder.parseSOF(reader); err != nil {
+			if err := d.parseSOF(reader); err != nil {
 				return nil, 0, 0, 0, err
 			}
 
 		case standard.MarkerDQT:
-			if err := decoder.parseDQT(reader); err != nil {
+			if err := d.parseDQT(reader); err != nil {
 				return nil, 0, 0, 0, err
 			}
 
 		case standard.MarkerDHT:
-			if err := decoder.parseDHT(reader); err != nil {
+			if err := d.parseDHT(reader); err != nil {
 				return nil, 0, 0, 0, err
 			}
 
 		case standard.MarkerDRI:
-			if err := decoder.parseDRI(reader); err != nil {
+			if err := d.parseDRI(reader); err != nil {
 				return nil, 0, 0, 0, err
 			}
 
 		case standard.MarkerSOS:
-			if err := decoder.parseSOS(reader); err != nil {
+			if err := d.parseSOS(reader); err != nil {
 				return nil, 0, 0, 0, err
 			}
 			// Decode scan data
-			if err := decoder.decodeScan(reader); err != nil {
+			if err := d.decodeScan(reader); err != nil {
 				return nil, 0, 0, 0, err
 			}
 			// After decoding scan, we're done (baseline JPEG has only one scan)
 			// Convert to output format
-			pixelData = decoder.convertToPixels()
-			return pixelData, decoder.width, decoder.height, len(decoder.components), nil
+			pixelData = d.convertToPixels()
+			return pixelData, d.width, d.height, len(d.components), nil
 
 		case standard.MarkerEOI:
 			// End of image, convert to output format
-			pixelData = decoder.convertToPixels()
-			return pixelData, decoder.width, decoder.height, len(decoder.components), nil
+			pixelData = d.convertToPixels()
+			return pixelData, d.width, d.height, len(d.components), nil
 
 		default:
 			// Skip unknown markers
@@ -176,14 +239,25 @@ func (d *Decoder) parseSOF(reader *standard.Reader) error {
 	mcuCols := standard.DivCeil(d.width, d.mcuWidth)
 	mcuRows := standard.DivCeil(d.height, d.mcuHeight)
 
+	// Interleaved scans code whole MCUs, so every component covers the
+	// MCU-padded image (H x V blocks per MCU).
+	peakBytes := int64(d.width) * int64(d.height) * int64(numComponents)
 	for _, comp := range d.components {
-		comp.width = standard.DivCeil(d.width*comp.H, maxH*8)
-		comp.height = standard.DivCeil(d.height*comp.V, maxV*8)
-		comp.data = make([]byte, comp.width*comp.height*64)
+		comp.width = mcuCols * comp.H
+		comp.height = mcuRows * comp.V
+		peakBytes += int64(comp.width) * int64(comp.height) * 64
+	}
+	if err := d.opts.Limits.CheckFrame(d.width, d.height, numComponents, peakBytes); err != nil {
+		return err
+	}
+	for i, comp := range d.components {
+		size := comp.width * comp.height * 64
+		if cap(d.compData[i]) < size {
+			d.compData[i] = make([]byte, size)
+		}
+		comp.data = d.compData[i][:size]
+		clear(comp.data)
 	}
-
-	_ = mcuCols
-	_ = mcuRows
 
 	return nil
 }
@@ -216,20 +290,17 @@ func (d *Decoder) parseDQT(reader *standard.Reader) error {
 			if offset+64 > len(data) {
 				return standard.ErrInvalidDQT
 			}
-			for i := 0; i < 64; i++ {
-				d.qtables[tq][standard.ZigZag[i]] = int32(data[offset+i])
-			}
+			d.quantStore[tq].Set(pq, data[offset:offset+64])
 			offset += 64
 		} else {
 			// 16-bit quantization table
 			if offset+128 > len(data) {
 				return standard.ErrInvalidDQT
 			}
-			for i := 0; i < 64; i++ {
-				d.qtables[tq][standard.ZigZag[i]] = int32(data[offset+i*2])<<8 | int32(data[offset+i*2+1])
-			}
+			d.quantStore[tq].Set(pq, data[offset:offset+128])
 			offset += 128
 		}
+		d.qtables[tq] = &d.quantStore[tq]
 	}
 
 	return nil
@@ -259,14 +330,14 @@ func (d *Decoder) parseDHT(reader *standard.Reader) error {
 		offset++
 
 		// Read the number of codes for each length
-		table := &standard.HuffmanTable{}
+		var bits [16]int
 		totalCodes := 0
 		for i := 0; i < 16; i++ {
 			if offset >= len(data) {
 				return standard.ErrInvalidDHT
 			}
-			table.Bits[i] = int(data[offset])
-			totalCodes += table.Bits[i]
+			bits[i] = int(data[offset])
+			totalCodes += bits[i]
 			offset++
 		}
 
@@ -274,14 +345,13 @@ func (d *Decoder) parseDHT(reader *standard.Reader) error {
 		if offset+totalCodes > len(data) {
 			return standard.ErrInvalidDHT
 		}
-		table.Values = make([]byte, totalCodes)
-		copy(table.Values, data[offset:offset+totalCodes])
-		offset += totalCodes
 
-		// Build the table
-		if err := table.Build(); err != nil {
+		// Build the table in the slot's reusable storage
+		table := &d.tableStore[min(tc, 1)][th]
+		if err := table.Set(bits, data[offset:offset+totalCodes]); err != nil {
 			return err
 		}
+		offset += totalCodes
 
 		// Store the table
 		if tc == 0 {
@@ -344,6 +414,9 @@ func (d *Decoder) parseSOS(reader *standard.Reader) error {
 		if comp == nil {
 			return standard.ErrInvalidSOS
 		}
+		if comp.Tq > 3 || d.qtables[comp.Tq] == nil {
+			return fmt.Errorf("%w: table %d not defined", standard.ErrInvalidDQT, comp.Tq)
+		}
 
 		comp.dcTableSelector = td
 		comp.acTableSelector = ta
@@ -359,7 +432,8 @@ func (d *Decoder) parseSOS(reader *standard.Reader) error {
 func (d *Decoder) decodeScan(reader *standard.Reader) error {
 	// Create a Huffman decoder
 	// We'll read the rest of the data until we hit a marker
-	var scanData bytes.Buffer
+	scanData := &d.scanData
+	scanData.Reset()
 	for {
 		b, err := reader.ReadByte()
 		if err == io.EOF {
@@ -451,6 +525,7 @@ func (d *Decoder) decodeBlock(huffDec *standard.HuffmanDecoder, comp *Component,
 	}
 
 	k := 1
+	hasAC := false
 	for k < 64 {
 		rs, err := huffDec.Decode(acTable)
 		if err != nil {
@@ -481,18 +556,24 @@ func (d *Decoder) decodeBlock(huffDec *standard.HuffmanDecoder, comp *Component,
 			}
 
 			coef[standard.ZigZag[k]] = int32(val)
+			hasAC = true
 			k++
 		}
 	}
 
-	qtable := &d.qtables[comp.Tq]
+	qtable := d.qtables[comp.Tq]
 	blockOffset := (blockY*comp.width + blockX) * 64
 	if blockOffset+63 >= len(comp.data) {
 		// Block is outside the component data, skip it
 		return nil
 	}
 
-	standard.IDCTISlow(coef[:], *qtable, comp.data[blockOffset:], 8)
+	// Flat blocks (all of a blank frame) carry only a DC term.
+	if dc := coef[0] * qtable.Values[0]; !hasAC && dc > -1<<15 && dc < 1<<15 {
+		standard.IDCTISlowDC(dc, comp.data[blockOffset:], 8)
+		return nil
+	}
+	standard.IDCTISlow(coef[:], qtable.Values, comp.data[blockOffset:], 8)
 
 	return nil
 }
@@ -507,80 +588,116 @@ func (d *Decoder) convertToPixels() []byte {
 		// Grayscale
 		comp := d.components[0]
 		for y := 0; y < d.height; y++ {
-			for x := 0; x < d.width; x++ {
-				blockX := x / 8
-				blockY := y / 8
-				inBlockX := x % 8
-				inBlockY := y % 8
-
-				if blockX < comp.width && blockY < comp.height {
-					blockOffset := (blockY*comp.width + blockX) * 64
-					val := comp.data[blockOffset+inBlockY*8+inBlockX]
-					pixelData[y*d.width+x] = val
-				}
-			}
+			comp.readRow(pixelData[y*d.width:(y+1)*d.width], y)
 		}
 	case 3:
-		// YCbCr to RGB conversion
-		for y := 0; y < d.height; y++ {
-			for x := 0; x < d.width; x++ {
-				// Sample each component
-				var yy, cb, cr byte
-
-				// Get maximum sampling factors
-				maxH := d.components[0].H
-				maxV := d.components[0].V
-
-				for i, comp := range d.components {
-					// Scale coordinates based on sampling factors
-					// For 4:2:0, Y has H=2,V=2, Cb/Cr have H=1,V=1
-					// So Cb/Cr coordinates are half of Y coordinates
-					sx := (x * comp.H) / maxH
-					sy := (y * comp.V) / maxV
-
-					blockX := sx / 8
-					blockY := sy / 8
-					inBlockX := sx % 8
-					inBlockY := sy % 8
-
-					if blockX < comp.width && blockY < comp.height {
-						blockOffset := (blockY*comp.width + blockX) * 64
-						val := comp.data[blockOffset+inBlockY*8+inBlockX]
-
-						switch i {
-						case 0:
-							yy = val
-						case 1:
-							cb = val
-						case 2:
-							cr = val
-						}
-					}
-				}
+		d.convertColorRows(pixelData)
+	}
 
-				// YCbCr to RGB conversion
-				r, g, b := ycbcrToRGB(yy, cb, cr)
+	return pixelData
+}
 
-				offset := (y*d.width + x) * 3
-				pixelData[offset+0] = r
-				pixelData[offset+1] = g
-				pixelData[offset+2] = b
-			}
+// readRow copies row y of the component (in component samples) from its 8x8
+// block layout into dst.
+func (c *Component) readRow(dst []byte, y int) {
+	blockY, inBlockY := y/8, y%8
+	if blockY >= c.height {
+		clear(dst)
+		return
+	}
+	src := c.data[blockY*c.width*64+inBlockY*8:]
+	for x := 0; x < len(dst); x += 8 {
+		copy(dst[x:min(x+8, len(dst))], src[x*8:x*8+8])
+	}
+}
+
+// convertColorRows upsamples the chroma rows of each MCU row and converts
+// them to RGB in one pass. Component rows are read once and reused for every
+// output row they cover, and chroma columns are replicated through a
+// precomputed index map.
+func (d *Decoder) convertColorRows(pixelData []byte) {
+	// Output strides: interleaved (3, 1) or planar (1, width*height)
+	pixelStride, compStride := 3, 1
+	if d.opts.PlanarOutput {
+		pixelStride, compStride = 1, d.width*d.height
+	}
+
+	// Get maximum sampling factors
+	maxH, maxV := 1, 1
+	for _, comp := range d.components {
+		maxH = max(maxH, comp.H)
+		maxV = max(maxV, comp.V)
+	}
+
+	var rows [3][]byte
+	var xmaps [3][]int
+	var rowY [3]int
+	for i, comp := range d.components {
+		rows[i] = make([]byte, comp.width*8)
+		rowY[i] = -1
+		if comp.H == maxH {
+			continue
+		}
+		// For 4:2:x, Y has H=2, Cb/Cr have H=1, so chroma columns are halved
+		xmaps[i] = make([]int, d.width)
+		for x := range xmaps[i] {
+			xmaps[i][x] = x * comp.H / maxH
 		}
 	}
 
-	return pixelData
+	for y := 0; y < d.height; y++ {
+		for i, comp := range d.components {
+			if sy := y * comp.V / maxV; sy != rowY[i] {
+				comp.readRow(rows[i], sy)
+				rowY[i] = sy
+			}
+		}
+
+		out := pixelData[y*d.width*pixelStride:]
+		yRow, cbRow, crRow := rows[0], rows[1], rows[2]
+		for x := 0; x < d.width; x++ {
+			yx, cbx, crx := x, x, x
+			if xmaps[0] != nil {
+				yx = xmaps[0][x]
+			}
+			if xmaps[1] != nil {
+				cbx = xmaps[1][x]
+			}
+			if xmaps[2] != nil {
+				crx = xmaps[2][x]
+			}
+			yy, cb, cr := yRow[yx], cbRow[cbx], crRow[crx]
+			if !d.opts.YCbCrOutput {
+				yy, cb, cr = ycbcrToRGB(yy, cb, cr)
+			}
+			offset := x * pixelStride
+			out[offset] = yy
+			out[offset+compStride] = cb
+			out[offset+2*compStride] = cr
+		}
+	}
 }
 
+// Chroma contributions of ycbcrToRGB indexed by the stored Cb/Cr sample.
+// The green terms keep their 16-bit fraction and are summed before shifting.
+var crToR, cbToB, cbToG, crToG = func() (crR, cbB, cbG, crG [256]int32) {
+	for i := range crR {
+		v := int32(i - 128)
+		crR[i] = (91881 * v) >> 16
+		cbB[i] = (116130 * v) >> 16
+		cbG[i] = 22554 * v
+		crG[i] = 46802 * v
+	}
+	return
+}()
+
 // ycbcrToRGB converts YCbCr to RGB
 func ycbcrToRGB(yy, cb, cr byte) (byte, byte, byte) {
 	y := int(yy)
-	cbVal := int(cb) - 128
-	crVal := int(cr) - 128
 
-	r := y + (91881*crVal)>>16
-	g := y - ((22554*cbVal + 46802*crVal) >> 16)
-	b := y + (116130*cbVal)>>16
+	r := y + int(crToR[cr])
+	g := y - int((cbToG[cb]+crToG[cr])>>16)
+	b := y + int(cbToB[cb])
 
 	return byte(standard.Clamp(r, 0, 255)),
 		byte(standard.Clamp(g, 0, 255)),
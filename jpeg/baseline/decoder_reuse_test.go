@@ -0,0 +1,125 @@
+package baseline
+
+import (
+	"bytes"
+	"errors"
+	"runtime"
+	"testing"
+
+	"github.com/cocosip/go-dicom-codecs/jpeg/standard"
+)
+
+func TestDecoderReuse(t *testing.T) {
+	gray := make([]byte, 48*40)
+	for i := range gray {
+		gray[i] = byte(i * 3)
+	}
+	rgb := make([]byte, 37*21*3)
+	for i := range rgb {
+		rgb[i] = byte(i * 5)
+	}
+	grayJPEG, err := Encode(gray, 48, 40, 1, 90)
+	if err != nil {
+		t.Fatalf("Encode gray: %v", err)
+	}
+	rgbJPEG, err := Encode(rgb, 37, 21, 3, 90)
+	if err != nil {
+		t.Fatalf("Encode rgb: %v", err)
+	}
+
+	dec := NewDecoder()
+	for _, stream := range [][]byte{grayJPEG, rgbJPEG, grayJPEG, rgbJPEG} {
+		want, _, _, _, err := Decode(stream)
+		if err != nil {
+			t.Fatalf("Decode: %v", err)
+		}
+		got, _, _, _, err := dec.DecodeWithOptions(stream, DecodeOptions{})
+		if err != nil {
+			t.Fatalf("reused DecodeWithOptions: %v", err)
+		}
+		if !bytes.Equal(got, want) {
+			t.Fatalf("reused decoder output differs from a fresh decode")
+		}
+	}
+
+	// After the first frame only the output and small per-codestream state
+	// are allocated; the component buffers are as large as the output.
+	frame := make([]byte, 256*256)
+	for i := range frame {
+		frame[i] = byte(i % 253)
+	}
+	stream, err := Encode(frame, 256, 256, 1, 90)
+	if err != nil {
+		t.Fatalf("Encode: %v", err)
+	}
+	if _, _, _, _, err := dec.DecodeWithOptions(stream, DecodeOptions{}); err != nil {
+		t.Fatalf("DecodeWithOptions: %v", err)
+	}
+	var before, after runtime.MemStats
+	runtime.ReadMemStats(&before)
+	const runs = 10
+	for i := 0; i < runs; i++ {
+		if _, _, _, _, err := dec.DecodeWithOptions(stream, DecodeOptions{}); err != nil {
+			t.Fatalf("DecodeWithOptions: %v", err)
+		}
+	}
+	runtime.ReadMemStats(&after)
+	if perFrame, limit := (after.TotalAlloc-before.TotalAlloc)/runs, uint64(len(frame)+16<<10); perFrame > limit {
+		t.Fatalf("reused decoder allocated %d bytes per frame, want at most %d", perFrame, limit)
+	}
+}
+
+func TestDecoderTableCache(t *testing.T) {
+	frame := make([]byte, 64*48)
+	for i := range frame {
+		frame[i] = byte(i*7 + i/64)
+	}
+	var streams [][]byte
+	for _, quality := range []int{90, 50, 90, 90, 25, 50} {
+		stream, err := Encode(frame, 64, 48, 1, quality)
+		if err != nil {
+			t.Fatalf("Encode quality %d: %v", quality, err)
+		}
+		streams = append(streams, stream)
+	}
+
+	// The reused decoder keeps tables whose DQT and DHT repeat and must
+	// replace them when the next frame redefines a slot.
+	dec := NewDecoder()
+	for i, stream := range streams {
+		want, _, _, _, err := NewDecoder().DecodeWithOptions(stream, DecodeOptions{})
+		if err != nil {
+			t.Fatalf("fresh decode %d: %v", i, err)
+		}
+		got, _, _, _, err := dec.DecodeWithOptions(stream, DecodeOptions{})
+		if err != nil {
+			t.Fatalf("reused decode %d: %v", i, err)
+		}
+		if !bytes.Equal(got, want) {
+			t.Fatalf("frame %d: reused decoder output differs from a fresh decode", i)
+		}
+	}
+}
+
+func TestDecodeUndefinedQuantTable(t *testing.T) {
+	frame := make([]byte, 16*16)
+	stream, err := Encode(frame, 16, 16, 1, 90)
+	if err != nil {
+		t.Fatalf("Encode: %v", err)
+	}
+	// Drop the DQT segment; the scan then refers to an undefined table.
+	dqt := bytes.Index(stream, []byte{0xFF, 0xDB})
+	if dqt < 0 {
+		t.Fatal("no DQT segment")
+	}
+	length := int(stream[dqt+2])<<8 | int(stream[dqt+3])
+	stripped := append(append([]byte{}, stream[:dqt]...), stream[dqt+2+length:]...)
+
+	dec := NewDecoder()
+	if _, _, _, _, err := dec.DecodeWithOptions(stream, DecodeOptions{}); err != nil {
+		t.Fatalf("DecodeWithOptions: %v", err)
+	}
+	if _, _, _, _, err := dec.DecodeWithOptions(stripped, DecodeOptions{}); !errors.Is(err, standard.ErrInvalidDQT) {
+		t.Fatalf("decode without DQT: err = %v, want %v", err, standard.ErrInvalidDQT)
+	}
+}
@@ -2,7 +2,10 @@ package baseline
 
 import (
 	"bytes"
+	"fmt"
+	"sync"
 
+	"github.com/cocosip/go-dicom-codecs/codec/stats"
 	"github.com/cocosip/go-dicom-codecs/jpeg/standard"
 )
 
@@ -18,69 +21,163 @@ type Encoder struct {
 	acTables [2]*standard.HuffmanTable
 	dcCodes  [2][]standard.HuffmanCode
 	acCodes  [2][]standard.HuffmanCode
+
+	opts     EncodeOptions
+	ycbcr    *YCbCrData // colour-converted planes, shared by both passes
+	constant bool       // every sample of every component is equal (opts.Stats)
+
+	// Storage that survives Reset.
+	planes      YCbCrData                       // storage behind ycbcr
+	codeStore   [2][2][256]standard.HuffmanCode // DC and AC codes by table
+	frequencies huffmanFrequencies
+	scanBuf     bytes.Buffer
+	out         bytes.Buffer
+}
+
+// NewEncoder creates a JPEG Baseline encoder. An encoder may be reused for
+// any number of frames; each encode starts with a Reset.
+func NewEncoder() *Encoder {
+	return &Encoder{}
+}
+
+// Reset clears the frame state of enc while keeping its colour planes,
+// Huffman statistics and output buffers for the next encode.
+func (enc *Encoder) Reset() {
+	enc.width, enc.height, enc.components, enc.quality = 0, 0, 0, 0
+	enc.qtables = [2][64]int32{}
+	enc.dcTables = [2]*standard.HuffmanTable{}
+	enc.acTables = [2]*standard.HuffmanTable{}
+	enc.dcCodes = [2][]standard.HuffmanCode{}
+	enc.acCodes = [2][]standard.HuffmanCode{}
+	enc.opts = EncodeOptions{}
+	enc.ycbcr = nil
+	enc.constant = false
+	enc.scanBuf.Reset()
+	enc.out.Reset()
+}
+
+// encoderPool holds encoders whose colour planes, Huffman code storage and
+// output buffers have grown to frame size. See putEncoder.
+var encoderPool = sync.Pool{New: func() any { return NewEncoder() }}
+
+// putEncoder returns enc to encoderPool without its options, so an idle
+// encoder does not keep the last frame's Stats alive.
+func putEncoder(enc *Encoder) {
+	enc.opts = EncodeOptions{}
+	encoderPool.Put(enc)
+}
+
+// EncodeOptions describes the layout of the pixel data given to
+// EncodeWithOptions.
+type EncodeOptions struct {
+	// PlanarInput means the pixel data holds one plane per component (DICOM
+	// PlanarConfiguration=1) instead of interleaved samples.
+	PlanarInput bool
+	// YCbCrInput means 3-component data is already YCbCr (DICOM YBR_FULL)
+	// and is coded without the RGB to YCbCr conversion.
+	YCbCrInput bool
+	// Subsampling selects the chroma sampling of 3-component images.
+	Subsampling Subsampling
+	// Stats optionally holds the statistics (codec/stats) of the pixel data.
+	// A constant frame is then coded without extracting or transforming its
+	// blocks, which all reduce to the same DC term.
+	Stats *stats.Stats
+}
+
+// Subsampling selects the chroma sampling of 3-component images.
+type Subsampling int
+
+const (
+	// Subsampling444 codes full-resolution chroma (default).
+	Subsampling444 Subsampling = iota
+	// Subsampling422 halves chroma horizontally.
+	Subsampling422
+	// Subsampling420 halves chroma horizontally and vertically.
+	Subsampling420
+)
+
+// lumaFactors returns the luma sampling factors; chroma is always 1x1.
+func (s Subsampling) lumaFactors() (h, v int) {
+	switch s {
+	case Subsampling422:
+		return 2, 1
+	case Subsampling420:
+		return 2, 2
+	default:
+		return 1, 1
+	}
 }
 
 // Encode encodes pixel data to JPEG Baseline format
 // components: 1 for grayscale, 3 for RGB
 // quality: 1-100, where 100 is best quality
 func Encode(pixelData []byte, width, height, components, quality int) ([]byte, error) {
+	return EncodeWithOptions(pixelData, width, height, components, quality, EncodeOptions{})
+}
+
+// EncodeWithOptions encodes pixel data laid out as described by opts.
+func EncodeWithOptions(pixelData []byte, width, height, components, quality int, opts EncodeOptions) ([]byte, error) {
+	enc := encoderPool.Get().(*Encoder)
+	defer putEncoder(enc)
+	return enc.EncodeWithOptions(pixelData, width, height, components, quality, opts)
+}
+
+// EncodeWithOptions resets enc and encodes one frame laid out as described by
+// opts. The returned stream is newly allocated and not retained by enc.
+func (enc *Encoder) EncodeWithOptions(pixelData []byte, width, height, components, quality int, opts EncodeOptions) ([]byte, error) {
+	if err := enc.start(pixelData, width, height, components, quality, opts); err != nil {
+		return nil, err
+	}
+	return enc.encode(pixelData, quality)
+}
+
+// start resets enc and validates the frame description. The Huffman tables
+// are built per encode from the frame's statistics.
+func (enc *Encoder) start(pixelData []byte, width, height, components, quality int, opts EncodeOptions) error {
 	if width <= 0 || height <= 0 {
-		return nil, standard.ErrInvalidDimensions
+		return standard.ErrInvalidDimensions
 	}
 
 	if components != 1 && components != 3 {
-		return nil, standard.ErrInvalidComponents
+		return standard.ErrInvalidComponents
 	}
 
 	if quality < 1 || quality > 100 {
-		return nil, standard.ErrInvalidQuality
+		return standard.ErrInvalidQuality
 	}
 
 	if len(pixelData) < width*height*components {
-		return nil, standard.ErrBufferTooSmall
+		return standard.ErrBufferTooSmall
 	}
 
-	enc := &Encoder{
-		width:      width,
-		height:     height,
-		components: components,
-		quality:    quality,
+	if opts.Subsampling < Subsampling444 || opts.Subsampling > Subsampling420 {
+		return fmt.Errorf("invalid chroma subsampling: %d", opts.Subsampling)
 	}
 
+	enc.Reset()
+	enc.width = width
+	enc.height = height
+	enc.components = components
+	enc.quality = quality
+	enc.opts = opts
+	enc.constant = opts.Stats != nil && len(opts.Stats.Components) == components && opts.Stats.Constant()
+	return nil
+}
+
+// encode writes the complete JPEG stream at the given quality. The encoder
+// may be reused for another quality; colour-converted planes are kept.
+func (enc *Encoder) encode(pixelData []byte, quality int) ([]byte, error) {
+	enc.quality = quality
+
 	// Initialize quantization tables
-	enc.qtables[0] = standard.ScaleQuantTable(standard.DefaultLuminanceQuantTable, quality)
-	enc.qtables[1] = standard.ScaleQuantTable(standard.DefaultChrominanceQuantTable, quality)
-
-	// Initialize Huffman tables
-	enc.dcTables[0] = standard.BuildStandardHuffmanTable(
-		standard.StandardDCLuminanceBits,
-		standard.StandardDCLuminanceValues,
-	)
-	enc.acTables[0] = standard.BuildStandardHuffmanTable(
-		standard.StandardACLuminanceBits,
-		standard.StandardACLuminanceValues,
-	)
-	enc.dcTables[1] = standard.BuildStandardHuffmanTable(
-		standard.StandardDCChrominanceBits,
-		standard.StandardDCChrominanceValues,
-	)
-	enc.acTables[1] = standard.BuildStandardHuffmanTable(
-		standard.StandardACChrominanceBits,
-		standard.StandardACChrominanceValues,
-	)
-
-	// Build Huffman codes
-	enc.dcCodes[0] = standard.BuildHuffmanCodes(enc.dcTables[0])
-	enc.acCodes[0] = standard.BuildHuffmanCodes(enc.acTables[0])
-	enc.dcCodes[1] = standard.BuildHuffmanCodes(enc.dcTables[1])
-	enc.acCodes[1] = standard.BuildHuffmanCodes(enc.acTables[1])
+	enc.qtables = qualityTables(quality)
 
 	if err := enc.optimizeHuffmanTables(pixelData); err != nil {
 		return nil, err
 	}
 
-	var buf bytes.Buffer
-	writer := standard.NewWriter(&buf)
+	enc.out.Reset()
+	writer := standard.NewWriter(&enc.out)
 
 	// Write SOI
 	if err := writer.WriteMarker(standard.MarkerSOI); err != nil {
@@ -112,7 +209,16 @@ func Encode(pixelData []byte, width, height, components, quality int) ([]byte, e
 		return nil, err
 	}
 
-	return buf.Bytes(), nil
+	return bytes.Clone(enc.out.Bytes()), nil
+}
+
+// qualityTables returns the luminance and chrominance quantization tables
+// for a quality.
+func qualityTables(quality int) [2][64]int32 {
+	return [2][64]int32{
+		standard.ScaleQuantTable(standard.DefaultLuminanceQuantTable, quality),
+		standard.ScaleQuantTable(standard.DefaultChrominanceQuantTable, quality),
+	}
 }
 
 // writeDQT writes Define Quantization Table segments
@@ -156,11 +262,12 @@ func (enc *Encoder) writeSOF0(writer *standard.Writer) error {
 		data[7] = 0x11 // Sampling factors: 1x1
 		data[8] = 0    // Quantization table 0
 	} else {
-		// YCbCr 4:4:4 sampling, matching fo-dicom's default SF444.
+		// YCbCr 4:4:4 sampling by default, matching fo-dicom's default SF444.
+		h, v := enc.opts.Subsampling.lumaFactors()
 		// Y component
-		data[6] = 1    // Component ID
-		data[7] = 0x11 // Sampling factors: 1x1
-		data[8] = 0    // Quantization table 0
+		data[6] = 1              // Component ID
+		data[7] = byte(h<<4 | v) // Sampling factors: 1x1, 2x1 (4:2:2) or 2x2 (4:2:0)
+		data[8] = 0              // Quantization table 0
 
 		// Cb component
 		data[9] = 2     // Component ID
@@ -258,8 +365,9 @@ func (enc *Encoder) writeSOS(writer *standard.Writer, pixelData []byte) error {
 
 // encodeScan encodes the scan data
 func (enc *Encoder) encodeScan(writer *standard.Writer, pixelData []byte) error {
-	var scanBuf bytes.Buffer
-	huffEnc := standard.NewHuffmanEncoder(&scanBuf)
+	scanBuf := &enc.scanBuf
+	scanBuf.Reset()
+	huffEnc := standard.NewHuffmanEncoder(scanBuf)
 
 	if enc.components == 1 {
 		// Grayscale
@@ -303,27 +411,30 @@ func (enc *Encoder) encodeGrayscale(huffEnc *standard.HuffmanEncoder, pixelData
 	return nil
 }
 
-// encodeRGB encodes RGB image with full-resolution YCbCr components.
+// encodeRGB encodes RGB image as interleaved YCbCr MCUs.
 func (enc *Encoder) encodeRGB(huffEnc *standard.HuffmanEncoder, pixelData []byte) error {
-	// Convert RGB to YCbCr and encode with 4:4:4 sampling.
-	ycbcr := enc.rgbToYCbCr(pixelData)
+	ycbcr := enc.ycbcrPlanes(pixelData)
+	h, v := enc.opts.Subsampling.lumaFactors()
 
 	dcPred := [3]int{0, 0, 0}
 
-	// Process in 8x8 MCUs with one block for each component.
-	blocksWide := standard.DivCeil(enc.width, 8)
-	blocksHigh := standard.DivCeil(enc.height, 8)
-	stride := standard.DivCeil(enc.width, 8) * 8
-
-	for blockY := 0; blockY < blocksHigh; blockY++ {
-		for blockX := 0; blockX < blocksWide; blockX++ {
-			if err := enc.encodeBlock(huffEnc, ycbcr.Y, blockX, blockY, 0, stride, &dcPred[0], 0); err != nil {
-				return err
+	// Each MCU holds h x v luma blocks followed by one block per chroma component.
+	mcusWide := ycbcr.Stride / (8 * h)
+	mcusHigh := len(ycbcr.Y) / ycbcr.Stride / (8 * v)
+
+	for mcuY := 0; mcuY < mcusHigh; mcuY++ {
+		for mcuX := 0; mcuX < mcusWide; mcuX++ {
+			for by := 0; by < v; by++ {
+				for bx := 0; bx < h; bx++ {
+					if err := enc.encodeBlock(huffEnc, ycbcr.Y, mcuX*h+bx, mcuY*v+by, 0, ycbcr.Stride, &dcPred[0], 0); err != nil {
+						return err
+					}
+				}
 			}
-			if err := enc.encodeBlock(huffEnc, ycbcr.Cb, blockX, blockY, 0, stride, &dcPred[1], 1); err != nil {
+			if err := enc.encodeBlock(huffEnc, ycbcr.Cb, mcuX, mcuY, 0, ycbcr.ChromaStride, &dcPred[1], 1); err != nil {
 				return err
 			}
-			if err := enc.encodeBlock(huffEnc, ycbcr.Cr, blockX, blockY, 0, stride, &dcPred[2], 1); err != nil {
+			if err := enc.encodeBlock(huffEnc, ycbcr.Cr, mcuX, mcuY, 0, ycbcr.ChromaStride, &dcPred[2], 1); err != nil {
 				return err
 			}
 		}
@@ -332,44 +443,110 @@ func (enc *Encoder) encodeRGB(huffEnc *standard.HuffmanEncoder, pixelData []byte
 	return nil
 }
 
-// YCbCrData holds YCbCr image data
+// YCbCrData holds YCbCr image data padded to whole MCUs
 type YCbCrData struct {
 	Y  []byte
 	Cb []byte
 	Cr []byte
+
+	Stride       int // Y row stride in samples
+	ChromaStride int // Cb/Cr row stride in samples
+}
+
+// ycbcrPlanes returns the padded YCbCr planes of pixelData, converting them
+// once for the Huffman statistics and encoding passes.
+func (enc *Encoder) ycbcrPlanes(pixelData []byte) *YCbCrData {
+	if enc.ycbcr == nil {
+		enc.ycbcr = enc.rgbToYCbCr(pixelData)
+	}
+	return enc.ycbcr
 }
 
-// rgbToYCbCr converts RGB to full-resolution YCbCr for 4:4:4 sampling.
+// rgbToYCbCr converts RGB to YCbCr planes padded to whole MCUs, reading
+// interleaved or planar input and copying samples unchanged when the input
+// is already YCbCr. Subsampled chroma is box-filtered from the full planes.
 func (enc *Encoder) rgbToYCbCr(rgb []byte) *YCbCrData {
-	stride := standard.DivCeil(enc.width, 8) * 8
-	height := standard.DivCeil(enc.height, 8) * 8
+	h, v := enc.opts.Subsampling.lumaFactors()
+	stride := standard.DivCeil(enc.width, 8*h) * 8 * h
+	height := standard.DivCeil(enc.height, 8*v) * 8 * v
 
-	y := make([]byte, stride*height)
-	cb := make([]byte, stride*height)
-	cr := make([]byte, stride*height)
+	// Every sample of the padded planes is written below.
+	y := growPlane(&enc.planes.Y, stride*height)
+	cb := growPlane(&enc.planes.Cb, stride*height)
+	cr := growPlane(&enc.planes.Cr, stride*height)
+
+	pixelStride, compStride := 3, 1
+	if enc.opts.PlanarInput {
+		pixelStride, compStride = 1, enc.width*enc.height
+	}
 
 	for row := 0; row < height; row++ {
 		sourceRow := min(row, enc.height-1)
 		for col := 0; col < stride; col++ {
 			sourceCol := min(col, enc.width-1)
-			offset := (sourceRow*enc.width + sourceCol) * 3
-			r := int(rgb[offset+0])
-			g := int(rgb[offset+1])
-			b := int(rgb[offset+2])
+			offset := (sourceRow*enc.width + sourceCol) * pixelStride
+			index := row*stride + col
+			if enc.opts.YCbCrInput {
+				y[index] = rgb[offset]
+				cb[index] = rgb[offset+compStride]
+				cr[index] = rgb[offset+2*compStride]
+				continue
+			}
+			r := int(rgb[offset])
+			g := int(rgb[offset+compStride])
+			b := int(rgb[offset+2*compStride])
 
 			// RGB to YCbCr conversion
 			yy := (19595*r + 38470*g + 7471*b + 32768) >> 16
 			cbVal := ((-11056*r - 21712*g + 32768*b + 8421376) >> 16)
 			crVal := ((32768*r - 27440*g - 5328*b + 8421376) >> 16)
 
-			index := row*stride + col
 			y[index] = byte(standard.Clamp(yy, 0, 255))
 			cb[index] = byte(standard.Clamp(cbVal, 0, 255))
 			cr[index] = byte(standard.Clamp(crVal, 0, 255))
 		}
 	}
 
-	return &YCbCrData{Y: y, Cb: cb, Cr: cr}
+	if h > 1 || v > 1 {
+		// Subsampled chroma is averaged in place: every cell lies at or
+		// after the output sample it produces.
+		cb = downsampleBox(cb, cb, stride, v)
+		cr = downsampleBox(cr, cr, stride, v)
+	}
+	return &YCbCrData{Y: y, Cb: cb, Cr: cr, Stride: stride, ChromaStride: stride / h}
+}
+
+// growPlane returns (*plane)[:n], reallocating *plane when it is too small.
+func growPlane(plane *[]byte, n int) []byte {
+	if cap(*plane) < n {
+		*plane = make([]byte, n)
+	}
+	return (*plane)[:n]
+}
+
+// downsampleBox averages every 2x1 (v=1, 4:2:2) or 2x2 (v=2, 4:2:0) cell of
+// a plane with the given stride into dst, rounding to nearest. dst may be
+// src's storage.
+func downsampleBox(dst, src []byte, stride, v int) []byte {
+	dstStride := stride / 2
+	rows := len(src) / stride / v
+	dst = dst[:dstStride*rows]
+	for y := 0; y < rows; y++ {
+		top := src[y*v*stride:]
+		out := dst[y*dstStride : (y+1)*dstStride]
+		if v == 1 {
+			for x := range out {
+				out[x] = byte((int(top[2*x]) + int(top[2*x+1]) + 1) >> 1)
+			}
+			continue
+		}
+		bottom := src[(y*v+1)*stride:]
+		for x := range out {
+			sum := int(top[2*x]) + int(top[2*x+1]) + int(bottom[2*x]) + int(bottom[2*x+1])
+			out[x] = byte((sum + 2) >> 2)
+		}
+	}
+	return dst
 }
 
 // encodeBlock encodes a single 8x8 block
@@ -438,6 +615,38 @@ func (enc *Encoder) encodeBlock(huffEnc *standard.HuffmanEncoder, data []byte, b
 }
 
 func (enc *Encoder) quantizeBlock(data []byte, blockX, blockY, stride, tableIdx int) [64]int32 {
+	coef := enc.transformBlock(data, blockX, blockY, stride)
+
+	// Quantize
+	qtable := &enc.qtables[tableIdx]
+	for i := 0; i < 64; i++ {
+		divisor := qtable[i] * 8
+		if coef[i] < 0 {
+			coef[i] = -((-coef[i] + divisor/2) / divisor)
+		} else {
+			coef[i] = (coef[i] + divisor/2) / divisor
+		}
+	}
+
+	return coef
+}
+
+// transformBlock returns the forward DCT of a block of a plane. Every plane
+// of a constant frame, padding and subsampled chroma included, holds a single
+// value, so its blocks are flat without being read.
+func (enc *Encoder) transformBlock(data []byte, blockX, blockY, stride int) [64]int32 {
+	if enc.constant {
+		var coef [64]int32
+		coef[0] = 64 * (int32(data[0]) - 128)
+		return coef
+	}
+	return transformBlock(data, blockX, blockY, stride)
+}
+
+// transformBlock returns the forward DCT of an 8x8 block, replicating edge
+// samples past the plane. IJG's integer DCT retains an eightfold scale that
+// the quantizer removes.
+func transformBlock(data []byte, blockX, blockY, stride int) [64]int32 {
 	// Extract 8x8 block
 	var block [64]byte
 	dataHeight := len(data) / stride
@@ -449,22 +658,25 @@ func (enc *Encoder) quantizeBlock(data []byte, blockX, blockY, stride, tableIdx
 		}
 	}
 
-	// IJG's integer DCT retains an eightfold scale that its quantizer removes.
 	var coef [64]int32
+	if flatBlock(&block) {
+		// The DCT of a flat block is its DC term alone: 8x8 samples of
+		// v-128 with IJG's eightfold scale.
+		coef[0] = 64 * (int32(block[0]) - 128)
+		return coef
+	}
 	standard.DCTISlow(block[:], 8, coef[:])
+	return coef
+}
 
-	// Quantize
-	qtable := &enc.qtables[tableIdx]
-	for i := 0; i < 64; i++ {
-		divisor := qtable[i] * 8
-		if coef[i] < 0 {
-			coef[i] = -((-coef[i] + divisor/2) / divisor)
-		} else {
-			coef[i] = (coef[i] + divisor/2) / divisor
+// flatBlock reports whether every sample of block is equal.
+func flatBlock(block *[64]byte) bool {
+	for _, v := range block[1:] {
+		if v != block[0] {
+			return false
 		}
 	}
-
-	return coef
+	return true
 }
 
 type huffmanFrequencies struct {
@@ -473,15 +685,12 @@ type huffmanFrequencies struct {
 }
 
 func (enc *Encoder) optimizeHuffmanTables(pixelData []byte) error {
-	frequencies := &huffmanFrequencies{}
-
-	if enc.components == 1 {
-		if err := enc.countGrayscale(frequencies, pixelData); err != nil {
-			return err
-		}
-	} else if err := enc.countRGB(frequencies, pixelData); err != nil {
-		return err
-	}
+	frequencies := &enc.frequencies
+	*frequencies = huffmanFrequencies{}
+	dcPred := [3]int{}
+	enc.forEachBlock(pixelData, func(data []byte, blockX, blockY, stride, component, tableIdx int) {
+		enc.countBlock(frequencies, data, blockX, blockY, stride, &dcPred[component], tableIdx)
+	})
 
 	tableCount := 1
 	if enc.components == 3 {
@@ -490,38 +699,41 @@ func (enc *Encoder) optimizeHuffmanTables(pixelData []byte) error {
 	for tableIdx := 0; tableIdx < tableCount; tableIdx++ {
 		enc.dcTables[tableIdx] = standard.BuildOptimalHuffmanTable(frequencies.dc[tableIdx])
 		enc.acTables[tableIdx] = standard.BuildOptimalHuffmanTable(frequencies.ac[tableIdx])
-		enc.dcCodes[tableIdx] = standard.BuildHuffmanCodes(enc.dcTables[tableIdx])
-		enc.acCodes[tableIdx] = standard.BuildHuffmanCodes(enc.acTables[tableIdx])
+		enc.dcCodes[tableIdx] = standard.BuildHuffmanCodesInto(enc.codeStore[0][tableIdx][:], enc.dcTables[tableIdx])
+		enc.acCodes[tableIdx] = standard.BuildHuffmanCodesInto(enc.codeStore[1][tableIdx][:], enc.acTables[tableIdx])
 	}
 
 	return nil
 }
 
-func (enc *Encoder) countGrayscale(frequencies *huffmanFrequencies, pixelData []byte) error {
-	dcPred := 0
-	for blockY := 0; blockY < standard.DivCeil(enc.height, 8); blockY++ {
-		for blockX := 0; blockX < standard.DivCeil(enc.width, 8); blockX++ {
-			enc.countBlock(frequencies, pixelData, blockX, blockY, enc.width, &dcPred, 0)
+// forEachBlock calls visit for every block in scan order with the plane that
+// holds it, its component (DC predictor) and its table index.
+func (enc *Encoder) forEachBlock(pixelData []byte, visit func(data []byte, blockX, blockY, stride, component, tableIdx int)) {
+	if enc.components == 1 {
+		for blockY := 0; blockY < standard.DivCeil(enc.height, 8); blockY++ {
+			for blockX := 0; blockX < standard.DivCeil(enc.width, 8); blockX++ {
+				visit(pixelData, blockX, blockY, enc.width, 0, 0)
+			}
 		}
+		return
 	}
-	return nil
-}
 
-func (enc *Encoder) countRGB(frequencies *huffmanFrequencies, pixelData []byte) error {
-	ycbcr := enc.rgbToYCbCr(pixelData)
-	dcPred := [3]int{}
-	blocksWide := standard.DivCeil(enc.width, 8)
-	blocksHigh := standard.DivCeil(enc.height, 8)
-	stride := standard.DivCeil(enc.width, 8) * 8
+	ycbcr := enc.ycbcrPlanes(pixelData)
+	h, v := enc.opts.Subsampling.lumaFactors()
+	mcusWide := ycbcr.Stride / (8 * h)
+	mcusHigh := len(ycbcr.Y) / ycbcr.Stride / (8 * v)
 
-	for blockY := 0; blockY < blocksHigh; blockY++ {
-		for blockX := 0; blockX < blocksWide; blockX++ {
-			enc.countBlock(frequencies, ycbcr.Y, blockX, blockY, stride, &dcPred[0], 0)
-			enc.countBlock(frequencies, ycbcr.Cb, blockX, blockY, stride, &dcPred[1], 1)
-			enc.countBlock(frequencies, ycbcr.Cr, blockX, blockY, stride, &dcPred[2], 1)
+	for mcuY := 0; mcuY < mcusHigh; mcuY++ {
+		for mcuX := 0; mcuX < mcusWide; mcuX++ {
+			for by := 0; by < v; by++ {
+				for bx := 0; bx < h; bx++ {
+					visit(ycbcr.Y, mcuX*h+bx, mcuY*v+by, ycbcr.Stride, 0, 0)
+				}
+			}
+			visit(ycbcr.Cb, mcuX, mcuY, ycbcr.ChromaStride, 1, 1)
+			visit(ycbcr.Cr, mcuX, mcuY, ycbcr.ChromaStride, 2, 1)
 		}
 	}
-	return nil
 }
 
 func (enc *Encoder) countBlock(frequencies *huffmanFrequencies, data []byte, blockX, blockY, stride int, dcPred *int, tableIdx int) {
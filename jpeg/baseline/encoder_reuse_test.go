@@ -0,0 +1,83 @@
+package baseline
+
+import (
+	"bytes"
+	"runtime"
+	"testing"
+
+	"github.com/cocosip/go-dicom-codecs/codec/stats"
+)
+
+func TestEncoderReuse(t *testing.T) {
+	gray := make([]byte, 48*40)
+	for i := range gray {
+		gray[i] = byte(i * 3)
+	}
+	rgb := make([]byte, 37*21*3)
+	for i := range rgb {
+		rgb[i] = byte(i * 5)
+	}
+	frames := []struct {
+		data          []byte
+		width, height int
+		components    int
+		opts          EncodeOptions
+	}{
+		{gray, 48, 40, 1, EncodeOptions{}},
+		{rgb, 37, 21, 3, EncodeOptions{Subsampling: Subsampling422}},
+		{rgb, 37, 21, 3, EncodeOptions{}},
+		{gray, 48, 40, 1, EncodeOptions{}},
+		{rgb, 37, 21, 3, EncodeOptions{Subsampling: Subsampling420}},
+	}
+
+	enc := NewEncoder()
+	for _, f := range frames {
+		want, err := (&Encoder{}).EncodeWithOptions(f.data, f.width, f.height, f.components, 85, f.opts)
+		if err != nil {
+			t.Fatalf("fresh EncodeWithOptions: %v", err)
+		}
+		got, err := enc.EncodeWithOptions(f.data, f.width, f.height, f.components, 85, f.opts)
+		if err != nil {
+			t.Fatalf("reused EncodeWithOptions: %v", err)
+		}
+		if !bytes.Equal(got, want) {
+			t.Fatalf("reused encoder output differs from a fresh encode")
+		}
+	}
+
+	// After the first frame only the output, the Huffman tables and small
+	// per-frame state are allocated; the colour planes are reused.
+	frame := make([]byte, 256*256*3)
+	for i := range frame {
+		frame[i] = byte(i % 253)
+	}
+	stream, err := enc.EncodeWithOptions(frame, 256, 256, 3, 90, EncodeOptions{})
+	if err != nil {
+		t.Fatalf("EncodeWithOptions: %v", err)
+	}
+	var before, after runtime.MemStats
+	runtime.ReadMemStats(&before)
+	const runs = 10
+	for i := 0; i < runs; i++ {
+		if _, err := enc.EncodeWithOptions(frame, 256, 256, 3, 90, EncodeOptions{}); err != nil {
+			t.Fatalf("EncodeWithOptions: %v", err)
+		}
+	}
+	runtime.ReadMemStats(&after)
+	if perFrame, limit := (after.TotalAlloc-before.TotalAlloc)/runs, uint64(len(stream)+32<<10); perFrame > limit {
+		t.Fatalf("reused encoder allocated %d bytes per frame, want at most %d", perFrame, limit)
+	}
+}
+
+func TestPooledEncoderDropsStats(t *testing.T) {
+	gray := make([]byte, 16*16)
+	enc := NewEncoder()
+	opts := EncodeOptions{Stats: &stats.Stats{}}
+	if _, err := enc.EncodeWithOptions(gray, 16, 16, 1, 85, opts); err != nil {
+		t.Fatalf("EncodeWithOptions: %v", err)
+	}
+	putEncoder(enc)
+	if enc.opts.Stats != nil {
+		t.Fatalf("pooled encoder still references the last frame's Stats")
+	}
+}
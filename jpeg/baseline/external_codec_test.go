@@ -237,6 +237,41 @@ func TestBaselineCodecRGB(t *testing.T) {
 	}
 }
 
+// TestBaselineCodecSubsampling checks that 4:2:2 encodes report YBR_FULL_422
+// and that 4:2:0, which has no DICOM photometric interpretation, is rejected.
+func TestBaselineCodecSubsampling(t *testing.T) {
+	width, height := 48, 32
+	frameInfo := &imagetypes.FrameInfo{
+		Width:                     uint16(width),
+		Height:                    uint16(height),
+		BitsAllocated:             8,
+		BitsStored:                8,
+		HighBit:                   7,
+		SamplesPerPixel:           3,
+		PhotometricInterpretation: photometricRGB,
+	}
+	src := codecHelpers.NewTestPixelData(frameInfo)
+	if err := src.AddFrame(make([]byte, width*height*3)); err != nil {
+		t.Fatalf("AddFrame error: %v", err)
+	}
+	baselineCodec := NewBaselineCodec(90)
+
+	params := codec.NewBaseParameters()
+	params.SetParameter("subsampling", Subsampling422)
+	if err := baselineCodec.Encode(src, codecHelpers.NewTestPixelData(frameInfo), params); err != nil {
+		t.Fatalf("4:2:2 encode failed: %v", err)
+	}
+	if pi := params.GetParameter("photometricInterpretation"); pi != "YBR_FULL_422" {
+		t.Errorf("photometricInterpretation = %v, want YBR_FULL_422", pi)
+	}
+
+	params = codec.NewBaseParameters()
+	params.SetParameter("subsampling", Subsampling420)
+	if err := baselineCodec.Encode(src, codecHelpers.NewTestPixelData(frameInfo), params); err == nil {
+		t.Error("4:2:0 accepted by the DICOM codec")
+	}
+}
+
 func TestBaselineCodecWithParameters(t *testing.T) {
 	// Create test data
 	width, height := 64, 64
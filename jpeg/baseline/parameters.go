@@ -1,6 +1,8 @@
 package baseline
 
 import (
+	"fmt"
+
 	"github.com/cocosip/go-dicom/pkg/imaging/codec"
 )
 
@@ -17,6 +19,17 @@ type JPEGBaselineParameters struct {
 	// - 1:   Lowest quality, maximum compression
 	Quality int
 
+	// Subsampling selects the chroma sampling of colour images
+	// (Subsampling444 default, Subsampling422). Subsampling422 encodes
+	// report photometricInterpretation YBR_FULL_422; Subsampling420 has no
+	// DICOM photometric interpretation and is rejected by Codec.Encode.
+	Subsampling Subsampling
+
+	// TargetSize, when > 0, selects per frame the highest quality whose
+	// encoded frame fits in this many bytes (see EncodeToSize); Quality is
+	// then ignored.
+	TargetSize int
+
 	// internal storage for compatibility with generic parameter interface
 	params map[string]interface{}
 }
@@ -34,6 +47,10 @@ func (p *JPEGBaselineParameters) GetParameter(name string) interface{} {
 	switch name {
 	case "quality":
 		return p.Quality
+	case "subsampling":
+		return p.Subsampling
+	case "targetSize":
+		return p.TargetSize
 	default:
 		// Check custom parameters
 		return p.params[name]
@@ -47,6 +64,17 @@ func (p *JPEGBaselineParameters) SetParameter(name string, value interface{}) {
 		if v, ok := value.(int); ok {
 			p.Quality = v
 		}
+	case "subsampling":
+		switch v := value.(type) {
+		case Subsampling:
+			p.Subsampling = v
+		case int:
+			p.Subsampling = Subsampling(v)
+		}
+	case "targetSize":
+		if v, ok := value.(int); ok {
+			p.TargetSize = v
+		}
 	default:
 		// Store as custom parameter
 		p.params[name] = value
@@ -58,6 +86,12 @@ func (p *JPEGBaselineParameters) Validate() error {
 	if p.Quality < 1 || p.Quality > 100 {
 		p.Quality = 90 // Reset to default
 	}
+	if p.Subsampling < Subsampling444 || p.Subsampling > Subsampling420 {
+		return fmt.Errorf("invalid chroma subsampling: %d", p.Subsampling)
+	}
+	if p.TargetSize < 0 {
+		p.TargetSize = 0
+	}
 	return nil
 }
 
@@ -66,3 +100,16 @@ func (p *JPEGBaselineParameters) WithQuality(quality int) *JPEGBaselineParameter
 	p.Quality = quality
 	return p
 }
+
+// WithSubsampling sets the chroma subsampling and returns the parameters for chaining
+func (p *JPEGBaselineParameters) WithSubsampling(subsampling Subsampling) *JPEGBaselineParameters {
+	p.Subsampling = subsampling
+	return p
+}
+
+// WithTargetSize sets the per-frame target size in bytes and returns the
+// parameters for chaining
+func (p *JPEGBaselineParameters) WithTargetSize(size int) *JPEGBaselineParameters {
+	p.TargetSize = size
+	return p
+}
@@ -0,0 +1,53 @@
+package baseline
+
+import (
+	"fmt"
+
+	"github.com/cocosip/go-dicom-codecs/jpeg/standard"
+)
+
+// markerOverhead returns the bytes of every segment except DHT and the scan
+// data: SOI, DQT, SOF0, the SOS header and EOI.
+func (enc *Encoder) markerOverhead() int {
+	tables := 1
+	if enc.components == 3 {
+		tables = 2
+	}
+	return 2 + tables*(4+65) + (4 + 6 + 3*enc.components) + (4 + 4 + 2*enc.components) + 2
+}
+
+// EncodeToSize encodes pixelData at the highest quality whose output fits in
+// targetBytes and returns the stream together with that quality.
+//
+// The forward DCT runs once; each candidate quality re-quantizes the cached
+// coefficients and sizes them with optimal Huffman tables, so the quality
+// search costs a fraction of an encode. The chosen quality is then encoded
+// for real and, if stuffing or rounding push it over the target, the search
+// is corrected and repeated (see standard.FitQuality). When even quality 1
+// does not fit, the quality 1 encoding is returned.
+func EncodeToSize(pixelData []byte, width, height, components, targetBytes int, opts EncodeOptions) ([]byte, int, error) {
+	if targetBytes <= 0 {
+		return nil, 0, fmt.Errorf("invalid target size: %d", targetBytes)
+	}
+	enc := encoderPool.Get().(*Encoder)
+	defer putEncoder(enc)
+	if err := enc.start(pixelData, width, height, components, 100, opts); err != nil {
+		return nil, 0, err
+	}
+
+	blocks := standard.DivCeil(width, 8) * standard.DivCeil(height, 8) * components
+	cache := standard.NewCoefficientCache(blocks)
+	enc.forEachBlock(pixelData, func(data []byte, blockX, blockY, stride, component, tableIdx int) {
+		coef := enc.transformBlock(data, blockX, blockY, stride)
+		cache.Add(&coef, tableIdx, component)
+	})
+
+	overhead := enc.markerOverhead()
+	estimate := func(quality int) int {
+		qtables := qualityTables(quality)
+		return overhead + cache.EstimateSize(&qtables)
+	}
+	return standard.FitQuality(targetBytes, estimate, func(quality int) ([]byte, error) {
+		return enc.encode(pixelData, quality)
+	})
+}
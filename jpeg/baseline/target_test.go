@@ -0,0 +1,89 @@
+package baseline
+
+import (
+	"testing"
+
+	"github.com/cocosip/go-dicom-codecs/jpeg/standard"
+)
+
+// targetTestImage returns a smooth gradient with some texture so that the
+// coded size varies steadily with quality.
+func targetTestImage(width, height, components int) []byte {
+	pixels := make([]byte, width*height*components)
+	for y := 0; y < height; y++ {
+		for x := 0; x < width; x++ {
+			for c := 0; c < components; c++ {
+				v := (x*3+y*2+c*40)%256 ^ (x*y>>3)&15
+				pixels[(y*width+x)*components+c] = byte(v)
+			}
+		}
+	}
+	return pixels
+}
+
+func TestEncodeToSize(t *testing.T) {
+	tests := []struct {
+		name        string
+		components  int
+		subsampling Subsampling
+	}{
+		{"grayscale", 1, Subsampling444},
+		{"rgb 4:4:4", 3, Subsampling444},
+		{"rgb 4:2:0", 3, Subsampling420},
+	}
+	const width, height = 200, 152
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			pixels := targetTestImage(width, height, tt.components)
+			opts := EncodeOptions{Subsampling: tt.subsampling}
+			full, err := EncodeWithOptions(pixels, width, height, tt.components, 95, opts)
+			if err != nil {
+				t.Fatalf("EncodeWithOptions failed: %v", err)
+			}
+			for _, fraction := range []float64{0.7, 0.4, 0.2} {
+				target := int(float64(len(full)) * fraction)
+				data, quality, err := EncodeToSize(pixels, width, height, tt.components, target, opts)
+				if err != nil {
+					t.Fatalf("EncodeToSize(%d) failed: %v", target, err)
+				}
+				t.Logf("target %d: quality %d, %d bytes", target, quality, len(data))
+				if len(data) > target {
+					t.Fatalf("target %d: output %d bytes exceeds target", target, len(data))
+				}
+				direct, err := EncodeWithOptions(pixels, width, height, tt.components, quality, opts)
+				if err != nil {
+					t.Fatalf("EncodeWithOptions(%d) failed: %v", quality, err)
+				}
+				if len(direct) != len(data) {
+					t.Fatalf("quality %d: target encode %d bytes, direct encode %d", quality, len(data), len(direct))
+				}
+				if quality < 100 {
+					better, err := EncodeWithOptions(pixels, width, height, tt.components, quality+1, opts)
+					if err != nil {
+						t.Fatalf("EncodeWithOptions(%d) failed: %v", quality+1, err)
+					}
+					if len(better) <= target {
+						t.Errorf("target %d: quality %d also fits (%d bytes), chose %d", target, quality+1, len(better), quality)
+					}
+				}
+			}
+		})
+	}
+}
+
+func TestEncodeToSizeUnreachable(t *testing.T) {
+	pixels := targetTestImage(64, 64, 1)
+	data, quality, err := EncodeToSize(pixels, 64, 64, 1, 100, EncodeOptions{})
+	if err != nil {
+		t.Fatalf("EncodeToSize failed: %v", err)
+	}
+	if quality != 1 || len(data) == 0 {
+		t.Fatalf("unreachable target: quality %d, %d bytes; want quality 1", quality, len(data))
+	}
+	if _, _, err := EncodeToSize(pixels, 64, 64, 1, 0, EncodeOptions{}); err == nil {
+		t.Fatalf("zero target should fail")
+	}
+	if _, _, err := EncodeToSize(pixels, 64, 64, 2, 1000, EncodeOptions{}); err != standard.ErrInvalidComponents {
+		t.Fatalf("invalid components: got %v", err)
+	}
+}
@@ -4,6 +4,7 @@ package extended
 import (
 	"fmt"
 
+	"github.com/cocosip/go-dicom-codecs/codec/limits"
 	"github.com/cocosip/go-dicom/pkg/dicom/transfer"
 	"github.com/cocosip/go-dicom/pkg/imaging/codec"
 	"github.com/cocosip/go-dicom/pkg/imaging/imagetypes"
@@ -90,6 +91,9 @@ func (c *Codec) Encode(oldPixelData imagetypes.PixelData, newPixelData imagetype
 					extendedParams.BitDepth = bdInt
 				}
 			}
+			if v, ok := parameters.GetParameter("targetSize").(int); ok {
+				extendedParams.TargetSize = v
+			}
 		}
 	} else {
 		// Use codec defaults
@@ -112,6 +116,7 @@ func (c *Codec) Encode(oldPixelData imagetypes.PixelData, newPixelData imagetype
 	}
 
 	quality := extendedParams.Quality
+	minQuality := 100
 
 	// Process all frames
 	frameCount := oldPixelData.FrameCount()
@@ -129,7 +134,14 @@ func (c *Codec) Encode(oldPixelData imagetypes.PixelData, newPixelData imagetype
 		}
 
 		// Encode
-		encoded, err := Encode(frameData, width, height, components, bitDepth, quality)
+		var encoded []byte
+		if extendedParams.TargetSize > 0 {
+			var frameQuality int
+			encoded, frameQuality, err = EncodeToSize(frameData, width, height, components, bitDepth, extendedParams.TargetSize)
+			minQuality = min(minQuality, frameQuality)
+		} else {
+			encoded, err = Encode(frameData, width, height, components, bitDepth, quality)
+		}
 		if err != nil {
 			return fmt.Errorf("JPEG Extended encode failed for frame %d: %w", frameIndex, err)
 		}
@@ -140,14 +152,20 @@ func (c *Codec) Encode(oldPixelData imagetypes.PixelData, newPixelData imagetype
 		}
 	}
 
+	// In target-size mode report the lowest quality chosen for any frame.
+	if extendedParams.TargetSize > 0 && parameters != nil {
+		parameters.SetParameter("quality", minQuality)
+	}
+
 	return nil
 }
 
 // Decode decodes JPEG Extended data
-func (c *Codec) Decode(oldPixelData imagetypes.PixelData, newPixelData imagetypes.PixelData, _ codec.Parameters) error {
+func (c *Codec) Decode(oldPixelData imagetypes.PixelData, newPixelData imagetypes.PixelData, parameters codec.Parameters) error {
 	if oldPixelData == nil || newPixelData == nil {
 		return fmt.Errorf("source and destination PixelData cannot be nil")
 	}
+	decodeLimits := limits.FromParameters(parameters)
 
 	// Process all frames
 	frameCount := oldPixelData.FrameCount()
@@ -165,7 +183,7 @@ func (c *Codec) Decode(oldPixelData imagetypes.PixelData, newPixelData imagetype
 		}
 
 		// Decode
-		decoded, _, _, _, _, err := Decode(frameData)
+		decoded, _, _, _, _, err := DecodeWithLimits(frameData, decodeLimits)
 		if err != nil {
 			return fmt.Errorf("JPEG Extended decode failed for frame %d: %w", frameIndex, err)
 		}
@@ -1,10 +1,32 @@
 package extended
 
+import (
+	"bytes"
+	"image/jpeg"
+
+	"github.com/cocosip/go-dicom-codecs/codec/limits"
+)
+
 // Decode decodes JPEG Extended (SOF1) data
 func Decode(jpegData []byte) (pixelData []byte, width, height, components, bitDepth int, err error) {
+	return DecodeWithLimits(jpegData, limits.DecodeLimits{})
+}
+
+// DecodeWithLimits decodes JPEG Extended data after checking the frame
+// declared by its SOF header against l.
+func DecodeWithLimits(jpegData []byte, l limits.DecodeLimits) (pixelData []byte, width, height, components, bitDepth int, err error) {
 	if detectBitDepth(jpegData) == sequential12Precision {
-		return decodeSequential12(jpegData)
+		return decodeSequential12(jpegData, l)
 	}
 
+	cfg, err := jpeg.DecodeConfig(bytes.NewReader(jpegData))
+	if err != nil {
+		return nil, 0, 0, 0, 0, err
+	}
+	// Go's decoder keeps a full-resolution plane per component next to the
+	// interleaved output.
+	if err := l.CheckFrame(cfg.Width, cfg.Height, 3, int64(cfg.Width)*int64(cfg.Height)*6); err != nil {
+		return nil, 0, 0, 0, 0, err
+	}
 	return DecodeSimple(jpegData)
 }
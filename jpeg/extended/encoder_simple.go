@@ -5,6 +5,7 @@ import (
 	"image"
 	"image/jpeg"
 
+	"github.com/cocosip/go-dicom-codecs/codec/limits"
 	"github.com/cocosip/go-dicom-codecs/jpeg/baseline"
 	"github.com/cocosip/go-dicom-codecs/jpeg/standard"
 )
@@ -34,7 +35,7 @@ func EncodeSimple(pixelData []byte, width, height, components, bitDepth, quality
 // native Sequential DCT implementation; 8-bit frames use Go's JPEG decoder.
 func DecodeSimple(jpegData []byte) (pixelData []byte, width, height, components, bitDepth int, err error) {
 	if detectBitDepth(jpegData) == sequential12Precision {
-		return decodeSequential12(jpegData)
+		return decodeSequential12(jpegData, limits.DecodeLimits{})
 	}
 
 	imageData, err := jpeg.Decode(bytes.NewReader(jpegData))
@@ -25,6 +25,11 @@ type JPEGExtendedParameters struct {
 	// from JPEG Baseline which only supports 8-bit.
 	BitDepth int
 
+	// TargetSize, when > 0, selects per frame the highest quality whose
+	// encoded frame fits in this many bytes (see EncodeToSize); Quality is
+	// then ignored.
+	TargetSize int
+
 	// internal storage for compatibility with generic parameter interface
 	params map[string]interface{}
 }
@@ -45,6 +50,8 @@ func (p *JPEGExtendedParameters) GetParameter(name string) interface{} {
 		return p.Quality
 	case "bitDepth":
 		return p.BitDepth
+	case "targetSize":
+		return p.TargetSize
 	default:
 		// Check custom parameters
 		return p.params[name]
@@ -62,6 +69,10 @@ func (p *JPEGExtendedParameters) SetParameter(name string, value interface{}) {
 		if v, ok := value.(int); ok {
 			p.BitDepth = v
 		}
+	case "targetSize":
+		if v, ok := value.(int); ok {
+			p.TargetSize = v
+		}
 	default:
 		// Store as custom parameter
 		p.params[name] = value
@@ -80,6 +91,10 @@ func (p *JPEGExtendedParameters) Validate() error {
 		p.BitDepth = 12 // Reset to default
 	}
 
+	if p.TargetSize < 0 {
+		p.TargetSize = 0
+	}
+
 	return nil
 }
 
@@ -94,3 +109,10 @@ func (p *JPEGExtendedParameters) WithBitDepth(bitDepth int) *JPEGExtendedParamet
 	p.BitDepth = bitDepth
 	return p
 }
+
+// WithTargetSize sets the per-frame target size in bytes and returns the
+// parameters for chaining
+func (p *JPEGExtendedParameters) WithTargetSize(size int) *JPEGExtendedParameters {
+	p.TargetSize = size
+	return p
+}
@@ -5,7 +5,9 @@ import (
 	"fmt"
 	"io"
 	"math"
+	"sync"
 
+	"github.com/cocosip/go-dicom-codecs/codec/limits"
 	"github.com/cocosip/go-dicom-codecs/jpeg/standard"
 )
 
@@ -208,6 +210,18 @@ func (e *sequential12Encoder) encodeBlock(encoder *standard.HuffmanEncoder, bloc
 }
 
 func (e *sequential12Encoder) quantizeBlock(blockX, blockY int) [64]int32 {
+	transformed := e.transformBlock(blockX, blockY)
+
+	var result [64]int32
+	for i, coefficient := range transformed {
+		result[i] = sequential12Quantize(coefficient, e.qtable[i]<<3)
+	}
+	return result
+}
+
+// transformBlock returns the level-shifted forward DCT of a block, keeping
+// libjpeg's factor-of-eight scale.
+func (e *sequential12Encoder) transformBlock(blockX, blockY int) [64]int32 {
 	var transformed [64]int32
 	for y := 0; y < 8; y++ {
 		sourceY := min(blockY*8+y, e.height-1)
@@ -219,12 +233,7 @@ func (e *sequential12Encoder) quantizeBlock(blockX, blockY int) [64]int32 {
 		}
 	}
 	sequential12DCTISlow(&transformed)
-
-	var result [64]int32
-	for i, coefficient := range transformed {
-		result[i] = sequential12Quantize(coefficient, e.qtable[i]<<3)
-	}
-	return result
+	return transformed
 }
 
 func sequential12Quantize(coefficient, divisor int32) int32 {
@@ -384,7 +393,7 @@ func sequential12WriteMagnitude(encoder *standard.HuffmanEncoder, value, categor
 	return encoder.WriteBits(uint32(bits), category)
 }
 
-func decodeSequential12(jpegData []byte) ([]byte, int, int, int, int, error) {
+func decodeSequential12(jpegData []byte, l limits.DecodeLimits) ([]byte, int, int, int, int, error) {
 	reader := standard.NewReader(bytes.NewReader(jpegData))
 	marker, err := reader.ReadMarker()
 	if err != nil {
@@ -394,7 +403,10 @@ func decodeSequential12(jpegData []byte) ([]byte, int, int, int, int, error) {
 		return nil, 0, 0, 0, 0, standard.ErrInvalidSOI
 	}
 
-	decoder := &sequential12Decoder{}
+	decoder := sequential12Decoders.Get().(*sequential12Decoder)
+	defer sequential12Decoders.Put(decoder)
+	decoder.reset()
+	decoder.limits = l
 	for {
 		marker, err = reader.ReadMarker()
 		if err != nil {
@@ -435,11 +447,32 @@ func decodeSequential12(jpegData []byte) ([]byte, int, int, int, int, error) {
 
 type sequential12Decoder struct {
 	width, height int
-	qtable        [4][64]int32
+	qtable        [4]*standard.QuantTable
 	dcTable       *standard.HuffmanTable
 	acTable       *standard.HuffmanTable
 	pixels        []byte
 	dcPredictor   int
+	limits        limits.DecodeLimits
+
+	// Storage that reset leaves allocated.
+	tableStore [2]standard.HuffmanTable // DC and AC
+	quantStore [4]standard.QuantTable
+	scan       bytes.Buffer
+}
+
+// sequential12Decoders holds decoders whose Huffman tables and scan buffer
+// are reused by the frames of a multi-frame image.
+var sequential12Decoders = sync.Pool{New: func() any { return &sequential12Decoder{} }}
+
+// reset clears the codestream state of d, keeping its scratch. The pixel
+// buffer is the decoder's output and is never reused.
+func (d *sequential12Decoder) reset() {
+	d.width, d.height = 0, 0
+	d.qtable = [4]*standard.QuantTable{}
+	d.dcTable, d.acTable = nil, nil
+	d.pixels = nil
+	d.dcPredictor = 0
+	d.scan.Reset()
 }
 
 func (d *sequential12Decoder) parseSOF1(reader *standard.Reader) error {
@@ -455,6 +488,9 @@ func (d *sequential12Decoder) parseSOF1(reader *standard.Reader) error {
 	if d.width <= 0 || d.height <= 0 {
 		return standard.ErrInvalidDimensions
 	}
+	if err := d.limits.CheckFrame(d.width, d.height, 1, int64(d.width)*int64(d.height)*2); err != nil {
+		return err
+	}
 	d.pixels = make([]byte, d.width*d.height*2)
 	return nil
 }
@@ -483,13 +519,8 @@ func (d *sequential12Decoder) parseDQT(reader *standard.Reader) error {
 		if offset+bytesPerValue > len(data) {
 			return standard.ErrInvalidDQT
 		}
-		for i := 0; i < 64; i++ {
-			if bytesPerValue == 64 {
-				d.qtable[tableID][standard.ZigZag[i]] = int32(data[offset+i])
-			} else {
-				d.qtable[tableID][standard.ZigZag[i]] = int32(data[offset+i*2])<<8 | int32(data[offset+i*2+1])
-			}
-		}
+		d.quantStore[tableID].Set(precisionAndID>>4, data[offset:offset+bytesPerValue])
+		d.qtable[tableID] = &d.quantStore[tableID]
 		offset += bytesPerValue
 	}
 	return nil
@@ -509,21 +540,21 @@ func (d *sequential12Decoder) parseDHT(reader *standard.Reader) error {
 		if classAndID&0x0f != 0 || classAndID>>4 > 1 {
 			return standard.ErrInvalidDHT
 		}
-		table := &standard.HuffmanTable{}
+		var bits [16]int
 		count := 0
 		for i := 0; i < 16; i++ {
-			table.Bits[i] = int(data[offset+i])
-			count += table.Bits[i]
+			bits[i] = int(data[offset+i])
+			count += bits[i]
 		}
 		offset += 16
 		if offset+count > len(data) {
 			return standard.ErrInvalidDHT
 		}
-		table.Values = append([]byte(nil), data[offset:offset+count]...)
-		offset += count
-		if err := table.Build(); err != nil {
+		table := &d.tableStore[classAndID>>4]
+		if err := table.Set(bits, data[offset:offset+count]); err != nil {
 			return err
 		}
+		offset += count
 		if classAndID>>4 == 0 {
 			d.dcTable = table
 		} else {
@@ -544,11 +575,15 @@ func (d *sequential12Decoder) parseSOS(reader *standard.Reader) error {
 	if d.dcTable == nil || d.acTable == nil {
 		return standard.ErrInvalidDHT
 	}
+	if d.qtable[0] == nil {
+		return standard.ErrInvalidDQT
+	}
 	return nil
 }
 
 func (d *sequential12Decoder) decodeScan(reader *standard.Reader) error {
-	var scan bytes.Buffer
+	scan := &d.scan
+	scan.Reset()
 	for {
 		value, err := reader.ReadByte()
 		if err == io.EOF {
@@ -598,7 +633,8 @@ func (d *sequential12Decoder) decodeBlock(decoder *standard.HuffmanDecoder, bloc
 	}
 	d.dcPredictor += difference
 	var coefficients [64]float64
-	coefficients[0] = float64(d.dcPredictor * int(d.qtable[0][0]))
+	qtable := &d.qtable[0].Values
+	coefficients[0] = float64(d.dcPredictor * int(qtable[0]))
 
 	for k := 1; k < 64; {
 		symbol, err := decoder.Decode(d.acTable)
@@ -621,7 +657,7 @@ func (d *sequential12Decoder) decodeBlock(decoder *standard.HuffmanDecoder, bloc
 		if err != nil {
 			return err
 		}
-		coefficients[standard.ZigZag[k]] = float64(value * int(d.qtable[0][standard.ZigZag[k]]))
+		coefficients[standard.ZigZag[k]] = float64(value * int(qtable[standard.ZigZag[k]]))
 		k++
 	}
 
@@ -0,0 +1,58 @@
+package extended
+
+import (
+	"fmt"
+
+	"github.com/cocosip/go-dicom-codecs/jpeg/baseline"
+	"github.com/cocosip/go-dicom-codecs/jpeg/standard"
+)
+
+// sequential12Overhead is the size of every 12-bit segment except DHT and
+// the scan data: SOI, JFIF APP0, DQT, SOF1, the SOS header and EOI.
+const sequential12Overhead = 2 + 18 + (4 + 65) + (4 + 9) + (4 + 6) + 2
+
+// EncodeToSize encodes pixelData at the highest quality whose output fits in
+// targetBytes and returns the stream together with that quality.
+//
+// As in baseline.EncodeToSize, the forward DCT runs once and candidate
+// qualities are sized by re-quantizing the cached coefficients; only the
+// chosen quality (and a corrected retry if it overshoots) is fully encoded.
+// Eight-bit input is delegated to the Baseline encoder.
+func EncodeToSize(pixelData []byte, width, height, components, bitDepth, targetBytes int) ([]byte, int, error) {
+	if targetBytes <= 0 {
+		return nil, 0, fmt.Errorf("invalid target size: %d", targetBytes)
+	}
+	if bitDepth != sequential12Precision {
+		if bitDepth != 8 {
+			return nil, 0, standard.ErrInvalidPrecision
+		}
+		return baseline.EncodeToSize(pixelData, width, height, components, targetBytes, baseline.EncodeOptions{})
+	}
+	if width <= 0 || height <= 0 {
+		return nil, 0, standard.ErrInvalidDimensions
+	}
+	if components != 1 {
+		return nil, 0, fmt.Errorf("12-bit JPEG Extended supports only one monochrome component")
+	}
+	if len(pixelData) < width*height*2 {
+		return nil, 0, standard.ErrBufferTooSmall
+	}
+
+	encoder := sequential12Encoder{width: width, height: height, pixels: pixelData}
+	blocksWide, blocksHigh := standard.DivCeil(width, 8), standard.DivCeil(height, 8)
+	cache := standard.NewCoefficientCache(blocksWide * blocksHigh)
+	for blockY := 0; blockY < blocksHigh; blockY++ {
+		for blockX := 0; blockX < blocksWide; blockX++ {
+			coefficients := encoder.transformBlock(blockX, blockY)
+			cache.Add(&coefficients, 0, 0)
+		}
+	}
+
+	estimate := func(quality int) int {
+		qtables := [2][64]int32{standard.ScaleQuantTable(standard.DefaultLuminanceQuantTable, quality)}
+		return sequential12Overhead + cache.EstimateSize(&qtables)
+	}
+	return standard.FitQuality(targetBytes, estimate, func(quality int) ([]byte, error) {
+		return encodeSequential12(pixelData, width, height, components, quality)
+	})
+}
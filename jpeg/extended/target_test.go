@@ -0,0 +1,40 @@
+package extended
+
+import "testing"
+
+func TestEncodeToSize12Bit(t *testing.T) {
+	const width, height = 160, 128
+	pixels := make([]byte, width*height*2)
+	for y := 0; y < height; y++ {
+		for x := 0; x < width; x++ {
+			v := (x*23+y*17)%4096 ^ (x*y)&63
+			pixels[(y*width+x)*2] = byte(v)
+			pixels[(y*width+x)*2+1] = byte(v >> 8)
+		}
+	}
+	full, err := Encode(pixels, width, height, 1, 12, 95)
+	if err != nil {
+		t.Fatalf("Encode failed: %v", err)
+	}
+	for _, fraction := range []float64{0.6, 0.3} {
+		target := int(float64(len(full)) * fraction)
+		data, quality, err := EncodeToSize(pixels, width, height, 1, 12, target)
+		if err != nil {
+			t.Fatalf("EncodeToSize(%d) failed: %v", target, err)
+		}
+		t.Logf("target %d: quality %d, %d bytes", target, quality, len(data))
+		if len(data) > target {
+			t.Fatalf("target %d: output %d bytes exceeds target", target, len(data))
+		}
+		better, err := Encode(pixels, width, height, 1, 12, quality+1)
+		if err != nil {
+			t.Fatalf("Encode(%d) failed: %v", quality+1, err)
+		}
+		if len(better) <= target {
+			t.Errorf("target %d: quality %d also fits (%d bytes), chose %d", target, quality+1, len(better), quality)
+		}
+		if _, _, _, _, bits, err := Decode(data); err != nil || bits != 12 {
+			t.Fatalf("decode of target-size stream: bits %d, err %v", bits, err)
+		}
+	}
+}
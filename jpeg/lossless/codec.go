@@ -4,6 +4,9 @@ package lossless
 import (
 	"fmt"
 
+	"github.com/cocosip/go-dicom-codecs/codec/layout"
+	"github.com/cocosip/go-dicom-codecs/codec/limits"
+	"github.com/cocosip/go-dicom-codecs/codec/voi"
 	"github.com/cocosip/go-dicom/pkg/dicom/transfer"
 	"github.com/cocosip/go-dicom/pkg/imaging/codec"
 	"github.com/cocosip/go-dicom/pkg/imaging/imagetypes"
@@ -111,8 +114,13 @@ func (c *Codec) Encode(oldPixelData imagetypes.PixelData, newPixelData imagetype
 		// The predictor works with raw byte values regardless of pixel representation.
 		// DO NOT shift pixel data for lossless JPEG encoding.
 
-		// Encode using the lossless encoder
-		jpegData, err := Encode(
+		// Encode using the lossless encoder, which reads planar frames plane
+		// by plane
+		encode := Encode
+		if frameInfo.PlanarConfiguration == 1 {
+			encode = EncodePlanar
+		}
+		jpegData, err := encode(
 			frameData, // No adjustment needed
 			int(frameInfo.Width),
 			int(frameInfo.Height),
@@ -134,7 +142,7 @@ func (c *Codec) Encode(oldPixelData imagetypes.PixelData, newPixelData imagetype
 }
 
 // Decode decodes JPEG Lossless data to uncompressed pixel data
-func (c *Codec) Decode(oldPixelData imagetypes.PixelData, newPixelData imagetypes.PixelData, _ codec.Parameters) error {
+func (c *Codec) Decode(oldPixelData imagetypes.PixelData, newPixelData imagetypes.PixelData, parameters codec.Parameters) error {
 	if oldPixelData == nil || newPixelData == nil {
 		return fmt.Errorf("source and destination PixelData cannot be nil")
 	}
@@ -150,6 +158,12 @@ func (c *Codec) Decode(oldPixelData imagetypes.PixelData, newPixelData imagetype
 	if frameCount == 0 {
 		return fmt.Errorf("source pixel data is empty (no frames)")
 	}
+	renderer, err := voi.RendererFromParameters(parameters, int(frameInfo.BitsStored), frameInfo.PixelRepresentation == 1)
+	if err != nil {
+		return err
+	}
+	decoder := NewDecoder()
+	decoder.SetLimits(limits.FromParameters(parameters))
 	for frameIndex := 0; frameIndex < frameCount; frameIndex++ {
 		// Get encoded frame data
 		frameData, err := oldPixelData.GetFrame(frameIndex)
@@ -162,7 +176,7 @@ func (c *Codec) Decode(oldPixelData imagetypes.PixelData, newPixelData imagetype
 		}
 
 		// Decode using the lossless decoder
-		pixelData, width, height, components, _, err := Decode(frameData)
+		pixelData, width, height, components, _, err := decoder.DecodeRendered(frameData, renderer)
 		if err != nil {
 			return fmt.Errorf("JPEG Lossless decode failed for frame %d: %w", frameIndex, err)
 		}
@@ -187,6 +201,9 @@ func (c *Codec) Decode(oldPixelData imagetypes.PixelData, newPixelData imagetype
 		}
 	}
 
+	if renderer != nil {
+		layout.ReportRendered(parameters)
+	}
 	return nil
 }
 
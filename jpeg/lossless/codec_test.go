@@ -1,9 +1,12 @@
 package lossless
 
 import (
+	"bytes"
 	"testing"
 
 	codecHelpers "github.com/cocosip/go-dicom-codecs/codec"
+	"github.com/cocosip/go-dicom-codecs/codec/layout"
+	"github.com/cocosip/go-dicom-codecs/codec/voi"
 	"github.com/cocosip/go-dicom/pkg/dicom/transfer"
 	"github.com/cocosip/go-dicom/pkg/imaging/codec"
 	"github.com/cocosip/go-dicom/pkg/imaging/imagetypes"
@@ -220,6 +223,61 @@ func TestLosslessCodecRGB(t *testing.T) {
 	}
 }
 
+// TestLosslessCodecPlanar checks that planar frames (PlanarConfiguration=1)
+// encode and decode to the same samples, interleaved.
+func TestLosslessCodecPlanar(t *testing.T) {
+	const (
+		width  = 17
+		height = 13
+	)
+
+	for _, bits := range []int{8, 12} {
+		sampleBytes := (bits + 7) / 8
+		planeSize := width * height
+		planar := make([]byte, planeSize*3*sampleBytes)
+		want := make([]byte, len(planar))
+		for comp := 0; comp < 3; comp++ {
+			for i := 0; i < planeSize; i++ {
+				v := (i*(comp+3) + comp*40) % (1 << bits)
+				for b := 0; b < sampleBytes; b++ {
+					planar[(comp*planeSize+i)*sampleBytes+b] = byte(v >> (8 * b))
+					want[(i*3+comp)*sampleBytes+b] = byte(v >> (8 * b))
+				}
+			}
+		}
+		frameInfo := &imagetypes.FrameInfo{
+			Width:                     width,
+			Height:                    height,
+			BitsAllocated:             uint16(sampleBytes * 8),
+			BitsStored:                uint16(bits),
+			HighBit:                   uint16(bits - 1),
+			SamplesPerPixel:           3,
+			PlanarConfiguration:       1,
+			PhotometricInterpretation: photometricRGB,
+		}
+		src := codecHelpers.NewTestPixelData(frameInfo)
+		if err := src.AddFrame(planar); err != nil {
+			t.Fatalf("AddFrame failed: %v", err)
+		}
+		c := NewLosslessCodec(4)
+		encoded := codecHelpers.NewTestPixelData(frameInfo)
+		if err := c.Encode(src, encoded, nil); err != nil {
+			t.Fatalf("%d-bit: Encode failed: %v", bits, err)
+		}
+		decoded := codecHelpers.NewTestPixelData(frameInfo)
+		if err := c.Decode(encoded, decoded, nil); err != nil {
+			t.Fatalf("%d-bit: Decode failed: %v", bits, err)
+		}
+		got, err := decoded.GetFrame(0)
+		if err != nil {
+			t.Fatalf("GetFrame failed: %v", err)
+		}
+		if !bytes.Equal(got, want) {
+			t.Errorf("%d-bit: decoded planar frame differs from the source samples", bits)
+		}
+	}
+}
+
 func TestLosslessCodecWithParameters(t *testing.T) {
 	// Create test data
 	width, height := 64, 64
@@ -360,3 +418,64 @@ func TestCodecRegistry(t *testing.T) {
 
 	t.Logf("Registry codec test passed")
 }
+
+// TestCodecDecodeRendered checks that voi render options produce one display
+// byte per sample from a 12-bit frame.
+func TestCodecDecodeRendered(t *testing.T) {
+	width, height := 24, 16
+	values := make([]int, width*height)
+	pixelData := make([]byte, width*height*2)
+	for i := range values {
+		values[i] = (i%width)*150 + (i/width)*40
+		pixelData[i*2] = byte(values[i])
+		pixelData[i*2+1] = byte(values[i] >> 8)
+	}
+	frameInfo := &imagetypes.FrameInfo{
+		Width:                     uint16(width),
+		Height:                    uint16(height),
+		BitsAllocated:             16,
+		BitsStored:                12,
+		HighBit:                   11,
+		SamplesPerPixel:           1,
+		PhotometricInterpretation: photometricMonochrome2,
+	}
+	src := codecHelpers.NewTestPixelData(frameInfo)
+	if err := src.AddFrame(pixelData); err != nil {
+		t.Fatalf("AddFrame failed: %v", err)
+	}
+	c := NewLosslessCodec(1)
+	encoded := codecHelpers.NewTestPixelData(frameInfo)
+	if err := c.Encode(src, encoded, nil); err != nil {
+		t.Fatalf("Encode failed: %v", err)
+	}
+
+	opts := voi.Options{RescaleIntercept: -1024, WindowCenter: 600, WindowWidth: 2000, Function: voi.FunctionSigmoid}
+	params := codec.NewBaseParameters()
+	params.SetParameter(voi.ParameterName, opts)
+	decoded := codecHelpers.NewTestPixelData(frameInfo)
+	if err := c.Decode(encoded, decoded, params); err != nil {
+		t.Fatalf("Decode failed: %v", err)
+	}
+	if params.GetParameter(layout.BitsAllocatedParameter) != 8 || params.GetParameter(layout.BitsStoredParameter) != 8 ||
+		params.GetParameter(layout.HighBitParameter) != 7 || params.GetParameter(layout.PixelRepresentationParameter) != 0 {
+		t.Errorf("reported sample format %v/%v/%v/%v, want 8/8/7/0",
+			params.GetParameter(layout.BitsAllocatedParameter), params.GetParameter(layout.BitsStoredParameter),
+			params.GetParameter(layout.HighBitParameter), params.GetParameter(layout.PixelRepresentationParameter))
+	}
+	rendered, err := decoded.GetFrame(0)
+	if err != nil {
+		t.Fatalf("GetFrame failed: %v", err)
+	}
+	r, err := voi.NewRenderer(opts, 12, false)
+	if err != nil {
+		t.Fatalf("NewRenderer failed: %v", err)
+	}
+	if len(rendered) != len(values) {
+		t.Fatalf("rendered length = %d, want %d", len(rendered), len(values))
+	}
+	for i, v := range values {
+		if want := r.Map(int32(v)); rendered[i] != want {
+			t.Fatalf("pixel %d (%d): got %d, want %d", i, v, rendered[i], want)
+		}
+	}
+}
@@ -3,7 +3,10 @@ package lossless
 import (
 	"bytes"
 	"fmt"
+	"sync"
 
+	"github.com/cocosip/go-dicom-codecs/codec/limits"
+	"github.com/cocosip/go-dicom-codecs/codec/voi"
 	"github.com/cocosip/go-dicom-codecs/jpeg/standard"
 )
 
@@ -17,14 +20,72 @@ type Decoder struct {
 
 	dcTables         [2]*standard.HuffmanTable
 	dcTableSelectors [3]int
+
+	renderer *voi.Renderer // optional display rendering of the output
+	limits   limits.DecodeLimits
+
+	// Reused by the next codestream.
+	tableStore [2]standard.HuffmanTable
+	samples    [3][]int
+	scanData   bytes.Buffer
+}
+
+// NewDecoder creates a JPEG Lossless decoder. A decoder may be reused for any
+// number of codestreams; each decode starts with a Reset.
+func NewDecoder() *Decoder {
+	return &Decoder{}
 }
 
+// SetLimits sets the limits the frame declared by SOF must satisfy before
+// the sample buffers are allocated. The zero value applies the defaults.
+func (d *Decoder) SetLimits(l limits.DecodeLimits) {
+	d.limits = l
+}
+
+// Reset clears the codestream state of d while keeping its Huffman tables,
+// sample buffers and scan buffer for the next decode.
+func (d *Decoder) Reset() {
+	d.width, d.height, d.components = 0, 0, 0
+	d.precision, d.predictor = 0, 0
+	d.dcTables = [2]*standard.HuffmanTable{}
+	d.dcTableSelectors = [3]int{}
+	d.renderer = nil
+	d.scanData.Reset()
+}
+
+// decoderPool keeps decoders whose table storage and sample planes a later
+// codestream can reuse.
+var decoderPool = sync.Pool{New: func() any { return NewDecoder() }}
+
 // Decode decodes JPEG Lossless data
 func Decode(jpegData []byte) (pixelData []byte, width, height, components, bitDepth int, err error) {
+	return DecodeRendered(jpegData, nil)
+}
+
+// DecodeRendered decodes JPEG Lossless data and maps every sample through
+// renderer, returning one 8-bit display value per sample instead of the
+// stored representation. The returned bit depth is that of the codestream.
+func DecodeRendered(jpegData []byte, renderer *voi.Renderer) (pixelData []byte, width, height, components, bitDepth int, err error) {
+	decoder := decoderPool.Get().(*Decoder)
+	defer decoderPool.Put(decoder)
+	return decoder.DecodeRendered(jpegData, renderer)
+}
+
+// Decode resets d and decodes one codestream. The returned pixel data is
+// newly allocated and not retained by d.
+func (d *Decoder) Decode(jpegData []byte) (pixelData []byte, width, height, components, bitDepth int, err error) {
+	return d.DecodeRendered(jpegData, nil)
+}
+
+// DecodeRendered is Decode with display rendering, as the package-level
+// DecodeRendered.
+func (d *Decoder) DecodeRendered(jpegData []byte, renderer *voi.Renderer) (pixelData []byte, width, height, components, bitDepth int, err error) {
 	r := bytes.NewReader(jpegData)
 	reader := standard.NewReader(r)
 
-	decoder := &Decoder{}
+	d.Reset()
+	d.renderer = renderer
+	defer func() { d.renderer = nil }()
 
 	// Read SOI marker
 	marker, err := reader.ReadMarker()
@@ -44,30 +105,30 @@ func Decode(jpegData []byte) (pixelData []byte, width, height, components, bitDe
 
 		switch marker {
 		case standard.MarkerSOF3:
-			if err := decoder.parseSOF3(reader); err != nil {
+			if err := d.parseSOF3(reader); err != nil {
 				return nil, 0, 0, 0, 0, err
 			}
 
 		case standard.MarkerDHT:
-			if err := decoder.parseDHT(reader); err != nil {
+			if err := d.parseDHT(reader); err != nil {
 				return nil, 0, 0, 0, 0, err
 			}
 
 		case standard.MarkerSOS:
-			if err := decoder.parseSOS(reader); err != nil {
+			if err := d.parseSOS(reader); err != nil {
 				return nil, 0, 0, 0, 0, err
 			}
 
 			// Decode scan data
-			samples, err := decoder.decodeScan(reader)
+			samples, err := d.decodeScan(reader)
 			if err != nil {
 				return nil, 0, 0, 0, 0, err
 			}
 
 			// Convert samples to pixel data
-			pixelData = decoder.samplesToPixels(samples)
+			pixelData = d.samplesToPixels(samples)
 
-			return pixelData, decoder.width, decoder.height, decoder.components, decoder.precision, nil
+			return pixelData, d.width, d.height, d.components, d.precision, nil
 
 		case standard.MarkerEOI:
 			return nil, 0, 0, 0, 0, fmt.Errorf("unexpected EOI before scan data")
@@ -112,6 +173,12 @@ func (d *Decoder) parseSOF3(reader *standard.Reader) error {
 		return standard.ErrInvalidComponents
 	}
 
+	// Samples are decoded into one int per sample before packing.
+	samples := int64(d.width) * int64(d.height) * int64(d.components)
+	if err := d.limits.CheckFrame(d.width, d.height, d.components, samples*(8+2)); err != nil {
+		return err
+	}
+
 	return nil
 }
 
@@ -154,17 +221,15 @@ func (d *Decoder) parseDHT(reader *standard.Reader) error {
 		if offset+totalSymbols > len(data) {
 			return standard.ErrInvalidDHT
 		}
-		values := make([]byte, totalSymbols)
-		copy(values, data[offset:offset+totalSymbols])
+		values := data[offset : offset+totalSymbols]
 		offset += totalSymbols
 
-		// Build Huffman table
-		var bitsArray [16]int
-		copy(bitsArray[:], bits[:])
-		table := standard.BuildStandardHuffmanTable(bitsArray, values)
-
 		if tc == 0 {
-			// DC table (used for lossless)
+			// DC table (used for lossless), built in the slot's reusable storage
+			table := &d.tableStore[th]
+			if err := table.Set(bits, values); err != nil {
+				return err
+			}
 			d.dcTables[th] = table
 		}
 	}
@@ -210,7 +275,8 @@ func (d *Decoder) parseSOS(reader *standard.Reader) error {
 func (d *Decoder) decodeScan(reader *standard.Reader) ([][]int, error) {
 	// Read scan data until we hit a marker or EOF
 	// NOTE: Do NOT process byte stuffing here - HuffmanDecoder handles it
-	var scanData bytes.Buffer
+	scanData := &d.scanData
+	scanData.Reset()
 	for {
 		b, err := reader.ReadByte()
 		if err != nil {
@@ -244,10 +310,14 @@ func (d *Decoder) decodeScan(reader *standard.Reader) ([][]int, error) {
 
 	huffDec := standard.NewHuffmanDecoder(bytes.NewReader(scanData.Bytes()))
 
-	// Allocate sample arrays
-	samples := make([][]int, d.components)
+	// Reuse the sample arrays of a previous codestream when large enough
+	samples := d.samples[:d.components]
 	for i := range samples {
-		samples[i] = make([]int, d.width*d.height)
+		if cap(samples[i]) < d.width*d.height {
+			samples[i] = make([]int, d.width*d.height)
+		}
+		samples[i] = samples[i][:d.width*d.height]
+		clear(samples[i])
 	}
 
 	// Decode pixel by pixel, interleaved
@@ -338,6 +408,17 @@ func (d *Decoder) decodeScan(reader *standard.Reader) ([][]int, error) {
 
 // samplesToPixels converts sample arrays to byte array
 func (d *Decoder) samplesToPixels(samples [][]int) []byte {
+	if d.renderer != nil {
+		// Display output: one byte per sample through the VOI renderer
+		pixelData := make([]byte, d.width*d.height*d.components)
+		for p := 0; p < d.width*d.height; p++ {
+			for i := 0; i < d.components; i++ {
+				pixelData[p*d.components+i] = d.renderer.MapStored(samples[i][p])
+			}
+		}
+		return pixelData
+	}
+
 	bytesPerSample := (d.precision + 7) / 8
 	pixelData := make([]byte, d.width*d.height*d.components*bytesPerSample)
 
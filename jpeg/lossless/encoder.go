@@ -2,6 +2,7 @@ package lossless
 
 import (
 	"bytes"
+	"sync"
 
 	"github.com/cocosip/go-dicom-codecs/jpeg/standard"
 )
@@ -16,12 +17,66 @@ type Encoder struct {
 
 	dcTables [2]*standard.HuffmanTable
 	dcCodes  [2][]standard.HuffmanCode
+
+	// Sample, code and output storage; Reset leaves it allocated.
+	sampleStore []int
+	samples     [][]int // per-component views of sampleStore
+	codeStore   [256]standard.HuffmanCode
+	scanBuf     bytes.Buffer
+	out         bytes.Buffer
+}
+
+// NewEncoder creates a JPEG Lossless encoder. An encoder may be reused for
+// any number of frames; each Encode starts with a Reset.
+func NewEncoder() *Encoder {
+	return &Encoder{}
 }
 
+// Reset clears the frame state of enc while keeping its sample buffer,
+// Huffman code storage and output buffers for the next Encode.
+func (enc *Encoder) Reset() {
+	enc.width, enc.height, enc.components = 0, 0, 0
+	enc.precision, enc.predictor = 0, 0
+	enc.dcTables = [2]*standard.HuffmanTable{}
+	enc.dcCodes = [2][]standard.HuffmanCode{}
+	enc.scanBuf.Reset()
+	enc.out.Reset()
+}
+
+// encoderPool keeps encoders along with their sample planes and Huffman
+// code storage.
+var encoderPool = sync.Pool{New: func() any { return NewEncoder() }}
+
 // Encode encodes pixel data to JPEG Lossless format
 // predictor: 0 for auto-select, 1-7 for specific predictor
 // bitDepth: 2-16 bits per sample
 func Encode(pixelData []byte, width, height, components, bitDepth, predictor int) ([]byte, error) {
+	enc := encoderPool.Get().(*Encoder)
+	defer encoderPool.Put(enc)
+	return enc.Encode(pixelData, width, height, components, bitDepth, predictor)
+}
+
+// EncodePlanar is Encode for pixel data holding one plane per component
+// (DICOM PlanarConfiguration=1).
+func EncodePlanar(pixelData []byte, width, height, components, bitDepth, predictor int) ([]byte, error) {
+	enc := encoderPool.Get().(*Encoder)
+	defer encoderPool.Put(enc)
+	return enc.EncodePlanar(pixelData, width, height, components, bitDepth, predictor)
+}
+
+// Encode resets enc and encodes one frame as the package-level Encode. The
+// returned stream is newly allocated and not retained by enc.
+func (enc *Encoder) Encode(pixelData []byte, width, height, components, bitDepth, predictor int) ([]byte, error) {
+	return enc.encode(pixelData, width, height, components, bitDepth, predictor, false)
+}
+
+// EncodePlanar is Encode for planar pixel data, as the package-level
+// EncodePlanar.
+func (enc *Encoder) EncodePlanar(pixelData []byte, width, height, components, bitDepth, predictor int) ([]byte, error) {
+	return enc.encode(pixelData, width, height, components, bitDepth, predictor, true)
+}
+
+func (enc *Encoder) encode(pixelData []byte, width, height, components, bitDepth, predictor int, planar bool) ([]byte, error) {
 	if width <= 0 || height <= 0 {
 		return nil, standard.ErrInvalidDimensions
 	}
@@ -44,25 +99,23 @@ func Encode(pixelData []byte, width, height, components, bitDepth, predictor int
 		return nil, standard.ErrBufferTooSmall
 	}
 
-	enc := &Encoder{
-		width:      width,
-		height:     height,
-		components: components,
-		precision:  bitDepth,
-		predictor:  predictor,
-	}
+	enc.Reset()
+	enc.width = width
+	enc.height = height
+	enc.components = components
+	enc.precision = bitDepth
+	enc.predictor = predictor
+
+	samples := enc.pixelsToSamples(pixelData, planar)
 
 	// Auto-select best predictor if predictor == 0
 	if enc.predictor == 0 {
-		samples := enc.pixelsToSamples(pixelData)
 		enc.predictor = SelectBestPredictor(samples, width, height)
 	}
 
-	samples := enc.pixelsToSamples(pixelData)
 	enc.optimizeHuffmanTables(samples)
 
-	var buf bytes.Buffer
-	writer := standard.NewWriter(&buf)
+	writer := standard.NewWriter(&enc.out)
 
 	// Write SOI
 	if err := writer.WriteMarker(standard.MarkerSOI); err != nil {
@@ -92,7 +145,7 @@ func Encode(pixelData []byte, width, height, components, bitDepth, predictor int
 		return nil, err
 	}
 
-	return buf.Bytes(), nil
+	return bytes.Clone(enc.out.Bytes()), nil
 }
 
 func (enc *Encoder) optimizeHuffmanTables(samples [][]int) {
@@ -128,7 +181,7 @@ func (enc *Encoder) optimizeHuffmanTables(samples [][]int) {
 	}
 
 	enc.dcTables[0] = standard.BuildOptimalHuffmanTable(frequencies)
-	enc.dcCodes[0] = standard.BuildHuffmanCodes(enc.dcTables[0])
+	enc.dcCodes[0] = standard.BuildHuffmanCodesInto(enc.codeStore[:], enc.dcTables[0])
 }
 
 // writeSOF3 writes Start of Frame (Lossless)
@@ -217,8 +270,9 @@ func (enc *Encoder) writeSOS(writer *standard.Writer, samples [][]int) error {
 
 // encodeScan encodes the scan data
 func (enc *Encoder) encodeScan(writer *standard.Writer, samples [][]int) error {
-	var scanBuf bytes.Buffer
-	huffEnc := standard.NewHuffmanEncoder(&scanBuf)
+	scanBuf := &enc.scanBuf
+	scanBuf.Reset()
+	huffEnc := standard.NewHuffmanEncoder(scanBuf)
 
 	// Encode line by line, interleaved
 	for row := 0; row < enc.height; row++ {
@@ -294,11 +348,33 @@ func losslessDifference(sample, predicted int) int {
 	return sample - predicted
 }
 
-// pixelsToSamples converts byte array to sample arrays
-func (enc *Encoder) pixelsToSamples(pixelData []byte) [][]int {
-	samples := make([][]int, enc.components)
-	for i := range samples {
-		samples[i] = make([]int, enc.width*enc.height)
+// pixelsToSamples converts byte array to sample arrays, reading interleaved
+// samples or, when planar, one plane per component
+func (enc *Encoder) pixelsToSamples(pixelData []byte, planar bool) [][]int {
+	// Every sample is written below, so reused storage needs no clearing.
+	n := enc.width * enc.height
+	if cap(enc.sampleStore) < n*enc.components {
+		enc.sampleStore = make([]int, n*enc.components)
+	}
+	samples := enc.samples[:0]
+	for i := 0; i < enc.components; i++ {
+		samples = append(samples, enc.sampleStore[i*n:(i+1)*n])
+	}
+	enc.samples = samples
+
+	if planar {
+		sampleBytes := (enc.precision + 7) / 8
+		for i := 0; i < enc.components; i++ {
+			plane := pixelData[i*n*sampleBytes:]
+			for j := 0; j < n; j++ {
+				val := int(plane[j*sampleBytes])
+				if sampleBytes == 2 {
+					val |= int(plane[j*2+1]) << 8
+				}
+				samples[i][j] = val
+			}
+		}
+		return samples
 	}
 
 	if enc.precision <= 8 {
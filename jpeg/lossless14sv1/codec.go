@@ -4,6 +4,9 @@ package lossless14sv1
 import (
 	"fmt"
 
+	"github.com/cocosip/go-dicom-codecs/codec/layout"
+	"github.com/cocosip/go-dicom-codecs/codec/limits"
+	"github.com/cocosip/go-dicom-codecs/codec/voi"
 	"github.com/cocosip/go-dicom/pkg/dicom/transfer"
 	"github.com/cocosip/go-dicom/pkg/imaging/codec"
 	"github.com/cocosip/go-dicom/pkg/imaging/imagetypes"
@@ -72,8 +75,13 @@ func (c *LosslessSV1Codec) Encode(oldPixelData imagetypes.PixelData, newPixelDat
 		// The predictor works with raw byte values regardless of pixel representation.
 		// DO NOT shift pixel data for lossless JPEG encoding.
 
-		// Encode using the lossless SV1 encoder
-		jpegData, err := Encode(
+		// Encode using the lossless SV1 encoder, which reads planar frames plane
+		// by plane
+		encode := Encode
+		if frameInfo.PlanarConfiguration == 1 {
+			encode = EncodePlanar
+		}
+		jpegData, err := encode(
 			frameData,
 			int(frameInfo.Width),
 			int(frameInfo.Height),
@@ -94,7 +102,7 @@ func (c *LosslessSV1Codec) Encode(oldPixelData imagetypes.PixelData, newPixelDat
 }
 
 // Decode decodes JPEG Lossless SV1 data to uncompressed pixel data
-func (c *LosslessSV1Codec) Decode(oldPixelData imagetypes.PixelData, newPixelData imagetypes.PixelData, _ codec.Parameters) error {
+func (c *LosslessSV1Codec) Decode(oldPixelData imagetypes.PixelData, newPixelData imagetypes.PixelData, parameters codec.Parameters) error {
 	if oldPixelData == nil || newPixelData == nil {
 		return fmt.Errorf("source and destination PixelData cannot be nil")
 	}
@@ -110,6 +118,12 @@ func (c *LosslessSV1Codec) Decode(oldPixelData imagetypes.PixelData, newPixelDat
 	if frameCount == 0 {
 		return fmt.Errorf("source pixel data is empty (no frames)")
 	}
+	renderer, err := voi.RendererFromParameters(parameters, int(frameInfo.BitsStored), frameInfo.PixelRepresentation == 1)
+	if err != nil {
+		return err
+	}
+	decoder := NewDecoder()
+	decoder.SetLimits(limits.FromParameters(parameters))
 	for frameIndex := 0; frameIndex < frameCount; frameIndex++ {
 		// Get encoded frame data
 		frameData, err := oldPixelData.GetFrame(frameIndex)
@@ -122,7 +136,7 @@ func (c *LosslessSV1Codec) Decode(oldPixelData imagetypes.PixelData, newPixelDat
 		}
 
 		// Decode using the lossless SV1 decoder
-		pixelData, width, height, components, _, err := Decode(frameData)
+		pixelData, width, height, components, _, err := decoder.DecodeRendered(frameData, renderer)
 		if err != nil {
 			return fmt.Errorf("JPEG Lossless SV1 decode failed for frame %d: %w", frameIndex, err)
 		}
@@ -147,6 +161,9 @@ func (c *LosslessSV1Codec) Decode(oldPixelData imagetypes.PixelData, newPixelDat
 		}
 	}
 
+	if renderer != nil {
+		layout.ReportRendered(parameters)
+	}
 	return nil
 }
 
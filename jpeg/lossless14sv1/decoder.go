@@ -3,7 +3,10 @@ package lossless14sv1
 import (
 	"bytes"
 	"io"
+	"sync"
 
+	"github.com/cocosip/go-dicom-codecs/codec/limits"
+	"github.com/cocosip/go-dicom-codecs/codec/voi"
 	"github.com/cocosip/go-dicom-codecs/jpeg/standard"
 )
 
@@ -26,14 +29,71 @@ type Decoder struct {
 	precision  int // Bit depth (2-16)
 	components []*Component
 	dcTables   [4]*standard.HuffmanTable
+
+	renderer *voi.Renderer // optional display rendering of the output
+	limits   limits.DecodeLimits
+
+	// Kept from one codestream to the next.
+	tableStore [4]standard.HuffmanTable
+	compData   [3][]int
+	scanData   bytes.Buffer
+}
+
+// NewDecoder creates a JPEG Lossless SV1 decoder. A decoder may be reused for
+// any number of codestreams; each decode starts with a Reset.
+func NewDecoder() *Decoder {
+	return &Decoder{}
+}
+
+// SetLimits sets the limits the frame declared by SOF must satisfy before
+// the sample buffers are allocated. The zero value applies the defaults.
+func (d *Decoder) SetLimits(l limits.DecodeLimits) {
+	d.limits = l
+}
+
+// Reset clears the codestream state of d while keeping its Huffman tables,
+// component buffers and scan buffer for the next decode.
+func (d *Decoder) Reset() {
+	d.width, d.height, d.precision = 0, 0, 0
+	d.components = nil
+	d.dcTables = [4]*standard.HuffmanTable{}
+	d.renderer = nil
+	d.scanData.Reset()
 }
 
+// decoderPool holds SV1 decoders with their Huffman tables and component
+// arrays.
+var decoderPool = sync.Pool{New: func() any { return NewDecoder() }}
+
 // Decode decodes JPEG Lossless First-Order Prediction data
 func Decode(jpegData []byte) (pixelData []byte, width, height, components, bitDepth int, err error) {
+	return DecodeRendered(jpegData, nil)
+}
+
+// DecodeRendered decodes JPEG Lossless data and maps every sample through
+// renderer, returning one 8-bit display value per sample instead of the
+// stored representation. The returned bit depth is that of the codestream.
+func DecodeRendered(jpegData []byte, renderer *voi.Renderer) (pixelData []byte, width, height, components, bitDepth int, err error) {
+	decoder := decoderPool.Get().(*Decoder)
+	defer decoderPool.Put(decoder)
+	return decoder.DecodeRendered(jpegData, renderer)
+}
+
+// Decode resets d and decodes one codestream. The returned pixel data is
+// newly allocated and not retained by d.
+func (d *Decoder) Decode(jpegData []byte) (pixelData []byte, width, height, components, bitDepth int, err error) {
+	return d.DecodeRendered(jpegData, nil)
+}
+
+// DecodeRendered is Decode with display rendering, as the package-level
+// DecodeRendered.
+func (d *Decoder) DecodeRendered(jpegData []byte, renderer *voi.Renderer) (pixelData []byte, width, height, components, bitDepth int, err error) {
 	r := bytes.NewReader(jpegData)
 	reader := standard.NewReader(r)
 
-	decoder := &Decoder{}
+	d.Reset()
+	d.renderer = renderer
+	defer func() { d.renderer = nil }()
 
 	// Read SOI marker
 	marker, err := reader.ReadMarker()
@@ -53,31 +113,31 @@ func Decode(jpegData []byte) (pixelData []byte, width, height, components, bitDe
 
 		switch marker {
 		case standard.MarkerSOF3: // Lossless
-			if err := decoder.parseSOF3(reader); err != nil {
+			if err := d.parseSOF3(reader); err != nil {
 				return nil, 0, 0, 0, 0, err
 			}
 
 		case standard.MarkerDHT:
-			if err := decoder.parseDHT(reader); err != nil {
+			if err := d.parseDHT(reader); err != nil {
 				return nil, 0, 0, 0, 0, err
 			}
 
 		case standard.MarkerSOS:
-			if err := decoder.parseSOS(reader); err != nil {
+			if err := d.parseSOS(reader); err != nil {
 				return nil, 0, 0, 0, 0, err
 			}
 			// Decode scan data
-			if err := decoder.decodeScan(reader); err != nil {
+			if err := d.decodeScan(reader); err != nil {
 				return nil, 0, 0, 0, 0, err
 			}
 			// Convert to output format
-			pixelData = decoder.convertToPixels()
-			return pixelData, decoder.width, decoder.height, len(decoder.components), decoder.precision, nil
+			pixelData = d.convertToPixels()
+			return pixelData, d.width, d.height, len(d.components), d.precision, nil
 
 		case standard.MarkerEOI:
 			// Should not reach here normally
-			pixelData = decoder.convertToPixels()
-			return pixelData, decoder.width, decoder.height, len(decoder.components), decoder.precision, nil
+			pixelData = d.convertToPixels()
+			return pixelData, d.width, d.height, len(d.components), d.precision, nil
 
 		default:
 			// Skip unknown markers
@@ -119,6 +179,12 @@ func (d *Decoder) parseSOF3(reader *standard.Reader) error {
 		return standard.ErrInvalidComponents
 	}
 
+	// Samples are decoded into one int per sample before packing.
+	samples := int64(d.width) * int64(d.height) * int64(numComponents)
+	if err := d.limits.CheckFrame(d.width, d.height, numComponents, samples*(8+2)); err != nil {
+		return err
+	}
+
 	if len(data) < 6+numComponents*3 {
 		return standard.ErrInvalidSOF
 	}
@@ -134,8 +200,12 @@ func (d *Decoder) parseSOF3(reader *standard.Reader) error {
 			V:      int(data[offset+1] & 0x0F),
 			width:  d.width,
 			height: d.height,
-			data:   make([]int, d.width*d.height),
 		}
+		if cap(d.compData[i]) < d.width*d.height {
+			d.compData[i] = make([]int, d.width*d.height)
+		}
+		comp.data = d.compData[i][:d.width*d.height]
+		clear(comp.data)
 
 		// For lossless, sampling factors should be 1x1
 		if comp.H != 1 || comp.V != 1 {
@@ -172,14 +242,14 @@ func (d *Decoder) parseDHT(reader *standard.Reader) error {
 		offset++
 
 		// Read the number of codes for each length
-		table := &standard.HuffmanTable{}
+		var bits [16]int
 		totalCodes := 0
 		for i := 0; i < 16; i++ {
 			if offset >= len(data) {
 				return standard.ErrInvalidDHT
 			}
-			table.Bits[i] = int(data[offset])
-			totalCodes += table.Bits[i]
+			bits[i] = int(data[offset])
+			totalCodes += bits[i]
 			offset++
 		}
 
@@ -187,17 +257,16 @@ func (d *Decoder) parseDHT(reader *standard.Reader) error {
 		if offset+totalCodes > len(data) {
 			return standard.ErrInvalidDHT
 		}
-		table.Values = make([]byte, totalCodes)
-		copy(table.Values, data[offset:offset+totalCodes])
+		values := data[offset : offset+totalCodes]
 		offset += totalCodes
 
-		// Build the table
-		if err := table.Build(); err != nil {
-			return err
-		}
-
 		// For lossless, we only use DC tables
 		if tc == 0 {
+			// Build the table in the slot's reusable storage
+			table := &d.tableStore[th]
+			if err := table.Set(bits, values); err != nil {
+				return err
+			}
 			d.dcTables[th] = table
 		}
 	}
@@ -257,7 +326,8 @@ func (d *Decoder) decodeScan(reader *standard.Reader) error {
 	modulus := 1 << uint(d.precision)
 
 	// Collect scan data
-	var scanData bytes.Buffer
+	scanData := &d.scanData
+	scanData.Reset()
 	for {
 		b, err := reader.ReadByte()
 		if err == io.EOF {
@@ -355,6 +425,17 @@ func (d *Decoder) decodeScan(reader *standard.Reader) error {
 // convertToPixels converts component data to byte array
 func (d *Decoder) convertToPixels() []byte {
 	numComponents := len(d.components)
+	if d.renderer != nil {
+		// Display output: one byte per sample through the VOI renderer
+		pixelData := make([]byte, d.width*d.height*numComponents)
+		for p := 0; p < d.width*d.height; p++ {
+			for i, comp := range d.components {
+				pixelData[p*numComponents+i] = d.renderer.MapStored(comp.data[p])
+			}
+		}
+		return pixelData
+	}
+
 	bytesPerSample := (d.precision + 7) / 8
 	pixelData := make([]byte, d.width*d.height*numComponents*bytesPerSample)
 
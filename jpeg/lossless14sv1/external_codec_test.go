@@ -1,6 +1,7 @@
 package lossless14sv1
 
 import (
+	"bytes"
 	"testing"
 
 	codecHelpers "github.com/cocosip/go-dicom-codecs/codec"
@@ -214,6 +215,61 @@ func TestLosslessSV1CodecRGB(t *testing.T) {
 	}
 }
 
+// TestLosslessSV1CodecPlanar checks that planar frames (PlanarConfiguration=1)
+// encode and decode to the same samples, interleaved.
+func TestLosslessSV1CodecPlanar(t *testing.T) {
+	const (
+		width  = 17
+		height = 13
+	)
+
+	for _, bits := range []int{8, 12} {
+		sampleBytes := (bits + 7) / 8
+		planeSize := width * height
+		planar := make([]byte, planeSize*3*sampleBytes)
+		want := make([]byte, len(planar))
+		for comp := 0; comp < 3; comp++ {
+			for i := 0; i < planeSize; i++ {
+				v := (i*(comp+3) + comp*40) % (1 << bits)
+				for b := 0; b < sampleBytes; b++ {
+					planar[(comp*planeSize+i)*sampleBytes+b] = byte(v >> (8 * b))
+					want[(i*3+comp)*sampleBytes+b] = byte(v >> (8 * b))
+				}
+			}
+		}
+		frameInfo := &imagetypes.FrameInfo{
+			Width:                     width,
+			Height:                    height,
+			BitsAllocated:             uint16(sampleBytes * 8),
+			BitsStored:                uint16(bits),
+			HighBit:                   uint16(bits - 1),
+			SamplesPerPixel:           3,
+			PlanarConfiguration:       1,
+			PhotometricInterpretation: photometricRGB,
+		}
+		src := codecHelpers.NewTestPixelData(frameInfo)
+		if err := src.AddFrame(planar); err != nil {
+			t.Fatalf("AddFrame failed: %v", err)
+		}
+		c := NewLosslessSV1Codec()
+		encoded := codecHelpers.NewTestPixelData(frameInfo)
+		if err := c.Encode(src, encoded, nil); err != nil {
+			t.Fatalf("%d-bit: Encode failed: %v", bits, err)
+		}
+		decoded := codecHelpers.NewTestPixelData(frameInfo)
+		if err := c.Decode(encoded, decoded, nil); err != nil {
+			t.Fatalf("%d-bit: Decode failed: %v", bits, err)
+		}
+		got, err := decoded.GetFrame(0)
+		if err != nil {
+			t.Fatalf("GetFrame failed: %v", err)
+		}
+		if !bytes.Equal(got, want) {
+			t.Errorf("%d-bit: decoded planar frame differs from the source samples", bits)
+		}
+	}
+}
+
 func TestLosslessSV1CodecRegistry(t *testing.T) {
 	// Register codec
 	RegisterLosslessSV1Codec()
@@ -1,6 +1,9 @@
 package standard
 
-import "io"
+import (
+	"bytes"
+	"io"
+)
 
 // HuffmanTable represents a Huffman coding table
 type HuffmanTable struct {
@@ -14,6 +17,7 @@ type HuffmanTable struct {
 	valPtr  [16]int32
 	// Lookup table for fast decoding of short codes
 	lookupTable [256]int16 // value: (nbits << 8) | value, -1 if not found
+	built       bool       // the lookup tables match Bits and Values
 }
 
 // Build builds lookup tables for fast Huffman decoding
@@ -51,15 +55,31 @@ func (h *HuffmanTable) Build() error {
 		code <<= 1
 	}
 
+	h.built = true
 	return nil
 }
 
+// Set replaces the code counts and values of h and rebuilds its lookup
+// tables, reusing the storage of the previous values so a decoder can keep
+// one table per slot across codestreams. Multi-frame objects repeat the same
+// DHT in every frame, so a definition equal to the one h was built from keeps
+// the existing lookup tables.
+func (h *HuffmanTable) Set(bits [16]int, values []byte) error {
+	if h.built && h.Bits == bits && bytes.Equal(h.Values, values) {
+		return nil
+	}
+	h.Bits = bits
+	h.Values = append(h.Values[:0], values...)
+	return h.Build()
+}
+
 // HuffmanDecoder decodes Huffman-encoded data
 type HuffmanDecoder struct {
 	r       io.Reader
-	bits    uint32 // Bit buffer
-	nBits   int    // Number of bits in buffer
-	readErr error  // Read error, if any
+	bits    uint32  // Bit buffer
+	nBits   int     // Number of bits in buffer
+	readErr error   // Read error, if any
+	buf     [1]byte // read scratch; a local array would escape through io.ReadFull
 }
 
 // NewHuffmanDecoder creates a new Huffman decoder
@@ -74,29 +94,28 @@ func (d *HuffmanDecoder) ReadBit() (bool, error) {
 	}
 
 	if d.nBits == 0 {
-		var b [1]byte
-		_, err := io.ReadFull(d.r, b[:])
+		_, err := io.ReadFull(d.r, d.buf[:])
 		if err != nil {
 			d.readErr = err
 			return false, err
 		}
+		b := d.buf[0]
 
 		// Handle byte stuffing (0xFF followed by 0x00)
-		if b[0] == 0xFF {
-			var b2 [1]byte
-			_, err := io.ReadFull(d.r, b2[:])
+		if b == 0xFF {
+			_, err := io.ReadFull(d.r, d.buf[:])
 			if err != nil {
 				d.readErr = err
 				return false, err
 			}
-			if b2[0] != 0x00 {
+			if d.buf[0] != 0x00 {
 				// Found a marker, this is an error in the middle of scan data
 				d.readErr = ErrInvalidData
 				return false, ErrInvalidData
 			}
 		}
 
-		d.bits = uint32(b[0])
+		d.bits = uint32(b)
 		d.nBits = 8
 	}
 
@@ -116,28 +135,27 @@ func (d *HuffmanDecoder) ReadBits(n int) (uint32, error) {
 			return 0, d.readErr
 		}
 
-		var b [1]byte
-		_, err := io.ReadFull(d.r, b[:])
+		_, err := io.ReadFull(d.r, d.buf[:])
 		if err != nil {
 			d.readErr = err
 			return 0, err
 		}
+		b := d.buf[0]
 
 		// Handle byte stuffing
-		if b[0] == 0xFF {
-			var b2 [1]byte
-			_, err := io.ReadFull(d.r, b2[:])
+		if b == 0xFF {
+			_, err := io.ReadFull(d.r, d.buf[:])
 			if err != nil {
 				d.readErr = err
 				return 0, err
 			}
-			if b2[0] != 0x00 {
+			if d.buf[0] != 0x00 {
 				d.readErr = ErrInvalidData
 				return 0, ErrInvalidData
 			}
 		}
 
-		d.bits = (d.bits << 8) | uint32(b[0])
+		d.bits = (d.bits << 8) | uint32(b)
 		d.nBits += 8
 	}
 
@@ -171,7 +189,10 @@ func (d *HuffmanDecoder) Decode(table *HuffmanTable) (byte, error) {
 			return 0, err
 		}
 
-		code = (code << 1) | map[bool]uint32{false: 0, true: 1}[bit]
+		code <<= 1
+		if bit {
+			code |= 1
+		}
 
 		if int32(code) <= table.maxCode[l] && table.maxCode[l] >= 0 {
 			idx := table.valPtr[l] + int32(code) - table.minCode[l]
@@ -5,8 +5,9 @@ import "io"
 // HuffmanEncoder encodes data using Huffman coding
 type HuffmanEncoder struct {
 	w     io.Writer
-	bits  uint32 // Bit buffer
-	nBits int    // Number of bits in buffer
+	bits  uint32  // Bit buffer
+	nBits int     // Number of bits in buffer
+	out   [2]byte // byte and stuffing written by writeByte; a field so it does not escape per call
 }
 
 // NewHuffmanEncoder creates a new Huffman encoder
@@ -36,18 +37,14 @@ func (e *HuffmanEncoder) WriteBits(bits uint32, n int) error {
 
 // writeByte writes a byte with byte stuffing
 func (e *HuffmanEncoder) writeByte(b byte) error {
-	if _, err := e.w.Write([]byte{b}); err != nil {
-		return err
-	}
-
 	// Byte stuffing: if we write 0xFF, follow with 0x00
+	e.out = [2]byte{b, 0x00}
+	n := 1
 	if b == 0xFF {
-		if _, err := e.w.Write([]byte{0x00}); err != nil {
-			return err
-		}
+		n = 2
 	}
-
-	return nil
+	_, err := e.w.Write(e.out[:n])
+	return err
 }
 
 // Flush writes any remaining bits
@@ -72,7 +69,17 @@ type HuffmanCode struct {
 
 // BuildHuffmanCodes builds Huffman codes from a table
 func BuildHuffmanCodes(table *HuffmanTable) []HuffmanCode {
-	codes := make([]HuffmanCode, 256)
+	return BuildHuffmanCodesInto(nil, table)
+}
+
+// BuildHuffmanCodesInto is BuildHuffmanCodes writing into codes, which is
+// reused when it can hold 256 entries.
+func BuildHuffmanCodesInto(codes []HuffmanCode, table *HuffmanTable) []HuffmanCode {
+	if cap(codes) < 256 {
+		codes = make([]HuffmanCode, 256)
+	}
+	codes = codes[:256]
+	clear(codes)
 
 	code := uint16(0)
 	p := 0
@@ -100,3 +100,18 @@ func IDCTISlow(coef []int32, qtable [64]int32, out []byte, stride int) {
 		out[row/8*stride+4] = byte(Clamp(int(ijgDescale(tmp13-tmp0, ijgConstBits+ijgPass1Bits+3))+128, 0, 255))
 	}
 }
+
+// IDCTISlowDC writes the output of IDCTISlow for a block whose only nonzero
+// coefficient is the DC term, given its dequantized value dc. The result is
+// a flat block of (dc+4)>>3 + 128. It matches IDCTISlow for |dc| < 2^15,
+// well inside the range where IDCTISlow's fixed-point arithmetic does not
+// overflow and far beyond the DC range of 8-bit data.
+func IDCTISlowDC(dc int32, out []byte, stride int) {
+	v := byte(Clamp(int((dc+4)>>3)+128, 0, 255))
+	for y := 0; y < 8; y++ {
+		row := out[y*stride : y*stride+8]
+		for x := range row {
+			row[x] = v
+		}
+	}
+}
@@ -0,0 +1,169 @@
+package standard
+
+import "math/bits"
+
+// Quality search limits used by FitQuality.
+const (
+	minQuality        = 1
+	maxQuality        = 100
+	fitQualityEncodes = 3 // full encodes, including the first
+)
+
+// CoefficientCache holds the forward-DCT blocks of a frame in scan order so
+// the entropy-coded size can be estimated for many quantization tables
+// without repeating the transform. Coefficients keep the IJG factor-of-eight
+// scale produced by the integer DCTs in this package.
+type CoefficientCache struct {
+	blocks    []cachedBlock
+	numTables int
+}
+
+type cachedBlock struct {
+	coef      [64]int32
+	table     uint8 // quantization and Huffman table index
+	predictor uint8 // DC predictor (component) index
+}
+
+// NewCoefficientCache returns an empty cache with room for blocks entries.
+func NewCoefficientCache(blocks int) *CoefficientCache {
+	return &CoefficientCache{blocks: make([]cachedBlock, 0, blocks)}
+}
+
+// Add appends a transformed block coded with table (0 or 1) whose DC is
+// predicted from the previous block of the same component.
+func (c *CoefficientCache) Add(coef *[64]int32, table, component int) {
+	c.blocks = append(c.blocks, cachedBlock{coef: *coef, table: uint8(table), predictor: uint8(component)})
+	c.numTables = max(c.numTables, table+1)
+}
+
+// EstimateSize returns the size in bytes of the DHT segments and the scan
+// data the cached blocks produce when quantized with qtables and coded with
+// optimal Huffman tables, as the baseline and 12-bit sequential encoders do.
+// Byte stuffing is approximated as one extra byte per 256.
+func (c *CoefficientCache) EstimateSize(qtables *[2][64]int32) int {
+	var dcFreq, acFreq [2][256]uint64
+	var magnitudeBits uint64
+	var predictors [4]int32
+	for i := range c.blocks {
+		block := &c.blocks[i]
+		q := &qtables[block.table]
+		dc := quantizeIJG(block.coef[0], q[0])
+		category := coefficientCategory(dc - predictors[block.predictor])
+		predictors[block.predictor] = dc
+		dcFreq[block.table][category]++
+		magnitudeBits += uint64(category)
+
+		ac := &acFreq[block.table]
+		run := 0
+		for k := 1; k < 64; k++ {
+			z := ZigZag[k]
+			value := quantizeIJG(block.coef[z], q[z])
+			if value == 0 {
+				run++
+				continue
+			}
+			for ; run >= 16; run -= 16 {
+				ac[0xF0]++
+			}
+			category := coefficientCategory(value)
+			ac[run<<4|category]++
+			magnitudeBits += uint64(category)
+			run = 0
+		}
+		if run > 0 {
+			ac[0]++
+		}
+	}
+
+	codeBits := magnitudeBits
+	tableBytes := 0
+	for t := 0; t < c.numTables; t++ {
+		for _, freq := range []*[256]uint64{&dcFreq[t], &acFreq[t]} {
+			table := BuildOptimalHuffmanTable(*freq)
+			codes := BuildHuffmanCodes(table)
+			for symbol, n := range freq {
+				codeBits += n * uint64(codes[symbol].Len)
+			}
+			tableBytes += 2 + 2 + 1 + 16 + len(table.Values)
+		}
+	}
+	scanBytes := int((codeBits + 7) / 8)
+	return tableBytes + scanBytes + scanBytes/256
+}
+
+// quantizeIJG divides an IJG-scaled coefficient by a quantizer step with
+// rounding to nearest, matching the encoders' quantization.
+func quantizeIJG(coefficient, step int32) int32 {
+	divisor := step * 8
+	if coefficient < 0 {
+		return -((-coefficient + divisor/2) / divisor)
+	}
+	return (coefficient + divisor/2) / divisor
+}
+
+func coefficientCategory(value int32) int {
+	if value < 0 {
+		value = -value
+	}
+	return bits.Len32(uint32(value))
+}
+
+// FitQuality returns the encoding at the highest quality (1-100) whose size
+// fits targetBytes, together with that quality.
+//
+// estimate predicts the encoded size for a quality (typically from a
+// CoefficientCache) and is searched by bisection; encode produces the real
+// codestream. When an encode overshoots, the estimate is rescaled by the
+// observed error and the search repeats below the failed quality, using at
+// most three full encodes. If nothing fits, the quality 1 encoding (or the
+// last one tried) is returned.
+func FitQuality(targetBytes int, estimate func(quality int) int, encode func(quality int) ([]byte, error)) ([]byte, int, error) {
+	sizes := map[int]int{}
+	cached := func(quality int) int {
+		size, ok := sizes[quality]
+		if !ok {
+			size = estimate(quality)
+			sizes[quality] = size
+		}
+		return size
+	}
+	scale := 1.0
+	hi := maxQuality
+	var data []byte
+	quality := 0
+	for encodes := 0; encodes < fitQualityEncodes && hi >= minQuality; encodes++ {
+		quality = highestFittingQuality(hi, func(q int) bool {
+			return float64(cached(q))*scale <= float64(targetBytes)
+		})
+		var err error
+		if data, err = encode(quality); err != nil {
+			return nil, 0, err
+		}
+		if len(data) <= targetBytes || quality == minQuality {
+			break
+		}
+		if predicted := cached(quality); predicted > 0 {
+			scale = float64(len(data)) / float64(predicted)
+		}
+		hi = quality - 1
+	}
+	return data, quality, nil
+}
+
+// highestFittingQuality bisects [1, hi] for the highest quality that fits,
+// assuming size grows with quality; it returns 1 when none fits.
+func highestFittingQuality(hi int, fits func(quality int) bool) int {
+	lo := minQuality
+	if fits(hi) {
+		return hi
+	}
+	for hi-lo > 1 {
+		mid := (lo + hi) / 2
+		if fits(mid) {
+			lo = mid
+		} else {
+			hi = mid
+		}
+	}
+	return lo
+}
@@ -0,0 +1,116 @@
+package standard
+
+import (
+	"bytes"
+	"encoding/binary"
+	"testing"
+
+	"github.com/cocosip/go-dicom-codecs/internal/replay"
+)
+
+// huffmanReplay is one recorded baseline scan; see cmd/replay-record.
+type huffmanReplay struct {
+	blocks   int
+	checksum int64
+	dc, ac   HuffmanTable
+	scan     []byte
+}
+
+func loadHuffmanReplay(tb testing.TB) []huffmanReplay {
+	tb.Helper()
+	records, err := replay.Read("testdata/replay/huffman.gz")
+	if err != nil {
+		tb.Fatalf("load corpus: %v", err)
+	}
+	scans := make([]huffmanReplay, len(records))
+	for i, r := range records {
+		s := &scans[i]
+		s.blocks, s.checksum = int(r.Params[0]), r.Params[1]
+		data := r.Data
+		for _, table := range []*HuffmanTable{&s.dc, &s.ac} {
+			n := int(binary.BigEndian.Uint16(data))
+			def := data[2 : 2+n]
+			var counts [16]int
+			for j := range counts {
+				counts[j] = int(def[j])
+			}
+			if err := table.Set(counts, def[16:]); err != nil {
+				tb.Fatalf("record %d: %v", i, err)
+			}
+			data = data[2+n:]
+		}
+		s.scan = data
+	}
+	return scans
+}
+
+// decodeScan Huffman-decodes every block of s, appending the symbols and
+// magnitude bits to values when it is non-nil.
+func (s *huffmanReplay) decodeScan(values []int32) ([]int32, error) {
+	dec := NewHuffmanDecoder(bytes.NewReader(s.scan))
+	for b := 0; b < s.blocks; b++ {
+		size, err := dec.Decode(&s.dc)
+		if err != nil {
+			return nil, err
+		}
+		bits, err := dec.ReadBits(int(size))
+		if err != nil {
+			return nil, err
+		}
+		if values != nil {
+			values = append(values, int32(size), int32(bits))
+		}
+		for k := 1; k < 64; {
+			rs, err := dec.Decode(&s.ac)
+			if err != nil {
+				return nil, err
+			}
+			if rs == 0x00 {
+				break
+			}
+			bits, err := dec.ReadBits(int(rs & 0x0F))
+			if err != nil {
+				return nil, err
+			}
+			if values != nil {
+				values = append(values, int32(rs), int32(bits))
+			}
+			k += int(rs>>4) + 1
+		}
+	}
+	return values, nil
+}
+
+func TestReplayCorpus(t *testing.T) {
+	scans := loadHuffmanReplay(t)
+	for i := range scans {
+		values, err := scans[i].decodeScan([]int32{})
+		if err != nil {
+			t.Fatalf("scan %d: %v", i, err)
+		}
+		if replay.Checksum(values) != scans[i].checksum {
+			t.Fatalf("scan %d: decoded symbols differ from the recording", i)
+		}
+	}
+}
+
+// BenchmarkReplayHuffmanDecoder decodes the symbols of baseline scans
+// recorded from a real 8-bit image, without dequantization or IDCT;
+// throughput is in scan bytes.
+func BenchmarkReplayHuffmanDecoder(b *testing.B) {
+	scans := loadHuffmanReplay(b)
+	total := 0
+	for _, s := range scans {
+		total += len(s.scan)
+	}
+	b.SetBytes(int64(total))
+	b.ReportAllocs()
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		for j := range scans {
+			if _, err := scans[j].decodeScan(nil); err != nil {
+				b.Fatal(err)
+			}
+		}
+	}
+}
@@ -1,5 +1,7 @@
 package standard
 
+import "bytes"
+
 // Standard JPEG quantization tables
 
 // DefaultLuminanceQuantTable is the standard luminance quantization table
@@ -55,6 +57,34 @@ func ScaleQuantTable(baseTable [64]int32, quality int) [64]int32 {
 	return result
 }
 
+// QuantTable is a dequantization table in natural (row-major) order, as
+// declared by one DQT entry.
+type QuantTable struct {
+	Values [64]int32
+	raw    []byte // precision and zig-zag values Values was built from
+}
+
+// Set loads the table from the 64 (precision 0) or 128 (precision 1) bytes
+// of a DQT entry in zig-zag order. Like HuffmanTable.Set it keeps Values
+// when the entry repeats the one the table was loaded from, so a decoder
+// holding one table per slot skips the conversion for every frame after the
+// first of a multi-frame object.
+func (q *QuantTable) Set(precision byte, data []byte) {
+	if len(q.raw) == len(data)+1 && q.raw[0] == precision && bytes.Equal(q.raw[1:], data) {
+		return
+	}
+	q.raw = append(append(q.raw[:0], precision), data...)
+	if precision == 0 {
+		for i := 0; i < 64; i++ {
+			q.Values[ZigZag[i]] = int32(data[i])
+		}
+		return
+	}
+	for i := 0; i < 64; i++ {
+		q.Values[ZigZag[i]] = int32(data[i*2])<<8 | int32(data[i*2+1])
+	}
+}
+
 // Standard Huffman tables for baseline JPEG
 
 // StandardDCLuminanceBits contains the number of codes for each length (DC luminance)
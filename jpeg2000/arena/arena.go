@@ -0,0 +1,100 @@
+// Package arena provides the scratch allocator used while decoding a JPEG
+// 2000 codestream.
+//
+// A decode carves its transient buffers (code-block data, subband
+// coefficient planes, IDWT samples and float planes) from one Arena instead
+// of allocating each with make, and releases them all at once with Reset
+// when a tile has been copied into the image. Arenas are meant to be pooled:
+// the slabs survive Reset, so decoding a series of frames reuses them rather
+// than handing hundreds of megabytes of short-lived slices to the garbage
+// collector per frame.
+package arena
+
+// Arena is a bump allocator with one slab per element type. Slices returned
+// by an Arena are zeroed and valid until the next Reset. When a slab is
+// exhausted the request falls back to make, and the slab is grown to the
+// high-water mark on the next Reset, so a pooled Arena settles at the size
+// its decodes need. A nil *Arena allocates every request with make.
+type Arena struct {
+	int32s   slab[int32]
+	float32s slab[float32]
+	bytes    slab[byte]
+}
+
+type slab[T any] struct {
+	buf  []T
+	used int
+	want int // capacity requested by Reserve or reached by the last cycle
+}
+
+func (s *slab[T]) alloc(n int) []T {
+	if s.buf == nil && s.want > 0 {
+		s.buf = make([]T, s.want)
+	}
+	if s.used+n > len(s.buf) {
+		s.want = max(s.want, s.used+n)
+		s.used += n
+		return make([]T, n)
+	}
+	out := s.buf[s.used : s.used+n : s.used+n]
+	s.used += n
+	return out
+}
+
+func (s *slab[T]) reset() {
+	if s.want > len(s.buf) {
+		// Grow lazily on the next alloc so an idle pooled arena holds no
+		// oversized slab.
+		s.buf = nil
+	} else {
+		clear(s.buf[:min(s.used, len(s.buf))])
+	}
+	s.used = 0
+}
+
+// Reserve makes sure the next cycle can carve at least the given number of
+// elements of each type without falling back to make. Decoders call it with
+// sizes derived from the codestream headers.
+func (a *Arena) Reserve(int32s, float32s, bytes int) {
+	if a == nil {
+		return
+	}
+	a.int32s.want = max(a.int32s.want, int32s)
+	a.float32s.want = max(a.float32s.want, float32s)
+	a.bytes.want = max(a.bytes.want, bytes)
+}
+
+// Int32s returns a zeroed []int32 of length n.
+func (a *Arena) Int32s(n int) []int32 {
+	if a == nil {
+		return make([]int32, n)
+	}
+	return a.int32s.alloc(n)
+}
+
+// Float32s returns a zeroed []float32 of length n.
+func (a *Arena) Float32s(n int) []float32 {
+	if a == nil {
+		return make([]float32, n)
+	}
+	return a.float32s.alloc(n)
+}
+
+// Bytes returns a zeroed []byte of length n.
+func (a *Arena) Bytes(n int) []byte {
+	if a == nil {
+		return make([]byte, n)
+	}
+	return a.bytes.alloc(n)
+}
+
+// Reset releases every slice carved since the previous Reset. Callers must
+// not use them afterwards.
+func (a *Arena) Reset() {
+	if a == nil {
+		return
+	}
+	a.int32s.reset()
+	a.float32s.reset()
+	a.bytes.reset()
+}
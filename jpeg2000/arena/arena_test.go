@@ -0,0 +1,64 @@
+package arena
+
+import "testing"
+
+func TestArenaCarvesZeroedSlices(t *testing.T) {
+	var a Arena
+	a.Reserve(16, 8, 4)
+	x := a.Int32s(10)
+	y := a.Int32s(6)
+	for i := range x {
+		x[i] = int32(i + 1)
+	}
+	for _, v := range y {
+		if v != 0 {
+			t.Fatalf("second slice not zeroed")
+		}
+	}
+	if cap(x) != len(x) {
+		t.Fatalf("cap %d, want %d so appends do not overwrite neighbours", cap(x), len(x))
+	}
+	if got := a.Float32s(8); len(got) != 8 {
+		t.Fatalf("Float32s length %d", len(got))
+	}
+	if got := a.Bytes(4); len(got) != 4 {
+		t.Fatalf("Bytes length %d", len(got))
+	}
+
+	a.Reset()
+	x = a.Int32s(10)
+	for _, v := range x {
+		if v != 0 {
+			t.Fatalf("slice carved after Reset not zeroed")
+		}
+	}
+}
+
+func TestArenaGrowsToHighWaterMark(t *testing.T) {
+	var a Arena
+	a.Reserve(8, 0, 0)
+	a.Int32s(8)
+	overflow := a.Int32s(100) // exceeds the slab, served by make
+	if len(overflow) != 100 {
+		t.Fatalf("overflow length %d", len(overflow))
+	}
+	a.Reset()
+
+	allocs := testing.AllocsPerRun(10, func() {
+		a.Int32s(8)
+		a.Int32s(100)
+		a.Reset()
+	})
+	if allocs != 0 {
+		t.Fatalf("%v allocations per cycle after growing, want 0", allocs)
+	}
+}
+
+func TestNilArenaAllocates(t *testing.T) {
+	var a *Arena
+	a.Reserve(1, 1, 1)
+	if len(a.Int32s(3)) != 3 || len(a.Float32s(3)) != 3 || len(a.Bytes(3)) != 3 {
+		t.Fatalf("nil arena returned wrong lengths")
+	}
+	a.Reset()
+}
@@ -0,0 +1,52 @@
+package jpeg2000
+
+import (
+	"bytes"
+	"testing"
+)
+
+// TestDecodeArenaReuse decodes codestreams of different geometry in turn so
+// that each decode reuses arenas, and slabs, left by the previous one.
+func TestDecodeArenaReuse(t *testing.T) {
+	tests := []struct {
+		name                string
+		width, height, comp int
+		tileSize            int
+		lossless            bool
+	}{
+		{"gray lossless", 120, 90, 1, 0, true},
+		{"rgb lossless tiled", 96, 80, 3, 32, true},
+		{"gray lossy tiled", 128, 96, 1, 64, false},
+	}
+	encoded := make([][]byte, len(tests))
+	want := make([][]byte, len(tests))
+	for i, tt := range tests {
+		pixels := streamTestImage(tt.width, tt.height, tt.comp)
+		params := DefaultEncodeParams(tt.width, tt.height, tt.comp, 8, false)
+		params.TileWidth, params.TileHeight = tt.tileSize, tt.tileSize
+		params.Lossless = tt.lossless
+		var err error
+		if encoded[i], err = NewEncoder(params).Encode(pixels); err != nil {
+			t.Fatalf("%s: Encode failed: %v", tt.name, err)
+		}
+		if tt.lossless {
+			want[i] = pixels
+		}
+	}
+
+	for round := 0; round < 3; round++ {
+		for i, tt := range tests {
+			decoder := NewDecoder()
+			if err := decoder.Decode(encoded[i]); err != nil {
+				t.Fatalf("%s round %d: Decode failed: %v", tt.name, round, err)
+			}
+			got := decoder.GetPixelData()
+			if want[i] == nil {
+				want[i] = bytes.Clone(got)
+			}
+			if !bytes.Equal(got, want[i]) {
+				t.Fatalf("%s round %d: pixels differ", tt.name, round)
+			}
+		}
+	}
+}
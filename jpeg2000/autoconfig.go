@@ -0,0 +1,76 @@
+package jpeg2000
+
+import "math/bits"
+
+// EncodePreference selects what AutoConfigure optimizes for.
+type EncodePreference int
+
+const (
+	// PreferBalanced keeps the compression of the defaults.
+	PreferBalanced EncodePreference = iota
+	// PreferSpeed uses fewer decomposition levels.
+	PreferSpeed
+	// PreferRatio decomposes as deeply as the image allows.
+	PreferRatio
+)
+
+// AutoGeometryParameter is the codec parameter that enables AutoConfigure
+// for an encode request. It carries an EncodePreference, or true for
+// PreferBalanced.
+const AutoGeometryParameter = "autoGeometry"
+
+// AutoGeometryFromParameters returns the preference carried by the
+// AutoGeometryParameter codec parameter and whether it is set.
+func AutoGeometryFromParameters(parameters interface {
+	GetParameter(name string) interface{}
+}) (EncodePreference, bool) {
+	if parameters == nil {
+		return PreferBalanced, false
+	}
+	switch v := parameters.GetParameter(AutoGeometryParameter).(type) {
+	case EncodePreference:
+		return v, true
+	case int:
+		return EncodePreference(v), true
+	case bool:
+		return PreferBalanced, v
+	}
+	return PreferBalanced, false
+}
+
+// autoMinLL is the smallest lowest-resolution (LL) side worth another
+// decomposition level; below it a level only adds packets and bit-plane
+// overhead without improving compression.
+const autoMinLL = 16
+
+// AutoConfigure chooses the decomposition levels, code-block and precinct
+// sizes of p from its image width and height for pref, and codes the image
+// as a single tile. The component count and bit depth do not affect the
+// choice.
+//
+// Code-blocks are 64x64 and precincts maximal for every preference: smaller
+// blocks or precincts cost 0.5-1% in size without speeding up the block
+// coder. The number of levels is the largest that keeps the lowest
+// resolution at least 16 samples wide (32 for PreferSpeed), capped at 5
+// (6 for PreferRatio). Tiling for parallel coding is not chosen: it has only
+// been measured on one core, where it does not pay.
+func (p *EncodeParams) AutoConfigure(pref EncodePreference) {
+	p.TileWidth, p.TileHeight = 0, 0
+	p.ParallelTiles = false
+
+	side := min(p.Width, p.Height)
+	minLL, maxLevels := autoMinLL, 5
+	switch pref {
+	case PreferSpeed:
+		minLL = 2 * autoMinLL
+	case PreferRatio:
+		maxLevels = 6
+	}
+	p.NumLevels = 0
+	if side >= 2*minLL {
+		p.NumLevels = min(maxLevels, bits.Len(uint(side/minLL))-1)
+	}
+
+	p.CodeBlockWidth, p.CodeBlockHeight = 64, 64
+	p.PrecinctWidth, p.PrecinctHeight = 0, 0
+}
@@ -0,0 +1,93 @@
+package jpeg2000
+
+import (
+	"bytes"
+	"testing"
+
+	"github.com/cocosip/go-dicom-codecs/codec/sched"
+)
+
+func TestAutoConfigure(t *testing.T) {
+	tests := []struct {
+		name          string
+		width, height int
+		pref          EncodePreference
+		levels        int
+	}{
+		{"icon", 64, 64, PreferBalanced, 2},
+		{"tiny", 24, 24, PreferBalanced, 0},
+		{"mr", 256, 256, PreferBalanced, 4},
+		{"ct", 512, 512, PreferBalanced, 5},
+		{"ct speed", 512, 512, PreferSpeed, 4},
+		{"us", 640, 480, PreferRatio, 4},
+		{"radiograph", 2048, 2500, PreferBalanced, 5},
+		{"radiograph speed", 2048, 2500, PreferSpeed, 5},
+		{"radiograph ratio", 2048, 2500, PreferRatio, 6},
+	}
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			p := DefaultEncodeParams(tt.width, tt.height, 1, 12, false)
+			p.CodeBlockWidth, p.PrecinctWidth = 32, 128
+			p.TileWidth, p.TileHeight, p.ParallelTiles = 512, 512, true
+			p.AutoConfigure(tt.pref)
+			if p.TileWidth != 0 || p.TileHeight != 0 || p.ParallelTiles {
+				t.Errorf("tiles = %dx%d parallel=%v, want a single tile", p.TileWidth, p.TileHeight, p.ParallelTiles)
+			}
+			if p.NumLevels != tt.levels {
+				t.Errorf("NumLevels = %d, want %d", p.NumLevels, tt.levels)
+			}
+			if p.CodeBlockWidth != 64 || p.CodeBlockHeight != 64 || p.PrecinctWidth != 0 || p.PrecinctHeight != 0 {
+				t.Errorf("code-block %dx%d precinct %dx%d, want 64x64 and maximal precincts",
+					p.CodeBlockWidth, p.CodeBlockHeight, p.PrecinctWidth, p.PrecinctHeight)
+			}
+		})
+	}
+}
+
+// TestParallelTilesIdentical checks that coding tiles concurrently produces
+// the codestream of a sequential encode, for the per-tile path and for the
+// global rate allocation used with layers.
+func TestParallelTilesIdentical(t *testing.T) {
+	s := sched.Default()
+	limit := s.Limit()
+	s.SetLimit(4)
+	defer s.SetLimit(limit)
+
+	const width, height = 300, 260
+	pixels := make([]byte, width*height*2)
+	for i := 0; i < width*height; i++ {
+		v := (i%width)*7 + (i/width)*3 + (i*i)%61
+		pixels[2*i], pixels[2*i+1] = byte(v), byte(v>>8&0x0f)
+	}
+
+	for _, layers := range []int{1, 3} {
+		p := DefaultEncodeParams(width, height, 1, 12, false)
+		p.TileWidth, p.TileHeight = 128, 128
+		p.NumLevels = 3
+		p.NumLayers = layers
+		sequential, err := NewEncoder(p).Encode(pixels)
+		if err != nil {
+			t.Fatalf("%d layers: sequential encode: %v", layers, err)
+		}
+
+		parallel := *p
+		parallel.ParallelTiles = true
+		for round := 0; round < 3; round++ {
+			got, err := NewEncoder(&parallel).Encode(pixels)
+			if err != nil {
+				t.Fatalf("%d layers: parallel encode: %v", layers, err)
+			}
+			if !bytes.Equal(got, sequential) {
+				t.Fatalf("%d layers: parallel codestream differs from the sequential one", layers)
+			}
+		}
+
+		decoder := NewDecoder()
+		if err := decoder.Decode(sequential); err != nil {
+			t.Fatalf("%d layers: decode: %v", layers, err)
+		}
+		if !bytes.Equal(decoder.GetPixelData(), pixels) {
+			t.Fatalf("%d layers: lossless round trip differs", layers)
+		}
+	}
+}
@@ -127,3 +127,69 @@ func BenchmarkCodestreamParsing(b *testing.B) {
 		_ = decoder.Decode(data)
 	}
 }
+
+// BenchmarkEncodeAutoGeometry compares the default geometry with
+// AutoConfigure on the image classes of a DICOM archive. Sub-benchmarks
+// report the codestream size as bytes/frame.
+func BenchmarkEncodeAutoGeometry(b *testing.B) {
+	classes := []struct {
+		name                           string
+		width, height, bitDepth, comps int
+	}{
+		{"icon-64", 64, 64, 8, 1},
+		{"mr-256", 256, 256, 12, 1},
+		{"ct-512", 512, 512, 12, 1},
+		{"us-640x480-rgb", 640, 480, 8, 3},
+		{"xr-2048", 2048, 2048, 12, 1},
+	}
+	for _, c := range classes {
+		pixels := benchmarkFrame(c.width, c.height, c.bitDepth, c.comps)
+		for _, mode := range []string{"default", "auto"} {
+			p := DefaultEncodeParams(c.width, c.height, c.comps, c.bitDepth, false)
+			if mode == "auto" {
+				p.AutoConfigure(PreferBalanced)
+			}
+			b.Run(c.name+"/"+mode, func(b *testing.B) {
+				var size int
+				b.SetBytes(int64(len(pixels)))
+				for i := 0; i < b.N; i++ {
+					params := *p
+					encoded, err := NewEncoder(&params).Encode(pixels)
+					if err != nil {
+						b.Fatal(err)
+					}
+					size = len(encoded)
+				}
+				b.ReportMetric(float64(size), "bytes/frame")
+			})
+		}
+	}
+}
+
+// benchmarkFrame returns an interleaved frame with a smooth body, sharp
+// edges and acquisition noise on a constant background.
+func benchmarkFrame(width, height, bitDepth, comps int) []byte {
+	bytesPerSample := (bitDepth + 7) / 8
+	maxVal := 1<<bitDepth - 1
+	out := make([]byte, width*height*comps*bytesPerSample)
+	seed := uint32(1)
+	for y := 0; y < height; y++ {
+		for x := 0; x < width; x++ {
+			dx, dy := 2*x-width, 2*y-height
+			v := maxVal / 50
+			if dx*dx+dy*dy < width*height*4/5 {
+				seed = seed*1664525 + 1013904223
+				v = maxVal*2/5 + (x*37+y*23)%(maxVal/8+1) + int(seed>>24)%(maxVal/64+1)
+			}
+			for c := 0; c < comps; c++ {
+				s := min(maxVal, v+c*maxVal/20)
+				i := ((y*width+x)*comps + c) * bytesPerSample
+				out[i] = byte(s)
+				if bytesPerSample == 2 {
+					out[i+1] = byte(s >> 8)
+				}
+			}
+		}
+	}
+	return out
+}
@@ -0,0 +1,137 @@
+package codestream
+
+import (
+	"bytes"
+	"encoding/binary"
+	"fmt"
+	"io"
+)
+
+// TilePartLocation gives the byte offsets of one tile-part in a codestream.
+// The tile-part's compressed data is data[DataOffset:End].
+type TilePartLocation struct {
+	Tile       int // Isot
+	Part       int // TPsot
+	NumParts   int // TNsot, 0 if unknown
+	Offset     int // offset of the SOT marker
+	DataOffset int // offset of the first byte after SOD
+	End        int // offset just past the tile-part
+}
+
+// LocateTileParts returns the tile-parts of a codestream in stream order
+// without decoding any marker segment except SOT. Main and tile-part header
+// segments are skipped by their length fields and tile-parts by Psot, so the
+// cost grows with the number of segments rather than the size of the
+// compressed data; only a tile-part whose Psot is 0 or inconsistent is
+// scanned for the next SOT or EOC marker.
+func LocateTileParts(data []byte) ([]TilePartLocation, error) {
+	if len(data) < 2 || binary.BigEndian.Uint16(data) != MarkerSOC {
+		return nil, fmt.Errorf("expected SOC marker (0x%04X)", MarkerSOC)
+	}
+
+	// Main header
+	off := 2
+	for {
+		marker, err := markerAt(data, off)
+		if err != nil {
+			return nil, fmt.Errorf("failed to locate main header end: %w", err)
+		}
+		if marker == MarkerSOT || marker == MarkerEOC {
+			break
+		}
+		if off, err = skipSegmentAt(data, off, marker); err != nil {
+			return nil, fmt.Errorf("failed to skip main header segment: %w", err)
+		}
+	}
+
+	var parts []TilePartLocation
+	for off+2 <= len(data) {
+		marker := binary.BigEndian.Uint16(data[off:])
+		if marker == MarkerEOC {
+			break
+		}
+		if marker != MarkerSOT {
+			return nil, fmt.Errorf("unexpected marker in tile sequence: 0x%04X (%s)", marker, MarkerName(marker))
+		}
+		if off+12 > len(data) {
+			return nil, fmt.Errorf("truncated SOT segment: %w", io.EOF)
+		}
+		if length := binary.BigEndian.Uint16(data[off+2:]); length != 10 {
+			return nil, fmt.Errorf("invalid SOT segment length: %d", length)
+		}
+		loc := TilePartLocation{
+			Tile:     int(binary.BigEndian.Uint16(data[off+4:])),
+			Part:     int(data[off+10]),
+			NumParts: int(data[off+11]),
+			Offset:   off,
+		}
+		psot := int(binary.BigEndian.Uint32(data[off+6:]))
+
+		// Tile-part header
+		pos := off + 12
+		for {
+			marker, err := markerAt(data, pos)
+			if err != nil {
+				return nil, fmt.Errorf("failed to locate SOD of tile %d: %w", loc.Tile, err)
+			}
+			if marker == MarkerSOD {
+				pos += 2
+				break
+			}
+			if pos, err = skipSegmentAt(data, pos, marker); err != nil {
+				return nil, fmt.Errorf("failed to skip tile-part header segment: %w", err)
+			}
+		}
+		loc.DataOffset = pos
+
+		if psot > 0 && off+psot >= pos && off+psot <= len(data) {
+			loc.End = off + psot
+		} else {
+			loc.End = nextTilePartBoundary(data, pos)
+		}
+		parts = append(parts, loc)
+		off = loc.End
+	}
+	return parts, nil
+}
+
+func markerAt(data []byte, off int) (uint16, error) {
+	if off+2 > len(data) {
+		return 0, io.EOF
+	}
+	return binary.BigEndian.Uint16(data[off:]), nil
+}
+
+// skipSegmentAt returns the offset following the marker segment at off.
+func skipSegmentAt(data []byte, off int, marker uint16) (int, error) {
+	if !HasLength(marker) {
+		return 0, fmt.Errorf("unexpected marker 0x%04X (%s)", marker, MarkerName(marker))
+	}
+	if off+4 > len(data) {
+		return 0, io.EOF
+	}
+	length := int(binary.BigEndian.Uint16(data[off+2:]))
+	if length < 2 || off+2+length > len(data) {
+		return 0, fmt.Errorf("invalid %s segment length: %d", MarkerName(marker), length)
+	}
+	return off + 2 + length, nil
+}
+
+// nextTilePartBoundary returns the offset of the first SOT or EOC marker at
+// or after from, or len(data) if there is none. Bit stuffing keeps 0xFF90
+// and 0xFFD9 out of packet data, so the only markers that may precede them
+// inside a tile-part are SOP and EPH, which are skipped. The search jumps
+// between 0xFF bytes with bytes.IndexByte instead of testing every byte.
+func nextTilePartBoundary(data []byte, from int) int {
+	for i := from; i+1 < len(data); i++ {
+		j := bytes.IndexByte(data[i:len(data)-1], 0xFF)
+		if j < 0 {
+			break
+		}
+		i += j
+		if next := data[i+1]; next == byte(MarkerSOT&0xFF) || next == byte(MarkerEOC&0xFF) {
+			return i
+		}
+	}
+	return len(data)
+}
@@ -0,0 +1,121 @@
+package codestream
+
+import (
+	"bytes"
+	"encoding/binary"
+	"testing"
+)
+
+// writeUnsizedTilePart writes a tile-part with Psot = 0, whose end is only
+// found by searching for the next SOT or EOC marker.
+func writeUnsizedTilePart(buf *bytes.Buffer, tileIdx uint16, partIdx, total uint8, data []byte) {
+	_ = binary.Write(buf, binary.BigEndian, MarkerSOT)
+	_ = binary.Write(buf, binary.BigEndian, uint16(10))
+	_ = binary.Write(buf, binary.BigEndian, tileIdx)
+	_ = binary.Write(buf, binary.BigEndian, uint32(0))
+	_ = binary.Write(buf, binary.BigEndian, partIdx)
+	_ = binary.Write(buf, binary.BigEndian, total)
+	_ = binary.Write(buf, binary.BigEndian, MarkerSOD)
+	buf.Write(data)
+}
+
+func TestLocateTileParts(t *testing.T) {
+	var buf bytes.Buffer
+	_ = binary.Write(&buf, binary.BigEndian, MarkerSOC)
+	writeSIZSegment(&buf, 128, 64, 64, 64, 1, 8)
+	writeCODSegment(&buf, 0, 0, 1)
+	writeQCDSegment(&buf, 8)
+
+	// Packet data with SOP and EPH markers and stuffed 0xFF bytes.
+	packets := []byte{0xFF, 0x91, 0x00, 0x04, 0x00, 0x00, 0x12, 0xFF, 0x92, 0x34, 0xFF, 0x7F, 0xFF}
+	writeTilePart(&buf, 0, 0, 2, []byte{0x01, 0x02})
+	writeTilePart(&buf, 1, 0, 1, packets)
+	writeUnsizedTilePart(&buf, 0, 1, 2, packets)
+	_ = binary.Write(&buf, binary.BigEndian, MarkerEOC)
+	data := buf.Bytes()
+
+	parts, err := LocateTileParts(data)
+	if err != nil {
+		t.Fatalf("LocateTileParts failed: %v", err)
+	}
+	want := []struct{ tile, part, numParts, size int }{
+		{0, 0, 2, 2},
+		{1, 0, 1, len(packets)},
+		{0, 1, 2, len(packets)},
+	}
+	if len(parts) != len(want) {
+		t.Fatalf("located %d tile-parts, want %d", len(parts), len(want))
+	}
+	for i, w := range want {
+		p := parts[i]
+		if p.Tile != w.tile || p.Part != w.part || p.NumParts != w.numParts || p.End-p.DataOffset != w.size {
+			t.Errorf("tile-part %d = %+v, want tile %d part %d/%d with %d bytes", i, p, w.tile, w.part, w.numParts, w.size)
+		}
+		if binary.BigEndian.Uint16(data[p.Offset:]) != MarkerSOT {
+			t.Errorf("tile-part %d offset %d is not at SOT", i, p.Offset)
+		}
+	}
+	if parts[2].End != len(data)-2 {
+		t.Errorf("unsized tile-part ends at %d, want EOC at %d", parts[2].End, len(data)-2)
+	}
+
+	cs, err := NewParser(data).Parse()
+	if err != nil {
+		t.Fatalf("Parse failed: %v", err)
+	}
+	if len(cs.Tiles) != 2 {
+		t.Fatalf("Parse found %d tiles, want 2", len(cs.Tiles))
+	}
+	for _, tile := range cs.Tiles {
+		var located []byte
+		for _, p := range parts {
+			if p.Tile == tile.Index {
+				located = append(located, data[p.DataOffset:p.End]...)
+			}
+		}
+		if !bytes.Equal(tile.Data, located) {
+			t.Errorf("tile %d: Parse data %v, located %v", tile.Index, tile.Data, located)
+		}
+	}
+}
+
+func TestLocateTilePartsErrors(t *testing.T) {
+	var header bytes.Buffer
+	_ = binary.Write(&header, binary.BigEndian, MarkerSOC)
+	writeSIZSegment(&header, 64, 64, 64, 64, 1, 8)
+
+	tests := []struct {
+		name string
+		data []byte
+	}{
+		{"missing SOC", []byte{0xFF, 0x51}},
+		{"truncated main header", header.Bytes()[:10]},
+		{"no tile-part", header.Bytes()},
+		{"stray marker", append(append([]byte{}, header.Bytes()...), 0xFF, 0x93)},
+	}
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			if _, err := LocateTileParts(tt.data); err == nil {
+				t.Error("expected an error")
+			}
+		})
+	}
+}
+
+func BenchmarkNextTilePartBoundary(b *testing.B) {
+	data := make([]byte, 1<<20)
+	for i := range data {
+		data[i] = byte(i * 7)
+		if data[i] == 0xFF {
+			data[i] = 0x7F
+		}
+	}
+	data[len(data)-2], data[len(data)-1] = 0xFF, 0xD9
+	b.SetBytes(int64(len(data)))
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		if nextTilePartBoundary(data, 0) != len(data)-2 {
+			b.Fatal("EOC not found")
+		}
+	}
+}
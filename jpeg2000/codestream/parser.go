@@ -552,7 +552,9 @@ func mergeTilePart(cs *Codestream, tiles map[int]*Tile, states map[int]*tilePart
 	}
 
 	if len(part.Data) > 0 {
-		existing.Data = append(existing.Data, part.Data...)
+		// Tile data aliases the input; cap it so the append copies instead of
+		// overwriting the following tile-part in the caller's buffer.
+		existing.Data = append(existing.Data[:len(existing.Data):len(existing.Data)], part.Data...)
 	}
 
 	return nil
@@ -1289,22 +1291,11 @@ func (p *Parser) skipSegment() error {
 	return nil
 }
 
+// readTileData reads tile-part data up to the next SOT or EOC marker, for
+// tile-parts whose Psot is 0 or does not fit the codestream.
 func (p *Parser) readTileData() []byte {
 	start := p.offset
-
-	// Read until we hit a marker (0xFF followed by non-0xFF)
-	for p.offset < len(p.data) {
-		if p.data[p.offset] == 0xFF && p.offset+1 < len(p.data) {
-			next := p.data[p.offset+1]
-			// Check if this is a valid marker (not 0xFF00)
-			if next != 0x00 && next >= 0x4F {
-				// This is a marker, stop here
-				break
-			}
-		}
-		p.offset++
-	}
-
+	p.offset = nextTilePartBoundary(p.data, start)
 	return p.data[start:p.offset]
 }
 
@@ -0,0 +1,39 @@
+package jpeg2000
+
+// Decode parameters read by the JPEG 2000 and HTJ2K codecs.
+const (
+	// MaxDecodePassesParameter carries an int that caps the EBCOT coding
+	// passes decoded per code-block (see Decoder.SetMaxCodingPasses).
+	MaxDecodePassesParameter = "maxDecodePasses"
+	// ReduceResolutionParameter carries an int number of the highest
+	// resolution levels to discard (see Decoder.SetReduceResolution).
+	ReduceResolutionParameter = "reduceResolution"
+)
+
+// MaxDecodePassesFromParameters returns the coding pass cap carried by the
+// MaxDecodePassesParameter codec parameter, or 0 (all passes).
+func MaxDecodePassesFromParameters(parameters interface {
+	GetParameter(name string) interface{}
+}) int {
+	return positiveIntParameter(parameters, MaxDecodePassesParameter)
+}
+
+// ReduceResolutionFromParameters returns the number of discarded resolution
+// levels carried by the ReduceResolutionParameter codec parameter, or 0.
+func ReduceResolutionFromParameters(parameters interface {
+	GetParameter(name string) interface{}
+}) int {
+	return positiveIntParameter(parameters, ReduceResolutionParameter)
+}
+
+func positiveIntParameter(parameters interface {
+	GetParameter(name string) interface{}
+}, name string) int {
+	if parameters == nil {
+		return 0
+	}
+	if v, ok := parameters.GetParameter(name).(int); ok && v > 0 {
+		return v
+	}
+	return 0
+}
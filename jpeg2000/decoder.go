@@ -3,7 +3,12 @@ package jpeg2000
 import (
 	"fmt"
 	"math"
+	"sync"
 
+	"github.com/cocosip/go-dicom-codecs/codec/layout"
+	"github.com/cocosip/go-dicom-codecs/codec/limits"
+	"github.com/cocosip/go-dicom-codecs/codec/voi"
+	"github.com/cocosip/go-dicom-codecs/jpeg2000/arena"
 	"github.com/cocosip/go-dicom-codecs/jpeg2000/codestream"
 	"github.com/cocosip/go-dicom-codecs/jpeg2000/colorspace"
 	"github.com/cocosip/go-dicom-codecs/jpeg2000/t2"
@@ -44,6 +49,24 @@ type Decoder struct {
 	// Error resilience configuration
 	resilient bool // Enable error resilience mode (warnings instead of errors)
 	strict    bool // Strict mode: fail on any error (default: false for resilience)
+
+	// Preview quality: cap on coding passes decoded per code-block (0 = all)
+	maxPasses int
+
+	// Reduced resolution: number of highest resolution levels discarded
+	reduce int
+
+	// Resource limits checked against the headers before decoding
+	limits limits.DecodeLimits
+
+	// Optional display rendering applied by GetPixelData
+	renderer *voi.Renderer
+
+	// Output layout: planar component planes instead of interleaved samples
+	planar bool
+	// Native colour: leave ICT-coded components as YCbCr
+	skipICT    bool
+	ictSkipped bool
 }
 
 type mctBinding struct {
@@ -87,6 +110,110 @@ func (d *Decoder) SetStrict(strict bool) {
 	}
 }
 
+// SetMaxCodingPasses limits EBCOT decoding to the first n coding passes of
+// every code-block, trading quality for speed on single-layer codestreams.
+// n <= 0 decodes all passes (default).
+func (d *Decoder) SetMaxCodingPasses(n int) {
+	if n < 0 {
+		n = 0
+	}
+	d.maxPasses = n
+}
+
+// SetMaxBitplanes limits EBCOT decoding to the n most significant bit-planes
+// of every code-block (one cleanup pass plus three passes per further plane).
+// n <= 0 decodes all bit-planes (default).
+func (d *Decoder) SetMaxBitplanes(n int) {
+	d.SetMaxCodingPasses(CodingPassesForBitplanes(n))
+}
+
+// MaxCodingPasses returns the configured coding pass cap (0 = unlimited).
+func (d *Decoder) MaxCodingPasses() int {
+	return d.maxPasses
+}
+
+// CodingPassesForBitplanes converts a bit-plane count into the number of
+// coding passes that cover it (cleanup first, then SPP/MRP/CP per plane).
+func CodingPassesForBitplanes(n int) int {
+	if n <= 0 {
+		return 0
+	}
+	return 3*n - 2
+}
+
+// SetReduceResolution decodes the image at 1/2^levels of its size by
+// skipping the code-blocks and inverse DWT of the highest resolution levels.
+// Width and Height report the reduced size after Decode. The value is clamped
+// to the number of decomposition levels in the codestream; 0 decodes at full
+// resolution (default).
+func (d *Decoder) SetReduceResolution(levels int) {
+	if levels < 0 {
+		levels = 0
+	}
+	d.reduce = levels
+}
+
+// SetRenderer makes GetPixelData map every sample through r, producing one
+// 8-bit display value per sample in the same pass that clamps and packs the
+// decoded data. nil restores the stored pixel representation.
+func (d *Decoder) SetRenderer(r *voi.Renderer) {
+	d.renderer = r
+}
+
+// SetPlanarOutput makes GetPixelData return one contiguous plane per
+// component (DICOM PlanarConfiguration=1) instead of interleaved samples.
+// Single-component images are unaffected.
+func (d *Decoder) SetPlanarOutput(planar bool) {
+	d.planar = planar
+}
+
+// SetSkipInverseICT leaves components coded with the irreversible colour
+// transform in YCbCr (DICOM YBR_ICT) instead of converting them to RGB.
+// The reversible RCT is still inverted: its chroma differences need one more
+// bit than the stored precision and cannot be returned losslessly.
+func (d *Decoder) SetSkipInverseICT(skip bool) {
+	d.skipICT = skip
+}
+
+// InverseICTSkipped reports whether the last Decode returned YCbCr
+// components because SetSkipInverseICT was set and the codestream used ICT.
+func (d *Decoder) InverseICTSkipped() bool {
+	return d.ictSkipped
+}
+
+// ReportLayout records the layout of the frames of the last Decode in
+// parameters: their size (reduced by SetReduceResolution) and sample format
+// (8-bit display values with SetRenderer), planarConfiguration=1 for planar
+// multi-component output and photometricInterpretation=YBR_ICT when the
+// inverse ICT was skipped.
+func (d *Decoder) ReportLayout(parameters layout.ParameterSetter) {
+	if parameters == nil {
+		return
+	}
+	layout.ReportSize(parameters, d.height, d.width)
+	if d.renderer != nil {
+		layout.ReportRendered(parameters)
+	} else {
+		layout.ReportSamples(parameters, d.bitDepth, d.isSigned)
+	}
+	if d.planar && d.components > 1 {
+		parameters.SetParameter(layout.PlanarConfigurationParameter, 1)
+	}
+	if d.ictSkipped {
+		parameters.SetParameter(layout.PhotometricInterpretationParameter, "YBR_ICT")
+	}
+}
+
+// RendererFor returns r when it matches the decoded bit depth and signedness,
+// otherwise a new renderer built from opts. Codecs use it to share one
+// renderer across the frames of an object.
+func (d *Decoder) RendererFor(r *voi.Renderer, opts voi.Options) (*voi.Renderer, error) {
+	if r.Matches(d.bitDepth, d.isSigned) {
+		return r, nil
+	}
+	return voi.NewRenderer(opts, d.bitDepth, d.isSigned)
+}
+
 // Decode decodes a JPEG 2000 codestream
 func (d *Decoder) Decode(data []byte) error {
 	// Parse codestream
@@ -97,6 +224,11 @@ func (d *Decoder) Decode(data []byte) error {
 	}
 
 	d.cs = cs
+	d.ictSkipped = false
+
+	if err := d.checkHeaderLimits(); err != nil {
+		return fmt.Errorf("codestream rejected: %w", err)
+	}
 
 	// Extract image parameters
 	if err := d.extractImageParameters(); err != nil {
@@ -532,17 +664,27 @@ func (d *Decoder) decodeTiles() error {
 	if len(d.cs.Tiles) == 0 {
 		return fmt.Errorf("no tiles found in codestream")
 	}
-	assembler := NewTileAssembler(d.cs.SIZ)
+	reduce := d.effectiveReduce()
+	assembler := NewReducedTileAssembler(d.cs.SIZ, reduce)
 	roiInfo := d.buildDecoderROIInfo()
-	if err := d.decodeAllTiles(assembler, roiInfo); err != nil {
+	if err := d.decodeAllTiles(assembler, roiInfo, reduce); err != nil {
 		return err
 	}
 	d.data = assembler.GetImageData()
+	d.width, d.height = assembler.GetImageDimensions()
 	d.applyInverseTransforms()
 	d.applyInverseDCLevelShift()
 	return nil
 }
 
+// effectiveReduce clamps the requested reduction to the main COD levels.
+func (d *Decoder) effectiveReduce() int {
+	if d.reduce == 0 || d.cs.COD == nil {
+		return 0
+	}
+	return min(d.reduce, int(d.cs.COD.NumberOfDecompositionLevels))
+}
+
 func (d *Decoder) buildDecoderROIInfo() *t2.ROIInfo {
 	if len(d.roiShifts) != d.components || d.components == 0 {
 		return nil
@@ -582,7 +724,44 @@ func (d *Decoder) buildDecoderROIInfo() *t2.ROIInfo {
 	return roiInfo
 }
 
-func (d *Decoder) decodeAllTiles(assembler *TileAssembler, roiInfo *t2.ROIInfo) error {
+// decodeArenas holds the scratch arenas of in-flight decodes; their slabs
+// outlive a decode so the frames of a series reuse them.
+var decodeArenas = sync.Pool{New: func() any { return new(arena.Arena) }}
+
+// reserveTileArena sizes a for the largest tile: two int32 planes
+// (coefficients and IDWT samples), a float32 plane for the 9/7 transform and
+// the tile's code-block data.
+func (d *Decoder) reserveTileArena(a *arena.Arena) {
+	tileLayout := NewTileLayout(d.cs.SIZ)
+	var int32s, float32s, bytes int
+	for _, tile := range d.cs.Tiles {
+		x0, y0, x1, y1 := tileLayout.GetTileBounds(tile.Index)
+		samples := 0
+		for _, c := range d.cs.SIZ.Components {
+			dx, dy := max(1, int(c.XRsiz)), max(1, int(c.YRsiz))
+			samples += (ceilDiv(x1, dx) - ceilDiv(x0, dx)) * (ceilDiv(y1, dy) - ceilDiv(y0, dy))
+		}
+		int32s = max(int32s, 2*samples)
+		if cod := d.cs.TileCOD(tile); cod != nil && cod.Transformation == 0 {
+			float32s = max(float32s, samples)
+		}
+		bytes = max(bytes, len(tile.Data))
+	}
+	a.Reserve(int32s, float32s, bytes)
+}
+
+// decodeAllTiles decodes the tiles into assembler. The transient buffers of
+// each tile are carved from a pooled arena that is reset once the tile has
+// been copied into the image.
+func (d *Decoder) decodeAllTiles(assembler *TileAssembler, roiInfo *t2.ROIInfo, reduce int) error {
+	scratch := decodeArenas.Get().(*arena.Arena)
+	defer func() {
+		scratch.Reset()
+		decodeArenas.Put(scratch)
+	}()
+	d.reserveTileArena(scratch)
+
+	var codingPasses int64
 	for tileIdx, tile := range d.cs.Tiles {
 		cod, qcd := d.resolveTileCODQCD(tile)
 		isHTJ2K := cod != nil && (cod.CodeBlockStyle&0x40) != 0
@@ -591,14 +770,20 @@ func (d *Decoder) decodeAllTiles(assembler *TileAssembler, roiInfo *t2.ROIInfo)
 			blockDecoderFactory = d.blockDecoderFactory
 		}
 		tileDecoder := t2.NewTileDecoder(tile, d.cs.SIZ, cod, qcd, roiInfo, isHTJ2K, blockDecoderFactory)
+		tileDecoder.SetMaxPasses(d.maxPasses)
+		tileDecoder.SetReduce(reduce)
+		tileDecoder.SetCodingPassLimit(d.limits.RemainingCodingPasses(codingPasses))
+		tileDecoder.SetArena(scratch)
 		tileData, err := tileDecoder.Decode()
 		if err != nil {
 			return fmt.Errorf("failed to decode tile %d: %w", tileIdx, err)
 		}
+		codingPasses += tileDecoder.CodingPasses()
 		err = assembler.AssembleTile(tileIdx, tileData)
 		if err != nil {
 			return fmt.Errorf("failed to assemble tile %d: %w", tileIdx, err)
 		}
+		scratch.Reset()
 	}
 	return nil
 }
@@ -727,6 +912,8 @@ func (d *Decoder) applyDecoderStandardInverseMCT() {
 		if d.cs.COD.Transformation == 1 {
 			r, g, b := colorspace.ApplyInverseRCTToComponents(d.data[0], d.data[1], d.data[2])
 			d.data[0], d.data[1], d.data[2] = r, g, b
+		} else if d.skipICT {
+			d.ictSkipped = true
 		} else {
 			r, g, b := colorspace.ApplyInverseICTToComponents(d.data[0], d.data[1], d.data[2])
 			d.data[0], d.data[1], d.data[2] = r, g, b
@@ -772,9 +959,12 @@ func (d *Decoder) IsSigned() bool {
 	return d.isSigned
 }
 
-// GetPixelData returns interleaved pixel data in a byte array
-// Suitable for use with the Codec interface
+// GetPixelData returns interleaved pixel data in a byte array (planar when
+// SetPlanarOutput is set). Suitable for use with the Codec interface
 func (d *Decoder) GetPixelData() []byte {
+	if d.renderer != nil {
+		return d.getRenderedPixelData()
+	}
 	if d.components == 1 {
 		// Grayscale
 		return d.getGrayscalePixelData()
@@ -861,9 +1051,20 @@ func (d *Decoder) getGrayscalePixelData() []byte {
 	return result
 }
 
-// getInterleavedPixelData returns interleaved RGB/multi-component pixel data
+// sampleStrides returns the output sample index strides (per pixel, per
+// component) for the interleaved or planar layout.
+func (d *Decoder) sampleStrides() (pixelStride, compStride int) {
+	if d.planar {
+		return 1, d.width * d.height
+	}
+	return d.components, 1
+}
+
+// getInterleavedPixelData returns interleaved (or planar) RGB/multi-component
+// pixel data
 func (d *Decoder) getInterleavedPixelData() []byte {
 	numPixels := d.width * d.height
+	pixelStride, compStride := d.sampleStrides()
 
 	if d.bitDepth <= 8 {
 		// 8-bit per component
@@ -897,7 +1098,7 @@ func (d *Decoder) getInterleavedPixelData() []byte {
 					}
 				}
 
-				result[i*d.components+c] = byte(val)
+				result[i*pixelStride+c*compStride] = byte(val)
 			}
 		}
 		return result
@@ -935,7 +1136,7 @@ func (d *Decoder) getInterleavedPixelData() []byte {
 				}
 			}
 
-			idx := (i*d.components + c) * 2
+			idx := (i*pixelStride + c*compStride) * 2
 			result[idx] = byte(val)
 			result[idx+1] = byte(val >> 8)
 		}
@@ -943,6 +1144,28 @@ func (d *Decoder) getInterleavedPixelData() []byte {
 	return result
 }
 
+// getRenderedPixelData maps samples through the renderer, one byte per
+// sample, in the interleaved or planar layout.
+func (d *Decoder) getRenderedPixelData() []byte {
+	numPixels := d.width * d.height
+	result := make([]byte, numPixels*d.components)
+	if d.components == 1 {
+		for i, val := range d.data[0][:numPixels] {
+			result[i] = d.renderer.Map(val)
+		}
+		return result
+	}
+	pixelStride, compStride := d.sampleStrides()
+	for c := 0; c < d.components; c++ {
+		plane := d.data[c]
+		base := c * compStride
+		for i := 0; i < numPixels; i++ {
+			result[base+i*pixelStride] = d.renderer.Map(plane[i])
+		}
+	}
+	return result
+}
+
 // applyInverseDCLevelShift applies inverse DC level shift for unsigned data
 // For unsigned data: add 2^(bitDepth-1) to convert back from signed range
 func (d *Decoder) applyInverseDCLevelShift() {
@@ -5,7 +5,11 @@ import (
 	"encoding/binary"
 	"fmt"
 	"math"
+	"sync"
+	"sync/atomic"
 
+	"github.com/cocosip/go-dicom-codecs/codec/sched"
+	"github.com/cocosip/go-dicom-codecs/codec/stats"
 	"github.com/cocosip/go-dicom-codecs/jpeg2000/codestream"
 	"github.com/cocosip/go-dicom-codecs/jpeg2000/colorspace"
 	"github.com/cocosip/go-dicom-codecs/jpeg2000/t1"
@@ -95,6 +99,21 @@ type EncodeParams struct {
 
 	// HTJ2KMode marks code-blocks as JPEG 2000 Part 15 HT code-blocks.
 	HTJ2KMode bool
+
+	// PlanarInput indicates that Encode receives one contiguous plane per
+	// component (DICOM PlanarConfiguration=1) instead of interleaved samples.
+	PlanarInput bool
+
+	// ParallelTiles codes the tiles of a multi-tile image concurrently,
+	// using slots of the shared scheduler (codec/sched) that are free at
+	// TilePriority. The codestream is identical to a sequential encode.
+	ParallelTiles bool
+	TilePriority  sched.Priority
+
+	// FrameStats, when set, holds the statistics (codec/stats) of the frame
+	// passed to Encode. Reversible encodes use them to recognise constant
+	// tile-components without scanning their samples.
+	FrameStats *stats.Stats
 }
 
 // BlockEncoder is an interface for T1 block encoders (EBCOT or HTJ2K)
@@ -106,6 +125,12 @@ type blockEncoderKMaxSetter interface {
 	SetKMax(kmax int)
 }
 
+// blockEncoderArenaSetter is implemented by block encoders that can append
+// their output to the encoder's per-tile arena.
+type blockEncoderArenaSetter interface {
+	SetOutputArena(arena *[]byte)
+}
+
 // MCTBindingParams describes Part 2 multi-component transform binding parameters.
 // Fields map to MCT/MCC/MCO marker semantics in JPEG 2000 Part 2.
 type MCTBindingParams struct {
@@ -147,6 +172,7 @@ func DefaultEncodeParams(width, height, components, bitDepth int, isSigned bool)
 		AppendLosslessLayer: false,
 		ROI:                 nil,
 		EnableMCT:           true,
+		TilePriority:        sched.Normal,
 	}
 }
 
@@ -166,6 +192,8 @@ type Encoder struct {
 	qcdSteps                []uint16
 	openJPEGMainHeaderBytes int
 	openJPEGNumTiles        int
+	stripY0                 int    // image row held at index 0 of data/irreversibleMCTData (streaming)
+	arena                   []byte // code-block streams of the tile being coded
 }
 
 // NewEncoder creates a new JPEG 2000 encoder
@@ -353,33 +381,56 @@ func (e *Encoder) convertPixelData(pixelData []byte) error {
 		e.data[i] = make([]int32, numPixels)
 	}
 
-	// Convert based on bit depth
+	if p.PlanarInput && p.Components > 1 {
+		// Planes are contiguous: sample (c, i) lives at c*numPixels+i.
+		e.unpackStrided(e.data, 0, pixelData, numPixels, 1, numPixels)
+	} else {
+		e.unpackSamples(e.data, 0, pixelData, numPixels)
+	}
+
+	return nil
+}
+
+// unpackSamples converts numPixels interleaved samples from src into the
+// component planes starting at plane index offset.
+func (e *Encoder) unpackSamples(planes [][]int32, offset int, src []byte, numPixels int) {
+	e.unpackStrided(planes, offset, src, numPixels, e.params.Components, 1)
+}
+
+// unpackStrided converts numPixels samples per component from src into the
+// component planes starting at plane index offset. Sample (c, i) is read at
+// sample index i*pixelStride + c*compStride, which covers both interleaved
+// (Components, 1) and planar (1, numPixels) layouts.
+func (e *Encoder) unpackStrided(planes [][]int32, offset int, src []byte, numPixels, pixelStride, compStride int) {
+	p := e.params
 	if p.BitDepth <= 8 {
 		// 8-bit data
-		for i := 0; i < numPixels; i++ {
-			for c := 0; c < p.Components; c++ {
-				val := int32(pixelData[i*p.Components+c])
+		for c := 0; c < p.Components; c++ {
+			dst := planes[c][offset : offset+numPixels]
+			base := c * compStride
+			for i := range dst {
+				val := int32(src[base+i*pixelStride])
 				if p.IsSigned && val >= 128 {
 					val -= 256
 				}
-				e.data[c][i] = val
+				dst[i] = val
 			}
 		}
-	} else {
-		// 16-bit data (little-endian)
-		for i := 0; i < numPixels; i++ {
-			for c := 0; c < p.Components; c++ {
-				idx := (i*p.Components + c) * 2
-				val := int32(pixelData[idx]) | (int32(pixelData[idx+1]) << 8)
-				if p.IsSigned && val >= (1<<(p.BitDepth-1)) {
-					val -= (1 << p.BitDepth)
-				}
-				e.data[c][i] = val
+		return
+	}
+	// 16-bit data (little-endian)
+	for c := 0; c < p.Components; c++ {
+		dst := planes[c][offset : offset+numPixels]
+		base := c * compStride
+		for i := range dst {
+			idx := (base + i*pixelStride) * 2
+			val := int32(src[idx]) | (int32(src[idx+1]) << 8)
+			if p.IsSigned && val >= (1<<(p.BitDepth-1)) {
+				val -= (1 << p.BitDepth)
 			}
+			dst[i] = val
 		}
 	}
-
-	return nil
 }
 
 // buildCodestream builds the JPEG 2000 codestream
@@ -389,76 +440,86 @@ func (e *Encoder) buildCodestream() ([]byte, error) {
 		return nil, fmt.Errorf("failed to resolve ROI: %w", err)
 	}
 
-	buf := &bytes.Buffer{}
+	header := &bytes.Buffer{}
+	if err := e.writeMainHeader(header); err != nil {
+		return nil, err
+	}
+
+	parts, err := e.codeTiles()
+	if err != nil {
+		return nil, fmt.Errorf("failed to write tiles: %w", err)
+	}
+	if err := e.writeTLM(header, parts); err != nil {
+		return nil, fmt.Errorf("failed to write TLM: %w", err)
+	}
 
+	// Every length is known now, so the codestream is allocated once and the
+	// packet data is copied straight out of the tile arenas.
+	size := header.Len() + 2
+	for i := range parts {
+		size += parts[i].length
+	}
+	out := make([]byte, 0, size)
+	out = append(out, header.Bytes()...)
+	for i := range parts {
+		out = parts[i].appendTo(out)
+	}
+	// Write EOC (End of Codestream)
+	out = binary.BigEndian.AppendUint16(out, codestream.MarkerEOC)
+	e.arena = nil
+
+	return out, nil
+}
+
+// writeMainHeader writes SOC and the main header marker segments that precede
+// the first tile-part.
+func (e *Encoder) writeMainHeader(buf *bytes.Buffer) error {
 	// Write SOC (Start of Codestream)
 	if err := binary.Write(buf, binary.BigEndian, codestream.MarkerSOC); err != nil {
-		return nil, err
+		return err
 	}
 
 	// Write SIZ (Image and Tile Size)
 	if err := e.writeSIZ(buf); err != nil {
-		return nil, fmt.Errorf("failed to write SIZ: %w", err)
+		return fmt.Errorf("failed to write SIZ: %w", err)
 	}
 	if err := e.writeCAP(buf); err != nil {
-		return nil, fmt.Errorf("failed to write CAP: %w", err)
+		return fmt.Errorf("failed to write CAP: %w", err)
 	}
 
 	// Write COD (Coding Style Default)
 	if err := e.writeCOD(buf); err != nil {
-		return nil, fmt.Errorf("failed to write COD: %w", err)
+		return fmt.Errorf("failed to write COD: %w", err)
 	}
 
 	// Write QCD (Quantization Default)
 	if err := e.writeQCD(buf); err != nil {
-		return nil, fmt.Errorf("failed to write QCD: %w", err)
+		return fmt.Errorf("failed to write QCD: %w", err)
 	}
 
 	// Write version COM marker (similar to OpenJPEG)
 	if err := e.writeVersionCOM(buf); err != nil {
-		return nil, fmt.Errorf("failed to write version COM: %w", err)
+		return fmt.Errorf("failed to write version COM: %w", err)
 	}
 
 	// Write RGN (ROI) if present
 	if err := e.writeRGN(buf); err != nil {
-		return nil, fmt.Errorf("failed to write RGN: %w", err)
+		return fmt.Errorf("failed to write RGN: %w", err)
 	}
 
 	// Write COM (private ROI metadata) if ROI is enabled
 	if err := e.writeCOM(buf); err != nil {
-		return nil, fmt.Errorf("failed to write COM: %w", err)
+		return fmt.Errorf("failed to write COM: %w", err)
 	}
 
 	// Write MCT/MCC (Part 2-style) if provided
 	if err := e.writeMCTAndMCC(buf); err != nil {
-		return nil, fmt.Errorf("failed to write MCT/MCC: %w", err)
+		return fmt.Errorf("failed to write MCT/MCC: %w", err)
 	}
 
 	e.openJPEGMainHeaderBytes = buf.Len()
 
-	if !e.params.HTJ2KMode {
-		if err := e.writeTiles(buf); err != nil {
-			return nil, fmt.Errorf("failed to write tiles: %w", err)
-		}
-	} else {
-		tileParts := &bytes.Buffer{}
-		if err := e.writeTiles(tileParts); err != nil {
-			return nil, fmt.Errorf("failed to write HTJ2K tile-parts: %w", err)
-		}
-		if err := e.writeTLM(buf, tileParts.Bytes()); err != nil {
-			return nil, fmt.Errorf("failed to write TLM: %w", err)
-		}
-		if _, err := buf.Write(tileParts.Bytes()); err != nil {
-			return nil, fmt.Errorf("failed to write HTJ2K tile-parts: %w", err)
-		}
-	}
-
-	// Write EOC (End of Codestream)
-	if err := binary.Write(buf, binary.BigEndian, codestream.MarkerEOC); err != nil {
-		return nil, err
-	}
-
-	return buf.Bytes(), nil
+	return nil
 }
 
 // applyCustomMCT applies a custom multi-component transform from params.MCTMatrix
@@ -1216,24 +1277,41 @@ func (e *Encoder) writeCAP(buf *bytes.Buffer) error {
 	return err
 }
 
-func (e *Encoder) writeTLM(buf *bytes.Buffer, tileParts []byte) error {
+func (e *Encoder) writeTLM(buf *bytes.Buffer, parts []tilePart) error {
 	if !e.params.HTJ2KMode {
 		return nil
 	}
 
-	type tlmEntry struct {
-		tileIndex uint16
-		length    uint32
+	entries := make([]tlmEntry, len(parts))
+	for i := range parts {
+		entries[i] = tlmEntry{tileIndex: uint16(parts[i].tileIdx), length: uint32(parts[i].length)}
 	}
-	entries := make([]tlmEntry, 0, e.params.NumLevels+1)
+	if len(entries) == 0 {
+		return fmt.Errorf("no tile-parts available for TLM")
+	}
+	return writeTLMEntries(buf, entries)
+}
+
+// tlmEntry is one Ttlm/Ptlm pair of a TLM marker segment.
+type tlmEntry struct {
+	tileIndex uint16
+	length    uint32
+}
+
+// maxTLMEntries is the number of 6-byte entries that fit in one TLM segment.
+const maxTLMEntries = (0xFFFF - 4) / 6
+
+// tilePartLengths walks consecutive SOT tile-parts and returns their indices and Psot lengths.
+func tilePartLengths(tileParts []byte) ([]tlmEntry, error) {
+	var entries []tlmEntry
 	for offset := 0; offset < len(tileParts); {
 		if offset+12 > len(tileParts) ||
 			tileParts[offset] != 0xFF || tileParts[offset+1] != 0x90 {
-			return fmt.Errorf("invalid tile-part at offset %d", offset)
+			return nil, fmt.Errorf("invalid tile-part at offset %d", offset)
 		}
 		length := binary.BigEndian.Uint32(tileParts[offset+6 : offset+10])
 		if length < 14 || uint64(offset)+uint64(length) > uint64(len(tileParts)) {
-			return fmt.Errorf("invalid tile-part length %d at offset %d", length, offset)
+			return nil, fmt.Errorf("invalid tile-part length %d at offset %d", length, offset)
 		}
 		entries = append(entries, tlmEntry{
 			tileIndex: binary.BigEndian.Uint16(tileParts[offset+4 : offset+6]),
@@ -1241,29 +1319,37 @@ func (e *Encoder) writeTLM(buf *bytes.Buffer, tileParts []byte) error {
 		})
 		offset += int(length)
 	}
+	return entries, nil
+}
 
-	if len(entries) == 0 {
-		return fmt.Errorf("no tile-parts available for TLM")
-	}
-	if err := binary.Write(buf, binary.BigEndian, codestream.MarkerTLM); err != nil {
-		return err
-	}
-	if err := binary.Write(buf, binary.BigEndian, uint16(4+len(entries)*6)); err != nil {
-		return err
-	}
-	if err := buf.WriteByte(0); err != nil {
-		return err
-	}
-	if err := buf.WriteByte(0x60); err != nil {
-		return err
-	}
-	for _, entry := range entries {
-		if err := binary.Write(buf, binary.BigEndian, entry.tileIndex); err != nil {
+// writeTLMEntries writes entries as one or more TLM segments (16-bit Ttlm, 32-bit Ptlm).
+func writeTLMEntries(buf *bytes.Buffer, entries []tlmEntry) error {
+	for ztlm := 0; len(entries) > 0; ztlm++ {
+		if ztlm > 0xFF {
+			return fmt.Errorf("too many tile-parts for TLM: %d segments exceed Ztlm range", ztlm+1)
+		}
+		n := min(len(entries), maxTLMEntries)
+		if err := binary.Write(buf, binary.BigEndian, codestream.MarkerTLM); err != nil {
 			return err
 		}
-		if err := binary.Write(buf, binary.BigEndian, entry.length); err != nil {
+		if err := binary.Write(buf, binary.BigEndian, uint16(4+n*6)); err != nil {
 			return err
 		}
+		if err := buf.WriteByte(byte(ztlm)); err != nil {
+			return err
+		}
+		if err := buf.WriteByte(0x60); err != nil {
+			return err
+		}
+		for _, entry := range entries[:n] {
+			if err := binary.Write(buf, binary.BigEndian, entry.tileIndex); err != nil {
+				return err
+			}
+			if err := binary.Write(buf, binary.BigEndian, entry.length); err != nil {
+				return err
+			}
+		}
+		entries = entries[n:]
 	}
 	return nil
 }
@@ -1376,26 +1462,38 @@ func (e *Encoder) getPrecinctSize(resolutionLevel int) (width, height int) {
 }
 
 // calculatePrecinctIndex calculates the precinct index for a code-block
-// based on its position within the resolution level
+// based on its position within the resolution level, together with the
+// code-block's offset inside that precinct.
 // In JPEG 2000, precincts are defined at the resolution level, and all subbands
-// at the same resolution share the same precinct partitioning
-// cbX0, cbY0 are in the **resolution reference grid** (not global wavelet space)
-func (e *Encoder) calculatePrecinctIndex(cbX0, cbY0, resolutionLevel int) int {
+// at the same resolution share the same precinct partitioning. The precinct
+// grid is anchored at the reference grid origin, so tiles that do not start on
+// a precinct boundary get a clipped first precinct (as in the decoder).
+// cbX0, cbY0 are in the **resolution reference grid** relative to the tile
+// (not global wavelet space)
+func (e *Encoder) calculatePrecinctIndex(cbX0, cbY0, resolutionLevel, tileX0, tileY0, tileWidth, tileHeight int) (precinctIdx, localX, localY int) {
 	// Get precinct dimensions for this resolution
 	precinctWidth, precinctHeight := e.getPrecinctSize(resolutionLevel)
 
-	// Get resolution dimensions
-	resWidth, _ := e.getResolutionDimensions(resolutionLevel)
+	// Get resolution bounds on the reference grid
+	resX0, resY0, resX1, _ := e.getResolutionBounds(resolutionLevel, tileX0, tileY0, tileWidth, tileHeight)
+
+	// Precinct grid covering the resolution
+	startX := (resX0 / precinctWidth) * precinctWidth
+	startY := (resY0 / precinctHeight) * precinctHeight
+	numPrecinctX := max(ceilDiv(resX1, precinctWidth)-resX0/precinctWidth, 1)
 
 	// Calculate precinct grid position
-	px := cbX0 / precinctWidth
-	py := cbY0 / precinctHeight
+	absX := resX0 + cbX0
+	absY := resY0 + cbY0
+	px := (absX - startX) / precinctWidth
+	py := (absY - startY) / precinctHeight
 
-	// Calculate number of precincts in X direction based on resolution dimensions
-	numPrecinctX := (resWidth + precinctWidth - 1) / precinctWidth
+	// Offsets inside the precinct clipped to the tile-resolution
+	localX = absX - max(startX+px*precinctWidth, resX0)
+	localY = absY - max(startY+py*precinctHeight, resY0)
 
 	// Linear precinct index
-	return py*numPrecinctX + px
+	return py*numPrecinctX + px, localX, localY
 }
 
 // toResolutionCoordinates converts global wavelet coordinates to resolution reference grid coordinates
@@ -1405,14 +1503,14 @@ func (e *Encoder) calculatePrecinctIndex(cbX0, cbY0, resolutionLevel int) int {
 //	HL (band=1): coordinates are at offset (subbandWidth, 0)
 //	LH (band=2): coordinates are at offset (0, subbandHeight)
 //	HH (band=3): coordinates are at offset (subbandWidth, subbandHeight)
-func (e *Encoder) toResolutionCoordinates(globalX, globalY, resolutionLevel, band int) (int, int) {
+func (e *Encoder) toResolutionCoordinates(globalX, globalY, resolutionLevel, band, tileX0, tileY0, tileWidth, tileHeight int) (int, int) {
 	if resolutionLevel == 0 {
 		// LL subband - coordinates are already correct
 		return globalX, globalY
 	}
 
 	// For resolution > 0, get subband dimensions
-	subbandWidth, subbandHeight := e.getSubbandDimensions(resolutionLevel)
+	subbandWidth, subbandHeight := e.getSubbandDimensions(resolutionLevel, tileX0, tileY0, tileWidth, tileHeight)
 
 	// Map coordinates based on subband type
 	// In the wavelet transform, subbands are laid out as:
@@ -1440,68 +1538,35 @@ func (e *Encoder) toResolutionCoordinates(globalX, globalY, resolutionLevel, ban
 	return resX, resY
 }
 
-// getSubbandDimensions returns the dimensions of a subband at a resolution level
-func (e *Encoder) getSubbandDimensions(resolutionLevel int) (width, height int) {
-	// For resolution level r:
-	// - r=0: LL subband dimensions = image / (2^numLevels)
-	// - r>0: HL/LH/HH subband dimensions = image / (2^(numLevels - r + 1))
-	//
-	// Simplified: All subbands at any resolution have the same calculation
-	// subbandWidth = imageWidth >> (numLevels - resolutionLevel + 1) for res > 0
-	// subbandWidth = imageWidth >> numLevels for res == 0
-
-	if resolutionLevel == 0 {
-		// LL subband
-		width = ceilDivPow2(e.params.Width, e.params.NumLevels)
-		height = ceilDivPow2(e.params.Height, e.params.NumLevels)
-	} else {
-		// HL/LH/HH subbands
-		// These come from decomposition level (numLevels - resolutionLevel + 1)
-		level := e.params.NumLevels - resolutionLevel + 1
-		if level < 0 {
-			level = 0
-		}
-		width = ceilDivPow2(e.params.Width, level)
-		height = ceilDivPow2(e.params.Height, level)
-	}
-
-	// Ensure minimum size of 1
-	if width < 1 {
-		width = 1
-	}
-	if height < 1 {
-		height = 1
+// getSubbandDimensions returns the dimensions of the low-pass subband that
+// precedes a resolution level of the tile at (tileX0,tileY0): the LL band for
+// r=0, and for r>0 the LL band of decomposition level (numLevels - r + 1),
+// whose size is the offset of HL/LH/HH in the tile-local wavelet layout.
+func (e *Encoder) getSubbandDimensions(resolutionLevel, tileX0, tileY0, tileWidth, tileHeight int) (width, height int) {
+	if resolutionLevel > 0 {
+		resolutionLevel--
 	}
-
-	return width, height
+	return e.getResolutionDimensions(resolutionLevel, tileX0, tileY0, tileWidth, tileHeight)
 }
 
-// getResolutionDimensions returns the dimensions of a resolution level
-func (e *Encoder) getResolutionDimensions(resolutionLevel int) (width, height int) {
-	// For resolution level r:
-	// - r=0: LL subband (lowest resolution) = image / (2^numLevels)
-	// - r=1: includes HL/LH/HH at decomposition level (numLevels-1) = image / (2^(numLevels-1))
-	// - r=numLevels: highest resolution = full image
-	//
-	// Formula: width = imageWidth / (2^(numLevels - resolutionLevel))
-
-	divisor := e.params.NumLevels - resolutionLevel
-	if divisor < 0 {
-		divisor = 0
-	}
-
-	width = ceilDivPow2(e.params.Width, divisor)
-	height = ceilDivPow2(e.params.Height, divisor)
-
-	// Ensure minimum size of 1
-	if width < 1 {
-		width = 1
-	}
-	if height < 1 {
-		height = 1
-	}
+// getResolutionDimensions returns the dimensions of a resolution level of the
+// tile at (tileX0,tileY0).
+func (e *Encoder) getResolutionDimensions(resolutionLevel, tileX0, tileY0, tileWidth, tileHeight int) (width, height int) {
+	x0, y0, x1, y1 := e.getResolutionBounds(resolutionLevel, tileX0, tileY0, tileWidth, tileHeight)
+	return x1 - x0, y1 - y0
+}
 
-	return width, height
+// getResolutionBounds returns the bounds of a resolution level of a tile on the
+// reduced reference grid. With n = numLevels - r decompositions below the full
+// tile, the resolution spans [ceil(tx0/2^n), ceil(tx1/2^n)), which is also
+// where the wavelet transform places its low-pass samples for the tile parity.
+func (e *Encoder) getResolutionBounds(resolutionLevel, tileX0, tileY0, tileWidth, tileHeight int) (x0, y0, x1, y1 int) {
+	n := max(e.params.NumLevels-resolutionLevel, 0)
+	x0 = ceilDivPow2(tileX0, n)
+	y0 = ceilDivPow2(tileY0, n)
+	x1 = ceilDivPow2(tileX0+tileWidth, n)
+	y1 = ceilDivPow2(tileY0+tileHeight, n)
+	return x0, y0, x1, y1
 }
 
 // ceilDivPow2 computes ceil(n / 2^pow) for pow >= 0.
@@ -1982,8 +2047,8 @@ func (e *Encoder) tileBounds(tileIdx, tileWidth, tileHeight, numTilesX int) (int
 	return x0, y0, x1, y1
 }
 
-// writeTiles writes all tile data
-func (e *Encoder) writeTiles(buf *bytes.Buffer) error {
+// codeTiles codes every tile and returns its tile-parts in codestream order.
+func (e *Encoder) codeTiles() ([]tilePart, error) {
 	p := e.params
 
 	// Calculate tile dimensions
@@ -2003,42 +2068,130 @@ func (e *Encoder) writeTiles(buf *bytes.Buffer) error {
 
 	useGlobalPCRD := numTiles > 1 && (e.params.NumLayers > 1 || e.params.TargetRatio > 0)
 	if useGlobalPCRD {
-		return e.writeTilesWithGlobalRateDistortion(buf, tileWidth, tileHeight, numTilesX, numTiles)
+		return e.codeTilesWithGlobalRateDistortion(tileWidth, tileHeight, numTilesX, numTiles)
 	}
 
-	// Write each tile
-	for tileIdx := 0; tileIdx < numTiles; tileIdx++ {
-		if err := e.writeTile(buf, tileIdx, tileWidth, tileHeight, numTilesX); err != nil {
+	// Code each tile
+	tileParts := make([][]tilePart, numTiles)
+	err := e.forEachTile(numTiles, func(te *Encoder, tileIdx int) error {
+		coded, err := te.codeTile(tileIdx, tileWidth, tileHeight, numTilesX)
+		if err != nil {
 			return fmt.Errorf("failed to write tile %d: %w", tileIdx, err)
 		}
+		tileParts[tileIdx] = coded
+		return nil
+	})
+	if err != nil {
+		return nil, err
 	}
 
-	return nil
+	parts := make([]tilePart, 0, numTiles)
+	for _, coded := range tileParts {
+		parts = append(parts, coded...)
+	}
+	return parts, nil
+}
+
+// forEachTile calls code for tiles 0..n-1. With ParallelTiles the tiles are
+// shared between the calling goroutine and helper tasks on the shared
+// scheduler, each coding with its own copy of e so that the tile state it
+// mutates (the code-block arena) is private. The caller claims tiles too, so
+// the encode completes even when no scheduler slot is free (for instance
+// inside a frame task that holds the last one), and helpers starting after
+// the last tile was claimed return at once. The first error is returned.
+func (e *Encoder) forEachTile(n int, code func(te *Encoder, tileIdx int) error) error {
+	s := sched.Default()
+	helpers := min(n, s.Limit()) - 1
+	if !e.params.ParallelTiles || helpers < 1 {
+		for tileIdx := 0; tileIdx < n; tileIdx++ {
+			if err := code(e, tileIdx); err != nil {
+				return err
+			}
+		}
+		return nil
+	}
+
+	var (
+		next     atomic.Int64
+		mu       sync.Mutex
+		finished int
+		firstErr error
+	)
+	allDone := sync.NewCond(&mu)
+	work := func(te *Encoder) {
+		for {
+			tileIdx := int(next.Add(1) - 1)
+			if tileIdx >= n {
+				return
+			}
+			mu.Lock()
+			failed := firstErr != nil
+			mu.Unlock()
+			var err error
+			if !failed {
+				err = code(te, tileIdx)
+			}
+			mu.Lock()
+			finished++
+			if err != nil && firstErr == nil {
+				firstErr = err
+			}
+			if finished == n {
+				allDone.Signal()
+			}
+			mu.Unlock()
+		}
+	}
+
+	group := s.NewGroup(e.params.TilePriority)
+	for h := 0; h < helpers; h++ {
+		te := new(Encoder)
+		*te = *e // copied now: e keeps changing while late helpers start
+		te.arena = nil
+		group.Go(func() error {
+			work(te)
+			return nil
+		})
+	}
+	work(e)
+
+	mu.Lock()
+	defer mu.Unlock()
+	for finished < n {
+		allDone.Wait()
+	}
+	return firstErr
 }
 
-// writeTilesWithGlobalRateDistortion performs global PCRD allocation across tiles.
-func (e *Encoder) writeTilesWithGlobalRateDistortion(buf *bytes.Buffer, tileWidth, tileHeight, numTilesX, numTiles int) error {
-	tileEncodings := make([]tileEncoding, 0, numTiles)
+// codeTilesWithGlobalRateDistortion performs global PCRD allocation across tiles.
+func (e *Encoder) codeTilesWithGlobalRateDistortion(tileWidth, tileHeight, numTilesX, numTiles int) ([]tilePart, error) {
+	tileEncodings := make([]tileEncoding, numTiles)
 	allBlocks := make([]*t2.PrecinctCodeBlock, 0)
 	packetEncs := make([]*t2.PacketEncoder, 0, numTiles)
 
-	for tileIdx := 0; tileIdx < numTiles; tileIdx++ {
-		x0, y0, x1, y1 := e.tileBounds(tileIdx, tileWidth, tileHeight, numTilesX)
+	err := e.forEachTile(numTiles, func(te *Encoder, tileIdx int) error {
+		x0, y0, x1, y1 := te.tileBounds(tileIdx, tileWidth, tileHeight, numTilesX)
 		actualWidth := x1 - x0
 		actualHeight := y1 - y0
 
-		transformedData := e.transformTile(x0, y0, actualWidth, actualHeight)
+		transformedData := te.transformTile(x0, y0, actualWidth, actualHeight)
 
-		packetEnc, blocks := e.buildTilePacketEncoder(transformedData, actualWidth, actualHeight)
-		tileEncodings = append(tileEncodings, tileEncoding{
+		packetEnc, blocks := te.buildTilePacketEncoder(transformedData, x0, y0, actualWidth, actualHeight)
+		tileEncodings[tileIdx] = tileEncoding{
 			idx:       tileIdx,
 			width:     actualWidth,
 			height:    actualHeight,
 			packetEnc: packetEnc,
 			blocks:    blocks,
-		})
-		allBlocks = append(allBlocks, blocks...)
-		packetEncs = append(packetEncs, packetEnc)
+		}
+		return nil
+	})
+	if err != nil {
+		return nil, err
+	}
+	for _, tile := range tileEncodings {
+		allBlocks = append(allBlocks, tile.blocks...)
+		packetEncs = append(packetEncs, tile.packetEnc)
 	}
 
 	if e.params.NumLayers > 1 || e.params.TargetRatio > 0 {
@@ -2046,50 +2199,79 @@ func (e *Encoder) writeTilesWithGlobalRateDistortion(buf *bytes.Buffer, tileWidt
 		e.applyRateDistortionGlobal(allBlocks, packetEncs, origBytes, numTiles)
 	}
 
+	parts := make([]tilePart, 0, numTiles)
 	for _, tile := range tileEncodings {
-		tileBytes := []byte{0x00}
-		if tile.packetEnc != nil {
-			tile.packetEnc.ResetState()
-			packets, err := tile.packetEnc.EncodePackets()
-			if err == nil {
-				tileBytes = e.packetsToBytes(packets)
-			}
+		tile.packetEnc.ResetState()
+		packets, err := tile.packetEnc.EncodePackets()
+		if err != nil {
+			return nil, fmt.Errorf("failed to encode packets of tile %d: %w", tile.idx, err)
 		}
-
-		tileHeader := &bytes.Buffer{}
-		if err := e.writeTileRGN(tileHeader); err != nil {
-			return fmt.Errorf("failed to write tile-part RGN: %w", err)
+		part, err := e.newTilePart(tile.idx, 0, 1, packets)
+		if err != nil {
+			return nil, err
 		}
+		parts = append(parts, part)
+	}
 
-		if err := binary.Write(buf, binary.BigEndian, codestream.MarkerSOT); err != nil {
-			return err
-		}
-		_ = binary.Write(buf, binary.BigEndian, uint16(10)) // Lsot
+	return parts, nil
+}
 
-		_ = binary.Write(buf, binary.BigEndian, uint16(tile.idx)) // Isot
-		tilePartLength := len(tileBytes) + tileHeader.Len() + 14  // SOT(12) + header + SOD(2) + data
-		_ = binary.Write(buf, binary.BigEndian, uint32(tilePartLength))
-		_ = binary.Write(buf, binary.BigEndian, uint8(0)) // TPsot
-		_ = binary.Write(buf, binary.BigEndian, uint8(1)) // TNsot
+// tilePart is one coded tile-part: the SOT segment, tile-part header and SOD
+// followed by packets whose bodies still alias the tile's code-block arena.
+// Holding parts in this form lets Psot, TLM and the codestream size be
+// computed before any packet data is copied.
+type tilePart struct {
+	tileIdx int
+	marker  []byte // SOT, tile-part header segments and SOD
+	packets []t2.Packet
+	length  int // Psot: marker bytes plus packet data
+}
 
-		if _, err := buf.Write(tileHeader.Bytes()); err != nil {
-			return err
-		}
+// appendTo appends the complete tile-part to dst.
+func (tp *tilePart) appendTo(dst []byte) []byte {
+	dst = append(dst, tp.marker...)
+	for i := range tp.packets {
+		dst = append(dst, tp.packets[i].Header...)
+		dst = append(dst, tp.packets[i].Body...)
+	}
+	return dst
+}
 
-		if err := binary.Write(buf, binary.BigEndian, codestream.MarkerSOD); err != nil {
-			return err
+// newTilePart builds the marker bytes of one tile-part for packets. The
+// tile-part header (e.g. RGN) is only written into the first part.
+func (e *Encoder) newTilePart(tileIdx, partIndex, partCount int, packets []t2.Packet) (tilePart, error) {
+	tileHeader := &bytes.Buffer{}
+	if partIndex == 0 {
+		if err := e.writeTileRGN(tileHeader); err != nil {
+			return tilePart{}, fmt.Errorf("failed to write tile-part RGN: %w", err)
 		}
+	}
 
-		if _, err := buf.Write(tileBytes); err != nil {
-			return err
-		}
+	dataLen := 0
+	for i := range packets {
+		dataLen += len(packets[i].Header) + len(packets[i].Body)
 	}
+	markerLen := 12 + tileHeader.Len() + 2 // SOT(12) + header + SOD(2)
 
-	return nil
+	marker := make([]byte, 0, markerLen)
+	marker = binary.BigEndian.AppendUint16(marker, codestream.MarkerSOT)
+	marker = binary.BigEndian.AppendUint16(marker, 10)              // Lsot
+	marker = binary.BigEndian.AppendUint16(marker, uint16(tileIdx)) // Isot
+	marker = binary.BigEndian.AppendUint32(marker, uint32(markerLen+dataLen))
+	marker = append(marker, byte(partIndex), byte(partCount)) // TPsot, TNsot
+	marker = append(marker, tileHeader.Bytes()...)
+	marker = binary.BigEndian.AppendUint16(marker, codestream.MarkerSOD)
+
+	return tilePart{
+		tileIdx: tileIdx,
+		marker:  marker,
+		packets: packets,
+		length:  markerLen + dataLen,
+	}, nil
 }
 
-// writeTile writes a single tile
-func (e *Encoder) writeTile(buf *bytes.Buffer, tileIdx, tileWidth, tileHeight, numTilesX int) error {
+// codeTile transforms and codes a single tile into its tile-parts.
+func (e *Encoder) codeTile(tileIdx, tileWidth, tileHeight, numTilesX int) ([]tilePart, error) {
 	// Calculate tile bounds
 	x0, y0, x1, y1 := e.tileBounds(tileIdx, tileWidth, tileHeight, numTilesX)
 
@@ -2097,90 +2279,54 @@ func (e *Encoder) writeTile(buf *bytes.Buffer, tileIdx, tileWidth, tileHeight, n
 	actualHeight := y1 - y0
 
 	transformedData := e.transformTile(x0, y0, actualWidth, actualHeight)
+	packets, err := e.encodeTilePackets(transformedData, x0, y0, actualWidth, actualHeight)
+	if err != nil {
+		return nil, fmt.Errorf("failed to encode packets of tile %d: %w", tileIdx, err)
+	}
 	if e.params.HTJ2KMode {
-		return e.writeHTJ2KTileParts(buf, tileIdx, e.encodeTilePackets(transformedData, actualWidth, actualHeight))
+		return e.htj2kTileParts(tileIdx, packets)
 	}
 
-	// Encode tile data
-	tileBytes := e.encodeTileData(transformedData, actualWidth, actualHeight)
-
-	// Build tile-part header (e.g., RGN) to compute Psot correctly
-	tileHeader := &bytes.Buffer{}
-	if err := e.writeTileRGN(tileHeader); err != nil {
-		return fmt.Errorf("failed to write tile-part RGN: %w", err)
+	part, err := e.newTilePart(tileIdx, 0, 1, packets)
+	if err != nil {
+		return nil, err
 	}
+	return []tilePart{part}, nil
+}
 
-	// Write SOT (Start of Tile)
-	_ = binary.Write(buf, binary.BigEndian, codestream.MarkerSOT)
-	_ = binary.Write(buf, binary.BigEndian, uint16(10)) // Lsot
-
-	_ = binary.Write(buf, binary.BigEndian, uint16(tileIdx)) // Isot
-	tilePartLength := len(tileBytes) + tileHeader.Len() + 14 // SOT(12) + header + SOD(2) + data
-	_ = binary.Write(buf, binary.BigEndian, uint32(tilePartLength))
-	_ = binary.Write(buf, binary.BigEndian, uint8(0)) // TPsot
-	_ = binary.Write(buf, binary.BigEndian, uint8(1)) // TNsot
-
-	// Write tile-part header (e.g., RGN)
-	if _, err := buf.Write(tileHeader.Bytes()); err != nil {
+// writeTile codes a single tile and writes its tile-parts to buf.
+func (e *Encoder) writeTile(buf *bytes.Buffer, tileIdx, tileWidth, tileHeight, numTilesX int) error {
+	parts, err := e.codeTile(tileIdx, tileWidth, tileHeight, numTilesX)
+	if err != nil {
 		return err
 	}
-
-	// Write SOD (Start of Data)
-	_ = binary.Write(buf, binary.BigEndian, codestream.MarkerSOD)
-
-	// Write tile data
-	buf.Write(tileBytes)
-
+	for i := range parts {
+		buf.Grow(parts[i].length)
+		buf.Write(parts[i].appendTo(buf.AvailableBuffer()))
+	}
 	return nil
 }
 
-func (e *Encoder) writeHTJ2KTileParts(buf *bytes.Buffer, tileIdx int, packets []t2.Packet) error {
+// htj2kTileParts splits a tile's packets into one tile-part per resolution.
+func (e *Encoder) htj2kTileParts(tileIdx int, packets []t2.Packet) ([]tilePart, error) {
 	partCount := e.params.NumLevels + 1
-	parts := make([][]byte, partCount)
+	byResolution := make([][]t2.Packet, partCount)
 	for _, packet := range packets {
 		if packet.ResolutionLevel < 0 || packet.ResolutionLevel >= partCount {
-			return fmt.Errorf("packet resolution %d is outside HTJ2K tile-part range", packet.ResolutionLevel)
+			return nil, fmt.Errorf("packet resolution %d is outside HTJ2K tile-part range", packet.ResolutionLevel)
 		}
-		parts[packet.ResolutionLevel] = append(parts[packet.ResolutionLevel], packet.Header...)
-		parts[packet.ResolutionLevel] = append(parts[packet.ResolutionLevel], packet.Body...)
+		byResolution[packet.ResolutionLevel] = append(byResolution[packet.ResolutionLevel], packet)
 	}
 
-	for partIndex, data := range parts {
-		tileHeader := &bytes.Buffer{}
-		if partIndex == 0 {
-			if err := e.writeTileRGN(tileHeader); err != nil {
-				return fmt.Errorf("failed to write tile-part RGN: %w", err)
-			}
-		}
-		if err := binary.Write(buf, binary.BigEndian, codestream.MarkerSOT); err != nil {
-			return err
-		}
-		if err := binary.Write(buf, binary.BigEndian, uint16(10)); err != nil {
-			return err
-		}
-		if err := binary.Write(buf, binary.BigEndian, uint16(tileIdx)); err != nil {
-			return err
-		}
-		if err := binary.Write(buf, binary.BigEndian, uint32(len(data)+tileHeader.Len()+14)); err != nil {
-			return err
-		}
-		if err := buf.WriteByte(byte(partIndex)); err != nil {
-			return err
-		}
-		if err := buf.WriteByte(byte(partCount)); err != nil {
-			return err
-		}
-		if _, err := buf.Write(tileHeader.Bytes()); err != nil {
-			return err
-		}
-		if err := binary.Write(buf, binary.BigEndian, codestream.MarkerSOD); err != nil {
-			return err
-		}
-		if _, err := buf.Write(data); err != nil {
-			return err
+	parts := make([]tilePart, partCount)
+	for partIndex, resPackets := range byResolution {
+		part, err := e.newTilePart(tileIdx, partIndex, partCount, resPackets)
+		if err != nil {
+			return nil, err
 		}
+		parts[partIndex] = part
 	}
-	return nil
+	return parts, nil
 }
 
 // applyWaveletTransform applies wavelet transform to tile data
@@ -2194,6 +2340,12 @@ func (e *Encoder) applyWaveletTransform(tileData [][]int32, width, height, x0, y
 		// Apply 5/3 reversible wavelet transform (lossless)
 		transformed := make([][]int32, len(tileData))
 		for c := 0; c < len(tileData); c++ {
+			if value, ok := e.constantTileComponent(c, tileData[c], width, height); ok {
+				if coeffs, ok := constantTransform53(value, len(tileData[c]), width, height, e.params.NumLevels, x0, y0); ok {
+					transformed[c] = coeffs
+					continue
+				}
+			}
 			// Copy component data
 			transformed[c] = make([]int32, len(tileData[c]))
 			copy(transformed[c], tileData[c])
@@ -2210,13 +2362,61 @@ func (e *Encoder) applyWaveletTransform(tileData [][]int32, width, height, x0, y
 	return e.applyIrreversibleWaveletTransform(floatData, width, height, x0, y0)
 }
 
+// constantTileComponent reports whether every sample of tile-component c is
+// equal, and the value. The frame statistics decide it without a scan when
+// they can: every tile of a constant frame is constant, and a varying
+// component cannot give a constant single tile unless a colour transform
+// mixed it with the others.
+func (e *Encoder) constantTileComponent(c int, data []int32, width, height int) (int32, bool) {
+	if len(data) == 0 {
+		return 0, false
+	}
+	if s := e.params.FrameStats; s != nil && len(s.Components) == e.params.Components {
+		if s.Constant() {
+			return data[0], true
+		}
+		singleTile := width == e.params.Width && height == e.params.Height
+		if singleTile && !e.usesColorTransform() && !s.Components[c].Constant() {
+			return 0, false
+		}
+	}
+	value := data[0]
+	for _, v := range data {
+		if v != value {
+			return 0, false
+		}
+	}
+	return value, true
+}
+
+// constantTransform53 returns the 5/3 decomposition of a tile-component of n
+// samples that all equal value without running the transform: the value
+// fills the final LL subband and every other coefficient is zero. It reports
+// false for geometries where that shortcut is not exact.
+func constantTransform53(value int32, n, width, height, levels, x0, y0 int) ([]int32, bool) {
+	llWidth, llHeight, ok := wavelet.ConstantLowpass53(width, height, levels, x0, y0)
+	if !ok {
+		return nil, false
+	}
+	coeffs := make([]int32, n)
+	if value != 0 {
+		for y := 0; y < llHeight; y++ {
+			row := coeffs[y*width : y*width+llWidth]
+			for x := range row {
+				row[x] = value
+			}
+		}
+	}
+	return coeffs, true
+}
+
 func (e *Encoder) transformTile(x0, y0, width, height int) [][]int32 {
 	if e.irreversibleMCTData != nil {
 		tileData := make([][]float32, e.params.Components)
 		for c := range tileData {
 			tileData[c] = make([]float32, width*height)
 			for ty := 0; ty < height; ty++ {
-				srcIdx := (y0+ty)*e.params.Width + x0
+				srcIdx := (y0-e.stripY0+ty)*e.params.Width + x0
 				dstIdx := ty * width
 				copy(tileData[c][dstIdx:dstIdx+width], e.irreversibleMCTData[c][srcIdx:srcIdx+width])
 			}
@@ -2228,7 +2428,7 @@ func (e *Encoder) transformTile(x0, y0, width, height int) [][]int32 {
 	for c := range tileData {
 		tileData[c] = make([]int32, width*height)
 		for ty := 0; ty < height; ty++ {
-			srcIdx := (y0+ty)*e.params.Width + x0
+			srcIdx := (y0-e.stripY0+ty)*e.params.Width + x0
 			dstIdx := ty * width
 			copy(tileData[c][dstIdx:dstIdx+width], e.data[c][srcIdx:srcIdx+width])
 		}
@@ -2388,14 +2588,26 @@ func bandInfosForResolution(width, height, x0, y0, numLevels, res int) []bandInf
 	}
 }
 
-func (e *Encoder) buildTilePacketEncoder(tileData [][]int32, width, height int) (*t2.PacketEncoder, []*t2.PrecinctCodeBlock) {
+// beginTileArena starts a fresh code-block arena for a tile. Earlier tiles
+// keep their arenas because their packets are only copied out once the whole
+// codestream is assembled. The previous tile's usage is the capacity hint.
+func (e *Encoder) beginTileArena(width, height int) {
+	hint := len(e.arena)
+	if hint == 0 {
+		hint = width * height * e.params.Components / 4
+	}
+	e.arena = make([]byte, 0, max(hint+hint/8, 4096))
+}
+
+func (e *Encoder) buildTilePacketEncoder(tileData [][]int32, x0, y0, width, height int) (*t2.PacketEncoder, []*t2.PrecinctCodeBlock) {
+	e.beginTileArena(width, height)
 	packetEnc := t2.NewPacketEncoder(
 		e.params.Components,
 		e.params.NumLayers,
 		e.params.NumLevels+1,                           // numResolutions = numLevels + 1
 		t2.ProgressionOrder(e.params.ProgressionOrder), // Cast uint8 to ProgressionOrder
 	)
-	packetEnc.SetImageDimensions(width, height)
+	packetEnc.SetTileBounds(x0, y0, x0+width, y0+height)
 	packetEnc.SetHTJ2KMode(e.params.HTJ2KMode)
 	precinctWidths := make([]int, e.params.NumLevels+1)
 	precinctHeights := make([]int, e.params.NumLevels+1)
@@ -2407,7 +2619,7 @@ func (e *Encoder) buildTilePacketEncoder(tileData [][]int32, width, height int)
 	packetEnc.SetPrecinctSizes(precinctWidths, precinctHeights)
 	for comp := 0; comp < e.params.Components; comp++ {
 		packetEnc.SetComponentSampling(comp, 1, 1)
-		packetEnc.SetComponentBounds(comp, 0, 0, width, height)
+		packetEnc.SetComponentBounds(comp, x0, y0, x0+width, y0+height)
 	}
 	allBlocks := make([]*t2.PrecinctCodeBlock, 0)
 
@@ -2421,7 +2633,7 @@ func (e *Encoder) buildTilePacketEncoder(tileData [][]int32, width, height int)
 		// Resolution 1+ = HL, LH, HH subbands
 		for res := 0; res <= e.params.NumLevels; res++ {
 			// Get subband dimensions for this resolution
-			subbands := e.getSubbandsForResolution(tileData[comp], width, height, res)
+			subbands := e.getSubbandsForResolution(tileData[comp], x0, y0, width, height, res)
 
 			// Process each subband
 			for _, subband := range subbands {
@@ -2436,13 +2648,8 @@ func (e *Encoder) buildTilePacketEncoder(tileData [][]int32, width, height int)
 					encodedCB.Index = globalCBIdx
 					// Calculate precinct index based on code-block position
 					// Convert from global wavelet space to resolution reference grid
-					resX0, resY0 := e.toResolutionCoordinates(encodedCB.X0, encodedCB.Y0, res, subband.band)
-					precinctIdx := e.calculatePrecinctIndex(resX0, resY0, res)
-					precinctWidth, precinctHeight := e.getPrecinctSize(res)
-					px := resX0 / precinctWidth
-					py := resY0 / precinctHeight
-					localX := resX0 - px*precinctWidth
-					localY := resY0 - py*precinctHeight
+					resX0, resY0 := e.toResolutionCoordinates(encodedCB.X0, encodedCB.Y0, res, subband.band, x0, y0, width, height)
+					precinctIdx, localX, localY := e.calculatePrecinctIndex(resX0, resY0, res, x0, y0, width, height)
 					encodedCB.CBX = localX / e.params.CodeBlockWidth
 					encodedCB.CBY = localY / e.params.CodeBlockHeight
 
@@ -2458,41 +2665,19 @@ func (e *Encoder) buildTilePacketEncoder(tileData [][]int32, width, height int)
 	return packetEnc, allBlocks
 }
 
-// encodeTileData encodes tile data using T1 and T2 encoding.
-func (e *Encoder) encodeTileData(tileData [][]int32, width, height int) []byte {
-	return e.packetsToBytes(e.encodeTilePackets(tileData, width, height))
-}
-
-func (e *Encoder) encodeTilePackets(tileData [][]int32, width, height int) []t2.Packet {
-	packetEnc, allBlocks := e.buildTilePacketEncoder(tileData, width, height)
+func (e *Encoder) encodeTilePackets(tileData [][]int32, x0, y0, width, height int) ([]t2.Packet, error) {
+	packetEnc, allBlocks := e.buildTilePacketEncoder(tileData, x0, y0, width, height)
 
 	// Apply rate-distortion optimized allocation (PCRD) if layered or TargetRatio is requested.
+	// The budget follows the tile area, which equals the image for single-tile encodes.
 	if e.params.NumLayers > 1 || e.params.TargetRatio > 0 {
-		origBytes := e.params.Width * e.params.Height * e.params.Components * ((e.params.BitDepth + 7) / 8)
+		origBytes := width * height * e.params.Components * ((e.params.BitDepth + 7) / 8)
 		e.applyRateDistortionGlobal(allBlocks, []*t2.PacketEncoder{packetEnc}, origBytes, 1)
 	}
 
 	// Generate packets
 	packetEnc.ResetState()
-	packets, err := packetEnc.EncodePackets()
-	if err != nil {
-		// Fallback to empty packet on error
-		return []t2.Packet{{ResolutionLevel: 0, Header: []byte{0x00}}}
-	}
-
-	return packets
-}
-
-func (e *Encoder) packetsToBytes(packets []t2.Packet) []byte {
-	// OpenJPEG applies bit-stuffing only to packet headers (handled during header encoding).
-	buf := &bytes.Buffer{}
-	for _, packet := range packets {
-		// Header already contains OpenJPEG-style bit stuffing.
-		buf.Write(packet.Header)
-		// Body is raw code-block data (no byte stuffing).
-		buf.Write(packet.Body)
-	}
-	return buf.Bytes()
+	return packetEnc.EncodePackets()
 }
 
 // estimateFixedOverhead builds main header segments to estimate constant bytes (excluding tile packet data).
@@ -3056,138 +3241,33 @@ type subbandInfo struct {
 }
 
 // getSubbandsForResolution extracts subbands for a specific resolution level
-func (e *Encoder) getSubbandsForResolution(data []int32, width, height, resolution int) []subbandInfo {
+// of the tile whose top-left corner is at (x0,y0). The subband sizes follow
+// the tile bounds on the reference grid, so tiles whose origin is not a
+// multiple of 2^NumLevels get the same layout as the wavelet transform.
+func (e *Encoder) getSubbandsForResolution(data []int32, x0, y0, width, height, resolution int) []subbandInfo {
 	// Resolution 0 contains only LL subband (approximation)
 	// Resolution r > 0 contains HL, LH, HH subbands from decomposition level r
+	scale := 1 << e.params.NumLevels
+	if resolution > 0 {
+		level := max(e.params.NumLevels-resolution, 0)
+		scale = 1 << (level + 1)
+	}
 
-	var subbands []subbandInfo
-
-	if resolution == 0 {
-		// LL subband (top-left quadrant after all decompositions)
-		// Use ceiling division to match JPEG2000 standard and OpenJPEG
-		divisor := 1 << e.params.NumLevels
-		llWidth := (width + divisor - 1) / divisor   // Ceiling division
-		llHeight := (height + divisor - 1) / divisor // Ceiling division
-		scale := divisor
-
-		llData := make([]int32, llWidth*llHeight)
-		for y := 0; y < llHeight; y++ {
-			for x := 0; x < llWidth; x++ {
-				srcIdx := y*width + x
-				if srcIdx < len(data) && y < height && x < width {
-					llData[y*llWidth+x] = data[srcIdx]
-				}
-				// else: pad with zero (already initialized to 0)
-			}
-		}
-
-		sb := subbandInfo{
-			data:   llData,
-			x0:     0,
-			y0:     0,
-			width:  llWidth,
-			height: llHeight,
-			band:   0, // LL
-			res:    0,
-			scale:  scale,
-		}
-		subbands = append(subbands, sb)
-	} else {
-		// For resolution r, extract HL, LH, HH subbands
-		// OpenJPEG uses: levelDiff = numResolutions - 1 - resno
-		// Since numResolutions = NumLevels + 1:
-		// levelDiff = (NumLevels + 1) - 1 - resolution = NumLevels - resolution
-		level := e.params.NumLevels - resolution
-		if level < 0 {
-			level = 0
-		}
-
-		// Helper function for ceiling division by power of 2 (matching OpenJPEG)
-		ceildivpow2 := func(a, b int) int {
-			return (a + (1 << b) - 1) >> b
-		}
-
-		scale := 1 << (level + 1)
-
-		// OpenJPEG band offset calculation (see tcd.c lines 1043-1056):
-		// bandno: 1=HL, 2=LH, 3=HH
-		// x0b = bandno & 1 (1 for HL and HH, 0 for LH)
-		// y0b = bandno >> 1 (1 for LH and HH, 0 for HL)
-		// width = ceildivpow2(image_width - (x0b << level), level+1)
-		// height = ceildivpow2(image_height - (y0b << level), level+1)
-
-		// LL subband dimensions (needed for offsets)
-		llWidth := ceildivpow2(width-(0<<level), level+1)
-		llHeight := ceildivpow2(height-(0<<level), level+1)
-
-		// HL (high-low): x0b=1, y0b=0
-		hlWidth := ceildivpow2(width-(1<<level), level+1)
-		hlHeight := ceildivpow2(height-(0<<level), level+1)
-		hlData := make([]int32, hlWidth*hlHeight)
-		for y := 0; y < hlHeight; y++ {
-			for x := 0; x < hlWidth; x++ {
-				srcIdx := y*width + (llWidth + x)
-				if srcIdx < len(data) && llWidth+x < width {
-					hlData[y*hlWidth+x] = data[srcIdx]
-				}
-				// else: pad with zero (already initialized to 0)
-			}
-		}
-		subbands = append(subbands, subbandInfo{
-			data:   hlData,
-			x0:     llWidth,
-			y0:     0,
-			width:  hlWidth,
-			height: hlHeight,
-			band:   1, // HL
-			res:    resolution,
-			scale:  scale,
-		})
-
-		// LH (low-high): x0b=0, y0b=1
-		lhWidth := ceildivpow2(width-(0<<level), level+1)
-		lhHeight := ceildivpow2(height-(1<<level), level+1)
-		lhData := make([]int32, lhWidth*lhHeight)
-		for y := 0; y < lhHeight; y++ {
-			for x := 0; x < lhWidth; x++ {
-				srcIdx := (llHeight+y)*width + x
-				if srcIdx < len(data) && llHeight+y < height {
-					lhData[y*lhWidth+x] = data[srcIdx]
-				}
-				// else: pad with zero (already initialized to 0)
-			}
-		}
-		subbands = append(subbands, subbandInfo{
-			data:   lhData,
-			x0:     0,
-			y0:     llHeight,
-			width:  lhWidth,
-			height: lhHeight,
-			band:   2, // LH
-			res:    resolution,
-			scale:  scale,
-		})
-
-		// HH (high-high): x0b=1, y0b=1
-		hhWidth := ceildivpow2(width-(1<<level), level+1)
-		hhHeight := ceildivpow2(height-(1<<level), level+1)
-		hhData := make([]int32, hhWidth*hhHeight)
-		for y := 0; y < hhHeight; y++ {
-			for x := 0; x < hhWidth; x++ {
-				srcIdx := (llHeight+y)*width + (llWidth + x)
-				if srcIdx < len(data) && llHeight+y < height && llWidth+x < width {
-					hhData[y*hhWidth+x] = data[srcIdx]
-				}
-				// else: pad with zero (already initialized to 0)
-			}
+	bands := bandInfosForResolution(width, height, x0, y0, e.params.NumLevels, resolution)
+	subbands := make([]subbandInfo, 0, len(bands))
+	for _, b := range bands {
+		bandData := make([]int32, b.width*b.height)
+		for y := 0; y < b.height; y++ {
+			srcIdx := (b.offsetY+y)*width + b.offsetX
+			copy(bandData[y*b.width:(y+1)*b.width], data[srcIdx:srcIdx+b.width])
 		}
 		subbands = append(subbands, subbandInfo{
-			data:   hhData,
-			x0:     llWidth,
-			y0:     llHeight,
-			width:  hhWidth,
-			height: hhHeight,
-			band:   3, // HH
+			data:   bandData,
+			x0:     b.offsetX,
+			y0:     b.offsetY,
+			width:  b.width,
+			height: b.height,
+			band:   b.band,
 			res:    resolution,
 			scale:  scale,
 		})
@@ -3209,6 +3289,7 @@ type codeBlockInfo struct {
 	resLevel int // Resolution level (0=LL)
 	band     int // Subband identifier (0=LL,1=HL,2=LH,3=HH)
 	mask     [][]bool
+	zero     bool // all coefficients are zero; data is nil
 }
 
 // partitionIntoCodeBlocks partitions a subband into code-blocks
@@ -3239,13 +3320,18 @@ func (e *Encoder) partitionIntoCodeBlocks(subband subbandInfo, compIdx int) []co
 			actualWidth := x1 - x0
 			actualHeight := y1 - y0
 
-			// Extract code-block data
-			cbData := make([]int32, actualWidth*actualHeight)
-			for y := 0; y < actualHeight; y++ {
-				for x := 0; x < actualWidth; x++ {
-					srcIdx := (y0+y)*subband.width + (x0 + x)
-					dstIdx := y*actualWidth + x
-					cbData[dstIdx] = subband.data[srcIdx]
+			// Extract code-block data; all-zero blocks (image background)
+			// are only flagged.
+			zero := zeroRegion(subband.data, subband.width, x0, y0, x1, y1)
+			var cbData []int32
+			if !zero {
+				cbData = make([]int32, actualWidth*actualHeight)
+				for y := 0; y < actualHeight; y++ {
+					for x := 0; x < actualWidth; x++ {
+						srcIdx := (y0+y)*subband.width + (x0 + x)
+						dstIdx := y*actualWidth + x
+						cbData[dstIdx] = subband.data[srcIdx]
+					}
 				}
 			}
 
@@ -3277,6 +3363,7 @@ func (e *Encoder) partitionIntoCodeBlocks(subband subbandInfo, compIdx int) []co
 				resLevel: subband.res,
 				band:     subband.band,
 				mask:     mask,
+				zero:     zero,
 			})
 		}
 	}
@@ -3284,6 +3371,19 @@ func (e *Encoder) partitionIntoCodeBlocks(subband subbandInfo, compIdx int) []co
 	return codeBlocks
 }
 
+// zeroRegion reports whether data, a row-major array of the given stride, is
+// zero over [x0,x1) x [y0,y1).
+func zeroRegion(data []int32, stride, x0, y0, x1, y1 int) bool {
+	for y := y0; y < y1; y++ {
+		for _, v := range data[y*stride+x0 : y*stride+x1] {
+			if v != 0 {
+				return false
+			}
+		}
+	}
+	return true
+}
+
 // encodeCodeBlock encodes a single code-block using T1 EBCOT encoder
 func (e *Encoder) encodeCodeBlock(cb codeBlockInfo, _ int) *t2.PrecinctCodeBlock {
 	// Use provided dimensions
@@ -3291,36 +3391,22 @@ func (e *Encoder) encodeCodeBlock(cb codeBlockInfo, _ int) *t2.PrecinctCodeBlock
 	actualHeight := cb.height
 	cbData := cb.data
 
-	if !e.params.HTJ2KMode && e.params.Lossless {
+	fracBits := e.t1FractionalBits()
+	if fracBits > 0 && e.params.Lossless {
 		// Apply T1 NMSEDEC FRACBITS scaling (left shift 6 bits).
 		// This matches OpenJPEG's representation for classic EBCOT T1 coding.
 		for i := range cbData {
-			cbData[i] <<= t1NMSEDecFracBits
+			cbData[i] <<= fracBits
 		}
 	}
 
-	cblkNumbps := e.codeBlockNumBps(cbData)
+	cblkNumbps := e.codeBlockNumBps(cbData, fracBits)
 	bandNumbps := e.bandNumbps(cb.resLevel, cb.band)
 	if bandNumbps <= 0 {
 		bandNumbps = cblkNumbps
 	}
 	numPasses, zeroBitPlanes := e.codeBlockPassLayout(cblkNumbps, bandNumbps)
 
-	// Create block encoder (EBCOT T1 or HTJ2K)
-	blockEnc := e.newCodeBlockEncoder(actualWidth, actualHeight, cb.compIdx, cb.resLevel, cb.band, bandNumbps)
-
-	// ROI handling: determine style/shift/inside and apply scaling/roishift
-	_, roiShift, inside := e.roiContext(cb)
-	roishift := 0
-	if roiShift > 0 && inside {
-		// MaxShift/General Scaling: scale ROI coefficients before coding.
-		if len(cb.mask) > 0 && len(cb.mask[0]) > 0 {
-			applyGeneralScalingMasked(cbData, cb.mask, roiShift)
-		} else {
-			applyGeneralScaling(cbData, roiShift)
-		}
-	}
-
 	// Create PrecinctCodeBlock structure
 	pcb := &t2.PrecinctCodeBlock{
 		Index:          0, // Will be set by caller if needed
@@ -3336,6 +3422,28 @@ func (e *Encoder) encodeCodeBlock(cb codeBlockInfo, _ int) *t2.PrecinctCodeBlock
 		ZeroBitPlanes:  zeroBitPlanes,
 	}
 
+	if cb.zero {
+		if e.encodeZeroCodeBlock(pcb, numPasses) {
+			return pcb
+		}
+		cbData = make([]int32, actualWidth*actualHeight)
+	}
+
+	// Create block encoder (EBCOT T1 or HTJ2K)
+	blockEnc := e.newCodeBlockEncoder(actualWidth, actualHeight, cb.compIdx, cb.resLevel, cb.band, bandNumbps)
+
+	// ROI handling: determine style/shift/inside and apply scaling/roishift
+	_, roiShift, inside := e.roiContext(cb)
+	roishift := 0
+	if roiShift > 0 && inside {
+		// MaxShift/General Scaling: scale ROI coefficients before coding.
+		if len(cb.mask) > 0 && len(cb.mask[0]) > 0 {
+			applyGeneralScalingMasked(cbData, cb.mask, roiShift)
+		} else {
+			applyGeneralScaling(cbData, roiShift)
+		}
+	}
+
 	useLayered := e.params.NumLayers > 1 || e.params.TargetRatio > 0
 
 	if useLayered {
@@ -3344,17 +3452,54 @@ func (e *Encoder) encodeCodeBlock(cb codeBlockInfo, _ int) *t2.PrecinctCodeBlock
 	return e.encodeSingleLayerCodeBlock(pcb, blockEnc, cbData, numPasses, roishift, bandNumbps, zeroBitPlanes)
 }
 
+// encodeZeroCodeBlock fills in pcb for an all-zero code-block without
+// creating a block encoder, giving the result the built-in encoders produce
+// for zero data. It reports false when a custom block encoder must be run.
+func (e *Encoder) encodeZeroCodeBlock(pcb *t2.PrecinctCodeBlock, numPasses int) bool {
+	useLayered := e.params.NumLayers > 1 || e.params.TargetRatio > 0
+	switch {
+	case !useLayered && e.params.HTJ2KMode && numPasses == 0:
+		pcb.Data = nil
+	case e.params.BlockEncoderFactory != nil:
+		return false
+	case useLayered:
+		// EncodeLayered codes no passes.
+		pcb.NumPassesTotal = 0
+		pcb.Data = nil
+		pcb.CompleteData = []byte{}
+	default:
+		pcb.Data = t1.EmptyBlockData()
+	}
+	return true
+}
+
 const t1NMSEDecFracBits = 6
 
-func (e *Encoder) codeBlockNumBps(cbData []int32) int {
+// losslessFastPath reports whether reversible code-blocks are T1-coded from
+// their native integer magnitudes. A single quality layer needs no per-pass
+// distortion, so the OpenJPEG fractional-bit scaling would only cost a shift
+// per coefficient; the coded passes and the codestream are identical.
+func (e *Encoder) losslessFastPath() bool {
+	p := e.params
+	return p.Lossless && !p.HTJ2KMode && p.BlockEncoderFactory == nil &&
+		p.NumLayers <= 1 && p.TargetRatio <= 0 && len(p.LayerRates) == 0
+}
+
+// t1FractionalBits returns the NMSEDEC fractional bits carried by the
+// coefficients handed to the block encoder.
+func (e *Encoder) t1FractionalBits() int {
+	if e.params.HTJ2KMode || e.losslessFastPath() {
+		return 0
+	}
+	return t1NMSEDecFracBits
+}
+
+func (e *Encoder) codeBlockNumBps(cbData []int32, fracBits int) int {
 	rawMaxBitplane := calculateMaxBitplane(cbData)
 	if rawMaxBitplane < 0 {
 		return 0
 	}
-	cblkNumbps := rawMaxBitplane + 1
-	if !e.params.HTJ2KMode {
-		cblkNumbps -= t1NMSEDecFracBits
-	}
+	cblkNumbps := rawMaxBitplane + 1 - fracBits
 	if cblkNumbps < 0 {
 		return 0
 	}
@@ -3390,8 +3535,8 @@ func (e *Encoder) newCodeBlockEncoder(width, height, component, res, band, bandN
 	} else {
 		t1Enc := t1.NewT1Encoder(width, height, 0)
 		t1Enc.SetOrientation(band)
-		if !e.params.HTJ2KMode {
-			t1Enc.SetNMSEDecFractionalBits(t1NMSEDecFracBits)
+		if fracBits := e.t1FractionalBits(); fracBits > 0 {
+			t1Enc.SetNMSEDecFractionalBits(fracBits)
 			if e.params.Lossless {
 				level := e.params.NumLevels - res
 				norm := dwtNorm53(level, band)
@@ -3418,6 +3563,9 @@ func (e *Encoder) newCodeBlockEncoder(width, height, component, res, band, bandN
 	if setter, ok := blockEnc.(blockEncoderKMaxSetter); ok {
 		setter.SetKMax(bandNumbps)
 	}
+	if setter, ok := blockEnc.(blockEncoderArenaSetter); ok && e.arena != nil {
+		setter.SetOutputArena(&e.arena)
+	}
 	return blockEnc
 }
 
@@ -1,6 +1,7 @@
 package jpeg2000
 
 import (
+	"bytes"
 	"testing"
 
 	"github.com/cocosip/go-dicom-codecs/jpeg2000/codestream"
@@ -562,3 +563,51 @@ func TestLossyQuality100QCDHasExplicitSteps(t *testing.T) {
 		t.Fatalf("unexpected SPqcd length: got %d, want %d", got, expectedBytes)
 	}
 }
+
+// TestZeroCodeBlockShortcut checks that flagged all-zero code-blocks, which
+// skip the block encoder, encode as zero data run through it does.
+func TestZeroCodeBlockShortcut(t *testing.T) {
+	tests := []struct {
+		name   string
+		modify func(p *EncodeParams)
+	}{
+		{"lossless", func(p *EncodeParams) {}},
+		{"lossy", func(p *EncodeParams) { p.Lossless = false }},
+		{"layers", func(p *EncodeParams) { p.NumLayers = 3 }},
+		{"target ratio", func(p *EncodeParams) { p.Lossless, p.TargetRatio = false, 10 }},
+		{"htj2k", func(p *EncodeParams) { p.HTJ2KMode = true }},
+	}
+	const width, height = 64, 64
+	pixels := make([]byte, width*height)
+	for i := range pixels {
+		pixels[i] = byte(i % 251)
+	}
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			p := DefaultEncodeParams(width, height, 1, 8, false)
+			p.NumLevels = 2
+			tt.modify(p)
+			enc := NewEncoder(p)
+			if _, err := enc.Encode(pixels); err != nil {
+				t.Fatalf("Encode failed: %v", err)
+			}
+			for band := 0; band < 4; band++ {
+				res := 1
+				if band == 0 {
+					res = 0
+				}
+				cb := codeBlockInfo{width: 16, height: 8, resLevel: res, band: band}
+				cb.data = make([]int32, cb.width*cb.height)
+				want := enc.encodeCodeBlock(cb, 0)
+				cb.data, cb.zero = nil, true
+				got := enc.encodeCodeBlock(cb, 0)
+				if !bytes.Equal(got.Data, want.Data) || (got.Data == nil) != (want.Data == nil) ||
+					!bytes.Equal(got.CompleteData, want.CompleteData) ||
+					got.NumPassesTotal != want.NumPassesTotal || got.ZeroBitPlanes != want.ZeroBitPlanes ||
+					len(got.Passes) != len(want.Passes) {
+					t.Errorf("band %d: shortcut %+v, encoder %+v", band, got, want)
+				}
+			}
+		})
+	}
+}
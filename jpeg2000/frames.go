@@ -0,0 +1,96 @@
+package jpeg2000
+
+import (
+	"fmt"
+	"sync"
+
+	"github.com/cocosip/go-dicom-codecs/codec/layout"
+	"github.com/cocosip/go-dicom-codecs/codec/limits"
+	"github.com/cocosip/go-dicom-codecs/codec/sched"
+	"github.com/cocosip/go-dicom-codecs/codec/voi"
+	"github.com/cocosip/go-dicom-codecs/jpeg2000/t2"
+)
+
+// FrameSource and FrameSink are the parts of the pixel data containers used
+// by DecodeFrames.
+type (
+	FrameSource interface {
+		FrameCount() int
+		GetFrame(index int) ([]byte, error)
+	}
+	FrameSink interface {
+		AddFrame(frame []byte) error
+	}
+)
+
+// Parameters is the part of codec.Parameters used by DecodeFrames.
+type Parameters interface {
+	GetParameter(name string) interface{}
+	SetParameter(name string, value interface{})
+}
+
+// DecodeFrames decodes every frame of src into dst on the shared scheduler,
+// one Decoder per frame, and is the Decode of the JPEG 2000 and HTJ2K codecs.
+//
+// parameters may carry the preview and reduced-resolution options
+// (MaxDecodePassesParameter, ReduceResolutionParameter), the layout options
+// of codec/layout, render options (voi.ParameterName), decode limits
+// (limits.ParameterName) and a scheduler priority; frames with the same
+// sample format share one renderer. The layout of the written frames is
+// reported back through parameters (see Decoder.ReportLayout). factory, when
+// not nil, decodes the code-blocks of HTJ2K codestreams.
+func DecodeFrames(src FrameSource, dst FrameSink, parameters Parameters, factory t2.BlockDecoderFactory) error {
+	frameCount := src.FrameCount()
+	if frameCount == 0 {
+		return fmt.Errorf("source pixel data is empty (no frames)")
+	}
+	renderOpts := voi.OptionsFromParameters(parameters)
+	var renderMu sync.Mutex
+	var renderer *voi.Renderer
+	var lastDecoder *Decoder
+	maxPasses, reduce := MaxDecodePassesFromParameters(parameters), ReduceResolutionFromParameters(parameters)
+	planar := layout.Bool(parameters, layout.PlanarOutputParameter)
+	skipICT := layout.Bool(parameters, layout.SkipColorTransformParameter)
+	decodeLimits := limits.FromParameters(parameters)
+
+	err := sched.Frames(sched.PriorityFromParameters(parameters), frameCount, sched.FrameReader(src),
+		func(frameIndex int, frameData []byte) ([]byte, error) {
+			decoder := NewDecoder()
+			if factory != nil {
+				decoder.SetBlockDecoderFactory(factory)
+			}
+			decoder.SetMaxCodingPasses(maxPasses)
+			decoder.SetReduceResolution(reduce)
+			decoder.SetPlanarOutput(planar)
+			decoder.SetSkipInverseICT(skipICT)
+			decoder.SetLimits(decodeLimits)
+
+			if err := decoder.Decode(frameData); err != nil {
+				return nil, fmt.Errorf("JPEG 2000 decode failed for frame %d: %w", frameIndex, err)
+			}
+			if renderOpts != nil {
+				// Frames with the same layout share one renderer.
+				renderMu.Lock()
+				r, err := decoder.RendererFor(renderer, *renderOpts)
+				if err == nil {
+					renderer = r
+				}
+				renderMu.Unlock()
+				if err != nil {
+					return nil, fmt.Errorf("invalid render options for frame %d: %w", frameIndex, err)
+				}
+				decoder.SetRenderer(r)
+			}
+			if frameIndex == frameCount-1 {
+				lastDecoder = decoder
+			}
+			return decoder.GetPixelData(), nil
+		},
+		sched.FrameWriter(dst))
+	if err != nil {
+		return err
+	}
+
+	lastDecoder.ReportLayout(parameters)
+	return nil
+}
@@ -0,0 +1,57 @@
+package jpeg2000
+
+import (
+	"bytes"
+	"testing"
+
+	"github.com/cocosip/go-dicom-codecs/codec/layout"
+)
+
+type frameList [][]byte
+
+func (f frameList) FrameCount() int                    { return len(f) }
+func (f frameList) GetFrame(index int) ([]byte, error) { return f[index], nil }
+func (f *frameList) AddFrame(frame []byte) error       { *f = append(*f, frame); return nil }
+
+type testParameters map[string]interface{}
+
+func (p testParameters) GetParameter(name string) interface{}        { return p[name] }
+func (p testParameters) SetParameter(name string, value interface{}) { p[name] = value }
+
+// TestDecodeFrames checks that every frame is decoded in order with the
+// options carried by the parameters and that the layout is reported back.
+func TestDecodeFrames(t *testing.T) {
+	width, height := 48, 40
+	interleaved, planar := planarTestImage(width, height)
+	params := DefaultEncodeParams(width, height, 3, 8, false)
+	params.NumLevels = 3
+	encoded, err := NewEncoder(params).Encode(interleaved)
+	if err != nil {
+		t.Fatalf("Encode failed: %v", err)
+	}
+
+	src := frameList{encoded, encoded, encoded}
+	var dst frameList
+	parameters := testParameters{layout.PlanarOutputParameter: true}
+	if err := DecodeFrames(src, &dst, parameters, nil); err != nil {
+		t.Fatalf("DecodeFrames failed: %v", err)
+	}
+	if len(dst) != len(src) {
+		t.Fatalf("decoded %d frames, want %d", len(dst), len(src))
+	}
+	for i, frame := range dst {
+		if !bytes.Equal(frame, planar) {
+			t.Fatalf("frame %d does not match the source planes", i)
+		}
+	}
+	if parameters[layout.PlanarConfigurationParameter] != 1 {
+		t.Errorf("planarConfiguration = %v, want 1", parameters[layout.PlanarConfigurationParameter])
+	}
+
+	if err := DecodeFrames(frameList{}, &dst, nil, nil); err == nil {
+		t.Errorf("empty source should fail")
+	}
+	if err := DecodeFrames(frameList{encoded[:20]}, &dst, nil, nil); err == nil {
+		t.Errorf("truncated frame should fail")
+	}
+}
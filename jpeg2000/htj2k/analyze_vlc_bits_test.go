@@ -109,7 +109,7 @@ func TestVLCDecoderBitReading(t *testing.T) {
 		data: vlcData,
 		pos:  len(vlcData),
 	}
-	dec.buildLookupTables()
+	dec.setLookupTables()
 
 	t.Logf("\n=== READING BITS (no init skip) ===")
 	for i := 0; i < 16; i++ {
@@ -4,6 +4,8 @@ package htj2k
 import (
 	"fmt"
 
+	"github.com/cocosip/go-dicom-codecs/codec/sched"
+	"github.com/cocosip/go-dicom-codecs/codec/stats"
 	"github.com/cocosip/go-dicom-codecs/jpeg2000"
 	"github.com/cocosip/go-dicom-codecs/jpeg2000/t2"
 	"github.com/cocosip/go-dicom/pkg/dicom/transfer"
@@ -150,6 +152,7 @@ func (c *Codec) Encode(oldPixelData imagetypes.PixelData, newPixelData imagetype
 		int(frameInfo.BitsAllocated),
 		frameInfo.PixelRepresentation != 0,
 	)
+	encParams.PlanarInput = frameInfo.PlanarConfiguration == 1
 
 	// Configure HTJ2K-specific settings
 	// Adjust NumLevels based on image size to ensure minimum subband size >= 1
@@ -176,38 +179,31 @@ func (c *Codec) Encode(oldPixelData imagetypes.PixelData, newPixelData imagetype
 		encParams.Lossless = false
 		encParams.Quality = htj2kParams.Quality
 	}
+	if pref, ok := jpeg2000.AutoGeometryFromParameters(parameters); ok {
+		encParams.AutoConfigure(pref)
+		encParams.TilePriority = sched.PriorityFromParameters(parameters)
+	}
 
-	// Create encoder with HTJ2K enabled
-	encoder := jpeg2000.NewEncoder(encParams)
-
-	// Process all frames
+	// Process all frames on the shared scheduler, each with its own encoder
+	// (HTJ2K enabled) over a copy of the encode parameters.
 	frameCount := oldPixelData.FrameCount()
 	if frameCount == 0 {
 		return fmt.Errorf("source pixel data is empty (no frames)")
 	}
-	for frameIndex := 0; frameIndex < frameCount; frameIndex++ {
-		// Get frame data
-		frameData, err := oldPixelData.GetFrame(frameIndex)
-		if err != nil {
-			return fmt.Errorf("failed to get frame %d: %w", frameIndex, err)
-		}
-
-		if len(frameData) == 0 {
-			return fmt.Errorf("frame %d pixel data is empty", frameIndex)
-		}
-		// Encode using full JPEG 2000 pipeline (DWT + HTJ2K block coding + T2)
-		encoded, err := encoder.Encode(frameData)
-		if err != nil {
-			return fmt.Errorf("HTJ2K encode failed for frame %d: %w", frameIndex, err)
-		}
-
-		// Add encoded frame to destination
-		if err := newPixelData.AddFrame(encoded); err != nil {
-			return fmt.Errorf("failed to add encoded frame %d: %w", frameIndex, err)
-		}
-	}
-
-	return nil
+	return sched.Frames(sched.PriorityFromParameters(parameters), frameCount, sched.FrameReader(oldPixelData),
+		func(frameIndex int, frameData []byte) ([]byte, error) {
+			// Encode using full JPEG 2000 pipeline (DWT + HTJ2K block coding + T2)
+			frameParams := *encParams
+			if frameParams.Lossless {
+				frameParams.FrameStats = stats.FromParameters(parameters, stats.FrameOf(frameInfo, frameData))
+			}
+			encoded, err := jpeg2000.NewEncoder(&frameParams).Encode(frameData)
+			if err != nil {
+				return nil, fmt.Errorf("HTJ2K encode failed for frame %d: %w", frameIndex, err)
+			}
+			return encoded, nil
+		},
+		sched.FrameWriter(newPixelData))
 }
 
 // Decode decodes HTJ2K data to uncompressed pixel data
@@ -246,43 +242,10 @@ func (c *Codec) Decode(oldPixelData imagetypes.PixelData, newPixelData imagetype
 		return fmt.Errorf("invalid HTJ2K parameters: %w", err)
 	}
 
-	// Process all frames
-	frameCount := oldPixelData.FrameCount()
-	if frameCount == 0 {
-		return fmt.Errorf("source pixel data is empty (no frames)")
-	}
-	for frameIndex := 0; frameIndex < frameCount; frameIndex++ {
-		// Get encoded frame data
-		frameData, err := oldPixelData.GetFrame(frameIndex)
-		if err != nil {
-			return fmt.Errorf("failed to get frame %d: %w", frameIndex, err)
-		}
-
-		if len(frameData) == 0 {
-			return fmt.Errorf("frame %d pixel data is empty", frameIndex)
-		}
-
-		// Create JPEG 2000 decoder
-		decoder := jpeg2000.NewDecoder()
-
-		// Set HTJ2K block decoder factory
-		// The decoder will use this factory to create HTJ2K block decoders instead of EBCOT T1 decoders
-		decoder.SetBlockDecoderFactory(func(width, height int, _ int) t2.BlockDecoder {
-			return NewHTDecoder(width, height)
-		})
-
-		// Decode using full JPEG 2000 pipeline (T2 + HTJ2K block decoding + Inverse DWT)
-		if err := decoder.Decode(frameData); err != nil {
-			return fmt.Errorf("HTJ2K decode failed for frame %d: %w", frameIndex, err)
-		}
-
-		// Add decoded frame to destination
-		if err := newPixelData.AddFrame(decoder.GetPixelData()); err != nil {
-			return fmt.Errorf("failed to add decoded frame %d: %w", frameIndex, err)
-		}
-	}
-
-	return nil
+	// HTJ2K code-blocks are decoded by the HT block decoder instead of EBCOT.
+	return jpeg2000.DecodeFrames(oldPixelData, newPixelData, parameters, func(width, height int, _ int) t2.BlockDecoder {
+		return NewHTDecoder(width, height)
+	})
 }
 
 // RegisterHTJ2KCodecs registers all HTJ2K codecs with the global registry
@@ -20,8 +20,11 @@ type HTEncoder struct {
 	data []int32 // Wavelet coefficients
 
 	// Encoding state
-	roishift    int
-	kmax        int
+	roishift int
+	kmax     int
+
+	// Optional shared output buffer (see SetOutputArena)
+	arena *[]byte
 
 	// Dimensions in quads
 	qw int // width in quads
@@ -34,10 +37,10 @@ func NewHTEncoder(width, height int) *HTEncoder {
 	qh := (height + 1) / 2
 
 	enc := &HTEncoder{
-		width:       width,
-		height:      height,
-		qw:          qw,
-		qh:          qh,
+		width:  width,
+		height: height,
+		qw:     qw,
+		qh:     qh,
 	}
 
 	return enc
@@ -49,6 +52,11 @@ func (h *HTEncoder) SetKMax(kmax int) {
 	h.kmax = kmax
 }
 
+// SetOutputArena makes the encoder append each coded block to *arena instead
+// of allocating it; the returned block is a sub-slice of the arena.
+func (h *HTEncoder) SetOutputArena(arena *[]byte) {
+	h.arena = arena
+}
 
 // Encode encodes a code-block using HTJ2K HT cleanup pass
 // Reference: ITU-T T.814 | ISO/IEC 15444-15:2019
@@ -231,13 +231,24 @@ func (h *HTEncoder) encodeOpenJPHCleanup(data []int32) ([]byte, error) {
 	melData, vlcData := terminateOJPHMELVLC(mel, vlc)
 	ms.terminate()
 
-	result := make([]byte, 0, len(ms.buf)+len(melData)+len(vlcData))
-	result = append(result, ms.buf...)
-	result = append(result, melData...)
-	result = append(result, vlcData...)
 	if len(melData)+len(vlcData) == 0 {
 		return nil, fmt.Errorf("HTJ2K cleanup suffix is empty")
 	}
+
+	var dst []byte
+	if h.arena != nil {
+		dst = *h.arena
+	} else {
+		dst = make([]byte, 0, len(ms.buf)+len(melData)+len(vlcData))
+	}
+	start := len(dst)
+	dst = append(dst, ms.buf...)
+	dst = append(dst, melData...)
+	dst = append(dst, vlcData...)
+	if h.arena != nil {
+		*h.arena = dst
+	}
+	result := dst[start:len(dst):len(dst)]
 	writeScupLocator(result, len(melData)+len(vlcData))
 	return result, nil
 }
@@ -436,52 +447,6 @@ func ojphEncodeTuple(initial bool, cq, rho, eps int) int {
 	return int(entry)
 }
 
-var ojphEncoderVLCTable0 [2048]uint16
-var ojphEncoderVLCTable1 [2048]uint16
-
-func init() {
-	initOJPHEncoderVLCTable(VLCTbl0, &ojphEncoderVLCTable0)
-	initOJPHEncoderVLCTable(VLCTbl1, &ojphEncoderVLCTable1)
-}
-
-func initOJPHEncoderVLCTable(src []VLCEntry, dst *[2048]uint16) {
-	var best *VLCEntry
-	for i := 0; i < 2048; i++ {
-		cq := i >> 8
-		rho := (i >> 4) & 0xF
-		eps := i & 0xF
-		if (eps&rho) != eps || (rho == 0 && cq == 0) {
-			dst[i] = 0
-			continue
-		}
-		best = nil
-		if eps != 0 {
-			bestEK := -1
-			for j := range src {
-				entry := &src[j]
-				if int(entry.CQ) == cq && int(entry.Rho) == rho && entry.UOff == 1 && (eps&int(entry.EK)) == int(entry.E1) {
-					ones := bits.OnesCount8(entry.EK)
-					if ones >= bestEK {
-						best = entry
-						bestEK = ones
-					}
-				}
-			}
-		} else {
-			for j := range src {
-				entry := &src[j]
-				if int(entry.CQ) == cq && int(entry.Rho) == rho && entry.UOff == 0 {
-					best = entry
-					break
-				}
-			}
-		}
-		if best != nil {
-			dst[i] = uint16(best.Cwd)<<8 | uint16(best.CwdLen)<<4 | uint16(best.EK)
-		}
-	}
-}
-
 func ojphEncodeMagSgn(ms *ojphMSWriter, rho, uq, tuple int, s []uint32) {
 	for i := 0; i < 4; i++ {
 		if rho&(1<<uint(i)) == 0 {
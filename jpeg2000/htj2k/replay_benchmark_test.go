@@ -0,0 +1,68 @@
+package htj2k
+
+import (
+	"testing"
+
+	"github.com/cocosip/go-dicom-codecs/internal/replay"
+)
+
+// htReplay is one recorded HT cleanup segment; see cmd/replay-record.
+type htReplay struct {
+	width, height, kmax int
+	checksum            int64
+	data                []byte
+}
+
+func loadHTReplay(tb testing.TB) []htReplay {
+	tb.Helper()
+	records, err := replay.Read("testdata/replay/ht_cleanup.gz")
+	if err != nil {
+		tb.Fatalf("load corpus: %v", err)
+	}
+	blocks := make([]htReplay, len(records))
+	for i, r := range records {
+		p := r.Params
+		blocks[i] = htReplay{int(p[0]), int(p[1]), int(p[2]), p[3], r.Data}
+	}
+	return blocks
+}
+
+func TestReplayCorpus(t *testing.T) {
+	for i, cb := range loadHTReplay(t) {
+		dec := NewHTDecoder(cb.width, cb.height)
+		dec.SetCodingContext(cb.kmax, cb.kmax-1)
+		decoded, err := dec.Decode(cb.data, 1)
+		if err != nil {
+			t.Fatalf("code-block %d: %v", i, err)
+		}
+		if replay.Checksum(decoded) != cb.checksum {
+			t.Fatalf("code-block %d (%dx%d): coefficients differ from the recording", i, cb.width, cb.height)
+		}
+	}
+}
+
+// BenchmarkReplayHTCleanup decodes cleanup segments of code-blocks recorded
+// from the 5/3 wavelet bands of real CT, MR and XR images; throughput is in
+// segment bytes.
+func BenchmarkReplayHTCleanup(b *testing.B) {
+	blocks := loadHTReplay(b)
+	decoders := make([]*HTDecoder, len(blocks))
+	var total, coefficients int
+	for i, cb := range blocks {
+		decoders[i] = NewHTDecoder(cb.width, cb.height)
+		decoders[i].SetCodingContext(cb.kmax, cb.kmax-1)
+		total += len(cb.data)
+		coefficients += cb.width * cb.height
+	}
+	b.SetBytes(int64(total))
+	b.ReportAllocs()
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		for j, cb := range blocks {
+			if _, err := decoders[j].Decode(cb.data, 1); err != nil {
+				b.Fatal(err)
+			}
+		}
+	}
+	b.ReportMetric(float64(b.Elapsed().Nanoseconds())/float64(b.N*coefficients), "ns/coefficient")
+}
@@ -0,0 +1,878 @@
+// Code generated by "go test -run TestGeneratedTables -update-tables"; DO NOT EDIT.
+
+package htj2k
+
+// VLCDecodeTbl0 contains decoding information for the initial row of quads, indexed by context << 7 | codeword.
+var VLCDecodeTbl0 = [1024]VLCDecoderEntry{
+	{2, 0, 0, 0, 3}, {10, 0, 0, 0, 5}, {4, 0, 0, 0, 3}, {6, 0, 0, 0, 6}, {8, 0, 0, 0, 3}, {14, 1, 10, 8, 6}, {1, 0, 0, 0, 4}, {13, 1, 13, 8, 7},
+	{2, 0, 0, 0, 3}, {11, 1, 1, 0, 6}, {4, 0, 0, 0, 3}, {15, 1, 15, 5, 7}, {8, 0, 0, 0, 3}, {7, 1, 2, 0, 6}, {5, 0, 0, 0, 5}, {5, 1, 5, 1, 7},
+	{2, 0, 0, 0, 3}, {3, 0, 0, 0, 5}, {4, 0, 0, 0, 3}, {4, 1, 4, 4, 6}, {8, 0, 0, 0, 3}, {12, 1, 12, 4, 6}, {1, 0, 0, 0, 4}, {12, 1, 12, 12, 7},
+	{2, 0, 0, 0, 3}, {15, 1, 14, 2, 6}, {4, 0, 0, 0, 3}, {15, 1, 9, 9, 7}, {8, 0, 0, 0, 3}, {9, 0, 0, 0, 6}, {12, 0, 0, 0, 5}, {3, 1, 3, 1, 7},
+	{2, 0, 0, 0, 3}, {10, 0, 0, 0, 5}, {4, 0, 0, 0, 3}, {5, 1, 4, 4, 6}, {8, 0, 0, 0, 3}, {12, 1, 12, 8, 6}, {1, 0, 0, 0, 4}, {13, 1, 1, 1, 7},
+	{2, 0, 0, 0, 3}, {15, 1, 15, 4, 6}, {4, 0, 0, 0, 3}, {15, 1, 15, 12, 7}, {8, 0, 0, 0, 3}, {9, 1, 0, 0, 6}, {5, 0, 0, 0, 5}, {7, 0, 0, 0, 7},
+	{2, 0, 0, 0, 3}, {3, 0, 0, 0, 5}, {4, 0, 0, 0, 3}, {15, 1, 15, 1, 7}, {8, 0, 0, 0, 3}, {10, 1, 8, 8, 6}, {1, 0, 0, 0, 4}, {11, 0, 0, 0, 7},
+	{2, 0, 0, 0, 3}, {15, 1, 15, 8, 6}, {4, 0, 0, 0, 3}, {14, 1, 14, 4, 7}, {8, 0, 0, 0, 3}, {8, 1, 8, 8, 6}, {12, 0, 0, 0, 5}, {1, 1, 1, 1, 7},
+	{2, 0, 0, 0, 3}, {10, 0, 0, 0, 5}, {4, 0, 0, 0, 3}, {6, 0, 0, 0, 6}, {8, 0, 0, 0, 3}, {14, 1, 10, 8, 6}, {1, 0, 0, 0, 4}, {13, 1, 5, 4, 7},
+	{2, 0, 0, 0, 3}, {11, 1, 1, 0, 6}, {4, 0, 0, 0, 3}, {14, 1, 2, 2, 7}, {8, 0, 0, 0, 3}, {7, 1, 2, 0, 6}, {5, 0, 0, 0, 5}, {7, 1, 2, 2, 7},
+	{2, 0, 0, 0, 3}, {3, 0, 0, 0, 5}, {4, 0, 0, 0, 3}, {4, 1, 4, 4, 6}, {8, 0, 0, 0, 3}, {12, 1, 12, 4, 6}, {1, 0, 0, 0, 4}, {11, 1, 1, 1, 7},
+	{2, 0, 0, 0, 3}, {15, 1, 14, 2, 6}, {4, 0, 0, 0, 3}, {15, 0, 0, 0, 7}, {8, 0, 0, 0, 3}, {9, 0, 0, 0, 6}, {12, 0, 0, 0, 5}, {3, 1, 2, 2, 7},
+	{2, 0, 0, 0, 3}, {10, 0, 0, 0, 5}, {4, 0, 0, 0, 3}, {5, 1, 4, 4, 6}, {8, 0, 0, 0, 3}, {12, 1, 12, 8, 6}, {1, 0, 0, 0, 4}, {13, 0, 0, 0, 7},
+	{2, 0, 0, 0, 3}, {15, 1, 15, 4, 6}, {4, 0, 0, 0, 3}, {15, 1, 11, 10, 7}, {8, 0, 0, 0, 3}, {9, 1, 0, 0, 6}, {5, 0, 0, 0, 5}, {6, 1, 0, 0, 7},
+	{2, 0, 0, 0, 3}, {3, 0, 0, 0, 5}, {4, 0, 0, 0, 3}, {15, 1, 14, 6, 7}, {8, 0, 0, 0, 3}, {10, 1, 8, 8, 6}, {1, 0, 0, 0, 4}, {10, 1, 10, 2, 7},
+	{2, 0, 0, 0, 3}, {15, 1, 15, 8, 6}, {4, 0, 0, 0, 3}, {14, 0, 0, 0, 7}, {8, 0, 0, 0, 3}, {8, 1, 8, 8, 6}, {12, 0, 0, 0, 5}, {2, 1, 2, 2, 7},
+	{0, 0, 0, 0, 2}, {12, 0, 0, 0, 5}, {8, 0, 0, 0, 4}, {7, 1, 2, 0, 6}, {0, 0, 0, 0, 2}, {12, 1, 12, 4, 6}, {2, 0, 0, 0, 4}, {15, 0, 0, 0, 7},
+	{0, 0, 0, 0, 2}, {15, 1, 10, 2, 6}, {4, 0, 0, 0, 4}, {5, 0, 0, 0, 6}, {0, 0, 0, 0, 2}, {9, 1, 0, 0, 6}, {1, 0, 0, 0, 4}, {13, 0, 0, 0, 7},
+	{0, 0, 0, 0, 2}, {11, 1, 1, 0, 6}, {8, 0, 0, 0, 4}, {6, 0, 0, 0, 6}, {0, 0, 0, 0, 2}, {10, 1, 8, 8, 6}, {2, 0, 0, 0, 4}, {13, 1, 1, 1, 7},
+	{0, 0, 0, 0, 2}, {14, 1, 10, 8, 6}, {4, 0, 0, 0, 4}, {3, 0, 0, 0, 6}, {0, 0, 0, 0, 2}, {8, 1, 8, 8, 6}, {1, 0, 0, 0, 4}, {1, 1, 1, 1, 7},
+	{0, 0, 0, 0, 2}, {12, 0, 0, 0, 5}, {8, 0, 0, 0, 4}, {6, 1, 0, 0, 6}, {0, 0, 0, 0, 2}, {12, 1, 8, 8, 6}, {2, 0, 0, 0, 4}, {15, 1, 8, 8, 7},
+	{0, 0, 0, 0, 2}, {15, 1, 11, 8, 6}, {4, 0, 0, 0, 4}, {4, 1, 4, 4, 6}, {0, 0, 0, 0, 2}, {9, 0, 0, 0, 6}, {1, 0, 0, 0, 4}, {11, 0, 0, 0, 7},
+	{0, 0, 0, 0, 2}, {15, 1, 14, 4, 6}, {8, 0, 0, 0, 4}, {5, 1, 4, 4, 6}, {0, 0, 0, 0, 2}, {10, 0, 0, 0, 6}, {2, 0, 0, 0, 4}, {14, 0, 0, 0, 7},
+	{0, 0, 0, 0, 2}, {13, 1, 5, 4, 6}, {4, 0, 0, 0, 4}, {2, 1, 2, 2, 6}, {0, 0, 0, 0, 2}, {3, 1, 0, 0, 6}, {1, 0, 0, 0, 4}, {7, 0, 0, 0, 7},
+	{0, 0, 0, 0, 2}, {12, 0, 0, 0, 5}, {8, 0, 0, 0, 4}, {7, 1, 2, 0, 6}, {0, 0, 0, 0, 2}, {12, 1, 12, 4, 6}, {2, 0, 0, 0, 4}, {15, 1, 15, 1, 7},
+	{0, 0, 0, 0, 2}, {15, 1, 10, 2, 6}, {4, 0, 0, 0, 4}, {5, 0, 0, 0, 6}, {0, 0, 0, 0, 2}, {9, 1, 0, 0, 6}, {1, 0, 0, 0, 4}, {11, 1, 1, 1, 7},
+	{0, 0, 0, 0, 2}, {11, 1, 1, 0, 6}, {8, 0, 0, 0, 4}, {6, 0, 0, 0, 6}, {0, 0, 0, 0, 2}, {10, 1, 8, 8, 6}, {2, 0, 0, 0, 4}, {14, 1, 2, 2, 7},
+	{0, 0, 0, 0, 2}, {14, 1, 10, 8, 6}, {4, 0, 0, 0, 4}, {3, 0, 0, 0, 6}, {0, 0, 0, 0, 2}, {8, 1, 8, 8, 6}, {1, 0, 0, 0, 4}, {7, 1, 2, 2, 7},
+	{0, 0, 0, 0, 2}, {12, 0, 0, 0, 5}, {8, 0, 0, 0, 4}, {6, 1, 0, 0, 6}, {0, 0, 0, 0, 2}, {12, 1, 8, 8, 6}, {2, 0, 0, 0, 4}, {14, 1, 14, 4, 7},
+	{0, 0, 0, 0, 2}, {15, 1, 11, 8, 6}, {4, 0, 0, 0, 4}, {4, 1, 4, 4, 6}, {0, 0, 0, 0, 2}, {9, 0, 0, 0, 6}, {1, 0, 0, 0, 4}, {10, 1, 10, 2, 7},
+	{0, 0, 0, 0, 2}, {15, 1, 14, 4, 6}, {8, 0, 0, 0, 4}, {5, 1, 4, 4, 6}, {0, 0, 0, 0, 2}, {10, 0, 0, 0, 6}, {2, 0, 0, 0, 4}, {13, 1, 13, 8, 7},
+	{0, 0, 0, 0, 2}, {13, 1, 5, 4, 6}, {4, 0, 0, 0, 4}, {2, 1, 2, 2, 6}, {0, 0, 0, 0, 2}, {3, 1, 0, 0, 6}, {1, 0, 0, 0, 4}, {5, 1, 5, 1, 7},
+	{0, 0, 0, 0, 2}, {5, 0, 0, 0, 5}, {8, 0, 0, 0, 4}, {6, 0, 0, 0, 6}, {0, 0, 0, 0, 2}, {13, 1, 8, 8, 6}, {2, 0, 0, 0, 4}, {15, 1, 3, 2, 7},
+	{0, 0, 0, 0, 2}, {15, 1, 1, 1, 6}, {4, 0, 0, 0, 4}, {4, 1, 4, 4, 6}, {0, 0, 0, 0, 2}, {10, 1, 0, 0, 6}, {1, 0, 0, 0, 4}, {11, 0, 0, 0, 7},
+	{0, 0, 0, 0, 2}, {7, 1, 3, 1, 6}, {8, 0, 0, 0, 4}, {5, 1, 5, 1, 6}, {0, 0, 0, 0, 2}, {12, 0, 0, 0, 6}, {2, 0, 0, 0, 4}, {13, 0, 0, 0, 7},
+	{0, 0, 0, 0, 2}, {14, 1, 2, 0, 6}, {4, 0, 0, 0, 4}, {1, 1, 1, 1, 6}, {0, 0, 0, 0, 2}, {9, 1, 0, 0, 6}, {1, 0, 0, 0, 4}, {7, 0, 0, 0, 7},
+	{0, 0, 0, 0, 2}, {5, 0, 0, 0, 5}, {8, 0, 0, 0, 4}, {5, 1, 5, 4, 6}, {0, 0, 0, 0, 2}, {12, 1, 4, 4, 6}, {2, 0, 0, 0, 4}, {14, 0, 0, 0, 7},
+	{0, 0, 0, 0, 2}, {15, 1, 15, 1, 6}, {4, 0, 0, 0, 4}, {3, 0, 0, 0, 6}, {0, 0, 0, 0, 2}, {10, 0, 0, 0, 6}, {1, 0, 0, 0, 4}, {5, 1, 5, 5, 7},
+	{0, 0, 0, 0, 2}, {15, 1, 7, 4, 6}, {8, 0, 0, 0, 4}, {3, 1, 1, 1, 6}, {0, 0, 0, 0, 2}, {11, 1, 2, 0, 6}, {2, 0, 0, 0, 4}, {7, 1, 7, 4, 7},
+	{0, 0, 0, 0, 2}, {13, 1, 12, 4, 6}, {4, 0, 0, 0, 4}, {15, 1, 15, 8, 7}, {0, 0, 0, 0, 2}, {9, 0, 0, 0, 6}, {1, 0, 0, 0, 4}, {2, 1, 2, 2, 7},
+	{0, 0, 0, 0, 2}, {5, 0, 0, 0, 5}, {8, 0, 0, 0, 4}, {6, 0, 0, 0, 6}, {0, 0, 0, 0, 2}, {13, 1, 8, 8, 6}, {2, 0, 0, 0, 4}, {15, 0, 0, 0, 7},
+	{0, 0, 0, 0, 2}, {15, 1, 1, 1, 6}, {4, 0, 0, 0, 4}, {4, 1, 4, 4, 6}, {0, 0, 0, 0, 2}, {10, 1, 0, 0, 6}, {1, 0, 0, 0, 4}, {8, 1, 8, 8, 7},
+	{0, 0, 0, 0, 2}, {7, 1, 3, 1, 6}, {8, 0, 0, 0, 4}, {5, 1, 5, 1, 6}, {0, 0, 0, 0, 2}, {12, 0, 0, 0, 6}, {2, 0, 0, 0, 4}, {12, 1, 12, 8, 7},
+	{0, 0, 0, 0, 2}, {14, 1, 2, 0, 6}, {4, 0, 0, 0, 4}, {1, 1, 1, 1, 6}, {0, 0, 0, 0, 2}, {9, 1, 0, 0, 6}, {1, 0, 0, 0, 4}, {6, 1, 0, 0, 7},
+	{0, 0, 0, 0, 2}, {5, 0, 0, 0, 5}, {8, 0, 0, 0, 4}, {5, 1, 5, 4, 6}, {0, 0, 0, 0, 2}, {12, 1, 4, 4, 6}, {2, 0, 0, 0, 4}, {13, 1, 13, 1, 7},
+	{0, 0, 0, 0, 2}, {15, 1, 15, 1, 6}, {4, 0, 0, 0, 4}, {3, 0, 0, 0, 6}, {0, 0, 0, 0, 2}, {10, 0, 0, 0, 6}, {1, 0, 0, 0, 4}, {7, 1, 2, 2, 7},
+	{0, 0, 0, 0, 2}, {15, 1, 7, 4, 6}, {8, 0, 0, 0, 4}, {3, 1, 1, 1, 6}, {0, 0, 0, 0, 2}, {11, 1, 2, 0, 6}, {2, 0, 0, 0, 4}, {11, 1, 2, 2, 7},
+	{0, 0, 0, 0, 2}, {13, 1, 12, 4, 6}, {4, 0, 0, 0, 4}, {14, 1, 2, 2, 7}, {0, 0, 0, 0, 2}, {9, 0, 0, 0, 6}, {1, 0, 0, 0, 4}, {3, 1, 3, 2, 7},
+	{0, 0, 0, 0, 3}, {13, 1, 13, 4, 6}, {15, 1, 15, 4, 5}, {15, 1, 15, 12, 7}, {1, 0, 0, 0, 4}, {3, 1, 1, 1, 6}, {5, 0, 0, 0, 5}, {8, 1, 8, 8, 7},
+	{0, 0, 0, 0, 3}, {11, 1, 3, 2, 6}, {8, 0, 0, 0, 5}, {14, 0, 0, 0, 7}, {2, 0, 0, 0, 5}, {5, 1, 5, 1, 6}, {15, 1, 10, 10, 6}, {7, 1, 7, 2, 7},
+	{0, 0, 0, 0, 3}, {12, 1, 4, 4, 6}, {15, 1, 15, 8, 5}, {14, 1, 4, 4, 7}, {1, 0, 0, 0, 4}, {7, 1, 6, 4, 6}, {4, 0, 0, 0, 5}, {10, 1, 10, 2, 7},
+	{0, 0, 0, 0, 3}, {10, 0, 0, 0, 6}, {5, 1, 5, 5, 5}, {13, 1, 9, 9, 7}, {15, 1, 15, 1, 5}, {3, 0, 0, 0, 6}, {15, 1, 15, 5, 6}, {6, 1, 6, 2, 7},
+	{0, 0, 0, 0, 3}, {13, 1, 13, 1, 6}, {15, 1, 15, 4, 5}, {15, 1, 14, 6, 7}, {1, 0, 0, 0, 4}, {7, 1, 7, 1, 6}, {5, 0, 0, 0, 5}, {11, 1, 11, 1, 7},
+	{0, 0, 0, 0, 3}, {10, 1, 8, 8, 6}, {8, 0, 0, 0, 5}, {13, 1, 13, 5, 7}, {2, 0, 0, 0, 5}, {4, 1, 4, 4, 6}, {15, 1, 15, 2, 6}, {7, 1, 6, 6, 7},
+	{0, 0, 0, 0, 3}, {12, 0, 0, 0, 6}, {15, 1, 15, 8, 5}, {14, 1, 14, 2, 7}, {1, 0, 0, 0, 4}, {5, 1, 5, 4, 6}, {4, 0, 0, 0, 5}, {9, 1, 1, 1, 7},
+	{0, 0, 0, 0, 3}, {9, 0, 0, 0, 6}, {5, 1, 5, 5, 5}, {12, 1, 12, 8, 7}, {15, 1, 15, 1, 5}, {1, 1, 1, 1, 6}, {14, 1, 12, 8, 6}, {6, 0, 0, 0, 7},
+	{0, 0, 0, 0, 3}, {13, 1, 13, 4, 6}, {15, 1, 15, 4, 5}, {15, 1, 15, 3, 7}, {1, 0, 0, 0, 4}, {3, 1, 1, 1, 6}, {5, 0, 0, 0, 5}, {11, 1, 1, 1, 7},
+	{0, 0, 0, 0, 3}, {11, 1, 3, 2, 6}, {8, 0, 0, 0, 5}, {13, 1, 13, 8, 7}, {2, 0, 0, 0, 5}, {5, 1, 5, 1, 6}, {15, 1, 10, 10, 6}, {2, 1, 2, 2, 7},
+	{0, 0, 0, 0, 3}, {12, 1, 4, 4, 6}, {15, 1, 15, 8, 5}, {15, 0, 0, 0, 7}, {1, 0, 0, 0, 4}, {7, 1, 6, 4, 6}, {4, 0, 0, 0, 5}, {9, 1, 9, 8, 7},
+	{0, 0, 0, 0, 3}, {10, 0, 0, 0, 6}, {5, 1, 5, 5, 5}, {13, 0, 0, 0, 7}, {15, 1, 15, 1, 5}, {3, 0, 0, 0, 6}, {15, 1, 15, 5, 6}, {6, 1, 4, 4, 7},
+	{0, 0, 0, 0, 3}, {13, 1, 13, 1, 6}, {15, 1, 15, 4, 5}, {15, 1, 11, 9, 7}, {1, 0, 0, 0, 4}, {7, 1, 7, 1, 6}, {5, 0, 0, 0, 5}, {11, 0, 0, 0, 7},
+	{0, 0, 0, 0, 3}, {10, 1, 8, 8, 6}, {8, 0, 0, 0, 5}, {13, 1, 13, 12, 7}, {2, 0, 0, 0, 5}, {4, 1, 4, 4, 6}, {15, 1, 15, 2, 6}, {7, 0, 0, 0, 7},
+	{0, 0, 0, 0, 3}, {12, 0, 0, 0, 6}, {15, 1, 15, 8, 5}, {14, 1, 14, 4, 7}, {1, 0, 0, 0, 4}, {5, 1, 5, 4, 6}, {4, 0, 0, 0, 5}, {7, 1, 7, 3, 7},
+	{0, 0, 0, 0, 3}, {9, 0, 0, 0, 6}, {5, 1, 5, 5, 5}, {11, 1, 11, 8, 7}, {15, 1, 15, 1, 5}, {1, 1, 1, 1, 6}, {14, 1, 12, 8, 6}, {3, 1, 3, 2, 7},
+	{0, 0, 0, 0, 2}, {10, 0, 0, 0, 5}, {8, 0, 0, 0, 4}, {7, 1, 4, 0, 6}, {0, 0, 0, 0, 2}, {13, 1, 1, 0, 6}, {2, 0, 0, 0, 4}, {13, 1, 1, 1, 7},
+	{0, 0, 0, 0, 2}, {15, 1, 7, 2, 6}, {4, 0, 0, 0, 4}, {5, 0, 0, 0, 6}, {0, 0, 0, 0, 2}, {10, 1, 10, 8, 6}, {1, 0, 0, 0, 4}, {11, 1, 11, 2, 7},
+	{0, 0, 0, 0, 2}, {9, 0, 0, 0, 6}, {8, 0, 0, 0, 4}, {6, 0, 0, 0, 6}, {0, 0, 0, 0, 2}, {12, 0, 0, 0, 6}, {2, 0, 0, 0, 4}, {14, 0, 0, 0, 7},
+	{0, 0, 0, 0, 2}, {14, 1, 12, 8, 6}, {4, 0, 0, 0, 4}, {2, 1, 2, 2, 6}, {0, 0, 0, 0, 2}, {8, 1, 8, 8, 6}, {1, 0, 0, 0, 4}, {7, 0, 0, 0, 7},
+	{0, 0, 0, 0, 2}, {10, 0, 0, 0, 5}, {8, 0, 0, 0, 4}, {6, 1, 0, 0, 6}, {0, 0, 0, 0, 2}, {12, 1, 8, 8, 6}, {2, 0, 0, 0, 4}, {15, 0, 0, 0, 7},
+	{0, 0, 0, 0, 2}, {15, 1, 9, 1, 6}, {4, 0, 0, 0, 4}, {3, 0, 0, 0, 6}, {0, 0, 0, 0, 2}, {10, 1, 10, 2, 6}, {1, 0, 0, 0, 4}, {10, 1, 10, 10, 7},
+	{0, 0, 0, 0, 2}, {15, 1, 11, 8, 6}, {8, 0, 0, 0, 4}, {5, 1, 0, 0, 6}, {0, 0, 0, 0, 2}, {11, 1, 0, 0, 6}, {2, 0, 0, 0, 4}, {12, 1, 12, 4, 7},
+	{0, 0, 0, 0, 2}, {14, 1, 4, 4, 6}, {4, 0, 0, 0, 4}, {15, 1, 15, 4, 7}, {0, 0, 0, 0, 2}, {3, 1, 2, 2, 6}, {1, 0, 0, 0, 4}, {1, 1, 1, 1, 7},
+	{0, 0, 0, 0, 2}, {10, 0, 0, 0, 5}, {8, 0, 0, 0, 4}, {7, 1, 4, 0, 6}, {0, 0, 0, 0, 2}, {13, 1, 1, 0, 6}, {2, 0, 0, 0, 4}, {15, 1, 9, 9, 7},
+	{0, 0, 0, 0, 2}, {15, 1, 7, 2, 6}, {4, 0, 0, 0, 4}, {5, 0, 0, 0, 6}, {0, 0, 0, 0, 2}, {10, 1, 10, 8, 6}, {1, 0, 0, 0, 4}, {11, 0, 0, 0, 7},
+	{0, 0, 0, 0, 2}, {9, 0, 0, 0, 6}, {8, 0, 0, 0, 4}, {6, 0, 0, 0, 6}, {0, 0, 0, 0, 2}, {12, 0, 0, 0, 6}, {2, 0, 0, 0, 4}, {13, 0, 0, 0, 7},
+	{0, 0, 0, 0, 2}, {14, 1, 12, 8, 6}, {4, 0, 0, 0, 4}, {2, 1, 2, 2, 6}, {0, 0, 0, 0, 2}, {8, 1, 8, 8, 6}, {1, 0, 0, 0, 4}, {4, 1, 4, 4, 7},
+	{0, 0, 0, 0, 2}, {10, 0, 0, 0, 5}, {8, 0, 0, 0, 4}, {6, 1, 0, 0, 6}, {0, 0, 0, 0, 2}, {12, 1, 8, 8, 6}, {2, 0, 0, 0, 4}, {14, 1, 14, 2, 7},
+	{0, 0, 0, 0, 2}, {15, 1, 9, 1, 6}, {4, 0, 0, 0, 4}, {3, 0, 0, 0, 6}, {0, 0, 0, 0, 2}, {10, 1, 10, 2, 6}, {1, 0, 0, 0, 4}, {7, 1, 4, 4, 7},
+	{0, 0, 0, 0, 2}, {15, 1, 11, 8, 6}, {8, 0, 0, 0, 4}, {5, 1, 0, 0, 6}, {0, 0, 0, 0, 2}, {11, 1, 0, 0, 6}, {2, 0, 0, 0, 4}, {9, 1, 0, 0, 7},
+	{0, 0, 0, 0, 2}, {14, 1, 4, 4, 6}, {4, 0, 0, 0, 4}, {15, 1, 7, 6, 7}, {0, 0, 0, 0, 2}, {3, 1, 2, 2, 6}, {1, 0, 0, 0, 4}, {3, 1, 3, 1, 7},
+	{0, 0, 0, 0, 3}, {12, 0, 0, 0, 6}, {8, 0, 0, 0, 5}, {15, 1, 13, 9, 7}, {15, 1, 15, 2, 5}, {7, 1, 6, 4, 6}, {15, 1, 15, 1, 6}, {11, 1, 9, 9, 7},
+	{0, 0, 0, 0, 3}, {10, 1, 10, 2, 6}, {2, 0, 0, 0, 5}, {14, 1, 6, 6, 7}, {15, 1, 15, 4, 5}, {5, 0, 0, 0, 6}, {14, 1, 14, 2, 6}, {7, 1, 7, 3, 7},
+	{0, 0, 0, 0, 3}, {11, 1, 9, 8, 6}, {4, 0, 0, 0, 5}, {15, 0, 0, 0, 7}, {15, 1, 15, 8, 5}, {6, 0, 0, 0, 6}, {15, 1, 7, 6, 6}, {9, 1, 8, 8, 7},
+	{0, 0, 0, 0, 3}, {8, 1, 8, 8, 6}, {1, 0, 0, 0, 5}, {13, 1, 13, 5, 7}, {10, 0, 0, 0, 5}, {2, 1, 2, 2, 6}, {13, 1, 9, 8, 6}, {4, 1, 4, 4, 7},
+	{0, 0, 0, 0, 3}, {11, 1, 11, 2, 6}, {8, 0, 0, 0, 5}, {15, 1, 15, 12, 7}, {15, 1, 15, 2, 5}, {6, 1, 2, 2, 6}, {9, 0, 0, 0, 6}, {11, 0, 0, 0, 7},
+	{0, 0, 0, 0, 3}, {10, 1, 10, 10, 6}, {2, 0, 0, 0, 5}, {13, 1, 13, 1, 7}, {15, 1, 15, 4, 5}, {3, 0, 0, 0, 6}, {13, 1, 13, 4, 6}, {6, 1, 6, 4, 7},
+	{0, 0, 0, 0, 3}, {10, 1, 10, 8, 6}, {4, 0, 0, 0, 5}, {14, 1, 14, 10, 7}, {15, 1, 15, 8, 5}, {5, 1, 4, 4, 6}, {14, 1, 14, 8, 6}, {7, 1, 7, 1, 7},
+	{0, 0, 0, 0, 3}, {3, 1, 3, 2, 6}, {1, 0, 0, 0, 5}, {12, 1, 12, 4, 7}, {10, 0, 0, 0, 5}, {15, 1, 15, 10, 7}, {12, 1, 8, 8, 6}, {3, 1, 3, 1, 7},
+	{0, 0, 0, 0, 3}, {12, 0, 0, 0, 6}, {8, 0, 0, 0, 5}, {15, 1, 7, 7, 7}, {15, 1, 15, 2, 5}, {7, 1, 6, 4, 6}, {15, 1, 15, 1, 6}, {11, 1, 11, 3, 7},
+	{0, 0, 0, 0, 3}, {10, 1, 10, 2, 6}, {2, 0, 0, 0, 5}, {14, 0, 0, 0, 7}, {15, 1, 15, 4, 5}, {5, 0, 0, 0, 6}, {14, 1, 14, 2, 6}, {7, 0, 0, 0, 7},
+	{0, 0, 0, 0, 3}, {11, 1, 9, 8, 6}, {4, 0, 0, 0, 5}, {14, 1, 14, 4, 7}, {15, 1, 15, 8, 5}, {6, 0, 0, 0, 6}, {15, 1, 7, 6, 6}, {7, 1, 6, 6, 7},
+	{0, 0, 0, 0, 3}, {8, 1, 8, 8, 6}, {1, 0, 0, 0, 5}, {13, 0, 0, 0, 7}, {10, 0, 0, 0, 5}, {2, 1, 2, 2, 6}, {13, 1, 9, 8, 6}, {3, 1, 3, 3, 7},
+	{0, 0, 0, 0, 3}, {11, 1, 11, 2, 6}, {8, 0, 0, 0, 5}, {15, 1, 7, 5, 7}, {15, 1, 15, 2, 5}, {6, 1, 2, 2, 6}, {9, 0, 0, 0, 6}, {9, 1, 9, 1, 7},
+	{0, 0, 0, 0, 3}, {10, 1, 10, 10, 6}, {2, 0, 0, 0, 5}, {13, 1, 9, 9, 7}, {15, 1, 15, 4, 5}, {3, 0, 0, 0, 6}, {13, 1, 13, 4, 6}, {5, 1, 5, 1, 7},
+	{0, 0, 0, 0, 3}, {10, 1, 10, 8, 6}, {4, 0, 0, 0, 5}, {14, 1, 14, 12, 7}, {15, 1, 15, 8, 5}, {5, 1, 4, 4, 6}, {14, 1, 14, 8, 6}, {7, 1, 7, 2, 7},
+	{0, 0, 0, 0, 3}, {3, 1, 3, 2, 6}, {1, 0, 0, 0, 5}, {11, 1, 11, 1, 7}, {10, 0, 0, 0, 5}, {15, 1, 15, 3, 7}, {12, 1, 8, 8, 6}, {1, 1, 1, 1, 7},
+	{0, 0, 0, 0, 3}, {13, 1, 5, 4, 6}, {15, 1, 15, 2, 5}, {1, 1, 1, 1, 6}, {1, 0, 0, 0, 4}, {7, 1, 6, 4, 6}, {15, 1, 15, 8, 6}, {12, 1, 12, 12, 7},
+	{0, 0, 0, 0, 3}, {11, 1, 9, 1, 6}, {4, 0, 0, 0, 5}, {14, 1, 2, 2, 7}, {2, 0, 0, 0, 5}, {2, 1, 2, 2, 6}, {15, 1, 15, 3, 6}, {8, 1, 8, 8, 7},
+	{0, 0, 0, 0, 3}, {12, 0, 0, 0, 6}, {8, 0, 0, 0, 5}, {15, 0, 0, 0, 7}, {1, 0, 0, 0, 4}, {5, 1, 1, 1, 6}, {15, 1, 15, 12, 6}, {10, 1, 10, 8, 7},
+	{0, 0, 0, 0, 3}, {10, 0, 0, 0, 6}, {3, 0, 0, 0, 5}, {13, 1, 12, 8, 7}, {15, 1, 15, 1, 5}, {3, 1, 3, 1, 6}, {15, 1, 6, 6, 6}, {6, 1, 6, 4, 7},
+	{0, 0, 0, 0, 3}, {12, 1, 12, 8, 6}, {15, 1, 15, 2, 5}, {15, 1, 15, 5, 7}, {1, 0, 0, 0, 4}, {6, 0, 0, 0, 6}, {15, 1, 15, 4, 6}, {11, 1, 11, 10, 7},
+	{0, 0, 0, 0, 3}, {10, 1, 2, 2, 6}, {4, 0, 0, 0, 5}, {14, 0, 0, 0, 7}, {2, 0, 0, 0, 5}, {3, 1, 3, 2, 6}, {15, 1, 14, 10, 6}, {7, 1, 7, 3, 7},
+	{0, 0, 0, 0, 3}, {11, 1, 11, 2, 6}, {8, 0, 0, 0, 5}, {13, 1, 5, 5, 7}, {1, 0, 0, 0, 4}, {5, 0, 0, 0, 6}, {7, 1, 7, 1, 6}, {9, 1, 1, 1, 7},
+	{0, 0, 0, 0, 3}, {9, 0, 0, 0, 6}, {3, 0, 0, 0, 5}, {12, 1, 12, 4, 7}, {15, 1, 15, 1, 5}, {3, 1, 3, 3, 6}, {14, 1, 14, 8, 6}, {4, 1, 4, 4, 7},
+	{0, 0, 0, 0, 3}, {13, 1, 5, 4, 6}, {15, 1, 15, 2, 5}, {1, 1, 1, 1, 6}, {1, 0, 0, 0, 4}, {7, 1, 6, 4, 6}, {15, 1, 15, 8, 6}, {11, 1, 9, 9, 7},
+	{0, 0, 0, 0, 3}, {11, 1, 9, 1, 6}, {4, 0, 0, 0, 5}, {14, 1, 14, 2, 7}, {2, 0, 0, 0, 5}, {2, 1, 2, 2, 6}, {15, 1, 15, 3, 6}, {7, 1, 6, 6, 7},
+	{0, 0, 0, 0, 3}, {12, 0, 0, 0, 6}, {8, 0, 0, 0, 5}, {14, 1, 14, 4, 7}, {1, 0, 0, 0, 4}, {5, 1, 1, 1, 6}, {15, 1, 15, 12, 6}, {9, 1, 9, 8, 7},
+	{0, 0, 0, 0, 3}, {10, 0, 0, 0, 6}, {3, 0, 0, 0, 5}, {13, 0, 0, 0, 7}, {15, 1, 15, 1, 5}, {3, 1, 3, 1, 6}, {15, 1, 6, 6, 6}, {6, 1, 2, 2, 7},
+	{0, 0, 0, 0, 3}, {12, 1, 12, 8, 6}, {15, 1, 15, 2, 5}, {15, 1, 11, 9, 7}, {1, 0, 0, 0, 4}, {6, 0, 0, 0, 6}, {15, 1, 15, 4, 6}, {11, 0, 0, 0, 7},
+	{0, 0, 0, 0, 3}, {10, 1, 2, 2, 6}, {4, 0, 0, 0, 5}, {13, 1, 13, 1, 7}, {2, 0, 0, 0, 5}, {3, 1, 3, 2, 6}, {15, 1, 14, 10, 6}, {7, 0, 0, 0, 7},
+	{0, 0, 0, 0, 3}, {11, 1, 11, 2, 6}, {8, 0, 0, 0, 5}, {14, 1, 14, 12, 7}, {1, 0, 0, 0, 4}, {5, 0, 0, 0, 6}, {7, 1, 7, 1, 6}, {7, 1, 7, 2, 7},
+	{0, 0, 0, 0, 3}, {9, 0, 0, 0, 6}, {3, 0, 0, 0, 5}, {11, 1, 11, 8, 7}, {15, 1, 15, 1, 5}, {3, 1, 3, 3, 6}, {14, 1, 14, 8, 6}, {5, 1, 5, 4, 7},
+	{15, 1, 15, 1, 4}, {13, 1, 13, 1, 6}, {15, 1, 15, 10, 5}, {13, 0, 0, 0, 7}, {15, 1, 15, 8, 4}, {1, 0, 0, 0, 6}, {15, 1, 15, 15, 5}, {7, 1, 7, 4, 7},
+	{15, 1, 15, 4, 4}, {7, 1, 7, 1, 6}, {15, 1, 15, 3, 5}, {11, 1, 11, 3, 7}, {15, 1, 15, 2, 4}, {14, 1, 14, 10, 7}, {14, 1, 14, 8, 6}, {4, 1, 4, 4, 7},
+	{15, 1, 15, 1, 4}, {10, 1, 2, 2, 6}, {0, 0, 0, 0, 5}, {11, 1, 11, 8, 7}, {15, 1, 15, 8, 4}, {15, 0, 0, 0, 7}, {15, 1, 15, 12, 6}, {7, 0, 0, 0, 7},
+	{15, 1, 15, 4, 4}, {5, 1, 1, 1, 6}, {15, 1, 15, 5, 5}, {7, 1, 7, 5, 7}, {15, 1, 15, 2, 4}, {13, 1, 13, 8, 7}, {14, 1, 14, 2, 6}, {3, 1, 3, 3, 7},
+	{15, 1, 15, 1, 4}, {11, 1, 11, 2, 6}, {15, 1, 15, 10, 5}, {12, 1, 8, 8, 7}, {15, 1, 15, 8, 4}, {15, 1, 15, 11, 7}, {15, 1, 15, 15, 5}, {7, 1, 7, 3, 7},
+	{15, 1, 15, 4, 4}, {6, 1, 0, 0, 6}, {15, 1, 15, 3, 5}, {11, 0, 0, 0, 7}, {15, 1, 15, 2, 4}, {14, 1, 6, 6, 7}, {15, 1, 15, 9, 6}, {3, 1, 3, 1, 7},
+	{15, 1, 15, 1, 4}, {9, 1, 0, 0, 6}, {0, 0, 0, 0, 5}, {11, 1, 11, 10, 7}, {15, 1, 15, 8, 4}, {15, 1, 15, 13, 7}, {15, 1, 15, 6, 6}, {6, 0, 0, 0, 7},
+	{15, 1, 15, 4, 4}, {2, 0, 0, 0, 6}, {15, 1, 15, 5, 5}, {8, 1, 8, 8, 7}, {15, 1, 15, 2, 4}, {13, 1, 13, 12, 7}, {13, 1, 13, 4, 6}, {2, 1, 2, 2, 7},
+	{15, 1, 15, 1, 4}, {13, 1, 13, 1, 6}, {15, 1, 15, 10, 5}, {12, 1, 12, 4, 7}, {15, 1, 15, 8, 4}, {1, 0, 0, 0, 6}, {15, 1, 15, 15, 5}, {7, 1, 7, 2, 7},
+	{15, 1, 15, 4, 4}, {7, 1, 7, 1, 6}, {15, 1, 15, 3, 5}, {11, 1, 9, 9, 7}, {15, 1, 15, 2, 4}, {14, 1, 14, 12, 7}, {14, 1, 14, 8, 6}, {4, 0, 0, 0, 7},
+	{15, 1, 15, 1, 4}, {10, 1, 2, 2, 6}, {0, 0, 0, 0, 5}, {10, 0, 0, 0, 7}, {15, 1, 15, 8, 4}, {15, 1, 15, 7, 7}, {15, 1, 15, 12, 6}, {5, 0, 0, 0, 7},
+	{15, 1, 15, 4, 4}, {5, 1, 1, 1, 6}, {15, 1, 15, 5, 5}, {9, 0, 0, 0, 7}, {15, 1, 15, 2, 4}, {13, 1, 13, 5, 7}, {14, 1, 14, 2, 6}, {3, 0, 0, 0, 7},
+	{15, 1, 15, 1, 4}, {11, 1, 11, 2, 6}, {15, 1, 15, 10, 5}, {12, 0, 0, 0, 7}, {15, 1, 15, 8, 4}, {15, 1, 15, 14, 7}, {15, 1, 15, 15, 5}, {7, 1, 6, 6, 7},
+	{15, 1, 15, 4, 4}, {6, 1, 0, 0, 6}, {15, 1, 15, 3, 5}, {10, 1, 10, 8, 7}, {15, 1, 15, 2, 4}, {14, 0, 0, 0, 7}, {15, 1, 15, 9, 6}, {3, 1, 3, 2, 7},
+	{15, 1, 15, 1, 4}, {9, 1, 0, 0, 6}, {0, 0, 0, 0, 5}, {11, 1, 11, 1, 7}, {15, 1, 15, 8, 4}, {14, 1, 14, 4, 7}, {15, 1, 15, 6, 6}, {5, 1, 5, 4, 7},
+	{15, 1, 15, 4, 4}, {2, 0, 0, 0, 6}, {15, 1, 15, 5, 5}, {8, 0, 0, 0, 7}, {15, 1, 15, 2, 4}, {13, 1, 9, 9, 7}, {13, 1, 13, 4, 6}, {1, 1, 1, 1, 7},
+}
+
+// VLCDecodeTbl1 contains decoding information for non-initial rows of quads, indexed by context << 7 | codeword.
+var VLCDecodeTbl1 = [1024]VLCDecoderEntry{
+	{1, 0, 0, 0, 3}, {6, 0, 0, 0, 5}, {4, 0, 0, 0, 3}, {13, 1, 0, 0, 6}, {8, 0, 0, 0, 3}, {8, 1, 8, 8, 5}, {2, 0, 0, 0, 3}, {4, 1, 4, 4, 6},
+	{1, 0, 0, 0, 3}, {10, 0, 0, 0, 5}, {4, 0, 0, 0, 3}, {10, 1, 8, 8, 6}, {8, 0, 0, 0, 3}, {3, 0, 0, 0, 5}, {2, 0, 0, 0, 3}, {13, 0, 0, 0, 7},
+	{1, 0, 0, 0, 3}, {12, 0, 0, 0, 5}, {4, 0, 0, 0, 3}, {9, 1, 0, 0, 6}, {8, 0, 0, 0, 3}, {5, 0, 0, 0, 5}, {2, 0, 0, 0, 3}, {2, 1, 2, 2, 6},
+	{1, 0, 0, 0, 3}, {9, 0, 0, 0, 5}, {4, 0, 0, 0, 3}, {7, 1, 0, 0, 6}, {8, 0, 0, 0, 3}, {15, 1, 1, 0, 6}, {2, 0, 0, 0, 3}, {7, 0, 0, 0, 7},
+	{1, 0, 0, 0, 3}, {6, 0, 0, 0, 5}, {4, 0, 0, 0, 3}, {12, 1, 8, 8, 6}, {8, 0, 0, 0, 3}, {8, 1, 8, 8, 5}, {2, 0, 0, 0, 3}, {1, 1, 1, 1, 6},
+	{1, 0, 0, 0, 3}, {10, 0, 0, 0, 5}, {4, 0, 0, 0, 3}, {5, 1, 0, 0, 6}, {8, 0, 0, 0, 3}, {3, 0, 0, 0, 5}, {2, 0, 0, 0, 3}, {14, 0, 0, 0, 7},
+	{1, 0, 0, 0, 3}, {12, 0, 0, 0, 5}, {4, 0, 0, 0, 3}, {11, 1, 0, 0, 6}, {8, 0, 0, 0, 3}, {5, 0, 0, 0, 5}, {2, 0, 0, 0, 3}, {15, 1, 1, 1, 7},
+	{1, 0, 0, 0, 3}, {9, 0, 0, 0, 5}, {4, 0, 0, 0, 3}, {3, 1, 0, 0, 6}, {8, 0, 0, 0, 3}, {14, 1, 4, 0, 6}, {2, 0, 0, 0, 3}, {10, 1, 10, 2, 7},
+	{1, 0, 0, 0, 3}, {6, 0, 0, 0, 5}, {4, 0, 0, 0, 3}, {13, 1, 0, 0, 6}, {8, 0, 0, 0, 3}, {8, 1, 8, 8, 5}, {2, 0, 0, 0, 3}, {4, 1, 4, 4, 6},
+	{1, 0, 0, 0, 3}, {10, 0, 0, 0, 5}, {4, 0, 0, 0, 3}, {10, 1, 8, 8, 6}, {8, 0, 0, 0, 3}, {3, 0, 0, 0, 5}, {2, 0, 0, 0, 3}, {14, 1, 4, 4, 7},
+	{1, 0, 0, 0, 3}, {12, 0, 0, 0, 5}, {4, 0, 0, 0, 3}, {9, 1, 0, 0, 6}, {8, 0, 0, 0, 3}, {5, 0, 0, 0, 5}, {2, 0, 0, 0, 3}, {2, 1, 2, 2, 6},
+	{1, 0, 0, 0, 3}, {9, 0, 0, 0, 5}, {4, 0, 0, 0, 3}, {7, 1, 0, 0, 6}, {8, 0, 0, 0, 3}, {15, 1, 1, 0, 6}, {2, 0, 0, 0, 3}, {11, 0, 0, 0, 7},
+	{1, 0, 0, 0, 3}, {6, 0, 0, 0, 5}, {4, 0, 0, 0, 3}, {12, 1, 8, 8, 6}, {8, 0, 0, 0, 3}, {8, 1, 8, 8, 5}, {2, 0, 0, 0, 3}, {1, 1, 1, 1, 6},
+	{1, 0, 0, 0, 3}, {10, 0, 0, 0, 5}, {4, 0, 0, 0, 3}, {5, 1, 0, 0, 6}, {8, 0, 0, 0, 3}, {3, 0, 0, 0, 5}, {2, 0, 0, 0, 3}, {12, 1, 12, 4, 7},
+	{1, 0, 0, 0, 3}, {12, 0, 0, 0, 5}, {4, 0, 0, 0, 3}, {11, 1, 0, 0, 6}, {8, 0, 0, 0, 3}, {5, 0, 0, 0, 5}, {2, 0, 0, 0, 3}, {15, 0, 0, 0, 7},
+	{1, 0, 0, 0, 3}, {9, 0, 0, 0, 5}, {4, 0, 0, 0, 3}, {3, 1, 0, 0, 6}, {8, 0, 0, 0, 3}, {14, 1, 4, 0, 6}, {2, 0, 0, 0, 3}, {6, 1, 0, 0, 7},
+	{0, 0, 0, 0, 1}, {8, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {5, 0, 0, 0, 6}, {0, 0, 0, 0, 1}, {1, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {13, 0, 0, 0, 7},
+	{0, 0, 0, 0, 1}, {2, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {9, 0, 0, 0, 6}, {0, 0, 0, 0, 1}, {4, 0, 0, 0, 5}, {0, 0, 0, 0, 1}, {7, 0, 0, 0, 7},
+	{0, 0, 0, 0, 1}, {8, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {12, 0, 0, 0, 6}, {0, 0, 0, 0, 1}, {1, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {8, 1, 8, 8, 7},
+	{0, 0, 0, 0, 1}, {2, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {15, 0, 0, 0, 7}, {0, 0, 0, 0, 1}, {3, 0, 0, 0, 5}, {0, 0, 0, 0, 1}, {2, 1, 2, 2, 7},
+	{0, 0, 0, 0, 1}, {8, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {15, 1, 4, 0, 6}, {0, 0, 0, 0, 1}, {1, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {11, 0, 0, 0, 7},
+	{0, 0, 0, 0, 1}, {2, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {11, 1, 0, 0, 7}, {0, 0, 0, 0, 1}, {4, 0, 0, 0, 5}, {0, 0, 0, 0, 1}, {6, 0, 0, 0, 7},
+	{0, 0, 0, 0, 1}, {8, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {10, 0, 0, 0, 6}, {0, 0, 0, 0, 1}, {1, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {4, 1, 4, 4, 7},
+	{0, 0, 0, 0, 1}, {2, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {14, 0, 0, 0, 7}, {0, 0, 0, 0, 1}, {3, 0, 0, 0, 5}, {0, 0, 0, 0, 1}, {3, 1, 1, 1, 7},
+	{0, 0, 0, 0, 1}, {8, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {5, 0, 0, 0, 6}, {0, 0, 0, 0, 1}, {1, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {12, 1, 0, 0, 7},
+	{0, 0, 0, 0, 1}, {2, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {9, 0, 0, 0, 6}, {0, 0, 0, 0, 1}, {4, 0, 0, 0, 5}, {0, 0, 0, 0, 1}, {6, 1, 0, 0, 7},
+	{0, 0, 0, 0, 1}, {8, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {12, 0, 0, 0, 6}, {0, 0, 0, 0, 1}, {1, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {9, 1, 0, 0, 7},
+	{0, 0, 0, 0, 1}, {2, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {14, 1, 0, 0, 7}, {0, 0, 0, 0, 1}, {3, 0, 0, 0, 5}, {0, 0, 0, 0, 1}, {3, 1, 3, 2, 7},
+	{0, 0, 0, 0, 1}, {8, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {15, 1, 4, 0, 6}, {0, 0, 0, 0, 1}, {1, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {10, 1, 0, 0, 7},
+	{0, 0, 0, 0, 1}, {2, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {15, 1, 4, 4, 7}, {0, 0, 0, 0, 1}, {4, 0, 0, 0, 5}, {0, 0, 0, 0, 1}, {5, 1, 0, 0, 7},
+	{0, 0, 0, 0, 1}, {8, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {10, 0, 0, 0, 6}, {0, 0, 0, 0, 1}, {1, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {7, 1, 0, 0, 7},
+	{0, 0, 0, 0, 1}, {2, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {13, 1, 0, 0, 7}, {0, 0, 0, 0, 1}, {3, 0, 0, 0, 5}, {0, 0, 0, 0, 1}, {1, 1, 1, 1, 7},
+	{0, 0, 0, 0, 1}, {2, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {5, 0, 0, 0, 6}, {0, 0, 0, 0, 1}, {8, 0, 0, 0, 5}, {0, 0, 0, 0, 1}, {11, 1, 0, 0, 7},
+	{0, 0, 0, 0, 1}, {1, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {15, 0, 0, 0, 7}, {0, 0, 0, 0, 1}, {12, 0, 0, 0, 6}, {0, 0, 0, 0, 1}, {7, 0, 0, 0, 7},
+	{0, 0, 0, 0, 1}, {2, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {15, 1, 15, 8, 7}, {0, 0, 0, 0, 1}, {4, 0, 0, 0, 5}, {0, 0, 0, 0, 1}, {7, 1, 0, 0, 7},
+	{0, 0, 0, 0, 1}, {1, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {13, 1, 0, 0, 7}, {0, 0, 0, 0, 1}, {10, 0, 0, 0, 6}, {0, 0, 0, 0, 1}, {3, 1, 3, 1, 7},
+	{0, 0, 0, 0, 1}, {2, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {2, 1, 2, 2, 6}, {0, 0, 0, 0, 1}, {8, 0, 0, 0, 5}, {0, 0, 0, 0, 1}, {11, 0, 0, 0, 7},
+	{0, 0, 0, 0, 1}, {1, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {14, 1, 4, 4, 7}, {0, 0, 0, 0, 1}, {10, 1, 10, 2, 6}, {0, 0, 0, 0, 1}, {6, 0, 0, 0, 7},
+	{0, 0, 0, 0, 1}, {2, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {15, 1, 5, 1, 7}, {0, 0, 0, 0, 1}, {4, 0, 0, 0, 5}, {0, 0, 0, 0, 1}, {9, 0, 0, 0, 7},
+	{0, 0, 0, 0, 1}, {1, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {12, 1, 0, 0, 7}, {0, 0, 0, 0, 1}, {3, 0, 0, 0, 6}, {0, 0, 0, 0, 1}, {3, 1, 2, 2, 7},
+	{0, 0, 0, 0, 1}, {2, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {5, 0, 0, 0, 6}, {0, 0, 0, 0, 1}, {8, 0, 0, 0, 5}, {0, 0, 0, 0, 1}, {11, 1, 11, 2, 7},
+	{0, 0, 0, 0, 1}, {1, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {14, 1, 4, 0, 7}, {0, 0, 0, 0, 1}, {12, 0, 0, 0, 6}, {0, 0, 0, 0, 1}, {6, 1, 0, 0, 7},
+	{0, 0, 0, 0, 1}, {2, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {15, 1, 7, 2, 7}, {0, 0, 0, 0, 1}, {4, 0, 0, 0, 5}, {0, 0, 0, 0, 1}, {9, 1, 0, 0, 7},
+	{0, 0, 0, 0, 1}, {1, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {13, 0, 0, 0, 7}, {0, 0, 0, 0, 1}, {10, 0, 0, 0, 6}, {0, 0, 0, 0, 1}, {4, 1, 4, 4, 7},
+	{0, 0, 0, 0, 1}, {2, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {2, 1, 2, 2, 6}, {0, 0, 0, 0, 1}, {8, 0, 0, 0, 5}, {0, 0, 0, 0, 1}, {10, 1, 10, 8, 7},
+	{0, 0, 0, 0, 1}, {1, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {14, 0, 0, 0, 7}, {0, 0, 0, 0, 1}, {10, 1, 10, 2, 6}, {0, 0, 0, 0, 1}, {5, 1, 0, 0, 7},
+	{0, 0, 0, 0, 1}, {2, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {15, 1, 4, 4, 7}, {0, 0, 0, 0, 1}, {4, 0, 0, 0, 5}, {0, 0, 0, 0, 1}, {8, 1, 8, 8, 7},
+	{0, 0, 0, 0, 1}, {1, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {10, 1, 10, 10, 7}, {0, 0, 0, 0, 1}, {3, 0, 0, 0, 6}, {0, 0, 0, 0, 1}, {1, 1, 1, 1, 7},
+	{0, 0, 0, 0, 2}, {15, 1, 15, 8, 6}, {2, 0, 0, 0, 4}, {5, 0, 0, 0, 6}, {0, 0, 0, 0, 2}, {11, 0, 0, 0, 6}, {8, 0, 0, 0, 5}, {15, 1, 6, 6, 7},
+	{0, 0, 0, 0, 2}, {12, 1, 0, 0, 6}, {1, 0, 0, 0, 4}, {1, 1, 1, 1, 6}, {0, 0, 0, 0, 2}, {9, 0, 0, 0, 6}, {3, 0, 0, 0, 5}, {10, 1, 10, 8, 7},
+	{0, 0, 0, 0, 2}, {15, 0, 0, 0, 6}, {2, 0, 0, 0, 4}, {3, 1, 3, 1, 6}, {0, 0, 0, 0, 2}, {10, 0, 0, 0, 6}, {4, 0, 0, 0, 5}, {11, 1, 11, 3, 7},
+	{0, 0, 0, 0, 2}, {11, 1, 11, 2, 6}, {1, 0, 0, 0, 4}, {15, 1, 15, 5, 7}, {0, 0, 0, 0, 2}, {6, 0, 0, 0, 6}, {7, 1, 5, 1, 6}, {5, 1, 5, 4, 7},
+	{0, 0, 0, 0, 2}, {15, 1, 15, 2, 6}, {2, 0, 0, 0, 4}, {2, 1, 2, 2, 6}, {0, 0, 0, 0, 2}, {10, 1, 2, 2, 6}, {8, 0, 0, 0, 5}, {14, 1, 4, 4, 7},
+	{0, 0, 0, 0, 2}, {12, 0, 0, 0, 6}, {1, 0, 0, 0, 4}, {15, 1, 15, 4, 7}, {0, 0, 0, 0, 2}, {7, 0, 0, 0, 6}, {3, 0, 0, 0, 5}, {7, 1, 4, 4, 7},
+	{0, 0, 0, 0, 2}, {13, 1, 4, 0, 6}, {2, 0, 0, 0, 4}, {3, 1, 3, 2, 6}, {0, 0, 0, 0, 2}, {9, 1, 0, 0, 6}, {4, 0, 0, 0, 5}, {13, 0, 0, 0, 7},
+	{0, 0, 0, 0, 2}, {11, 1, 8, 8, 6}, {1, 0, 0, 0, 4}, {15, 1, 15, 10, 7}, {0, 0, 0, 0, 2}, {5, 1, 1, 1, 6}, {15, 1, 15, 1, 6}, {4, 1, 4, 4, 7},
+	{0, 0, 0, 0, 2}, {15, 1, 15, 8, 6}, {2, 0, 0, 0, 4}, {5, 0, 0, 0, 6}, {0, 0, 0, 0, 2}, {11, 0, 0, 0, 6}, {8, 0, 0, 0, 5}, {14, 1, 12, 8, 7},
+	{0, 0, 0, 0, 2}, {12, 1, 0, 0, 6}, {1, 0, 0, 0, 4}, {1, 1, 1, 1, 6}, {0, 0, 0, 0, 2}, {9, 0, 0, 0, 6}, {3, 0, 0, 0, 5}, {8, 1, 8, 8, 7},
+	{0, 0, 0, 0, 2}, {15, 0, 0, 0, 6}, {2, 0, 0, 0, 4}, {3, 1, 3, 1, 6}, {0, 0, 0, 0, 2}, {10, 0, 0, 0, 6}, {4, 0, 0, 0, 5}, {13, 1, 4, 4, 7},
+	{0, 0, 0, 0, 2}, {11, 1, 11, 2, 6}, {1, 0, 0, 0, 4}, {15, 1, 10, 8, 7}, {0, 0, 0, 0, 2}, {6, 0, 0, 0, 6}, {7, 1, 5, 1, 6}, {6, 1, 0, 0, 7},
+	{0, 0, 0, 0, 2}, {15, 1, 15, 2, 6}, {2, 0, 0, 0, 4}, {2, 1, 2, 2, 6}, {0, 0, 0, 0, 2}, {10, 1, 2, 2, 6}, {8, 0, 0, 0, 5}, {14, 0, 0, 0, 7},
+	{0, 0, 0, 0, 2}, {12, 0, 0, 0, 6}, {1, 0, 0, 0, 4}, {14, 1, 14, 2, 7}, {0, 0, 0, 0, 2}, {7, 0, 0, 0, 6}, {3, 0, 0, 0, 5}, {7, 1, 7, 2, 7},
+	{0, 0, 0, 0, 2}, {13, 1, 4, 0, 6}, {2, 0, 0, 0, 4}, {3, 1, 3, 2, 6}, {0, 0, 0, 0, 2}, {9, 1, 0, 0, 6}, {4, 0, 0, 0, 5}, {11, 1, 11, 1, 7},
+	{0, 0, 0, 0, 2}, {11, 1, 8, 8, 6}, {1, 0, 0, 0, 4}, {15, 1, 7, 3, 7}, {0, 0, 0, 0, 2}, {5, 1, 1, 1, 6}, {15, 1, 15, 1, 6}, {3, 1, 3, 3, 7},
+	{0, 0, 0, 0, 1}, {8, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {14, 1, 2, 0, 6}, {0, 0, 0, 0, 1}, {12, 0, 0, 0, 5}, {0, 0, 0, 0, 1}, {12, 1, 12, 4, 7},
+	{0, 0, 0, 0, 1}, {4, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {15, 1, 3, 2, 7}, {0, 0, 0, 0, 1}, {1, 0, 0, 0, 5}, {0, 0, 0, 0, 1}, {8, 1, 8, 8, 7},
+	{0, 0, 0, 0, 1}, {8, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {6, 0, 0, 0, 6}, {0, 0, 0, 0, 1}, {2, 0, 0, 0, 5}, {0, 0, 0, 0, 1}, {10, 1, 0, 0, 7},
+	{0, 0, 0, 0, 1}, {4, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {14, 1, 2, 2, 7}, {0, 0, 0, 0, 1}, {10, 0, 0, 0, 6}, {0, 0, 0, 0, 1}, {5, 1, 0, 0, 7},
+	{0, 0, 0, 0, 1}, {8, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {4, 1, 4, 4, 6}, {0, 0, 0, 0, 1}, {12, 0, 0, 0, 5}, {0, 0, 0, 0, 1}, {12, 1, 12, 12, 7},
+	{0, 0, 0, 0, 1}, {4, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {15, 0, 0, 0, 7}, {0, 0, 0, 0, 1}, {1, 0, 0, 0, 5}, {0, 0, 0, 0, 1}, {6, 1, 0, 0, 7},
+	{0, 0, 0, 0, 1}, {8, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {5, 0, 0, 0, 6}, {0, 0, 0, 0, 1}, {2, 0, 0, 0, 5}, {0, 0, 0, 0, 1}, {9, 1, 0, 0, 7},
+	{0, 0, 0, 0, 1}, {4, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {13, 1, 0, 0, 7}, {0, 0, 0, 0, 1}, {15, 1, 3, 0, 6}, {0, 0, 0, 0, 1}, {2, 1, 2, 2, 7},
+	{0, 0, 0, 0, 1}, {8, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {14, 1, 2, 0, 6}, {0, 0, 0, 0, 1}, {12, 0, 0, 0, 5}, {0, 0, 0, 0, 1}, {12, 1, 12, 8, 7},
+	{0, 0, 0, 0, 1}, {4, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {15, 1, 1, 1, 7}, {0, 0, 0, 0, 1}, {1, 0, 0, 0, 5}, {0, 0, 0, 0, 1}, {7, 0, 0, 0, 7},
+	{0, 0, 0, 0, 1}, {8, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {6, 0, 0, 0, 6}, {0, 0, 0, 0, 1}, {2, 0, 0, 0, 5}, {0, 0, 0, 0, 1}, {7, 1, 0, 0, 7},
+	{0, 0, 0, 0, 1}, {4, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {14, 0, 0, 0, 7}, {0, 0, 0, 0, 1}, {10, 0, 0, 0, 6}, {0, 0, 0, 0, 1}, {3, 0, 0, 0, 7},
+	{0, 0, 0, 0, 1}, {8, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {4, 1, 4, 4, 6}, {0, 0, 0, 0, 1}, {12, 0, 0, 0, 5}, {0, 0, 0, 0, 1}, {11, 0, 0, 0, 7},
+	{0, 0, 0, 0, 1}, {4, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {11, 1, 0, 0, 7}, {0, 0, 0, 0, 1}, {1, 0, 0, 0, 5}, {0, 0, 0, 0, 1}, {3, 1, 0, 0, 7},
+	{0, 0, 0, 0, 1}, {8, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {5, 0, 0, 0, 6}, {0, 0, 0, 0, 1}, {2, 0, 0, 0, 5}, {0, 0, 0, 0, 1}, {9, 0, 0, 0, 7},
+	{0, 0, 0, 0, 1}, {4, 0, 0, 0, 4}, {0, 0, 0, 0, 1}, {13, 0, 0, 0, 7}, {0, 0, 0, 0, 1}, {15, 1, 3, 0, 6}, {0, 0, 0, 0, 1}, {1, 1, 1, 1, 7},
+	{0, 0, 0, 0, 2}, {14, 1, 10, 8, 6}, {4, 0, 0, 0, 4}, {8, 1, 8, 8, 6}, {0, 0, 0, 0, 2}, {13, 0, 0, 0, 6}, {12, 0, 0, 0, 5}, {15, 1, 15, 3, 7},
+	{0, 0, 0, 0, 2}, {15, 1, 15, 12, 6}, {2, 0, 0, 0, 5}, {3, 1, 0, 0, 6}, {0, 0, 0, 0, 2}, {11, 0, 0, 0, 6}, {5, 0, 0, 0, 5}, {13, 1, 13, 8, 7},
+	{0, 0, 0, 0, 2}, {15, 1, 15, 8, 6}, {4, 0, 0, 0, 4}, {6, 0, 0, 0, 6}, {0, 0, 0, 0, 2}, {7, 1, 2, 0, 6}, {8, 0, 0, 0, 5}, {15, 1, 9, 9, 7},
+	{0, 0, 0, 0, 2}, {14, 0, 0, 0, 6}, {15, 0, 0, 0, 5}, {3, 0, 0, 0, 6}, {0, 0, 0, 0, 2}, {10, 0, 0, 0, 6}, {1, 0, 0, 0, 5}, {9, 1, 0, 0, 7},
+	{0, 0, 0, 0, 2}, {15, 1, 15, 2, 6}, {4, 0, 0, 0, 4}, {7, 0, 0, 0, 6}, {0, 0, 0, 0, 2}, {12, 1, 4, 4, 6}, {12, 0, 0, 0, 5}, {15, 1, 7, 6, 7},
+	{0, 0, 0, 0, 2}, {15, 1, 15, 1, 6}, {2, 0, 0, 0, 5}, {4, 1, 4, 4, 6}, {0, 0, 0, 0, 2}, {10, 1, 0, 0, 6}, {5, 0, 0, 0, 5}, {12, 1, 12, 8, 7},
+	{0, 0, 0, 0, 2}, {15, 1, 15, 4, 6}, {4, 0, 0, 0, 4}, {5, 1, 4, 4, 6}, {0, 0, 0, 0, 2}, {11, 1, 1, 0, 6}, {8, 0, 0, 0, 5}, {14, 1, 14, 4, 7},
+	{0, 0, 0, 0, 2}, {13, 1, 5, 4, 6}, {15, 0, 0, 0, 5}, {1, 1, 1, 1, 6}, {0, 0, 0, 0, 2}, {9, 0, 0, 0, 6}, {1, 0, 0, 0, 5}, {2, 1, 2, 2, 7},
+	{0, 0, 0, 0, 2}, {14, 1, 10, 8, 6}, {4, 0, 0, 0, 4}, {8, 1, 8, 8, 6}, {0, 0, 0, 0, 2}, {13, 0, 0, 0, 6}, {12, 0, 0, 0, 5}, {15, 1, 15, 10, 7},
+	{0, 0, 0, 0, 2}, {15, 1, 15, 12, 6}, {2, 0, 0, 0, 5}, {3, 1, 0, 0, 6}, {0, 0, 0, 0, 2}, {11, 0, 0, 0, 6}, {5, 0, 0, 0, 5}, {11, 1, 1, 1, 7},
+	{0, 0, 0, 0, 2}, {15, 1, 15, 8, 6}, {4, 0, 0, 0, 4}, {6, 0, 0, 0, 6}, {0, 0, 0, 0, 2}, {7, 1, 2, 0, 6}, {8, 0, 0, 0, 5}, {14, 1, 2, 2, 7},
+	{0, 0, 0, 0, 2}, {14, 0, 0, 0, 6}, {15, 0, 0, 0, 5}, {3, 0, 0, 0, 6}, {0, 0, 0, 0, 2}, {10, 0, 0, 0, 6}, {1, 0, 0, 0, 5}, {7, 1, 2, 2, 7},
+	{0, 0, 0, 0, 2}, {15, 1, 15, 2, 6}, {4, 0, 0, 0, 4}, {7, 0, 0, 0, 6}, {0, 0, 0, 0, 2}, {12, 1, 4, 4, 6}, {12, 0, 0, 0, 5}, {15, 1, 13, 5, 7},
+	{0, 0, 0, 0, 2}, {15, 1, 15, 1, 6}, {2, 0, 0, 0, 5}, {4, 1, 4, 4, 6}, {0, 0, 0, 0, 2}, {10, 1, 0, 0, 6}, {5, 0, 0, 0, 5}, {6, 1, 0, 0, 7},
+	{0, 0, 0, 0, 2}, {15, 1, 15, 4, 6}, {4, 0, 0, 0, 4}, {5, 1, 4, 4, 6}, {0, 0, 0, 0, 2}, {11, 1, 1, 0, 6}, {8, 0, 0, 0, 5}, {13, 1, 1, 1, 7},
+	{0, 0, 0, 0, 2}, {13, 1, 5, 4, 6}, {15, 0, 0, 0, 5}, {1, 1, 1, 1, 6}, {0, 0, 0, 0, 2}, {9, 0, 0, 0, 6}, {1, 0, 0, 0, 5}, {5, 1, 5, 1, 7},
+	{0, 0, 0, 0, 3}, {15, 0, 0, 0, 6}, {1, 0, 0, 0, 4}, {1, 1, 1, 1, 6}, {4, 0, 0, 0, 4}, {8, 1, 8, 8, 6}, {10, 0, 0, 0, 5}, {13, 1, 13, 4, 7},
+	{0, 0, 0, 0, 3}, {10, 1, 10, 2, 6}, {5, 0, 0, 0, 5}, {15, 1, 7, 6, 7}, {2, 0, 0, 0, 4}, {3, 1, 2, 2, 6}, {11, 0, 0, 0, 6}, {10, 1, 10, 10, 7},
+	{0, 0, 0, 0, 3}, {14, 0, 0, 0, 6}, {1, 0, 0, 0, 4}, {15, 1, 15, 5, 7}, {4, 0, 0, 0, 4}, {6, 0, 0, 0, 6}, {8, 0, 0, 0, 5}, {12, 1, 12, 12, 7},
+	{0, 0, 0, 0, 3}, {9, 1, 0, 0, 6}, {12, 0, 0, 0, 5}, {14, 1, 4, 4, 7}, {2, 0, 0, 0, 4}, {3, 0, 0, 0, 6}, {15, 1, 15, 8, 6}, {7, 1, 3, 1, 7},
+	{0, 0, 0, 0, 3}, {14, 1, 14, 8, 6}, {1, 0, 0, 0, 4}, {15, 1, 15, 1, 7}, {4, 0, 0, 0, 4}, {7, 0, 0, 0, 6}, {10, 0, 0, 0, 5}, {12, 1, 12, 4, 7},
+	{0, 0, 0, 0, 3}, {7, 1, 2, 2, 6}, {5, 0, 0, 0, 5}, {13, 1, 13, 1, 7}, {2, 0, 0, 0, 4}, {4, 1, 4, 4, 6}, {15, 1, 15, 4, 6}, {5, 1, 5, 1, 7},
+	{0, 0, 0, 0, 3}, {13, 0, 0, 0, 6}, {1, 0, 0, 0, 4}, {14, 1, 14, 2, 7}, {4, 0, 0, 0, 4}, {5, 1, 4, 4, 6}, {8, 0, 0, 0, 5}, {11, 1, 2, 2, 7},
+	{0, 0, 0, 0, 3}, {9, 0, 0, 0, 6}, {12, 0, 0, 0, 5}, {13, 1, 12, 8, 7}, {2, 0, 0, 0, 4}, {2, 1, 2, 2, 6}, {15, 1, 15, 2, 6}, {6, 1, 2, 2, 7},
+	{0, 0, 0, 0, 3}, {15, 0, 0, 0, 6}, {1, 0, 0, 0, 4}, {1, 1, 1, 1, 6}, {4, 0, 0, 0, 4}, {8, 1, 8, 8, 6}, {10, 0, 0, 0, 5}, {11, 1, 11, 1, 7},
+	{0, 0, 0, 0, 3}, {10, 1, 10, 2, 6}, {5, 0, 0, 0, 5}, {15, 1, 3, 3, 7}, {2, 0, 0, 0, 4}, {3, 1, 2, 2, 6}, {11, 0, 0, 0, 6}, {10, 1, 10, 8, 7},
+	{0, 0, 0, 0, 3}, {14, 0, 0, 0, 6}, {1, 0, 0, 0, 4}, {15, 1, 11, 9, 7}, {4, 0, 0, 0, 4}, {6, 0, 0, 0, 6}, {8, 0, 0, 0, 5}, {11, 1, 10, 8, 7},
+	{0, 0, 0, 0, 3}, {9, 1, 0, 0, 6}, {12, 0, 0, 0, 5}, {14, 1, 14, 4, 7}, {2, 0, 0, 0, 4}, {3, 0, 0, 0, 6}, {15, 1, 15, 8, 6}, {6, 1, 6, 4, 7},
+	{0, 0, 0, 0, 3}, {14, 1, 14, 8, 6}, {1, 0, 0, 0, 4}, {15, 1, 15, 12, 7}, {4, 0, 0, 0, 4}, {7, 0, 0, 0, 6}, {10, 0, 0, 0, 5}, {12, 1, 12, 8, 7},
+	{0, 0, 0, 0, 3}, {7, 1, 2, 2, 6}, {5, 0, 0, 0, 5}, {14, 1, 14, 10, 7}, {2, 0, 0, 0, 4}, {4, 1, 4, 4, 6}, {15, 1, 15, 4, 6}, {7, 1, 7, 4, 7},
+	{0, 0, 0, 0, 3}, {13, 0, 0, 0, 6}, {1, 0, 0, 0, 4}, {15, 1, 15, 10, 7}, {4, 0, 0, 0, 4}, {5, 1, 4, 4, 6}, {8, 0, 0, 0, 5}, {11, 1, 11, 2, 7},
+	{0, 0, 0, 0, 3}, {9, 0, 0, 0, 6}, {12, 0, 0, 0, 5}, {13, 1, 4, 4, 7}, {2, 0, 0, 0, 4}, {2, 1, 2, 2, 6}, {15, 1, 15, 2, 6}, {3, 1, 3, 1, 7},
+	{15, 0, 0, 0, 3}, {15, 1, 15, 10, 6}, {15, 1, 15, 1, 5}, {3, 0, 0, 0, 6}, {0, 0, 0, 0, 4}, {11, 1, 3, 2, 6}, {7, 0, 0, 0, 5}, {13, 1, 1, 1, 7},
+	{15, 0, 0, 0, 3}, {13, 1, 5, 4, 6}, {15, 1, 15, 2, 5}, {14, 1, 14, 4, 7}, {13, 0, 0, 0, 5}, {7, 1, 7, 1, 6}, {15, 1, 15, 12, 6}, {7, 1, 7, 3, 7},
+	{15, 0, 0, 0, 3}, {15, 1, 15, 3, 6}, {15, 1, 15, 8, 5}, {1, 1, 1, 1, 6}, {0, 0, 0, 0, 4}, {9, 0, 0, 0, 6}, {5, 0, 0, 0, 5}, {11, 1, 11, 1, 7},
+	{15, 0, 0, 0, 3}, {12, 1, 0, 0, 6}, {11, 0, 0, 0, 5}, {13, 1, 13, 8, 7}, {15, 1, 15, 4, 5}, {6, 0, 0, 0, 6}, {15, 1, 11, 9, 6}, {5, 1, 5, 4, 7},
+	{15, 0, 0, 0, 3}, {15, 1, 7, 6, 6}, {15, 1, 15, 1, 5}, {2, 0, 0, 0, 6}, {0, 0, 0, 0, 4}, {10, 0, 0, 0, 6}, {7, 0, 0, 0, 5}, {9, 1, 0, 0, 7},
+	{15, 0, 0, 0, 3}, {10, 1, 0, 0, 6}, {15, 1, 15, 2, 5}, {15, 1, 15, 7, 7}, {13, 0, 0, 0, 5}, {4, 0, 0, 0, 6}, {15, 1, 15, 5, 6}, {7, 1, 7, 4, 7},
+	{15, 0, 0, 0, 3}, {14, 0, 0, 0, 6}, {15, 1, 15, 8, 5}, {1, 0, 0, 0, 6}, {0, 0, 0, 0, 4}, {8, 0, 0, 0, 6}, {5, 0, 0, 0, 5}, {8, 1, 8, 8, 7},
+	{15, 0, 0, 0, 3}, {12, 0, 0, 0, 6}, {11, 0, 0, 0, 5}, {14, 1, 14, 2, 7}, {15, 1, 15, 4, 5}, {5, 1, 1, 1, 6}, {14, 1, 10, 8, 6}, {3, 1, 1, 1, 7},
+	{15, 0, 0, 0, 3}, {15, 1, 15, 10, 6}, {15, 1, 15, 1, 5}, {3, 0, 0, 0, 6}, {0, 0, 0, 0, 4}, {11, 1, 3, 2, 6}, {7, 0, 0, 0, 5}, {13, 1, 13, 1, 7},
+	{15, 0, 0, 0, 3}, {13, 1, 5, 4, 6}, {15, 1, 15, 2, 5}, {15, 1, 15, 11, 7}, {13, 0, 0, 0, 5}, {7, 1, 7, 1, 6}, {15, 1, 15, 12, 6}, {7, 1, 4, 4, 7},
+	{15, 0, 0, 0, 3}, {15, 1, 15, 3, 6}, {15, 1, 15, 8, 5}, {1, 1, 1, 1, 6}, {0, 0, 0, 0, 4}, {9, 0, 0, 0, 6}, {5, 0, 0, 0, 5}, {7, 1, 7, 2, 7},
+	{15, 0, 0, 0, 3}, {12, 1, 0, 0, 6}, {11, 0, 0, 0, 5}, {14, 1, 2, 2, 7}, {15, 1, 15, 4, 5}, {6, 0, 0, 0, 6}, {15, 1, 11, 9, 6}, {4, 1, 4, 4, 7},
+	{15, 0, 0, 0, 3}, {15, 1, 7, 6, 6}, {15, 1, 15, 1, 5}, {2, 0, 0, 0, 6}, {0, 0, 0, 0, 4}, {10, 0, 0, 0, 6}, {7, 0, 0, 0, 5}, {11, 1, 1, 1, 7},
+	{15, 0, 0, 0, 3}, {10, 1, 0, 0, 6}, {15, 1, 15, 2, 5}, {15, 1, 15, 15, 7}, {13, 0, 0, 0, 5}, {4, 0, 0, 0, 6}, {15, 1, 15, 5, 6}, {3, 1, 3, 2, 7},
+	{15, 0, 0, 0, 3}, {14, 0, 0, 0, 6}, {15, 1, 15, 8, 5}, {1, 0, 0, 0, 6}, {0, 0, 0, 0, 4}, {8, 0, 0, 0, 6}, {5, 0, 0, 0, 5}, {6, 1, 0, 0, 7},
+	{15, 0, 0, 0, 3}, {12, 0, 0, 0, 6}, {11, 0, 0, 0, 5}, {11, 1, 11, 8, 7}, {15, 1, 15, 4, 5}, {5, 1, 1, 1, 6}, {14, 1, 10, 8, 6}, {2, 1, 2, 2, 7},
+}
+
+// VLCLookupTable0 is the packed lookup table for initial row quads, indexed by context << 7 | codeword prefix.
+var VLCLookupTable0 = [1024]VLCLookupEntry{
+	0x0023, 0x00A5, 0x0043, 0x0066, 0x0083, 0xA8EE, 0x0014, 0xD8DF, 0x0023, 0x10BE, 0x0043, 0xF5FF,
+	0x0083, 0x207E, 0x0055, 0x515F, 0x0023, 0x0035, 0x0043, 0x444E, 0x0083, 0xC4CE, 0x0014, 0xCCCF,
+	0x0023, 0xE2FE, 0x0043, 0x99FF, 0x0083, 0x0096, 0x00C5, 0x313F, 0x0023, 0x00A5, 0x0043, 0x445E,
+	0x0083, 0xC8CE, 0x0014, 0x11DF, 0x0023, 0xF4FE, 0x0043, 0xFCFF, 0x0083, 0x009E, 0x0055, 0x0077,
+	0x0023, 0x0035, 0x0043, 0xF1FF, 0x0083, 0x88AE, 0x0014, 0x00B7, 0x0023, 0xF8FE, 0x0043, 0xE4EF,
+	0x0083, 0x888E, 0x00C5, 0x111F, 0x0023, 0x00A5, 0x0043, 0x0066, 0x0083, 0xA8EE, 0x0014, 0x54DF,
+	0x0023, 0x10BE, 0x0043, 0x22EF, 0x0083, 0x207E, 0x0055, 0x227F, 0x0023, 0x0035, 0x0043, 0x444E,
+	0x0083, 0xC4CE, 0x0014, 0x11BF, 0x0023, 0xE2FE, 0x0043, 0x00F7, 0x0083, 0x0096, 0x00C5, 0x223F,
+	0x0023, 0x00A5, 0x0043, 0x445E, 0x0083, 0xC8CE, 0x0014, 0x00D7, 0x0023, 0xF4FE, 0x0043, 0xBAFF,
+	0x0083, 0x009E, 0x0055, 0x006F, 0x0023, 0x0035, 0x0043, 0xE6FF, 0x0083, 0x88AE, 0x0014, 0xA2AF,
+	0x0023, 0xF8FE, 0x0043, 0x00E7, 0x0083, 0x888E, 0x00C5, 0x222F, 0x0002, 0x00C5, 0x0084, 0x207E,
+	0x0002, 0xC4CE, 0x0024, 0x00F7, 0x0002, 0xA2FE, 0x0044, 0x0056, 0x0002, 0x009E, 0x0014, 0x00D7,
+	0x0002, 0x10BE, 0x0084, 0x0066, 0x0002, 0x88AE, 0x0024, 0x11DF, 0x0002, 0xA8EE, 0x0044, 0x0036,
+	0x0002, 0x888E, 0x0014, 0x111F, 0x0002, 0x00C5, 0x0084, 0x006E, 0x0002, 0x88CE, 0x0024, 0x88FF,
+	0x0002, 0xB8FE, 0x0044, 0x444E, 0x0002, 0x0096, 0x0014, 0x00B7, 0x0002, 0xE4FE, 0x0084, 0x445E,
+	0x0002, 0x00A6, 0x0024, 0x00E7, 0x0002, 0x54DE, 0x0044, 0x222E, 0x0002, 0x003E, 0x0014, 0x0077,
+	0x0002, 0x00C5, 0x0084, 0x207E, 0x0002, 0xC4CE, 0x0024, 0xF1FF, 0x0002, 0xA2FE, 0x0044, 0x0056,
+	0x0002, 0x009E, 0x0014, 0x11BF, 0x0002, 0x10BE, 0x0084, 0x0066, 0x0002, 0x88AE, 0x0024, 0x22EF,
+	0x0002, 0xA8EE, 0x0044, 0x0036, 0x0002, 0x888E, 0x0014, 0x227F, 0x0002, 0x00C5, 0x0084, 0x006E,
+	0x0002, 0x88CE, 0x0024, 0xE4EF, 0x0002, 0xB8FE, 0x0044, 0x444E, 0x0002, 0x0096, 0x0014, 0xA2AF,
+	0x0002, 0xE4FE, 0x0084, 0x445E, 0x0002, 0x00A6, 0x0024, 0xD8DF, 0x0002, 0x54DE, 0x0044, 0x222E,
+	0x0002, 0x003E, 0x0014, 0x515F, 0x0002, 0x0055, 0x0084, 0x0066, 0x0002, 0x88DE, 0x0024, 0x32FF,
+	0x0002, 0x11FE, 0x0044, 0x444E, 0x0002, 0x00AE, 0x0014, 0x00B7, 0x0002, 0x317E, 0x0084, 0x515E,
+	0x0002, 0x00C6, 0x0024, 0x00D7, 0x0002, 0x20EE, 0x0044, 0x111E, 0x0002, 0x009E, 0x0014, 0x0077,
+	0x0002, 0x0055, 0x0084, 0x545E, 0x0002, 0x44CE, 0x0024, 0x00E7, 0x0002, 0xF1FE, 0x0044, 0x0036,
+	0x0002, 0x00A6, 0x0014, 0x555F, 0x0002, 0x74FE, 0x0084, 0x113E, 0x0002, 0x20BE, 0x0024, 0x747F,
+	0x0002, 0xC4DE, 0x0044, 0xF8FF, 0x0002, 0x0096, 0x0014, 0x222F, 0x0002, 0x0055, 0x0084, 0x0066,
+	0x0002, 0x88DE, 0x0024, 0x00F7, 0x0002, 0x11FE, 0x0044, 0x444E, 0x0002, 0x00AE, 0x0014, 0x888F,
+	0x0002, 0x317E, 0x0084, 0x515E, 0x0002, 0x00C6, 0x0024, 0xC8CF, 0x0002, 0x20EE, 0x0044, 0x111E,
+	0x0002, 0x009E, 0x0014, 0x006F, 0x0002, 0x0055, 0x0084, 0x545E, 0x0002, 0x44CE, 0x0024, 0xD1DF,
+	0x0002, 0xF1FE, 0x0044, 0x0036, 0x0002, 0x00A6, 0x0014, 0x227F, 0x0002, 0x74FE, 0x0084, 0x113E,
+	0x0002, 0x20BE, 0x0024, 0x22BF, 0x0002, 0xC4DE, 0x0044, 0x22EF, 0x0002, 0x0096, 0x0014, 0x323F,
+	0x0003, 0xD4DE, 0xF4FD, 0xFCFF, 0x0014, 0x113E, 0x0055, 0x888F, 0x0003, 0x32BE, 0x0085, 0x00E7,
+	0x0025, 0x515E, 0xAAFE, 0x727F, 0x0003, 0x44CE, 0xF8FD, 0x44EF, 0x0014, 0x647E, 0x0045, 0xA2AF,
+	0x0003, 0x00A6, 0x555D, 0x99DF, 0xF1FD, 0x0036, 0xF5FE, 0x626F, 0x0003, 0xD1DE, 0xF4FD, 0xE6FF,
+	0x0014, 0x717E, 0x0055, 0xB1BF, 0x0003, 0x88AE, 0x0085, 0xD5DF, 0x0025, 0x444E, 0xF2FE, 0x667F,
+	0x0003, 0x00C6, 0xF8FD, 0xE2EF, 0x0014, 0x545E, 0x0045, 0x119F, 0x0003, 0x0096, 0x555D, 0xC8CF,
+	0xF1FD, 0x111E, 0xC8EE, 0x0067, 0x0003, 0xD4DE, 0xF4FD, 0xF3FF, 0x0014, 0x113E, 0x0055, 0x11BF,
+	0x0003, 0x32BE, 0x0085, 0xD8DF, 0x0025, 0x515E, 0xAAFE, 0x222F, 0x0003, 0x44CE, 0xF8FD, 0x00F7,
+	0x0014, 0x647E, 0x0045, 0x989F, 0x0003, 0x00A6, 0x555D, 0x00D7, 0xF1FD, 0x0036, 0xF5FE, 0x446F,
+	0x0003, 0xD1DE, 0xF4FD, 0xB9FF, 0x0014, 0x717E, 0x0055, 0x00B7, 0x0003, 0x88AE, 0x0085, 0xDCDF,
+	0x0025, 0x444E, 0xF2FE, 0x0077, 0x0003, 0x00C6, 0xF8FD, 0xE4EF, 0x0014, 0x545E, 0x0045, 0x737F,
+	0x0003, 0x0096, 0x555D, 0xB8BF, 0xF1FD, 0x111E, 0xC8EE, 0x323F, 0x0002, 0x00A5, 0x0084, 0x407E,
+	0x0002, 0x10DE, 0x0024, 0x11DF, 0x0002, 0x72FE, 0x0044, 0x0056, 0x0002, 0xA8AE, 0x0014, 0xB2BF,
+	0x0002, 0x0096, 0x0084, 0x0066, 0x0002, 0x00C6, 0x0024, 0x00E7, 0x0002, 0xC8EE, 0x0044, 0x222E,
+	0x0002, 0x888E, 0x0014, 0x0077, 0x0002, 0x00A5, 0x0084, 0x006E, 0x0002, 0x88CE, 0x0024, 0x00F7,
+	0x0002, 0x91FE, 0x0044, 0x0036, 0x0002, 0xA2AE, 0x0014, 0xAAAF, 0x0002, 0xB8FE, 0x0084, 0x005E,
+	0x0002, 0x00BE, 0x0024, 0xC4CF, 0x0002, 0x44EE, 0x0044, 0xF4FF, 0x0002, 0x223E, 0x0014, 0x111F,
+	0x0002, 0x00A5, 0x0084, 0x407E, 0x0002, 0x10DE, 0x0024, 0x99FF, 0x0002, 0x72FE, 0x0044, 0x0056,
+	0x0002, 0xA8AE, 0x0014, 0x00B7, 0x0002, 0x0096, 0x0084, 0x0066, 0x0002, 0x00C6, 0x0024, 0x00D7,
+	0x0002, 0xC8EE, 0x0044, 0x222E, 0x0002, 0x888E, 0x0014, 0x444F, 0x0002, 0x00A5, 0x0084, 0x006E,
+	0x0002, 0x88CE, 0x0024, 0xE2EF, 0x0002, 0x91FE, 0x0044, 0x0036, 0x0002, 0xA2AE, 0x0014, 0x447F,
+	0x0002, 0xB8FE, 0x0084, 0x005E, 0x0002, 0x00BE, 0x0024, 0x009F, 0x0002, 0x44EE, 0x0044, 0x76FF,
+	0x0002, 0x223E, 0x0014, 0x313F, 0x0003, 0x00C6, 0x0085, 0xD9FF, 0xF2FD, 0x647E, 0xF1FE, 0x99BF,
+	0x0003, 0xA2AE, 0x0025, 0x66EF, 0xF4FD, 0x0056, 0xE2EE, 0x737F, 0x0003, 0x98BE, 0x0045, 0x00F7,
+	0xF8FD, 0x0066, 0x76FE, 0x889F, 0x0003, 0x888E, 0x0015, 0xD5DF, 0x00A5, 0x222E, 0x98DE, 0x444F,
+	0x0003, 0xB2BE, 0x0085, 0xFCFF, 0xF2FD, 0x226E, 0x0096, 0x00B7, 0x0003, 0xAAAE, 0x0025, 0xD1DF,
+	0xF4FD, 0x0036, 0xD4DE, 0x646F, 0x0003, 0xA8AE, 0x0045, 0xEAEF, 0xF8FD, 0x445E, 0xE8EE, 0x717F,
+	0x0003, 0x323E, 0x0015, 0xC4CF, 0x00A5, 0xFAFF, 0x88CE, 0x313F, 0x0003, 0x00C6, 0x0085, 0x77FF,
+	0xF2FD, 0x647E, 0xF1FE, 0xB3BF, 0x0003, 0xA2AE, 0x0025, 0x00E7, 0xF4FD, 0x0056, 0xE2EE, 0x0077,
+	0x0003, 0x98BE, 0x0045, 0xE4EF, 0xF8FD, 0x0066, 0x76FE, 0x667F, 0x0003, 0x888E, 0x0015, 0x00D7,
+	0x00A5, 0x222E, 0x98DE, 0x333F, 0x0003, 0xB2BE, 0x0085, 0x75FF, 0xF2FD, 0x226E, 0x0096, 0x919F,
+	0x0003, 0xAAAE, 0x0025, 0x99DF, 0xF4FD, 0x0036, 0xD4DE, 0x515F, 0x0003, 0xA8AE, 0x0045, 0xECEF,
+	0xF8FD, 0x445E, 0xE8EE, 0x727F, 0x0003, 0x323E, 0x0015, 0xB1BF, 0x00A5, 0xF3FF, 0x88CE, 0x111F,
+	0x0003, 0x54DE, 0xF2FD, 0x111E, 0x0014, 0x647E, 0xF8FE, 0xCCCF, 0x0003, 0x91BE, 0x0045, 0x22EF,
+	0x0025, 0x222E, 0xF3FE, 0x888F, 0x0003, 0x00C6, 0x0085, 0x00F7, 0x0014, 0x115E, 0xFCFE, 0xA8AF,
+	0x0003, 0x00A6, 0x0035, 0xC8DF, 0xF1FD, 0x313E, 0x66FE, 0x646F, 0x0003, 0xC8CE, 0xF2FD, 0xF5FF,
+	0x0014, 0x0066, 0xF4FE, 0xBABF, 0x0003, 0x22AE, 0x0045, 0x00E7, 0x0025, 0x323E, 0xEAFE, 0x737F,
+	0x0003, 0xB2BE, 0x0085, 0x55DF, 0x0014, 0x0056, 0x717E, 0x119F, 0x0003, 0x0096, 0x0035, 0xC4CF,
+	0xF1FD, 0x333E, 0xE8EE, 0x444F, 0x0003, 0x54DE, 0xF2FD, 0x111E, 0x0014, 0x647E, 0xF8FE, 0x99BF,
+	0x0003, 0x91BE, 0x0045, 0xE2EF, 0x0025, 0x222E, 0xF3FE, 0x667F, 0x0003, 0x00C6, 0x0085, 0xE4EF,
+	0x0014, 0x115E, 0xFCFE, 0x989F, 0x0003, 0x00A6, 0x0035, 0x00D7, 0xF1FD, 0x313E, 0x66FE, 0x226F,
+	0x0003, 0xC8CE, 0xF2FD, 0xB9FF, 0x0014, 0x0066, 0xF4FE, 0x00B7, 0x0003, 0x22AE, 0x0045, 0xD1DF,
+	0x0025, 0x323E, 0xEAFE, 0x0077, 0x0003, 0xB2BE, 0x0085, 0xECEF, 0x0014, 0x0056, 0x717E, 0x727F,
+	0x0003, 0x0096, 0x0035, 0xB8BF, 0xF1FD, 0x333E, 0xE8EE, 0x545F, 0xF1FC, 0xD1DE, 0xFAFD, 0x00D7,
+	0xF8FC, 0x0016, 0xFFFD, 0x747F, 0xF4FC, 0x717E, 0xF3FD, 0xB3BF, 0xF2FC, 0xEAEF, 0xE8EE, 0x444F,
+	0xF1FC, 0x22AE, 0x0005, 0xB8BF, 0xF8FC, 0x00F7, 0xFCFE, 0x0077, 0xF4FC, 0x115E, 0xF5FD, 0x757F,
+	0xF2FC, 0xD8DF, 0xE2EE, 0x333F, 0xF1FC, 0xB2BE, 0xFAFD, 0x88CF, 0xF8FC, 0xFBFF, 0xFFFD, 0x737F,
+	0xF4FC, 0x006E, 0xF3FD, 0x00B7, 0xF2FC, 0x66EF, 0xF9FE, 0x313F, 0xF1FC, 0x009E, 0x0005, 0xBABF,
+	0xF8FC, 0xFDFF, 0xF6FE, 0x0067, 0xF4FC, 0x0026, 0xF5FD, 0x888F, 0xF2FC, 0xDCDF, 0xD4DE, 0x222F,
+	0xF1FC, 0xD1DE, 0xFAFD, 0xC4CF, 0xF8FC, 0x0016, 0xFFFD, 0x727F, 0xF4FC, 0x717E, 0xF3FD, 0x99BF,
+	0xF2FC, 0xECEF, 0xE8EE, 0x0047, 0xF1FC, 0x22AE, 0x0005, 0x00A7, 0xF8FC, 0xF7FF, 0xFCFE, 0x0057,
+	0xF4FC, 0x115E, 0xF5FD, 0x0097, 0xF2FC, 0xD5DF, 0xE2EE, 0x0037, 0xF1FC, 0xB2BE, 0xFAFD, 0x00C7,
+	0xF8FC, 0xFEFF, 0xFFFD, 0x667F, 0xF4FC, 0x006E, 0xF3FD, 0xA8AF, 0xF2FC, 0x00E7, 0xF9FE, 0x323F,
+	0xF1FC, 0x009E, 0x0005, 0xB1BF, 0xF8FC, 0xE4EF, 0xF6FE, 0x545F, 0xF4FC, 0x0026, 0xF5FD, 0x0087,
+	0xF2FC, 0x99DF, 0xD4DE, 0x111F,
+}
+
+// VLCLookupTable1 is the packed lookup table for non-initial row quads, indexed by context << 7 | codeword prefix.
+var VLCLookupTable1 = [1024]VLCLookupEntry{
+	0x0013, 0x0065, 0x0043, 0x00DE, 0x0083, 0x888D, 0x0023, 0x444E, 0x0013, 0x00A5, 0x0043, 0x88AE,
+	0x0083, 0x0035, 0x0023, 0x00D7, 0x0013, 0x00C5, 0x0043, 0x009E, 0x0083, 0x0055, 0x0023, 0x222E,
+	0x0013, 0x0095, 0x0043, 0x007E, 0x0083, 0x10FE, 0x0023, 0x0077, 0x0013, 0x0065, 0x0043, 0x88CE,
+	0x0083, 0x888D, 0x0023, 0x111E, 0x0013, 0x00A5, 0x0043, 0x005E, 0x0083, 0x0035, 0x0023, 0x00E7,
+	0x0013, 0x00C5, 0x0043, 0x00BE, 0x0083, 0x0055, 0x0023, 0x11FF, 0x0013, 0x0095, 0x0043, 0x003E,
+	0x0083, 0x40EE, 0x0023, 0xA2AF, 0x0013, 0x0065, 0x0043, 0x00DE, 0x0083, 0x888D, 0x0023, 0x444E,
+	0x0013, 0x00A5, 0x0043, 0x88AE, 0x0083, 0x0035, 0x0023, 0x44EF, 0x0013, 0x00C5, 0x0043, 0x009E,
+	0x0083, 0x0055, 0x0023, 0x222E, 0x0013, 0x0095, 0x0043, 0x007E, 0x0083, 0x10FE, 0x0023, 0x00B7,
+	0x0013, 0x0065, 0x0043, 0x88CE, 0x0083, 0x888D, 0x0023, 0x111E, 0x0013, 0x00A5, 0x0043, 0x005E,
+	0x0083, 0x0035, 0x0023, 0xC4CF, 0x0013, 0x00C5, 0x0043, 0x00BE, 0x0083, 0x0055, 0x0023, 0x00F7,
+	0x0013, 0x0095, 0x0043, 0x003E, 0x0083, 0x40EE, 0x0023, 0x006F, 0x0001, 0x0084, 0x0001, 0x0056,
+	0x0001, 0x0014, 0x0001, 0x00D7, 0x0001, 0x0024, 0x0001, 0x0096, 0x0001, 0x0045, 0x0001, 0x0077,
+	0x0001, 0x0084, 0x0001, 0x00C6, 0x0001, 0x0014, 0x0001, 0x888F, 0x0001, 0x0024, 0x0001, 0x00F7,
+	0x0001, 0x0035, 0x0001, 0x222F, 0x0001, 0x0084, 0x0001, 0x40FE, 0x0001, 0x0014, 0x0001, 0x00B7,
+	0x0001, 0x0024, 0x0001, 0x00BF, 0x0001, 0x0045, 0x0001, 0x0067, 0x0001, 0x0084, 0x0001, 0x00A6,
+	0x0001, 0x0014, 0x0001, 0x444F, 0x0001, 0x0024, 0x0001, 0x00E7, 0x0001, 0x0035, 0x0001, 0x113F,
+	0x0001, 0x0084, 0x0001, 0x0056, 0x0001, 0x0014, 0x0001, 0x00CF, 0x0001, 0x0024, 0x0001, 0x0096,
+	0x0001, 0x0045, 0x0001, 0x006F, 0x0001, 0x0084, 0x0001, 0x00C6, 0x0001, 0x0014, 0x0001, 0x009F,
+	0x0001, 0x0024, 0x0001, 0x00EF, 0x0001, 0x0035, 0x0001, 0x323F, 0x0001, 0x0084, 0x0001, 0x40FE,
+	0x0001, 0x0014, 0x0001, 0x00AF, 0x0001, 0x0024, 0x0001, 0x44FF, 0x0001, 0x0045, 0x0001, 0x005F,
+	0x0001, 0x0084, 0x0001, 0x00A6, 0x0001, 0x0014, 0x0001, 0x007F, 0x0001, 0x0024, 0x0001, 0x00DF,
+	0x0001, 0x0035, 0x0001, 0x111F, 0x0001, 0x0024, 0x0001, 0x0056, 0x0001, 0x0085, 0x0001, 0x00BF,
+	0x0001, 0x0014, 0x0001, 0x00F7, 0x0001, 0x00C6, 0x0001, 0x0077, 0x0001, 0x0024, 0x0001, 0xF8FF,
+	0x0001, 0x0045, 0x0001, 0x007F, 0x0001, 0x0014, 0x0001, 0x00DF, 0x0001, 0x00A6, 0x0001, 0x313F,
+	0x0001, 0x0024, 0x0001, 0x222E, 0x0001, 0x0085, 0x0001, 0x00B7, 0x0001, 0x0014, 0x0001, 0x44EF,
+	0x0001, 0xA2AE, 0x0001, 0x0067, 0x0001, 0x0024, 0x0001, 0x51FF, 0x0001, 0x0045, 0x0001, 0x0097,
+	0x0001, 0x0014, 0x0001, 0x00CF, 0x0001, 0x0036, 0x0001, 0x223F, 0x0001, 0x0024, 0x0001, 0x0056,
+	0x0001, 0x0085, 0x0001, 0xB2BF, 0x0001, 0x0014, 0x0001, 0x40EF, 0x0001, 0x00C6, 0x0001, 0x006F,
+	0x0001, 0x0024, 0x0001, 0x72FF, 0x0001, 0x0045, 0x0001, 0x009F, 0x0001, 0x0014, 0x0001, 0x00D7,
+	0x0001, 0x00A6, 0x0001, 0x444F, 0x0001, 0x0024, 0x0001, 0x222E, 0x0001, 0x0085, 0x0001, 0xA8AF,
+	0x0001, 0x0014, 0x0001, 0x00E7, 0x0001, 0xA2AE, 0x0001, 0x005F, 0x0001, 0x0024, 0x0001, 0x44FF,
+	0x0001, 0x0045, 0x0001, 0x888F, 0x0001, 0x0014, 0x0001, 0xAAAF, 0x0001, 0x0036, 0x0001, 0x111F,
+	0x0002, 0xF8FE, 0x0024, 0x0056, 0x0002, 0x00B6, 0x0085, 0x66FF, 0x0002, 0x00CE, 0x0014, 0x111E,
+	0x0002, 0x0096, 0x0035, 0xA8AF, 0x0002, 0x00F6, 0x0024, 0x313E, 0x0002, 0x00A6, 0x0045, 0xB3BF,
+	0x0002, 0xB2BE, 0x0014, 0xF5FF, 0x0002, 0x0066, 0x517E, 0x545F, 0x0002, 0xF2FE, 0x0024, 0x222E,
+	0x0002, 0x22AE, 0x0085, 0x44EF, 0x0002, 0x00C6, 0x0014, 0xF4FF, 0x0002, 0x0076, 0x0035, 0x447F,
+	0x0002, 0x40DE, 0x0024, 0x323E, 0x0002, 0x009E, 0x0045, 0x00D7, 0x0002, 0x88BE, 0x0014, 0xFAFF,
+	0x0002, 0x115E, 0xF1FE, 0x444F, 0x0002, 0xF8FE, 0x0024, 0x0056, 0x0002, 0x00B6, 0x0085, 0xC8EF,
+	0x0002, 0x00CE, 0x0014, 0x111E, 0x0002, 0x0096, 0x0035, 0x888F, 0x0002, 0x00F6, 0x0024, 0x313E,
+	0x0002, 0x00A6, 0x0045, 0x44DF, 0x0002, 0xB2BE, 0x0014, 0xA8FF, 0x0002, 0x0066, 0x517E, 0x006F,
+	0x0002, 0xF2FE, 0x0024, 0x222E, 0x0002, 0x22AE, 0x0085, 0x00E7, 0x0002, 0x00C6, 0x0014, 0xE2EF,
+	0x0002, 0x0076, 0x0035, 0x727F, 0x0002, 0x40DE, 0x0024, 0x323E, 0x0002, 0x009E, 0x0045, 0xB1BF,
+	0x0002, 0x88BE, 0x0014, 0x73FF, 0x0002, 0x115E, 0xF1FE, 0x333F, 0x0001, 0x0084, 0x0001, 0x20EE,
+	0x0001, 0x00C5, 0x0001, 0xC4CF, 0x0001, 0x0044, 0x0001, 0x32FF, 0x0001, 0x0015, 0x0001, 0x888F,
+	0x0001, 0x0084, 0x0001, 0x0066, 0x0001, 0x0025, 0x0001, 0x00AF, 0x0001, 0x0044, 0x0001, 0x22EF,
+	0x0001, 0x00A6, 0x0001, 0x005F, 0x0001, 0x0084, 0x0001, 0x444E, 0x0001, 0x00C5, 0x0001, 0xCCCF,
+	0x0001, 0x0044, 0x0001, 0x00F7, 0x0001, 0x0015, 0x0001, 0x006F, 0x0001, 0x0084, 0x0001, 0x0056,
+	0x0001, 0x0025, 0x0001, 0x009F, 0x0001, 0x0044, 0x0001, 0x00DF, 0x0001, 0x30FE, 0x0001, 0x222F,
+	0x0001, 0x0084, 0x0001, 0x20EE, 0x0001, 0x00C5, 0x0001, 0xC8CF, 0x0001, 0x0044, 0x0001, 0x11FF,
+	0x0001, 0x0015, 0x0001, 0x0077, 0x0001, 0x0084, 0x0001, 0x0066, 0x0001, 0x0025, 0x0001, 0x007F,
+	0x0001, 0x0044, 0x0001, 0x00E7, 0x0001, 0x00A6, 0x0001, 0x0037, 0x0001, 0x0084, 0x0001, 0x444E,
+	0x0001, 0x00C5, 0x0001, 0x00B7, 0x0001, 0x0044, 0x0001, 0x00BF, 0x0001, 0x0015, 0x0001, 0x003F,
+	0x0001, 0x0084, 0x0001, 0x0056, 0x0001, 0x0025, 0x0001, 0x0097, 0x0001, 0x0044, 0x0001, 0x00D7,
+	0x0001, 0x30FE, 0x0001, 0x111F, 0x0002, 0xA8EE, 0x0044, 0x888E, 0x0002, 0x00D6, 0x00C5, 0xF3FF,
+	0x0002, 0xFCFE, 0x0025, 0x003E, 0x0002, 0x00B6, 0x0055, 0xD8DF, 0x0002, 0xF8FE, 0x0044, 0x0066,
+	0x0002, 0x207E, 0x0085, 0x99FF, 0x0002, 0x00E6, 0x00F5, 0x0036, 0x0002, 0x00A6, 0x0015, 0x009F,
+	0x0002, 0xF2FE, 0x0044, 0x0076, 0x0002, 0x44CE, 0x00C5, 0x76FF, 0x0002, 0xF1FE, 0x0025, 0x444E,
+	0x0002, 0x00AE, 0x0055, 0xC8CF, 0x0002, 0xF4FE, 0x0044, 0x445E, 0x0002, 0x10BE, 0x0085, 0xE4EF,
+	0x0002, 0x54DE, 0x00F5, 0x111E, 0x0002, 0x0096, 0x0015, 0x222F, 0x0002, 0xA8EE, 0x0044, 0x888E,
+	0x0002, 0x00D6, 0x00C5, 0xFAFF, 0x0002, 0xFCFE, 0x0025, 0x003E, 0x0002, 0x00B6, 0x0055, 0x11BF,
+	0x0002, 0xF8FE, 0x0044, 0x0066, 0x0002, 0x207E, 0x0085, 0x22EF, 0x0002, 0x00E6, 0x00F5, 0x0036,
+	0x0002, 0x00A6, 0x0015, 0x227F, 0x0002, 0xF2FE, 0x0044, 0x0076, 0x0002, 0x44CE, 0x00C5, 0xD5FF,
+	0x0002, 0xF1FE, 0x0025, 0x444E, 0x0002, 0x00AE, 0x0055, 0x006F, 0x0002, 0xF4FE, 0x0044, 0x445E,
+	0x0002, 0x10BE, 0x0085, 0x11DF, 0x0002, 0x54DE, 0x00F5, 0x111E, 0x0002, 0x0096, 0x0015, 0x515F,
+	0x0003, 0x00F6, 0x0014, 0x111E, 0x0044, 0x888E, 0x00A5, 0xD4DF, 0x0003, 0xA2AE, 0x0055, 0x76FF,
+	0x0024, 0x223E, 0x00B6, 0xAAAF, 0x0003, 0x00E6, 0x0014, 0xF5FF, 0x0044, 0x0066, 0x0085, 0xCCCF,
+	0x0003, 0x009E, 0x00C5, 0x44EF, 0x0024, 0x0036, 0xF8FE, 0x317F, 0x0003, 0xE8EE, 0x0014, 0xF1FF,
+	0x0044, 0x0076, 0x00A5, 0xC4CF, 0x0003, 0x227E, 0x0055, 0xD1DF, 0x0024, 0x444E, 0xF4FE, 0x515F,
+	0x0003, 0x00D6, 0x0014, 0xE2EF, 0x0044, 0x445E, 0x0085, 0x22BF, 0x0003, 0x0096, 0x00C5, 0xC8DF,
+	0x0024, 0x222E, 0xF2FE, 0x226F, 0x0003, 0x00F6, 0x0014, 0x111E, 0x0044, 0x888E, 0x00A5, 0xB1BF,
+	0x0003, 0xA2AE, 0x0055, 0x33FF, 0x0024, 0x223E, 0x00B6, 0xA8AF, 0x0003, 0x00E6, 0x0014, 0xB9FF,
+	0x0044, 0x0066, 0x0085, 0xA8BF, 0x0003, 0x009E, 0x00C5, 0xE4EF, 0x0024, 0x0036, 0xF8FE, 0x646F,
+	0x0003, 0xE8EE, 0x0014, 0xFCFF, 0x0044, 0x0076, 0x00A5, 0xC8CF, 0x0003, 0x227E, 0x0055, 0xEAEF,
+	0x0024, 0x444E, 0xF4FE, 0x747F, 0x0003, 0x00D6, 0x0014, 0xFAFF, 0x0044, 0x445E, 0x0085, 0xB2BF,
+	0x0003, 0x0096, 0x00C5, 0x44DF, 0x0024, 0x222E, 0xF2FE, 0x313F, 0x00F3, 0xFAFE, 0xF1FD, 0x0036,
+	0x0004, 0x32BE, 0x0075, 0x11DF, 0x00F3, 0x54DE, 0xF2FD, 0xE4EF, 0x00D5, 0x717E, 0xFCFE, 0x737F,
+	0x00F3, 0xF3FE, 0xF8FD, 0x111E, 0x0004, 0x0096, 0x0055, 0xB1BF, 0x00F3, 0x00CE, 0x00B5, 0xD8DF,
+	0xF4FD, 0x0066, 0xB9FE, 0x545F, 0x00F3, 0x76FE, 0xF1FD, 0x0026, 0x0004, 0x00A6, 0x0075, 0x009F,
+	0x00F3, 0x00AE, 0xF2FD, 0xF7FF, 0x00D5, 0x0046, 0xF5FE, 0x747F, 0x00F3, 0x00E6, 0xF8FD, 0x0016,
+	0x0004, 0x0086, 0x0055, 0x888F, 0x00F3, 0x00C6, 0x00B5, 0xE2EF, 0xF4FD, 0x115E, 0xA8EE, 0x113F,
+	0x00F3, 0xFAFE, 0xF1FD, 0x0036, 0x0004, 0x32BE, 0x0075, 0xD1DF, 0x00F3, 0x54DE, 0xF2FD, 0xFBFF,
+	0x00D5, 0x717E, 0xFCFE, 0x447F, 0x00F3, 0xF3FE, 0xF8FD, 0x111E, 0x0004, 0x0096, 0x0055, 0x727F,
+	0x00F3, 0x00CE, 0x00B5, 0x22EF, 0xF4FD, 0x0066, 0xB9FE, 0x444F, 0x00F3, 0x76FE, 0xF1FD, 0x0026,
+	0x0004, 0x00A6, 0x0075, 0x11BF, 0x00F3, 0x00AE, 0xF2FD, 0xFFFF, 0x00D5, 0x0046, 0xF5FE, 0x323F,
+	0x00F3, 0x00E6, 0xF8FD, 0x0016, 0x0004, 0x0086, 0x0055, 0x006F, 0x00F3, 0x00C6, 0x00B5, 0xB8BF,
+	0xF4FD, 0x115E, 0xA8EE, 0x222F,
+}
+
+// ojphEncoderVLCTable0 maps cq<<8 | rho<<4 | eps to the initial-row codeword (bits 8-15), its length (bits 4-7) and e_k (bits 0-3).
+var ojphEncoderVLCTable0 = [2048]uint16{
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0640, 0x3F71, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0030, 0x0000, 0x7F72, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x1150, 0x1F73, 0x5F72, 0x5F72, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0230, 0x0000, 0x0000, 0x0000, 0x1364, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0E50, 0x0F75, 0x0000, 0x0000,
+	0x2364, 0x2364, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0360, 0x0000, 0x6F70, 0x0000, 0x6F70, 0x0000, 0x6F70, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x2F70, 0x0D62, 0x4F72, 0x4F72, 0x0D62, 0x0D62, 0x4F72, 0x4F72,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0430, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x3D68, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x1D60, 0x2D60, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2D60, 0x2D60, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0150, 0x0000, 0x777A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x3568, 0x0000, 0x3568, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3770, 0x5771, 0x0961, 0x5771,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0961, 0x5771, 0x0961, 0x5771, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x1E50, 0x0000, 0x0000, 0x0000, 0x156C, 0x0000, 0x0000, 0x0000, 0x256C, 0x0000, 0x0000, 0x0000,
+	0x177C, 0x0000, 0x0000, 0x0000, 0x6770, 0x2771, 0x0000, 0x0000, 0x4775, 0x2771, 0x0000, 0x0000,
+	0x077D, 0x2771, 0x0000, 0x0000, 0x4775, 0x2771, 0x0000, 0x0000, 0x7B70, 0x0000, 0x4B72, 0x0000,
+	0x3B7E, 0x0000, 0x4B72, 0x0000, 0x056A, 0x0000, 0x4B72, 0x0000, 0x056A, 0x0000, 0x4B72, 0x0000,
+	0x5B70, 0x337F, 0x196E, 0x196E, 0x296F, 0x0B7F, 0x737E, 0x737E, 0x396F, 0x1B79, 0x6B7B, 0x1B79,
+	0x2B7F, 0x1B79, 0x6B7B, 0x1B79, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0E40, 0x1F71, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0640, 0x0000, 0x3B62, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x1B60, 0x3D60, 0x3D60, 0x3D60, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0A40, 0x0000, 0x0000, 0x0000,
+	0x2B64, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0B60, 0x7F75, 0x0000, 0x0000, 0x3364, 0x3364, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x1360, 0x0000, 0x2360, 0x0000, 0x2360, 0x0000, 0x2360, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3F70, 0x0362, 0x5F72, 0x5F72,
+	0x0362, 0x0362, 0x5F72, 0x5F72, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0240, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1D68, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x2D60, 0x0D60, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0D60, 0x0D60, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3560, 0x0000, 0x6F7A, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x1568, 0x0000, 0x1568, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x2F70, 0x4F71, 0x1161, 0x4F71, 0x0000, 0x0000, 0x0000, 0x0000, 0x1161, 0x4F71, 0x1161, 0x4F71,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0150, 0x0000, 0x0000, 0x0000, 0x056C, 0x0000, 0x0000, 0x0000,
+	0x2568, 0x0000, 0x0000, 0x0000, 0x2568, 0x0000, 0x0000, 0x0000, 0x0F70, 0x1771, 0x0000, 0x0000,
+	0x3965, 0x1771, 0x0000, 0x0000, 0x777D, 0x1771, 0x0000, 0x0000, 0x3965, 0x1771, 0x0000, 0x0000,
+	0x3770, 0x0000, 0x5772, 0x0000, 0x677E, 0x0000, 0x5772, 0x0000, 0x196A, 0x0000, 0x5772, 0x0000,
+	0x196A, 0x0000, 0x5772, 0x0000, 0x0770, 0x477F, 0x096A, 0x096A, 0x316E, 0x316E, 0x096A, 0x096A,
+	0x296B, 0x2778, 0x2778, 0x2778, 0x296B, 0x2778, 0x2778, 0x2778, 0x0020, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0E40, 0x1B61, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0640, 0x0000, 0x3F72, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2B60, 0x3361, 0x7F73, 0x3361,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0A40, 0x0000, 0x0000, 0x0000, 0x0B64, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0150, 0x1365, 0x0000, 0x0000, 0x2365, 0x2F75, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0360, 0x0000, 0x5F70, 0x0000,
+	0x5F70, 0x0000, 0x5F70, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x1F70, 0x1163, 0x6F72, 0x6F72, 0x3777, 0x1163, 0x6F72, 0x6F72, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0240, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x4F78, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3D60, 0x1D60, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x1D60, 0x1D60, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x2D60, 0x0000, 0x0D60, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0D60, 0x0000, 0x0D60, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0F70, 0x3562, 0x7772, 0x7772, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x3562, 0x3562, 0x7772, 0x7772, 0x0000, 0x0000, 0x0000, 0x0000, 0x1560, 0x0000, 0x0000, 0x0000,
+	0x2564, 0x0000, 0x0000, 0x0000, 0x577C, 0x0000, 0x0000, 0x0000, 0x2564, 0x0000, 0x0000, 0x0000,
+	0x1770, 0x677D, 0x0000, 0x0000, 0x396C, 0x396C, 0x0000, 0x0000, 0x0568, 0x0568, 0x0000, 0x0000,
+	0x0568, 0x0568, 0x0000, 0x0000, 0x2770, 0x0000, 0x7B72, 0x0000, 0x1962, 0x0000, 0x7B72, 0x0000,
+	0x1962, 0x0000, 0x7B72, 0x0000, 0x1962, 0x0000, 0x7B72, 0x0000, 0x4770, 0x296F, 0x0773, 0x0961,
+	0x3167, 0x0961, 0x0773, 0x0961, 0x3B7F, 0x0961, 0x0773, 0x0961, 0x3167, 0x0961, 0x0773, 0x0961,
+	0x0030, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0440, 0x3D61, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0C50, 0x0000, 0x4F72, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x1D60, 0x0561, 0x7F73, 0x0561, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x1650, 0x0000, 0x0000, 0x0000, 0x2D64, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0650, 0x0D65, 0x0000, 0x0000,
+	0x3565, 0x1A55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x3F70, 0x0000, 0x1F76, 0x0000, 0x5F74, 0x0000, 0x5F74, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x6F70, 0x2567, 0x0F77, 0x7777, 0x1566, 0x1566, 0x2F76, 0x2F76,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0A50, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0778, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x3960, 0x3771, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5779, 0x3771, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x1960, 0x0000, 0x177A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x2968, 0x0000, 0x2968, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6770, 0x277B, 0x0963, 0x4771,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x7B7B, 0x4771, 0x0963, 0x4771, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x3160, 0x0000, 0x0000, 0x0000, 0x1164, 0x0000, 0x0000, 0x0000, 0x3B7C, 0x0000, 0x0000, 0x0000,
+	0x1164, 0x0000, 0x0000, 0x0000, 0x5B70, 0x216D, 0x0000, 0x0000, 0x016D, 0x2B7D, 0x0000, 0x0000,
+	0x4B7D, 0x1B79, 0x0000, 0x0000, 0x6B7D, 0x1B79, 0x0000, 0x0000, 0x0B70, 0x0000, 0x337E, 0x0000,
+	0x737E, 0x0000, 0x1374, 0x0000, 0x3E6C, 0x0000, 0x3E6C, 0x0000, 0x1374, 0x0000, 0x1374, 0x0000,
+	0x5370, 0x1C5F, 0x2E6F, 0x437F, 0x025F, 0x1E6F, 0x237E, 0x237E, 0x125F, 0x637B, 0x0E6A, 0x0E6A,
+	0x037F, 0x637B, 0x0E6A, 0x0E6A, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0E40, 0x3F71, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0640, 0x0000, 0x1B62, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x2B60, 0x7F73, 0x3D62, 0x3D62, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0A40, 0x0000, 0x0000, 0x0000,
+	0x5F74, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0B60, 0x3360, 0x0000, 0x0000, 0x3360, 0x3360, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x1360, 0x0000, 0x2360, 0x0000, 0x2360, 0x0000, 0x2360, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1F70, 0x0364, 0x0364, 0x0364,
+	0x6F74, 0x6F74, 0x6F74, 0x6F74, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0240, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1D68, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x1160, 0x7770, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x7770, 0x7770, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0150, 0x0000, 0x2D6A, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0D6A, 0x0000, 0x2F7A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x4F70, 0x3560, 0x0F7B, 0x3560, 0x0000, 0x0000, 0x0000, 0x0000, 0x3560, 0x3560, 0x3560, 0x3560,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x1560, 0x0000, 0x0000, 0x0000, 0x377C, 0x0000, 0x0000, 0x0000,
+	0x2568, 0x0000, 0x0000, 0x0000, 0x2568, 0x0000, 0x0000, 0x0000, 0x5770, 0x0771, 0x0000, 0x0000,
+	0x0561, 0x0771, 0x0000, 0x0000, 0x0561, 0x0771, 0x0000, 0x0000, 0x0561, 0x0771, 0x0000, 0x0000,
+	0x1770, 0x0000, 0x677E, 0x0000, 0x3964, 0x0000, 0x3964, 0x0000, 0x196C, 0x0000, 0x196C, 0x0000,
+	0x3964, 0x0000, 0x3964, 0x0000, 0x2770, 0x2969, 0x0967, 0x2969, 0x3B7F, 0x2969, 0x7B77, 0x2969,
+	0x316B, 0x4779, 0x0967, 0x4779, 0x316B, 0x4779, 0x7B77, 0x4779, 0x0030, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x1A50, 0x7F71, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0A50, 0x0000, 0x1D62, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2D60, 0x3F73, 0x3963, 0x5F73,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x1250, 0x0000, 0x0000, 0x0000, 0x1F74, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0D60, 0x6F75, 0x0000, 0x0000, 0x3564, 0x3564, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1560, 0x0000, 0x2562, 0x0000,
+	0x2F76, 0x0000, 0x2562, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x4F70, 0x3777, 0x7777, 0x0F77, 0x0566, 0x0566, 0x5776, 0x5776, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0250, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x1968, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2660, 0x6779, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x1778, 0x1778, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x1C50, 0x0000, 0x096A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x316A, 0x0000, 0x296A, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x2770, 0x7B7B, 0x216B, 0x477B, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x1169, 0x0779, 0x1169, 0x0779, 0x0000, 0x0000, 0x0000, 0x0000, 0x0160, 0x0000, 0x0000, 0x0000,
+	0x3B7C, 0x0000, 0x0000, 0x0000, 0x3E68, 0x0000, 0x0000, 0x0000, 0x3E68, 0x0000, 0x0000, 0x0000,
+	0x5B70, 0x2B7D, 0x0000, 0x0000, 0x2E6D, 0x1B7D, 0x0000, 0x0000, 0x1E69, 0x6B79, 0x0000, 0x0000,
+	0x1E69, 0x6B79, 0x0000, 0x0000, 0x4B70, 0x0000, 0x0E6E, 0x0000, 0x537E, 0x0000, 0x0B76, 0x0000,
+	0x366E, 0x0000, 0x337E, 0x0000, 0x737E, 0x0000, 0x0B76, 0x0000, 0x1370, 0x066F, 0x045F, 0x7D7F,
+	0x0C5F, 0x6377, 0x1667, 0x4377, 0x145F, 0x037D, 0x3D7F, 0x037D, 0x237F, 0x6377, 0x1667, 0x4377,
+	0x0030, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0440, 0x0361, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0C50, 0x0000, 0x0D62, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x1A50, 0x1D63, 0x2D63, 0x3D63, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0A50, 0x0000, 0x0000, 0x0000, 0x3F74, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3560, 0x1561, 0x0000, 0x0000,
+	0x7F75, 0x1561, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x2560, 0x0000, 0x5F72, 0x0000, 0x1F76, 0x0000, 0x5F72, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x6F70, 0x3667, 0x7777, 0x2F77, 0x0566, 0x0566, 0x4F76, 0x4F76,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1250, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0F78, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x3960, 0x3771, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5779, 0x3771, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x1960, 0x0000, 0x2962, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x177A, 0x0000, 0x2962, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6770, 0x0969, 0x316B, 0x0969,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x7B7B, 0x4779, 0x277B, 0x4779, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x1160, 0x0000, 0x0000, 0x0000, 0x3B7C, 0x0000, 0x0000, 0x0000, 0x216C, 0x0000, 0x0000, 0x0000,
+	0x077C, 0x0000, 0x0000, 0x0000, 0x5B70, 0x6B7D, 0x0000, 0x0000, 0x0165, 0x3375, 0x0000, 0x0000,
+	0x1B7C, 0x1B7C, 0x0000, 0x0000, 0x0165, 0x3375, 0x0000, 0x0000, 0x2B70, 0x0000, 0x4B7E, 0x0000,
+	0x537E, 0x0000, 0x0B72, 0x0000, 0x3E6E, 0x0000, 0x0B72, 0x0000, 0x737E, 0x0000, 0x0B72, 0x0000,
+	0x1370, 0x1C5F, 0x025F, 0x0E6F, 0x266F, 0x237F, 0x1E66, 0x1E66, 0x066F, 0x637B, 0x2E6E, 0x2E6E,
+	0x166F, 0x637B, 0x1E66, 0x1E66, 0x1250, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0560, 0x7F71, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x3960, 0x0000, 0x3F72, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x5F70, 0x2F73, 0x6F73, 0x1F73, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4F70, 0x0000, 0x0000, 0x0000,
+	0x0F74, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x5770, 0x1961, 0x0000, 0x0000, 0x7775, 0x1961, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x3770, 0x0000, 0x2960, 0x0000, 0x2960, 0x0000, 0x2960, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1770, 0x0967, 0x4777, 0x2777,
+	0x0777, 0x1B77, 0x6776, 0x6776, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x7B70, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3B78, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x5B70, 0x3160, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x3160, 0x3160, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5370, 0x0000, 0x1162, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x6B7A, 0x0000, 0x1162, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x2B70, 0x737B, 0x216B, 0x0B7B, 0x0000, 0x0000, 0x0000, 0x0000, 0x137B, 0x4B79, 0x337B, 0x4B79,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x6370, 0x0000, 0x0000, 0x0000, 0x437C, 0x0000, 0x0000, 0x0000,
+	0x2378, 0x0000, 0x0000, 0x0000, 0x2378, 0x0000, 0x0000, 0x0000, 0x0370, 0x016D, 0x0000, 0x0000,
+	0x3E6D, 0x5D7D, 0x0000, 0x0000, 0x1D7D, 0x7D79, 0x0000, 0x0000, 0x3D7D, 0x7D79, 0x0000, 0x0000,
+	0x6D70, 0x0000, 0x1E6E, 0x0000, 0x757E, 0x0000, 0x2D76, 0x0000, 0x0E6E, 0x0000, 0x0D7E, 0x0000,
+	0x4D7E, 0x0000, 0x2D76, 0x0000, 0x1570, 0x004F, 0x0C4F, 0x0A5F, 0x084F, 0x1A5F, 0x366F, 0x557F,
+	0x044F, 0x2E6F, 0x025F, 0x257F, 0x166F, 0x357F, 0x657F, 0x065F,
+}
+
+// ojphEncoderVLCTable1 is ojphEncoderVLCTable0 for non-initial rows.
+var ojphEncoderVLCTable1 = [2048]uint16{
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0030, 0x2761, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0630, 0x0000, 0x1762, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0D50, 0x3B60, 0x3B60, 0x3B60, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0230, 0x0000, 0x0000, 0x0000, 0x0764, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1550, 0x2B60, 0x0000, 0x0000,
+	0x2B60, 0x2B60, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0150, 0x0000, 0x7F70, 0x0000, 0x7F70, 0x0000, 0x7F70, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x1F70, 0x1B60, 0x1B60, 0x1B60, 0x1B60, 0x1B60, 0x1B60, 0x1B60,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0430, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0558, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x1950, 0x1360, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1360, 0x1360, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0950, 0x0000, 0x3F7A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0B68, 0x0000, 0x0B68, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5F70, 0x3360, 0x3360, 0x3360,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x3360, 0x3360, 0x3360, 0x3360, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x1150, 0x0000, 0x0000, 0x0000, 0x6F7C, 0x0000, 0x0000, 0x0000, 0x2368, 0x0000, 0x0000, 0x0000,
+	0x2368, 0x0000, 0x0000, 0x0000, 0x0F70, 0x0360, 0x0000, 0x0000, 0x0360, 0x0360, 0x0000, 0x0000,
+	0x0360, 0x0360, 0x0000, 0x0000, 0x0360, 0x0360, 0x0000, 0x0000, 0x2F70, 0x0000, 0x3D64, 0x0000,
+	0x4F74, 0x0000, 0x4F74, 0x0000, 0x3D64, 0x0000, 0x3D64, 0x0000, 0x4F74, 0x0000, 0x4F74, 0x0000,
+	0x7770, 0x3771, 0x1D61, 0x3771, 0x1D61, 0x3771, 0x1D61, 0x3771, 0x1D61, 0x3771, 0x1D61, 0x3771,
+	0x1D61, 0x3771, 0x1D61, 0x3771, 0x0010, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0540, 0x7F71, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0940, 0x0000, 0x1F72, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x1D50, 0x3F71, 0x5F73, 0x3F71, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0D50, 0x0000, 0x0000, 0x0000,
+	0x3774, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0360, 0x6F70, 0x0000, 0x0000, 0x6F70, 0x6F70, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x2F70, 0x0000, 0x4F70, 0x0000, 0x4F70, 0x0000, 0x4F70, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0F70, 0x7770, 0x7770, 0x7770,
+	0x7770, 0x7770, 0x7770, 0x7770, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0140, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1778, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0B60, 0x5770, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x5770, 0x5770, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3360, 0x0000, 0x6770, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x6770, 0x0000, 0x6770, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x2770, 0x2B70, 0x2B70, 0x2B70, 0x0000, 0x0000, 0x0000, 0x0000, 0x2B70, 0x2B70, 0x2B70, 0x2B70,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x1360, 0x0000, 0x0000, 0x0000, 0x4770, 0x0000, 0x0000, 0x0000,
+	0x4770, 0x0000, 0x0000, 0x0000, 0x4770, 0x0000, 0x0000, 0x0000, 0x0770, 0x7B70, 0x0000, 0x0000,
+	0x7B70, 0x7B70, 0x0000, 0x0000, 0x7B70, 0x7B70, 0x0000, 0x0000, 0x7B70, 0x7B70, 0x0000, 0x0000,
+	0x3B70, 0x0000, 0x5B70, 0x0000, 0x5B70, 0x0000, 0x5B70, 0x0000, 0x5B70, 0x0000, 0x5B70, 0x0000,
+	0x5B70, 0x0000, 0x5B70, 0x0000, 0x1B70, 0x2364, 0x2364, 0x2364, 0x6B74, 0x6B74, 0x6B74, 0x6B74,
+	0x2364, 0x2364, 0x2364, 0x2364, 0x6B74, 0x6B74, 0x6B74, 0x6B74, 0x0010, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0940, 0x7F71, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0140, 0x0000, 0x2362, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3D60, 0x1F73, 0x3F72, 0x3F72,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x1550, 0x0000, 0x0000, 0x0000, 0x5F74, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0360, 0x6F70, 0x0000, 0x0000, 0x6F70, 0x6F70, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2F70, 0x0000, 0x4F70, 0x0000,
+	0x4F70, 0x0000, 0x4F70, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0F70, 0x1770, 0x1770, 0x1770, 0x1770, 0x1770, 0x1770, 0x1770, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0550, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x7778, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3770, 0x5770, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x5770, 0x5770, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x1D60, 0x0000, 0x2D6A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x677A, 0x0000, 0x7B7A, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x2770, 0x0770, 0x477B, 0x0770, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0770, 0x0770, 0x0770, 0x0770, 0x0000, 0x0000, 0x0000, 0x0000, 0x0D60, 0x0000, 0x0000, 0x0000,
+	0x3B70, 0x0000, 0x0000, 0x0000, 0x3B70, 0x0000, 0x0000, 0x0000, 0x3B70, 0x0000, 0x0000, 0x0000,
+	0x5B70, 0x1B70, 0x0000, 0x0000, 0x1B70, 0x1B70, 0x0000, 0x0000, 0x1B70, 0x1B70, 0x0000, 0x0000,
+	0x1B70, 0x1B70, 0x0000, 0x0000, 0x6B70, 0x0000, 0x4B74, 0x0000, 0x2B74, 0x0000, 0x2B74, 0x0000,
+	0x4B74, 0x0000, 0x4B74, 0x0000, 0x2B74, 0x0000, 0x2B74, 0x0000, 0x0B70, 0x3375, 0x5377, 0x3375,
+	0x7374, 0x7374, 0x7374, 0x7374, 0x137F, 0x3375, 0x5377, 0x3375, 0x7374, 0x7374, 0x7374, 0x7374,
+	0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0A40, 0x0B61, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0240, 0x0000, 0x2362, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0E50, 0x1363, 0x3363, 0x7F73, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x1650, 0x0000, 0x0000, 0x0000, 0x3F74, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0360, 0x3D61, 0x0000, 0x0000,
+	0x1F75, 0x3D61, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x1D60, 0x0000, 0x5F70, 0x0000, 0x5F70, 0x0000, 0x5F70, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x2D60, 0x1E65, 0x6F77, 0x1E65, 0x2F74, 0x2F74, 0x2F74, 0x2F74,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0650, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x4F78, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0D60, 0x3560, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3560, 0x3560, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x1560, 0x0000, 0x2562, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0F7A, 0x0000, 0x2562, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0560, 0x777B, 0x196B, 0x177B,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x3968, 0x3968, 0x3968, 0x3968, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x2960, 0x0000, 0x0000, 0x0000, 0x0960, 0x0000, 0x0000, 0x0000, 0x0960, 0x0000, 0x0000, 0x0000,
+	0x0960, 0x0000, 0x0000, 0x0000, 0x3770, 0x3164, 0x0000, 0x0000, 0x5774, 0x5774, 0x0000, 0x0000,
+	0x3164, 0x3164, 0x0000, 0x0000, 0x5774, 0x5774, 0x0000, 0x0000, 0x6770, 0x0000, 0x6B7E, 0x0000,
+	0x2774, 0x0000, 0x2774, 0x0000, 0x477C, 0x0000, 0x477C, 0x0000, 0x2774, 0x0000, 0x2774, 0x0000,
+	0x1160, 0x3E6F, 0x216F, 0x7B77, 0x2B7F, 0x1B7F, 0x0776, 0x0776, 0x016F, 0x5B7A, 0x3B7F, 0x7B77,
+	0x5B7A, 0x5B7A, 0x0776, 0x0776, 0x0010, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0D50, 0x7F71, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x1550, 0x0000, 0x3F72, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x5F70, 0x6F70, 0x6F70, 0x6F70, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0940, 0x0000, 0x0000, 0x0000,
+	0x2364, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x3360, 0x1F70, 0x0000, 0x0000, 0x1F70, 0x1F70, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x1360, 0x0000, 0x2F70, 0x0000, 0x2F70, 0x0000, 0x2F70, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4F70, 0x5770, 0x5770, 0x5770,
+	0x5770, 0x5770, 0x5770, 0x5770, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0140, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0F78, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x7770, 0x3770, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x3770, 0x3770, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1D60, 0x0000, 0x1770, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x1770, 0x0000, 0x1770, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x6770, 0x6B70, 0x6B70, 0x6B70, 0x0000, 0x0000, 0x0000, 0x0000, 0x6B70, 0x6B70, 0x6B70, 0x6B70,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0550, 0x0000, 0x0000, 0x0000, 0x077C, 0x0000, 0x0000, 0x0000,
+	0x477C, 0x0000, 0x0000, 0x0000, 0x277C, 0x0000, 0x0000, 0x0000, 0x7B70, 0x3B70, 0x0000, 0x0000,
+	0x3B70, 0x3B70, 0x0000, 0x0000, 0x3B70, 0x3B70, 0x0000, 0x0000, 0x3B70, 0x3B70, 0x0000, 0x0000,
+	0x5B70, 0x0000, 0x1B72, 0x0000, 0x0362, 0x0000, 0x1B72, 0x0000, 0x0362, 0x0000, 0x1B72, 0x0000,
+	0x0362, 0x0000, 0x1B72, 0x0000, 0x2B70, 0x4B71, 0x0B73, 0x4B71, 0x3D63, 0x4B71, 0x0B73, 0x4B71,
+	0x3D63, 0x4B71, 0x0B73, 0x4B71, 0x3D63, 0x4B71, 0x0B73, 0x4B71, 0x0020, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x1E50, 0x3B61, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0A50, 0x0000, 0x3F72, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1B60, 0x0B60, 0x0B60, 0x0B60,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0240, 0x0000, 0x0000, 0x0000, 0x2B64, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0E50, 0x7F75, 0x0000, 0x0000, 0x3364, 0x3364, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1360, 0x0000, 0x6F70, 0x0000,
+	0x6F70, 0x0000, 0x6F70, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x2360, 0x1562, 0x5F72, 0x5F72, 0x1562, 0x1562, 0x5F72, 0x5F72, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x1650, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0368, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3D60, 0x1F70, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x1F70, 0x1F70, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x1D60, 0x0000, 0x2D60, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2D60, 0x0000, 0x2D60, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0D60, 0x4F71, 0x3561, 0x4F71, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x3561, 0x4F71, 0x3561, 0x4F71, 0x0000, 0x0000, 0x0000, 0x0000, 0x0650, 0x0000, 0x0000, 0x0000,
+	0x2564, 0x0000, 0x0000, 0x0000, 0x2F7C, 0x0000, 0x0000, 0x0000, 0x2564, 0x0000, 0x0000, 0x0000,
+	0x0560, 0x7771, 0x0000, 0x0000, 0x3965, 0x7771, 0x0000, 0x0000, 0x0F7D, 0x7771, 0x0000, 0x0000,
+	0x3965, 0x7771, 0x0000, 0x0000, 0x1960, 0x0000, 0x5772, 0x0000, 0x377E, 0x0000, 0x5772, 0x0000,
+	0x016A, 0x0000, 0x5772, 0x0000, 0x016A, 0x0000, 0x5772, 0x0000, 0x1A50, 0x296F, 0x216F, 0x077F,
+	0x316F, 0x677D, 0x2777, 0x677D, 0x116F, 0x1779, 0x477F, 0x1779, 0x096F, 0x1779, 0x2777, 0x1779,
+	0x0030, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0240, 0x0361, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0C40, 0x0000, 0x3D62, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x1D60, 0x7F73, 0x0D62, 0x0D62, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0440, 0x0000, 0x0000, 0x0000, 0x2D64, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0A50, 0x2F75, 0x0000, 0x0000,
+	0x3564, 0x3564, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x1560, 0x0000, 0x3F72, 0x0000, 0x5F76, 0x0000, 0x3F72, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x2560, 0x1F73, 0x2962, 0x2962, 0x6F77, 0x1F73, 0x2962, 0x2962,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1650, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0568, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x3960, 0x1960, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1960, 0x1960, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0650, 0x0000, 0x096A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x4F7A, 0x0000, 0x0F7A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0E60, 0x477B, 0x777B, 0x3772,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x577A, 0x577A, 0x3772, 0x3772, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x1A50, 0x0000, 0x0000, 0x0000, 0x277C, 0x0000, 0x0000, 0x0000, 0x677C, 0x0000, 0x0000, 0x0000,
+	0x177C, 0x0000, 0x0000, 0x0000, 0x3160, 0x2B7D, 0x0000, 0x0000, 0x077D, 0x7B74, 0x0000, 0x0000,
+	0x3B7C, 0x3B7C, 0x0000, 0x0000, 0x7B74, 0x7B74, 0x0000, 0x0000, 0x1160, 0x0000, 0x337E, 0x0000,
+	0x5B7E, 0x0000, 0x1B74, 0x0000, 0x216E, 0x0000, 0x6B7E, 0x0000, 0x1B74, 0x0000, 0x1B74, 0x0000,
+	0x0160, 0x237F, 0x3E6F, 0x4B73, 0x2E6F, 0x137F, 0x0B77, 0x4B73, 0x1E6F, 0x537B, 0x737F, 0x4B73,
+	0x637F, 0x537B, 0x0B77, 0x4B73, 0x0440, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3360, 0x1361, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x2360, 0x0000, 0x7F72, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0360, 0x3F71, 0x6F73, 0x3F71, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2D60, 0x0000, 0x0000, 0x0000,
+	0x5F74, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x1650, 0x3D61, 0x0000, 0x0000, 0x1F75, 0x3D61, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x1D60, 0x0000, 0x7770, 0x0000, 0x7770, 0x0000, 0x7770, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0650, 0x0D67, 0x5777, 0x0F77,
+	0x2F77, 0x4F74, 0x4F74, 0x4F74, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x3560, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3778, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x1560, 0x2770, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x2770, 0x2770, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2560, 0x0000, 0x2960, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x2960, 0x0000, 0x2960, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x1A50, 0x177B, 0x0563, 0x6771, 0x0000, 0x0000, 0x0000, 0x0000, 0x7B7B, 0x6771, 0x0563, 0x6771,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x3960, 0x0000, 0x0000, 0x0000, 0x1960, 0x0000, 0x0000, 0x0000,
+	0x1960, 0x0000, 0x0000, 0x0000, 0x1960, 0x0000, 0x0000, 0x0000, 0x0C50, 0x477D, 0x0000, 0x0000,
+	0x0965, 0x0771, 0x0000, 0x0000, 0x1B7D, 0x0771, 0x0000, 0x0000, 0x0965, 0x0771, 0x0000, 0x0000,
+	0x3160, 0x0000, 0x3B7E, 0x0000, 0x0B7E, 0x0000, 0x5B72, 0x0000, 0x3E6A, 0x0000, 0x5B72, 0x0000,
+	0x3E6A, 0x0000, 0x5B72, 0x0000, 0x0030, 0x025F, 0x0A5F, 0x116F, 0x1C5F, 0x2E6F, 0x2167, 0x2B7F,
+	0x125F, 0x1E6B, 0x016F, 0x4B7F, 0x0E6F, 0x1E6B, 0x2167, 0x6B7F,
+}
+
+// UVLCTbl0 holds decode entries for initial row pairs (includes MEL event).
+var UVLCTbl0 = [256 + 64]UVLCDecodeEntry{
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x16AB, 0x0401, 0x0802, 0x0401, 0x0C8B, 0x0401, 0x0802, 0x0401,
+	0x16AB, 0x0401, 0x0802, 0x0401, 0x0C8B, 0x0401, 0x0802, 0x0401, 0x16AB, 0x0401, 0x0802, 0x0401,
+	0x0C8B, 0x0401, 0x0802, 0x0401, 0x16AB, 0x0401, 0x0802, 0x0401, 0x0C8B, 0x0401, 0x0802, 0x0401,
+	0x16AB, 0x0401, 0x0802, 0x0401, 0x0C8B, 0x0401, 0x0802, 0x0401, 0x16AB, 0x0401, 0x0802, 0x0401,
+	0x0C8B, 0x0401, 0x0802, 0x0401, 0x16AB, 0x0401, 0x0802, 0x0401, 0x0C8B, 0x0401, 0x0802, 0x0401,
+	0x16AB, 0x0401, 0x0802, 0x0401, 0x0C8B, 0x0401, 0x0802, 0x0401, 0xA02B, 0x2001, 0x4002, 0x2001,
+	0x600B, 0x2001, 0x4002, 0x2001, 0xA02B, 0x2001, 0x4002, 0x2001, 0x600B, 0x2001, 0x4002, 0x2001,
+	0xA02B, 0x2001, 0x4002, 0x2001, 0x600B, 0x2001, 0x4002, 0x2001, 0xA02B, 0x2001, 0x4002, 0x2001,
+	0x600B, 0x2001, 0x4002, 0x2001, 0xA02B, 0x2001, 0x4002, 0x2001, 0x600B, 0x2001, 0x4002, 0x2001,
+	0xA02B, 0x2001, 0x4002, 0x2001, 0x600B, 0x2001, 0x4002, 0x2001, 0xA02B, 0x2001, 0x4002, 0x2001,
+	0x600B, 0x2001, 0x4002, 0x2001, 0xA02B, 0x2001, 0x4002, 0x2001, 0x600B, 0x2001, 0x4002, 0x2001,
+	0x36AC, 0xA42C, 0xA82D, 0x2402, 0x2C8C, 0x4403, 0x2803, 0x2402, 0x56AC, 0x640C, 0x4804, 0x2402,
+	0x4C8C, 0x4403, 0x2803, 0x2402, 0x36AC, 0xA42C, 0x680D, 0x2402, 0x2C8C, 0x4403, 0x2803, 0x2402,
+	0x56AC, 0x640C, 0x4804, 0x2402, 0x4C8C, 0x4403, 0x2803, 0x2402, 0x36AC, 0xA42C, 0xA82D, 0x2402,
+	0x2C8C, 0x4403, 0x2803, 0x2402, 0x56AC, 0x640C, 0x4804, 0x2402, 0x4C8C, 0x4403, 0x2803, 0x2402,
+	0x36AC, 0xA42C, 0x680D, 0x2402, 0x2C8C, 0x4403, 0x2803, 0x2402, 0x56AC, 0x640C, 0x4804, 0x2402,
+	0x4C8C, 0x4403, 0x2803, 0x2402, 0xFED6, 0xEC2C, 0xF02D, 0x6C02, 0xF4B6, 0x8C03, 0x7003, 0x6C02,
+	0x7EAC, 0xAC0C, 0x9004, 0x6C02, 0x748C, 0x8C03, 0x7003, 0x6C02, 0x9EAD, 0xEC2C, 0xB00D, 0x6C02,
+	0x948D, 0x8C03, 0x7003, 0x6C02, 0x7EAC, 0xAC0C, 0x9004, 0x6C02, 0x748C, 0x8C03, 0x7003, 0x6C02,
+	0xBEB6, 0xEC2C, 0xF02D, 0x6C02, 0xB496, 0x8C03, 0x7003, 0x6C02, 0x7EAC, 0xAC0C, 0x9004, 0x6C02,
+	0x748C, 0x8C03, 0x7003, 0x6C02, 0x9EAD, 0xEC2C, 0xB00D, 0x6C02, 0x948D, 0x8C03, 0x7003, 0x6C02,
+	0x7EAC, 0xAC0C, 0x9004, 0x6C02, 0x748C, 0x8C03, 0x7003, 0x6C02,
+}
+
+// UVLCTbl1 holds decode entries for non-initial rows.
+var UVLCTbl1 = [256]UVLCDecodeEntry{
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x16AB, 0x0401, 0x0802, 0x0401, 0x0C8B, 0x0401, 0x0802, 0x0401,
+	0x16AB, 0x0401, 0x0802, 0x0401, 0x0C8B, 0x0401, 0x0802, 0x0401, 0x16AB, 0x0401, 0x0802, 0x0401,
+	0x0C8B, 0x0401, 0x0802, 0x0401, 0x16AB, 0x0401, 0x0802, 0x0401, 0x0C8B, 0x0401, 0x0802, 0x0401,
+	0x16AB, 0x0401, 0x0802, 0x0401, 0x0C8B, 0x0401, 0x0802, 0x0401, 0x16AB, 0x0401, 0x0802, 0x0401,
+	0x0C8B, 0x0401, 0x0802, 0x0401, 0x16AB, 0x0401, 0x0802, 0x0401, 0x0C8B, 0x0401, 0x0802, 0x0401,
+	0x16AB, 0x0401, 0x0802, 0x0401, 0x0C8B, 0x0401, 0x0802, 0x0401, 0xA02B, 0x2001, 0x4002, 0x2001,
+	0x600B, 0x2001, 0x4002, 0x2001, 0xA02B, 0x2001, 0x4002, 0x2001, 0x600B, 0x2001, 0x4002, 0x2001,
+	0xA02B, 0x2001, 0x4002, 0x2001, 0x600B, 0x2001, 0x4002, 0x2001, 0xA02B, 0x2001, 0x4002, 0x2001,
+	0x600B, 0x2001, 0x4002, 0x2001, 0xA02B, 0x2001, 0x4002, 0x2001, 0x600B, 0x2001, 0x4002, 0x2001,
+	0xA02B, 0x2001, 0x4002, 0x2001, 0x600B, 0x2001, 0x4002, 0x2001, 0xA02B, 0x2001, 0x4002, 0x2001,
+	0x600B, 0x2001, 0x4002, 0x2001, 0xA02B, 0x2001, 0x4002, 0x2001, 0x600B, 0x2001, 0x4002, 0x2001,
+	0xB6D6, 0xA42C, 0xA82D, 0x2402, 0xACB6, 0x4403, 0x2803, 0x2402, 0x36AC, 0x640C, 0x4804, 0x2402,
+	0x2C8C, 0x4403, 0x2803, 0x2402, 0x56AD, 0xA42C, 0x680D, 0x2402, 0x4C8D, 0x4403, 0x2803, 0x2402,
+	0x36AC, 0x640C, 0x4804, 0x2402, 0x2C8C, 0x4403, 0x2803, 0x2402, 0x76B6, 0xA42C, 0xA82D, 0x2402,
+	0x6C96, 0x4403, 0x2803, 0x2402, 0x36AC, 0x640C, 0x4804, 0x2402, 0x2C8C, 0x4403, 0x2803, 0x2402,
+	0x56AD, 0xA42C, 0x680D, 0x2402, 0x4C8D, 0x4403, 0x2803, 0x2402, 0x36AC, 0x640C, 0x4804, 0x2402,
+	0x2C8C, 0x4403, 0x2803, 0x2402,
+}
+
+// UVLCBias stores bias for initial row pairs (u_bias).
+var UVLCBias = [256 + 64]uint8{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4, 0, 0, 0, 4, 0, 0, 0, 4, 0, 0, 0, 4, 0, 0, 0,
+	4, 0, 0, 0, 4, 0, 0, 0, 4, 0, 0, 0, 4, 0, 0, 0,
+	4, 0, 0, 0, 4, 0, 0, 0, 4, 0, 0, 0, 4, 0, 0, 0,
+	4, 0, 0, 0, 4, 0, 0, 0, 4, 0, 0, 0, 4, 0, 0, 0,
+	10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+}
@@ -0,0 +1,274 @@
+package htj2k
+
+import (
+	"bytes"
+	"flag"
+	"fmt"
+	"go/format"
+	"math/bits"
+	"os"
+	"strings"
+	"testing"
+)
+
+var updateTables = flag.Bool("update-tables", false, "rewrite tables_gen.go from the source tables")
+
+const generatedTablesFile = "tables_gen.go"
+
+// TestGeneratedTables checks that tables_gen.go matches the tables built from
+// the compact source tables. Run "go generate" (go test -run
+// TestGeneratedTables -update-tables) after changing a source table or a
+// builder to rewrite it.
+func TestGeneratedTables(t *testing.T) {
+	want, err := generateTablesSource()
+	if err != nil {
+		t.Fatalf("generate tables: %v", err)
+	}
+	if *updateTables {
+		if err := os.WriteFile(generatedTablesFile, want, 0o644); err != nil {
+			t.Fatalf("write %s: %v", generatedTablesFile, err)
+		}
+		return
+	}
+	got, err := os.ReadFile(generatedTablesFile)
+	if err != nil {
+		t.Fatalf("read %s: %v", generatedTablesFile, err)
+	}
+	if !bytes.Equal(got, want) {
+		t.Fatalf("%s is stale; run go generate ./jpeg2000/htj2k", generatedTablesFile)
+	}
+}
+
+// TestVLCSourceTables validates the source tables and the generated decode
+// tables, which the package used to do at start-up.
+func TestVLCSourceTables(t *testing.T) {
+	if err := ValidateVLCTables(); err != nil {
+		t.Fatal(err)
+	}
+	// The decoders take the first matching codeword, which is the longest
+	// match OpenJPEG's table construction picks only if no codeword is a
+	// prefix of another in the same context.
+	for name, src := range map[string][]VLCEntry{"VLCTbl0": VLCTbl0, "VLCTbl1": VLCTbl1} {
+		for i, a := range src {
+			for j, b := range src {
+				if i == j || a.CQ != b.CQ || a.CwdLen > b.CwdLen {
+					continue
+				}
+				if mask := uint8(1)<<a.CwdLen - 1; b.Cwd&mask == a.Cwd {
+					t.Errorf("%s[%d] (cwd 0x%02X/%d) is a prefix of %s[%d] (cwd 0x%02X/%d) in context %d",
+						name, i, a.Cwd, a.CwdLen, name, j, b.Cwd, b.CwdLen, a.CQ)
+				}
+			}
+		}
+	}
+}
+
+func generateTablesSource() ([]byte, error) {
+	var buf bytes.Buffer
+	buf.WriteString("// Code generated by \"go test -run TestGeneratedTables -update-tables\"; DO NOT EDIT.\n\n")
+	buf.WriteString("package htj2k\n\n")
+
+	decodeEntry := func(table [1024]VLCDecoderEntry) func(int) string {
+		return func(i int) string {
+			e := table[i]
+			if e == (VLCDecoderEntry{}) {
+				return "{}"
+			}
+			return fmt.Sprintf("{%d, %d, %d, %d, %d}", e.Rho, e.UOff, e.EK, e.E1, e.CwdLen)
+		}
+	}
+	hex16 := func(value func(int) uint16) func(int) string {
+		return func(i int) string { return fmt.Sprintf("0x%04X", value(i)) }
+	}
+
+	decode0, decode1 := buildVLCDecodeTable(VLCTbl0), buildVLCDecodeTable(VLCTbl1)
+	writeTable(&buf, "VLCDecodeTbl0 contains decoding information for the initial row of quads, indexed by context << 7 | codeword.",
+		"VLCDecodeTbl0", "[1024]VLCDecoderEntry", len(decode0), 8, decodeEntry(decode0))
+	writeTable(&buf, "VLCDecodeTbl1 contains decoding information for non-initial rows of quads, indexed by context << 7 | codeword.",
+		"VLCDecodeTbl1", "[1024]VLCDecoderEntry", len(decode1), 8, decodeEntry(decode1))
+
+	lookup0, lookup1 := buildVLCLookupTable(VLCTbl0), buildVLCLookupTable(VLCTbl1)
+	writeTable(&buf, "VLCLookupTable0 is the packed lookup table for initial row quads, indexed by context << 7 | codeword prefix.",
+		"VLCLookupTable0", "[1024]VLCLookupEntry", len(lookup0), 12, hex16(func(i int) uint16 { return uint16(lookup0[i]) }))
+	writeTable(&buf, "VLCLookupTable1 is the packed lookup table for non-initial row quads, indexed by context << 7 | codeword prefix.",
+		"VLCLookupTable1", "[1024]VLCLookupEntry", len(lookup1), 12, hex16(func(i int) uint16 { return uint16(lookup1[i]) }))
+
+	var enc0, enc1 [2048]uint16
+	initOJPHEncoderVLCTable(VLCTbl0, &enc0)
+	initOJPHEncoderVLCTable(VLCTbl1, &enc1)
+	writeTable(&buf, "ojphEncoderVLCTable0 maps cq<<8 | rho<<4 | eps to the initial-row codeword (bits 8-15), its length (bits 4-7) and e_k (bits 0-3).",
+		"ojphEncoderVLCTable0", "[2048]uint16", len(enc0), 12, hex16(func(i int) uint16 { return enc0[i] }))
+	writeTable(&buf, "ojphEncoderVLCTable1 is ojphEncoderVLCTable0 for non-initial rows.",
+		"ojphEncoderVLCTable1", "[2048]uint16", len(enc1), 12, hex16(func(i int) uint16 { return enc1[i] }))
+
+	var uvlc0 [256 + 64]UVLCDecodeEntry
+	var uvlc1 [256]UVLCDecodeEntry
+	var bias [256 + 64]uint8
+	generateUVLCTables(&uvlc0, &uvlc1, &bias)
+	writeTable(&buf, "UVLCTbl0 holds decode entries for initial row pairs (includes MEL event).",
+		"UVLCTbl0", "[256 + 64]UVLCDecodeEntry", len(uvlc0), 12, hex16(func(i int) uint16 { return uint16(uvlc0[i]) }))
+	writeTable(&buf, "UVLCTbl1 holds decode entries for non-initial rows.",
+		"UVLCTbl1", "[256]UVLCDecodeEntry", len(uvlc1), 12, hex16(func(i int) uint16 { return uint16(uvlc1[i]) }))
+	writeTable(&buf, "UVLCBias stores bias for initial row pairs (u_bias).",
+		"UVLCBias", "[256 + 64]uint8", len(bias), 16, func(i int) string { return fmt.Sprint(bias[i]) })
+
+	return format.Source(buf.Bytes())
+}
+
+func writeTable(buf *bytes.Buffer, doc, name, typ string, n, perLine int, entry func(int) string) {
+	fmt.Fprintf(buf, "// %s\nvar %s = %s{\n", doc, name, typ)
+	for i := 0; i < n; i += perLine {
+		row := make([]string, 0, perLine)
+		for j := i; j < min(i+perLine, n); j++ {
+			row = append(row, entry(j))
+		}
+		fmt.Fprintf(buf, "\t%s,\n", strings.Join(row, ", "))
+	}
+	buf.WriteString("}\n\n")
+}
+
+// initOJPHEncoderVLCTable builds an encoder VLC table from a source table,
+// picking for each (cq, rho, eps) the codeword OpenJPH's encoder uses.
+func initOJPHEncoderVLCTable(src []VLCEntry, dst *[2048]uint16) {
+	var best *VLCEntry
+	for i := 0; i < 2048; i++ {
+		cq := i >> 8
+		rho := (i >> 4) & 0xF
+		eps := i & 0xF
+		if (eps&rho) != eps || (rho == 0 && cq == 0) {
+			dst[i] = 0
+			continue
+		}
+		best = nil
+		if eps != 0 {
+			bestEK := -1
+			for j := range src {
+				entry := &src[j]
+				if int(entry.CQ) == cq && int(entry.Rho) == rho && entry.UOff == 1 && (eps&int(entry.EK)) == int(entry.E1) {
+					ones := bits.OnesCount8(entry.EK)
+					if ones >= bestEK {
+						best = entry
+						bestEK = ones
+					}
+				}
+			}
+		} else {
+			for j := range src {
+				entry := &src[j]
+				if int(entry.CQ) == cq && int(entry.Rho) == rho && entry.UOff == 0 {
+					best = entry
+					break
+				}
+			}
+		}
+		if best != nil {
+			dst[i] = uint16(best.Cwd)<<8 | uint16(best.CwdLen)<<4 | uint16(best.EK)
+		}
+	}
+}
+
+// generateUVLCTables builds the UVLC decode tables (ojph_block_common.cpp::uvlc_init_tables).
+func generateUVLCTables(tbl0 *[256 + 64]UVLCDecodeEntry, tbl1 *[256]UVLCDecodeEntry, bias *[256 + 64]uint8) {
+	// dec table: index by 3-bit head (xx1/x10/100/000), value packs lp/ls/prefix.
+	dec := [8]uint8{
+		3 | (5 << 2) | (5 << 5), // 000 -> lp=3, ls=5, u_pfx=5
+		1 | (0 << 2) | (1 << 5), // 001 -> lp=1, ls=0, u_pfx=1
+		2 | (0 << 2) | (2 << 5), // 010 -> lp=2, ls=0, u_pfx=2
+		1 | (0 << 2) | (1 << 5), // 011 -> lp=1, ls=0, u_pfx=1
+		3 | (1 << 2) | (3 << 5), // 100 -> lp=3, ls=1, u_pfx=3
+		1 | (0 << 2) | (1 << 5), // 101 -> lp=1, ls=0, u_pfx=1
+		2 | (0 << 2) | (2 << 5), // 110 -> lp=2, ls=0, u_pfx=2
+		1 | (0 << 2) | (1 << 5), // 111 -> lp=1, ls=0, u_pfx=1
+	}
+
+	// Initial row pairs: mode=0 => both u_off=0; mode=1/2 => one u_off;
+	// mode=3 => both u_off with mel=0; mode=4 => both u_off with mel=1.
+	for i := 0; i < len(tbl0); i++ {
+		mode := i >> 6
+		vlc := i & 0x3F
+		switch mode {
+		case 0:
+			tbl0[i] = 0
+			bias[i] = 0
+		case 1, 2:
+			d := dec[vlc&0x7]
+			lp := int(d & 0x3)
+			ls := int((d >> 2) & 0x7)
+			u0suf := ls
+			u0 := int(d >> 5)
+			u1 := 0
+			if mode == 2 {
+				u0suf = 0
+				u0 = 0
+				u1 = int(d >> 5)
+			}
+			tbl0[i] = UVLCDecodeEntry(lp | (ls << 3) | (u0suf << 7) | (u0 << 10) | (u1 << 13))
+			bias[i] = 0
+		case 3:
+			d0 := dec[vlc&0x7]
+			vlc >>= d0 & 0x3
+			d1 := dec[vlc&0x7]
+			var lp, u0suf, ls, u0, u1 int
+			if (d0 & 0x3) == 3 {
+				lp = int(d0&0x3) + 1
+				u0suf = int((d0 >> 2) & 0x7)
+				ls = u0suf
+				u0 = int(d0 >> 5)
+				u1 = (vlc & 1) + 1
+				bias[i] = 4
+			} else {
+				lp = int(d0&0x3) + int(d1&0x3)
+				u0suf = int((d0 >> 2) & 0x7)
+				ls = u0suf + int((d1>>2)&0x7)
+				u0 = int(d0 >> 5)
+				u1 = int(d1 >> 5)
+				bias[i] = 0
+			}
+			tbl0[i] = UVLCDecodeEntry(lp | (ls << 3) | (u0suf << 7) | (u0 << 10) | (u1 << 13))
+		case 4:
+			d0 := dec[vlc&0x7]
+			vlc >>= d0 & 0x3
+			d1 := dec[vlc&0x7]
+			lp := int((d0 & 0x3) + (d1 & 0x3))
+			u0suf := int((d0 >> 2) & 0x7)
+			ls := u0suf + int((d1>>2)&0x7)
+			u0 := int((d0 >> 5) + 2)
+			u1 := int((d1 >> 5) + 2)
+			tbl0[i] = UVLCDecodeEntry(lp | (ls << 3) | (u0suf << 7) | (u0 << 10) | (u1 << 13))
+			bias[i] = 10
+		}
+	}
+
+	// Non-initial rows: mode=0/1/2/3 (no MEL event).
+	for i := 0; i < len(tbl1); i++ {
+		mode := i >> 6
+		vlc := i & 0x3F
+		switch mode {
+		case 0:
+			tbl1[i] = 0
+		case 1, 2:
+			d := dec[vlc&0x7]
+			lp := int(d & 0x3)
+			ls := int((d >> 2) & 0x7)
+			u0suf := ls
+			u0 := int(d >> 5)
+			u1 := 0
+			if mode == 2 {
+				u0suf = 0
+				u0 = 0
+				u1 = int(d >> 5)
+			}
+			tbl1[i] = UVLCDecodeEntry(lp | (ls << 3) | (u0suf << 7) | (u0 << 10) | (u1 << 13))
+		case 3:
+			d0 := dec[vlc&0x7]
+			vlc >>= d0 & 0x3
+			d1 := dec[vlc&0x7]
+			lp := int((d0 & 0x3) + (d1 & 0x3))
+			u0suf := int((d0 >> 2) & 0x7)
+			ls := u0suf + int((d1>>2)&0x7)
+			u0 := int(d0 >> 5)
+			u1 := int(d1 >> 5)
+			tbl1[i] = UVLCDecodeEntry(lp | (ls << 3) | (u0suf << 7) | (u0 << 10) | (u1 << 13))
+		}
+	}
+}
@@ -13,8 +13,8 @@ type VLCDecoder struct {
 
 	// Lookup tables for fast decoding (1024 entries each)
 	// Key: (cQ << 7) | codeword
-	tbl0 [1024]uint16 // For initial quad rows
-	tbl1 [1024]uint16 // For non-initial quad rows
+	tbl0 *[1024]VLCLookupEntry // For initial quad rows
+	tbl1 *[1024]VLCLookupEntry // For non-initial quad rows
 }
 
 // NewVLCDecoder creates a new VLC decoder
@@ -24,7 +24,7 @@ func NewVLCDecoder(data []byte) *VLCDecoder {
 		pos:      0,    // Start from beginning (no reversal)
 		lastByte: 0xFF, // Initialize with encoder's vlcLast (first byte was skipped)
 	}
-	v.buildLookupTables()
+	v.setLookupTables()
 
 	// Skip initial 4-bit padding
 	_, _ = v.readBits(4)
@@ -32,60 +32,12 @@ func NewVLCDecoder(data []byte) *VLCDecoder {
 	return v
 }
 
-// buildLookupTables builds the lookup tables from VLCTbl0 and VLCTbl1
-// This follows the OpenJPEG approach in vlc_init_tables()
-func (v *VLCDecoder) buildLookupTables() {
-	// Build lookup table for tbl0
-	for i := 0; i < 1024; i++ {
-		cwd := i & 0x7F
-		cQ := i >> 7
-		bestLen := uint8(0)
-		var packed uint16
-		for j := range VLCTbl0 {
-			entry := &VLCTbl0[j]
-			if int(entry.CQ) != cQ {
-				continue
-			}
-			mask := (1 << entry.CwdLen) - 1
-			if int(entry.Cwd) == (cwd & mask) {
-				if entry.CwdLen > bestLen {
-					bestLen = entry.CwdLen
-					packed = (uint16(entry.EK) << 12) |
-						(uint16(entry.E1) << 8) |
-						(uint16(entry.Rho) << 4) |
-						(uint16(entry.UOff) << 3) |
-						uint16(entry.CwdLen)
-				}
-			}
-		}
-		v.tbl0[i] = packed
-	}
-
-	// Build lookup table for tbl1
-	for i := 0; i < 1024; i++ {
-		cwd := i & 0x7F
-		cQ := i >> 7
-		bestLen := uint8(0)
-		var packed uint16
-		for j := range VLCTbl1 {
-			entry := &VLCTbl1[j]
-			if int(entry.CQ) != cQ {
-				continue
-			}
-			mask := (1 << entry.CwdLen) - 1
-			if int(entry.Cwd) == (cwd & mask) {
-				if entry.CwdLen > bestLen {
-					bestLen = entry.CwdLen
-					packed = (uint16(entry.EK) << 12) |
-						(uint16(entry.E1) << 8) |
-						(uint16(entry.Rho) << 4) |
-						(uint16(entry.UOff) << 3) |
-						uint16(entry.CwdLen)
-				}
-			}
-		}
-		v.tbl1[i] = packed
-	}
+// setLookupTables points the decoder at the shared generated lookup tables.
+// The source tables are prefix-free, so these match OpenJPEG's
+// vlc_init_tables() longest-match construction.
+func (v *VLCDecoder) setLookupTables() {
+	v.tbl0 = &VLCLookupTable0
+	v.tbl1 = &VLCLookupTable1
 }
 
 // readBits reads n bits from the bit stream (forward, LSB first)
@@ -5,7 +5,7 @@ package htj2k
 // Reference: OpenJPH ojph_block_common.cpp:154-189
 
 // VLCDecoderOptimized implements optimized VLC decoding using pre-generated tables
-// This decoder uses the VLCDecodeTbl0 and VLCDecodeTbl1 tables generated in Stage 3.1
+// This decoder uses the generated VLCDecodeTbl0 and VLCDecodeTbl1 tables
 type VLCDecoderOptimized struct {
 	data      []byte
 	pos       int    // Current byte position (forward reading)
@@ -22,12 +22,6 @@ func NewVLCDecoderOptimized(data []byte) *VLCDecoderOptimized {
 		lastByte: 0xFF, // Initialize consistent with encoder
 	}
 
-	// Generate tables if not already generated
-	// In production, tables should be pre-generated at package init
-	if VLCDecodeTbl0[0].CwdLen == 0 && VLCTbl0[0].CwdLen != 0 {
-		_ = GenerateVLCTables()
-	}
-
 	// Skip initial 4-bit padding (encoder starts with 4 bits set to 1111)
 	_, _ = v.readBits(4)
 
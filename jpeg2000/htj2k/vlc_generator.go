@@ -3,8 +3,9 @@ package htj2k
 // VLC Table Generator for HTJ2K
 // Based on ISO/IEC 15444-15:2019 Annex F and OpenJPH implementation
 //
-// This file generates complete VLC lookup tables (1024 entries each) from
-// the compact source tables defined in vlc_tables.go
+// This file expands the compact source tables defined in vlc_tables.go into
+// complete VLC lookup tables (1024 entries each). The expanded tables are
+// generated into tables_gen.go ahead of time; see TestGeneratedTables.
 
 import (
 	"fmt"
@@ -20,28 +21,21 @@ type VLCDecoderEntry struct {
 	CwdLen uint8 // Codeword length (3 bits)
 }
 
-// VLC lookup tables for decoding (1024 entries each)
-// Index format: [context (3 bits) << 7 | codeword (7 bits)]
-var (
-	// VLCDecodeTbl0 contains decoding information for initial row of quads
-	VLCDecodeTbl0 [1024]VLCDecoderEntry
+// The decode lookup tables VLCDecodeTbl0 and VLCDecodeTbl1 (1024 entries
+// each, indexed by context << 7 | codeword) are generated into tables_gen.go
+// by go generate, so importing the package does not build them.
 
-	// VLCDecodeTbl1 contains decoding information for non-initial rows of quads
-	VLCDecodeTbl1 [1024]VLCDecoderEntry
-)
-
-// Ensure lookup表在包加载时生成并校验，避免运行期遗漏。
-func init() {
-	if err := GenerateVLCTables(); err != nil {
-		panic(fmt.Sprintf("generate VLC tables: %v", err))
-	}
-	if err := ValidateVLCTables(); err != nil {
-		panic(fmt.Sprintf("validate VLC tables: %v", err))
-	}
+// GenerateVLCTables rebuilds the 1024-entry lookup tables VLCDecodeTbl0 and
+// VLCDecodeTbl1 from the compact source tables VLCTbl0 and VLCTbl1. The
+// generated tables already hold the result; this is only needed after
+// modifying the source tables.
+func GenerateVLCTables() error {
+	VLCDecodeTbl0 = buildVLCDecodeTable(VLCTbl0)
+	VLCDecodeTbl1 = buildVLCDecodeTable(VLCTbl1)
+	return nil
 }
 
-// GenerateVLCTables generates the complete 1024-entry lookup tables
-// from the compact source tables VLCTbl0 and VLCTbl1
+// buildVLCDecodeTable expands a source table into a decode lookup table.
 //
 // The lookup table index is 10 bits composed of:
 //   - 7 LSBs: codeword (which might be shorter than 7 bits)
@@ -55,15 +49,14 @@ func init() {
 //     - Source entry context equals extracted context
 //     - Source entry codeword equals (extracted codeword masked by codeword length)
 //  5. If match found, populate lookup table with decoded values
-func GenerateVLCTables() error {
-	// Generate VLCTbl0 (for initial quad rows)
-	for i := 0; i < 1024; i++ {
+//
+// Entries without a match stay zero; a zero CwdLen marks an invalid codeword.
+func buildVLCDecodeTable(src []VLCEntry) (table [1024]VLCDecoderEntry) {
+	for i := range table {
 		cwd := i & 0x7F   // Extract 7-bit codeword
 		context := i >> 7 // Extract 3-bit context (0-7)
 
-		// Search source table VLCTbl0 for matching entry
-		found := false
-		for _, entry := range VLCTbl0 {
+		for _, entry := range src {
 			if entry.CQ != uint8(context) {
 				continue
 			}
@@ -71,54 +64,18 @@ func GenerateVLCTables() error {
 			// Check if codeword matches (mask by codeword length)
 			mask := (1 << entry.CwdLen) - 1
 			if entry.Cwd == uint8(cwd&mask) {
-				// Found matching entry - populate decode table
-				VLCDecodeTbl0[i] = VLCDecoderEntry{
+				table[i] = VLCDecoderEntry{
 					Rho:    entry.Rho,
 					UOff:   entry.UOff,
 					EK:     entry.EK,
 					E1:     entry.E1,
 					CwdLen: entry.CwdLen,
 				}
-				found = true
 				break
 			}
 		}
-
-		// If no match found, entry remains zero (invalid codeword)
-		// Note: Zero CwdLen indicates invalid entry
-		_ = found // Entry is already zero-initialized if not found
 	}
-
-	// Generate VLCTbl1 (for non-initial quad rows)
-	for i := 0; i < 1024; i++ {
-		cwd := i & 0x7F
-		context := i >> 7
-
-		found := false
-		for _, entry := range VLCTbl1 {
-			if entry.CQ != uint8(context) {
-				continue
-			}
-
-			mask := (1 << entry.CwdLen) - 1
-			if entry.Cwd == uint8(cwd&mask) {
-				VLCDecodeTbl1[i] = VLCDecoderEntry{
-					Rho:    entry.Rho,
-					UOff:   entry.UOff,
-					EK:     entry.EK,
-					E1:     entry.E1,
-					CwdLen: entry.CwdLen,
-				}
-				found = true
-				break
-			}
-		}
-
-		// If no match found, entry remains zero (invalid codeword)
-		_ = found // Entry is already zero-initialized if not found
-	}
-
-	return nil
+	return table
 }
 
 // ValidateVLCTables validates the generated VLC tables
@@ -210,14 +167,3 @@ func GetVLCTableStats() (tbl0Entries, tbl1Entries, tbl0Valid, tbl1Valid int) {
 
 	return
 }
-
-// init automatically generates VLC tables when package is imported
-func init() {
-	if err := GenerateVLCTables(); err != nil {
-		panic(fmt.Sprintf("Failed to generate VLC tables: %v", err))
-	}
-
-	if err := ValidateVLCTables(); err != nil {
-		panic(fmt.Sprintf("VLC table validation failed: %v", err))
-	}
-}
@@ -856,67 +856,46 @@ func packVLCEntry(rho, uOff, e1, ek, cwdLen uint8) VLCLookupEntry {
 		(uint16(rho) << 4) | (uint16(uOff) << 3) | uint16(cwdLen))
 }
 
-// VLCLookupTable0 is the 1024-entry lookup table for initial row quads
-// Indexed by: (context << 7) | (codeword_prefix & 0x7F)
-// Context: 3 bits (0-7), Codeword prefix: 7 bits (0-127)
-var VLCLookupTable0 [1024]VLCLookupEntry
+// VLCLookupTable0 (initial row quads) and VLCLookupTable1 (non-initial row
+// quads) are the 1024-entry lookup tables indexed by
+// (context << 7) | (codeword_prefix & 0x7F), with a 3-bit context and a
+// 7-bit codeword prefix. They are generated into tables_gen.go from VLCTbl0
+// and VLCTbl1.
+//
+//go:generate go test -run TestGeneratedTables -update-tables
 
-// VLCLookupTable1 is the 1024-entry lookup table for non-initial row quads
-// Indexed by: (context << 7) | (codeword_prefix & 0x7F)
-// Context: 3 bits (0-7), Codeword prefix: 7 bits (0-127)
-var VLCLookupTable1 [1024]VLCLookupEntry
-
-func init() {
-	InitVLCTables()
-}
-
-// InitVLCTables initializes the VLC lookup tables from the source tables
-// This must be called before using the VLC tables (e.g., in init() or at startup)
+// InitVLCTables rebuilds VLCLookupTable0 and VLCLookupTable1 from the source
+// tables. The generated tables already hold the result; this is only needed
+// after modifying VLCTbl0 or VLCTbl1.
 // Implementation matches OpenJPH's vlc_init_tables() in ojph_block_common.cpp
 func InitVLCTables() {
-	// Initialize table 0 (initial row of quads)
-	// For each possible lookup index (1024 = 8 contexts × 128 codeword prefixes)
-	for i := 0; i < 1024; i++ {
-		cwd := uint8(i & 0x7F) // Extract 7-bit codeword prefix
-		cq := uint8(i >> 7)    // Extract 3-bit context
-
-		// Find matching entry in source table
-		for j := range VLCTbl0 {
-			entry := &VLCTbl0[j]
-			if entry.CQ == cq {
-				// Check if codeword matches (mask by codeword length)
-				mask := (uint8(1) << entry.CwdLen) - 1
-				if entry.Cwd == (cwd & mask) {
-					// Pack and store in lookup table
-					VLCLookupTable0[i] = packVLCEntry(
-						entry.Rho, entry.UOff, entry.E1, entry.EK, entry.CwdLen)
-					break
-				}
-			}
-		}
-	}
+	VLCLookupTable0 = buildVLCLookupTable(VLCTbl0)
+	VLCLookupTable1 = buildVLCLookupTable(VLCTbl1)
+}
 
-	// Initialize table 1 (non-initial rows of quads)
-	// Same logic as table 0, but using VLCTbl1
-	for i := 0; i < 1024; i++ {
+// buildVLCLookupTable expands a source table into a packed lookup table.
+func buildVLCLookupTable(src []VLCEntry) (table [1024]VLCLookupEntry) {
+	// For each possible lookup index (1024 = 8 contexts × 128 codeword prefixes)
+	for i := range table {
 		cwd := uint8(i & 0x7F) // Extract 7-bit codeword prefix
 		cq := uint8(i >> 7)    // Extract 3-bit context
 
 		// Find matching entry in source table
-		for j := range VLCTbl1 {
-			entry := &VLCTbl1[j]
+		for j := range src {
+			entry := &src[j]
 			if entry.CQ == cq {
 				// Check if codeword matches (mask by codeword length)
 				mask := (uint8(1) << entry.CwdLen) - 1
 				if entry.Cwd == (cwd & mask) {
 					// Pack and store in lookup table
-					VLCLookupTable1[i] = packVLCEntry(
+					table[i] = packVLCEntry(
 						entry.Rho, entry.UOff, entry.E1, entry.EK, entry.CwdLen)
 					break
 				}
 			}
 		}
 	}
+	return table
 }
 
 // LookupVLC0 looks up VLC entry for initial row quad
@@ -0,0 +1,96 @@
+package jpeg2000
+
+import (
+	"fmt"
+
+	"github.com/cocosip/go-dicom-codecs/codec/limits"
+	"github.com/cocosip/go-dicom-codecs/jpeg2000/codestream"
+)
+
+// SetLimits sets the resource limits a codestream must satisfy. The image,
+// tile, code-block and layer counts declared by SIZ, COD and QCD are checked
+// before any image buffer is allocated, and the coding passes signalled by
+// the packet headers of each tile before its code-blocks are decoded. The
+// zero DecodeLimits applies limits.Defaults.
+func (d *Decoder) SetLimits(l limits.DecodeLimits) {
+	d.limits = l
+}
+
+// checkHeaderLimits validates the main header geometry and every tile's
+// coding style against d.limits.
+func (d *Decoder) checkHeaderLimits() error {
+	siz := d.cs.SIZ
+	if siz.Xsiz <= siz.XOsiz || siz.Ysiz <= siz.YOsiz || siz.XTsiz == 0 || siz.YTsiz == 0 ||
+		siz.XTOsiz > siz.XOsiz || siz.YTOsiz > siz.YOsiz {
+		return fmt.Errorf("invalid SIZ geometry")
+	}
+	width, height := int(siz.Xsiz-siz.XOsiz), int(siz.Ysiz-siz.YOsiz)
+	tilesX := ceilDiv(int(siz.Xsiz-siz.XTOsiz), int(siz.XTsiz))
+	tilesY := ceilDiv(int(siz.Ysiz-siz.YTOsiz), int(siz.YTsiz))
+	if err := d.limits.CheckTiles(int64(tilesX) * int64(tilesY)); err != nil {
+		return err
+	}
+
+	// The assembled image is int32 per sample and the output at most two
+	// bytes per sample; the tile being decoded adds int32 coefficients and
+	// reconstructed samples.
+	var samples int64
+	for _, c := range siz.Components {
+		samples += int64(ceilDiv(width, max(1, int(c.XRsiz)))) * int64(ceilDiv(height, max(1, int(c.YRsiz))))
+	}
+	tileSamples := int64(min(width, int(siz.XTsiz))) * int64(min(height, int(siz.YTsiz))) * int64(siz.Csiz)
+	if err := d.limits.CheckFrame(width, height, int(siz.Csiz), samples*(4+2)+tileSamples*8); err != nil {
+		return err
+	}
+
+	layout := NewTileLayout(siz)
+	var codeBlocks int64
+	for _, tile := range d.cs.Tiles {
+		cod := d.cs.TileCOD(tile)
+		if cod == nil {
+			continue
+		}
+		if err := d.limits.CheckLayers(int(cod.NumberOfLayers)); err != nil {
+			return err
+		}
+		x0, y0, x1, y1 := layout.GetTileBounds(tile.Index)
+		for _, c := range siz.Components {
+			dx, dy := max(1, int(c.XRsiz)), max(1, int(c.YRsiz))
+			codeBlocks += tileComponentCodeBlocks(ceilDiv(x1, dx)-ceilDiv(x0, dx), ceilDiv(y1, dy)-ceilDiv(y0, dy), cod)
+		}
+		if err := d.limits.CheckCodeBlocks(codeBlocks); err != nil {
+			return err
+		}
+	}
+	return nil
+}
+
+// tileComponentCodeBlocks returns the number of code-blocks of a w x h
+// tile-component coded with cod, taking code-blocks clipped by precincts
+// into account.
+func tileComponentCodeBlocks(w, h int, cod *codestream.CODSegment) int64 {
+	levels := int(cod.NumberOfDecompositionLevels)
+	blocks := func(bw, bh, xcb, ycb int) int64 {
+		return int64(ceilDiv(bw, 1<<xcb)) * int64(ceilDiv(bh, 1<<ycb))
+	}
+	var n int64
+	for r := 0; r <= levels; r++ {
+		xcb, ycb := int(cod.CodeBlockWidth)+2, int(cod.CodeBlockHeight)+2
+		if r < len(cod.PrecinctSizes) {
+			ppx, ppy := int(cod.PrecinctSizes[r].PPx), int(cod.PrecinctSizes[r].PPy)
+			if r > 0 {
+				ppx, ppy = ppx-1, ppy-1
+			}
+			xcb, ycb = max(0, min(xcb, ppx)), max(0, min(ycb, ppy))
+		}
+		shift := levels - r
+		if r == 0 {
+			n += blocks(ceilDivPow2(w, shift), ceilDivPow2(h, shift), xcb, ycb)
+			continue
+		}
+		lowW, lowH := ceilDivPow2(w, shift+1), ceilDivPow2(h, shift+1)
+		highW, highH := ceilDivPow2(w, shift)-lowW, ceilDivPow2(h, shift)-lowH
+		n += blocks(highW, lowH, xcb, ycb) + blocks(lowW, highH, xcb, ycb) + blocks(highW, highH, xcb, ycb)
+	}
+	return n
+}
@@ -0,0 +1,78 @@
+package jpeg2000
+
+import (
+	"encoding/binary"
+	"errors"
+	"testing"
+
+	"github.com/cocosip/go-dicom-codecs/codec/limits"
+)
+
+// TestDecodeLimits checks that every limit rejects a codestream declaring
+// more than it allows and that the defaults admit it.
+func TestDecodeLimits(t *testing.T) {
+	pixels := streamTestImage(96, 80, 3)
+	params := DefaultEncodeParams(96, 80, 3, 8, false)
+	params.TileWidth, params.TileHeight = 32, 32
+	params.NumLayers = 3
+	params.Lossless = false
+	encoded, err := NewEncoder(params).Encode(pixels)
+	if err != nil {
+		t.Fatalf("Encode failed: %v", err)
+	}
+
+	if err := NewDecoder().Decode(encoded); err != nil {
+		t.Fatalf("decode with default limits failed: %v", err)
+	}
+	unlimited := limits.DecodeLimits{MaxPixels: -1, MaxComponents: -1, MaxTiles: -1, MaxCodeBlocks: -1, MaxCodingPasses: -1, MaxLayers: -1, MaxBytes: -1}
+	decoder := NewDecoder()
+	decoder.SetLimits(unlimited)
+	if err := decoder.Decode(encoded); err != nil {
+		t.Fatalf("decode without limits failed: %v", err)
+	}
+
+	tests := []struct {
+		name   string
+		limits limits.DecodeLimits
+	}{
+		{"pixels", limits.DecodeLimits{MaxPixels: 96*80 - 1}},
+		{"components", limits.DecodeLimits{MaxComponents: 2}},
+		{"tiles", limits.DecodeLimits{MaxTiles: 8}},
+		{"code-blocks", limits.DecodeLimits{MaxCodeBlocks: 20}},
+		{"coding passes", limits.DecodeLimits{MaxCodingPasses: 10}},
+		{"layers", limits.DecodeLimits{MaxLayers: 2}},
+		{"bytes", limits.DecodeLimits{MaxBytes: 1024}},
+	}
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			decoder := NewDecoder()
+			decoder.SetLimits(tt.limits)
+			err := decoder.Decode(encoded)
+			if !errors.Is(err, limits.ErrExceeded) {
+				t.Fatalf("Decode error = %v, want %v", err, limits.ErrExceeded)
+			}
+		})
+	}
+}
+
+// TestDecodeLimitsHostileSIZ checks that a SIZ declaring a huge image is
+// rejected by the default limits before any buffer is sized from it.
+func TestDecodeLimitsHostileSIZ(t *testing.T) {
+	params := DefaultEncodeParams(64, 64, 1, 8, false)
+	encoded, err := NewEncoder(params).Encode(streamTestImage(64, 64, 1))
+	if err != nil {
+		t.Fatalf("Encode failed: %v", err)
+	}
+	// SIZ follows SOC: FF51, Lsiz, Rsiz, then Xsiz and Ysiz.
+	if encoded[2] != 0xFF || encoded[3] != 0x51 {
+		t.Fatalf("SIZ not found after SOC")
+	}
+	hostile := append([]byte(nil), encoded...)
+	binary.BigEndian.PutUint32(hostile[8:], 1<<20)
+	binary.BigEndian.PutUint32(hostile[12:], 1<<20)
+
+	err = NewDecoder().Decode(hostile)
+	if !errors.Is(err, limits.ErrExceeded) {
+		t.Fatalf("Decode error = %v, want %v", err, limits.ErrExceeded)
+	}
+}
@@ -4,6 +4,8 @@ package lossless
 import (
 	"fmt"
 
+	"github.com/cocosip/go-dicom-codecs/codec/sched"
+	"github.com/cocosip/go-dicom-codecs/codec/stats"
 	"github.com/cocosip/go-dicom-codecs/jpeg2000"
 	"github.com/cocosip/go-dicom/pkg/dicom/transfer"
 	"github.com/cocosip/go-dicom/pkg/imaging/codec"
@@ -64,8 +66,11 @@ func (c *Codec) Encode(oldPixelData imagetypes.PixelData, newPixelData imagetype
 	}
 	encParams := c.configureLosslessEncodeParams(frameInfo, losslessParams)
 	c.extractLosslessMCTParameters(encParams, losslessParams, parameters)
-	encoder := jpeg2000.NewEncoder(encParams)
-	return c.encodeLosslessAllFrames(oldPixelData, newPixelData, encoder)
+	if pref, ok := jpeg2000.AutoGeometryFromParameters(parameters); ok {
+		encParams.AutoConfigure(pref)
+		encParams.TilePriority = sched.PriorityFromParameters(parameters)
+	}
+	return c.encodeLosslessAllFrames(oldPixelData, newPixelData, encParams, parameters)
 }
 
 func (c *Codec) validateLosslessEncodeInputs(oldPixelData, newPixelData imagetypes.PixelData) (*imagetypes.FrameInfo, error) {
@@ -157,6 +162,7 @@ func (c *Codec) configureLosslessEncodeParams(frameInfo *imagetypes.FrameInfo, l
 		int(frameInfo.BitsStored),
 		frameInfo.PixelRepresentation != 0,
 	)
+	encParams.PlanarInput = frameInfo.PlanarConfiguration == 1
 	encParams.NumLevels = losslessParams.NumLevels
 	encParams.ProgressionOrder = losslessParams.ProgressionOrder
 	encParams.NumLayers = losslessParams.NumLayers
@@ -238,68 +244,35 @@ func (c *Codec) extractLosslessMCTParameters(encParams *jpeg2000.EncodeParams, l
 	}
 }
 
-func (c *Codec) encodeLosslessAllFrames(oldPixelData, newPixelData imagetypes.PixelData, encoder *jpeg2000.Encoder) error {
+// encodeLosslessAllFrames encodes the frames on the shared scheduler, each
+// with its own encoder over a copy of encParams and the frame's cached
+// statistics, if parameters carry a stats.Cache.
+func (c *Codec) encodeLosslessAllFrames(oldPixelData, newPixelData imagetypes.PixelData, encParams *jpeg2000.EncodeParams, parameters codec.Parameters) error {
 	frameCount := oldPixelData.FrameCount()
 	if frameCount == 0 {
 		return fmt.Errorf("source pixel data is empty (no frames)")
 	}
-	for frameIndex := 0; frameIndex < frameCount; frameIndex++ {
-		frameData, err := oldPixelData.GetFrame(frameIndex)
-		if err != nil {
-			return fmt.Errorf("failed to get frame %d: %w", frameIndex, err)
-		}
-		if len(frameData) == 0 {
-			return fmt.Errorf("frame %d pixel data is empty", frameIndex)
-		}
-		encoded, err := encoder.Encode(frameData)
-		if err != nil {
-			return fmt.Errorf("JPEG 2000 encode failed for frame %d: %w", frameIndex, err)
-		}
-		if err := newPixelData.AddFrame(encoded); err != nil {
-			return fmt.Errorf("failed to add encoded frame %d: %w", frameIndex, err)
-		}
-	}
-	return nil
+	frameInfo := oldPixelData.GetFrameInfo()
+	return sched.Frames(sched.PriorityFromParameters(parameters), frameCount, sched.FrameReader(oldPixelData),
+		func(frameIndex int, frameData []byte) ([]byte, error) {
+			params := *encParams
+			params.FrameStats = stats.FromParameters(parameters, stats.FrameOf(frameInfo, frameData))
+			encoded, err := jpeg2000.NewEncoder(&params).Encode(frameData)
+			if err != nil {
+				return nil, fmt.Errorf("JPEG 2000 encode failed for frame %d: %w", frameIndex, err)
+			}
+			return encoded, nil
+		},
+		sched.FrameWriter(newPixelData))
 }
 
 // Decode decodes JPEG 2000 Lossless data to uncompressed pixel data
-func (c *Codec) Decode(oldPixelData imagetypes.PixelData, newPixelData imagetypes.PixelData, _ codec.Parameters) error {
+func (c *Codec) Decode(oldPixelData imagetypes.PixelData, newPixelData imagetypes.PixelData, parameters codec.Parameters) error {
 	if oldPixelData == nil || newPixelData == nil {
 		return fmt.Errorf("source and destination PixelData cannot be nil")
 	}
 
-	// Process all frames
-	frameCount := oldPixelData.FrameCount()
-	if frameCount == 0 {
-		return fmt.Errorf("source pixel data is empty (no frames)")
-	}
-
-	for frameIndex := 0; frameIndex < frameCount; frameIndex++ {
-		// Get encoded frame data
-		frameData, err := oldPixelData.GetFrame(frameIndex)
-		if err != nil {
-			return fmt.Errorf("failed to get frame %d: %w", frameIndex, err)
-		}
-
-		if len(frameData) == 0 {
-			return fmt.Errorf("frame %d pixel data is empty", frameIndex)
-		}
-
-		// Create decoder
-		decoder := jpeg2000.NewDecoder()
-
-		// Decode
-		if err := decoder.Decode(frameData); err != nil {
-			return fmt.Errorf("JPEG 2000 decode failed for frame %d: %w", frameIndex, err)
-		}
-
-		// Add decoded frame to destination
-		if err := newPixelData.AddFrame(decoder.GetPixelData()); err != nil {
-			return fmt.Errorf("failed to add decoded frame %d: %w", frameIndex, err)
-		}
-	}
-
-	return nil
+	return jpeg2000.DecodeFrames(oldPixelData, newPixelData, parameters, nil)
 }
 
 // RegisterJPEG2000LosslessCodec registers the JPEG 2000 Lossless codec with the global registry
@@ -4,6 +4,9 @@ import (
 	"testing"
 
 	codecHelpers "github.com/cocosip/go-dicom-codecs/codec"
+	"github.com/cocosip/go-dicom-codecs/codec/layout"
+	"github.com/cocosip/go-dicom-codecs/codec/voi"
+	"github.com/cocosip/go-dicom-codecs/jpeg2000"
 	"github.com/cocosip/go-dicom/pkg/imaging/codec"
 	"github.com/cocosip/go-dicom/pkg/imaging/imagetypes"
 )
@@ -230,3 +233,62 @@ func TestEncodeEmptyData(t *testing.T) {
 		t.Error("Expected error for empty data, got nil")
 	}
 }
+
+// TestDecodeReportsLayout checks that reduced-resolution and rendered decodes
+// report the size and sample format of the frames they wrote.
+func TestDecodeReportsLayout(t *testing.T) {
+	const width, height = 100, 75
+	pixelData := make([]byte, width*height*2)
+	for i := 0; i < width*height; i++ {
+		v := (i%width)*30 + (i/width)*11
+		pixelData[2*i], pixelData[2*i+1] = byte(v), byte(v>>8)
+	}
+	frameInfo := &imagetypes.FrameInfo{
+		Width: width, Height: height, BitsAllocated: 16, BitsStored: 12, HighBit: 11,
+		SamplesPerPixel: 1, PhotometricInterpretation: "MONOCHROME2",
+	}
+	src := codecHelpers.NewTestPixelData(frameInfo)
+	if err := src.AddFrame(pixelData); err != nil {
+		t.Fatalf("AddFrame failed: %v", err)
+	}
+	c := NewCodec()
+	encoded := codecHelpers.NewTestPixelData(frameInfo)
+	if err := c.Encode(src, encoded, nil); err != nil {
+		t.Fatalf("Encode failed: %v", err)
+	}
+
+	tests := []struct {
+		name   string
+		set    map[string]interface{}
+		report map[string]int
+	}{
+		{"reduced", map[string]interface{}{jpeg2000.ReduceResolutionParameter: 2}, map[string]int{
+			layout.RowsParameter: 19, layout.ColumnsParameter: 25,
+			layout.BitsAllocatedParameter: 16, layout.BitsStoredParameter: 12, layout.HighBitParameter: 11, layout.PixelRepresentationParameter: 0,
+		}},
+		{"rendered", map[string]interface{}{voi.ParameterName: voi.Options{WindowCenter: 2000, WindowWidth: 4000}}, map[string]int{
+			layout.RowsParameter: height, layout.ColumnsParameter: width,
+			layout.BitsAllocatedParameter: 8, layout.BitsStoredParameter: 8, layout.HighBitParameter: 7, layout.PixelRepresentationParameter: 0,
+		}},
+	}
+	for _, tt := range tests {
+		params := codec.NewBaseParameters()
+		for name, v := range tt.set {
+			params.SetParameter(name, v)
+		}
+		decoded := codecHelpers.NewTestPixelData(frameInfo)
+		if err := c.Decode(encoded, decoded, params); err != nil {
+			t.Fatalf("%s: Decode failed: %v", tt.name, err)
+		}
+		for name, want := range tt.report {
+			if got := params.GetParameter(name); got != want {
+				t.Errorf("%s: %s = %v, want %d", tt.name, name, got, want)
+			}
+		}
+		frame, _ := decoded.GetFrame(0)
+		rows, columns := tt.report[layout.RowsParameter], tt.report[layout.ColumnsParameter]
+		if want := rows * columns * tt.report[layout.BitsAllocatedParameter] / 8; len(frame) != want {
+			t.Errorf("%s: frame is %d bytes, want %d", tt.name, len(frame), want)
+		}
+	}
+}
@@ -51,6 +51,11 @@ type JPEG2000LosslessParameters struct {
 	// mirroring OpenJPEG behavior when Rate>0 in lossless syntax.
 	AppendLosslessLayer bool
 
+	// MaxDecodePasses caps the EBCOT coding passes decoded per code-block for
+	// fast previews of single-layer codestreams. 0 decodes everything (default).
+	// Use jpeg2000.CodingPassesForBitplanes to express the cap in bit-planes.
+	MaxDecodePasses int
+
 	// internal storage for compatibility with generic parameter interface
 	params map[string]interface{}
 }
@@ -96,6 +101,8 @@ func (p *JPEG2000LosslessParameters) GetParameter(name string) interface{} {
 		return p.UsePCRDOpt
 	case "appendLosslessLayer":
 		return p.AppendLosslessLayer
+	case jpeg2000.MaxDecodePassesParameter:
+		return p.MaxDecodePasses
 	default:
 		// Check custom parameters
 		return p.params[name]
@@ -151,6 +158,10 @@ func (p *JPEG2000LosslessParameters) SetParameter(name string, value interface{}
 		if v, ok := value.(bool); ok {
 			p.AppendLosslessLayer = v
 		}
+	case jpeg2000.MaxDecodePassesParameter:
+		if v, ok := value.(int); ok {
+			p.MaxDecodePasses = v
+		}
 	default:
 		// Store as custom parameter
 		p.params[name] = value
@@ -183,6 +194,9 @@ func (p *JPEG2000LosslessParameters) Validate() error {
 		// Ensure at least two layers when requesting a final lossless layer with a target ratio
 		p.NumLayers = 2
 	}
+	if p.MaxDecodePasses < 0 {
+		p.MaxDecodePasses = 0
+	}
 	return nil
 }
 
@@ -240,6 +254,13 @@ func (p *JPEG2000LosslessParameters) WithAppendLosslessLayer(enable bool) *JPEG2
 	return p
 }
 
+// WithMaxDecodePasses sets the preview coding pass cap used when decoding
+// and returns the parameters for chaining.
+func (p *JPEG2000LosslessParameters) WithMaxDecodePasses(passes int) *JPEG2000LosslessParameters {
+	p.MaxDecodePasses = passes
+	return p
+}
+
 // WithMCTBindings sets multi-component transform bindings.
 func (p *JPEG2000LosslessParameters) WithMCTBindings(bindings []jpeg2000.MCTBindingParams) *JPEG2000LosslessParameters {
 	p.SetParameter("mctBindings", bindings)
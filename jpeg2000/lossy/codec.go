@@ -5,6 +5,7 @@ import (
 	"fmt"
 	"math"
 
+	"github.com/cocosip/go-dicom-codecs/codec/sched"
 	"github.com/cocosip/go-dicom-codecs/jpeg2000"
 	"github.com/cocosip/go-dicom/pkg/dicom/transfer"
 	"github.com/cocosip/go-dicom/pkg/imaging/codec"
@@ -140,81 +141,39 @@ func (c *Codec) Encode(oldPixelData imagetypes.PixelData, newPixelData imagetype
 		int(frameInfo.BitsStored),
 		frameInfo.PixelRepresentation != 0,
 	)
+	baseEncParams.PlanarInput = frameInfo.PlanarConfiguration == 1
+	if pref, ok := jpeg2000.AutoGeometryFromParameters(parameters); ok {
+		baseEncParams.AutoConfigure(pref)
+		baseEncParams.TilePriority = sched.PriorityFromParameters(parameters)
+		autoParams := *lossyParams
+		autoParams.NumLevels = baseEncParams.NumLevels
+		lossyParams = &autoParams
+	}
 
-	// Process all frames
+	// Process all frames on the shared scheduler; every frame gets its own
+	// copy of the encode parameters.
 	frameCount := oldPixelData.FrameCount()
 	if frameCount == 0 {
 		return fmt.Errorf("source pixel data is empty (no frames)")
 	}
-	for frameIndex := 0; frameIndex < frameCount; frameIndex++ {
-		// Get frame data
-		frameData, err := oldPixelData.GetFrame(frameIndex)
-		if err != nil {
-			return fmt.Errorf("failed to get frame %d: %w", frameIndex, err)
-		}
-
-		if len(frameData) == 0 {
-			return fmt.Errorf("frame %d pixel data is empty", frameIndex)
-		}
-
-		// Rate control: if TargetRatio > 0, adjust quality to approach target ratio.
-		var encoded []byte
-		var encErr error
-		if lossyParams.TargetRatio > 0 {
-			encoded, encErr = c.encodeFrameWithTargetRatio(frameData, frameInfo, lossyParams, baseEncParams)
-		} else {
-			encoded, encErr = c.encodeFrameOnce(frameData, frameInfo, lossyParams, baseEncParams)
-		}
-		if encErr != nil {
-			return encErr
-		}
-
-		// Add encoded frame to destination
-		if err := newPixelData.AddFrame(encoded); err != nil {
-			return fmt.Errorf("failed to add encoded frame %d: %w", frameIndex, err)
-		}
-	}
-
-	return nil
+	return sched.Frames(sched.PriorityFromParameters(parameters), frameCount, sched.FrameReader(oldPixelData),
+		func(_ int, frameData []byte) ([]byte, error) {
+			// Rate control: if TargetRatio > 0, adjust quality to approach target ratio.
+			if lossyParams.TargetRatio > 0 {
+				return c.encodeFrameWithTargetRatio(frameData, frameInfo, lossyParams, baseEncParams)
+			}
+			return c.encodeFrameOnce(frameData, frameInfo, lossyParams, baseEncParams)
+		},
+		sched.FrameWriter(newPixelData))
 }
 
 // Decode decodes JPEG 2000 Lossy data to uncompressed pixel data
-func (c *Codec) Decode(oldPixelData imagetypes.PixelData, newPixelData imagetypes.PixelData, _ codec.Parameters) error {
+func (c *Codec) Decode(oldPixelData imagetypes.PixelData, newPixelData imagetypes.PixelData, parameters codec.Parameters) error {
 	if oldPixelData == nil || newPixelData == nil {
 		return fmt.Errorf("source and destination PixelData cannot be nil")
 	}
 
-	// Process all frames
-	frameCount := oldPixelData.FrameCount()
-	if frameCount == 0 {
-		return fmt.Errorf("source pixel data is empty (no frames)")
-	}
-	for frameIndex := 0; frameIndex < frameCount; frameIndex++ {
-		// Get encoded frame data
-		frameData, err := oldPixelData.GetFrame(frameIndex)
-		if err != nil {
-			return fmt.Errorf("failed to get frame %d: %w", frameIndex, err)
-		}
-
-		if len(frameData) == 0 {
-			return fmt.Errorf("frame %d pixel data is empty", frameIndex)
-		}
-
-		// Create decoder
-		decoder := jpeg2000.NewDecoder()
-
-		// Decode (decoder automatically detects lossy vs lossless from codestream)
-		if err := decoder.Decode(frameData); err != nil {
-			return fmt.Errorf("JPEG 2000 decode failed for frame %d: %w", frameIndex, err)
-		}
-
-		// Add decoded frame to destination
-		if err := newPixelData.AddFrame(decoder.GetPixelData()); err != nil {
-			return fmt.Errorf("failed to add decoded frame %d: %w", frameIndex, err)
-		}
-	}
-
-	return nil
+	return jpeg2000.DecodeFrames(oldPixelData, newPixelData, parameters, nil)
 }
 
 // RegisterJPEG2000LossyCodec registers the JPEG 2000 Lossy codec with the global registry
@@ -54,6 +54,11 @@ type JPEG2000LossyParameters struct {
 	// SubbandSteps allows explicit per-subbands quantization steps (lossy). Length must be 3*NumLevels+1 when set.
 	SubbandSteps []float64
 
+	// MaxDecodePasses caps the EBCOT coding passes decoded per code-block for
+	// fast previews of single-layer codestreams. 0 decodes everything (default).
+	// Use jpeg2000.CodingPassesForBitplanes to express the cap in bit-planes.
+	MaxDecodePasses int
+
 	// internal storage for compatibility with generic parameter interface
 	params map[string]interface{}
 }
@@ -109,6 +114,8 @@ func (p *JPEG2000LossyParameters) GetParameter(name string) interface{} {
 		return p.QuantStepScale
 	case "subbandSteps":
 		return p.SubbandSteps
+	case jpeg2000.MaxDecodePassesParameter:
+		return p.MaxDecodePasses
 	default:
 		return p.params[name]
 	}
@@ -168,6 +175,10 @@ func (p *JPEG2000LossyParameters) SetParameter(name string, value interface{}) {
 		if v, ok := value.([]float64); ok {
 			p.SubbandSteps = v
 		}
+	case jpeg2000.MaxDecodePassesParameter:
+		if v, ok := value.(int); ok {
+			p.MaxDecodePasses = v
+		}
 	default:
 		p.params[name] = value
 	}
@@ -191,6 +202,9 @@ func (p *JPEG2000LossyParameters) Validate() error {
 	if p.QuantStepScale <= 0 {
 		p.QuantStepScale = 1.0
 	}
+	if p.MaxDecodePasses < 0 {
+		p.MaxDecodePasses = 0
+	}
 	return nil
 }
 
@@ -250,6 +264,13 @@ func (p *JPEG2000LossyParameters) WithSubbandSteps(steps []float64) *JPEG2000Los
 	return p
 }
 
+// WithMaxDecodePasses sets the preview coding pass cap used when decoding
+// and returns the parameters for chaining.
+func (p *JPEG2000LossyParameters) WithMaxDecodePasses(passes int) *JPEG2000LossyParameters {
+	p.MaxDecodePasses = passes
+	return p
+}
+
 // WithMCTBindings sets multi-component transform bindings.
 func (p *JPEG2000LossyParameters) WithMCTBindings(bindings []jpeg2000.MCTBindingParams) *JPEG2000LossyParameters {
 	p.SetParameter("mctBindings", bindings)
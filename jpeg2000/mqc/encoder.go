@@ -9,9 +9,9 @@ type MQEncoder struct {
 	bp     int
 
 	// State variables
-	a   uint32 // Probability interval
-	c   uint32 // Code register
-	ct  int    // Bit counter
+	a  uint32 // Probability interval
+	c  uint32 // Code register
+	ct int    // Bit counter
 
 	// Contexts
 	contexts []uint8 // Context states (one per context)
@@ -22,13 +22,13 @@ const bypassCtInit = 0xDEADBEEF
 // NewMQEncoder creates a new MQ encoder
 func NewMQEncoder(numContexts int) *MQEncoder {
 	mqe := &MQEncoder{
-		buffer:    make([]byte, 1, 1024),
-		start:     1,
-		bp:        0,
-		a:         0x8000,
-		c:         0,
-		ct:        12,
-		contexts:  make([]uint8, numContexts),
+		buffer:   make([]byte, 1, 1024),
+		start:    1,
+		bp:       0,
+		a:        0x8000,
+		c:        0,
+		ct:       12,
+		contexts: make([]uint8, numContexts),
 	}
 
 	// Initialize all contexts to state 0
@@ -39,6 +39,24 @@ func NewMQEncoder(numContexts int) *MQEncoder {
 	return mqe
 }
 
+// NewMQEncoderAppend creates an MQ encoder that writes its output after the
+// existing contents of dst instead of into a private buffer, so the streams of
+// many code-blocks can share one backing array. A zero byte is appended as the
+// dummy byte preceding the stream. Call Bytes after flushing to get dst
+// extended with this encoder's output.
+func NewMQEncoderAppend(dst []byte, numContexts int) *MQEncoder {
+	dst = append(dst, 0)
+	return &MQEncoder{
+		buffer:   dst,
+		start:    len(dst),
+		bp:       len(dst) - 1,
+		a:        0x8000,
+		c:        0,
+		ct:       12,
+		contexts: make([]uint8, numContexts),
+	}
+}
+
 // Encode encodes a single bit using the specified context
 func (mqe *MQEncoder) Encode(bit int, contextID int) {
 	cx := &mqe.contexts[contextID]
@@ -160,10 +178,7 @@ func (mqe *MQEncoder) Flush() []byte {
 		mqe.bp++
 	}
 
-	if mqe.bp < mqe.start {
-		return []byte{}
-	}
-	return mqe.buffer[mqe.start:mqe.bp]
+	return mqe.GetBuffer()
 }
 
 // GetBuffer returns the current output buffer (for layered encoding)
@@ -171,7 +186,14 @@ func (mqe *MQEncoder) GetBuffer() []byte {
 	if mqe.bp < mqe.start {
 		return []byte{}
 	}
-	return mqe.buffer[mqe.start:mqe.bp]
+	// Cap the slice so appends by the caller cannot overwrite a shared buffer.
+	return mqe.buffer[mqe.start:mqe.bp:mqe.bp]
+}
+
+// Bytes returns the whole underlying buffer up to the end of the output,
+// including anything that preceded it when created with NewMQEncoderAppend.
+func (mqe *MQEncoder) Bytes() []byte {
+	return mqe.buffer[:max(mqe.bp, mqe.start-1)]
 }
 
 // NumBytes returns the current number of bytes in the output buffer
@@ -252,7 +274,7 @@ func (mqe *MQEncoder) BypassExtraBytes(erterm bool) int {
 	if mqe.ct < 7 {
 		return 1
 	}
-	if mqe.ct == 7 && (erterm || (mqe.bp > 0 && mqe.buffer[mqe.bp-1] != 0xFF)) {
+	if mqe.ct == 7 && (erterm || (mqe.bp >= mqe.start && mqe.buffer[mqe.bp-1] != 0xFF)) {
 		return 1
 	}
 	return 0
@@ -260,7 +282,7 @@ func (mqe *MQEncoder) BypassExtraBytes(erterm bool) int {
 
 // BypassFlushEnc flushes RAW (bypass) encoding with optional ERTERM behavior.
 func (mqe *MQEncoder) BypassFlushEnc(erterm bool) {
-	if mqe.ct < 7 || (mqe.ct == 7 && (erterm || (mqe.bp > 0 && mqe.buffer[mqe.bp-1] != 0xFF))) {
+	if mqe.ct < 7 || (mqe.ct == 7 && (erterm || (mqe.bp >= mqe.start && mqe.buffer[mqe.bp-1] != 0xFF))) {
 		bitValue := 0
 		for mqe.ct > 0 {
 			mqe.ct--
@@ -276,11 +298,11 @@ func (mqe *MQEncoder) BypassFlushEnc(erterm bool) {
 		}
 		mqe.buffer[mqe.bp] = byte(mqe.c)
 		mqe.bp++
-	} else if mqe.ct == 7 && mqe.bp > 0 && mqe.buffer[mqe.bp-1] == 0xFF {
+	} else if mqe.ct == 7 && mqe.bp >= mqe.start && mqe.buffer[mqe.bp-1] == 0xFF {
 		if !erterm {
 			mqe.bp--
 		}
-	} else if mqe.ct == 8 && !erterm && mqe.bp > 1 && mqe.buffer[mqe.bp-1] == 0x7F && mqe.buffer[mqe.bp-2] == 0xFF {
+	} else if mqe.ct == 8 && !erterm && mqe.bp > mqe.start && mqe.buffer[mqe.bp-1] == 0x7F && mqe.buffer[mqe.bp-2] == 0xFF {
 		mqe.bp -= 2
 	}
 }
@@ -344,7 +366,10 @@ func (mqe *MQEncoder) ensureIndex(idx int) {
 	}
 	needed := idx + 1
 	if needed <= cap(mqe.buffer) {
+		// Reused capacity may hold stale bytes; the coder expects zeros.
+		n := len(mqe.buffer)
 		mqe.buffer = mqe.buffer[:needed]
+		clear(mqe.buffer[n:])
 		return
 	}
 	newCap := cap(mqe.buffer) * 2
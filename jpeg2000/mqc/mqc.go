@@ -4,6 +4,8 @@ package mqc
 // Reference: ISO/IEC 15444-1:2019 Annex C
 // Based on the MQ-coder (multiplication-free, table-driven arithmetic coder)
 
+import "github.com/cocosip/go-dicom-codecs/internal/replay"
+
 // MQDecoder implements the MQ arithmetic decoder
 type MQDecoder struct {
 	// Input data
@@ -19,6 +21,8 @@ type MQDecoder struct {
 
 	// Contexts
 	contexts []uint8 // Context states (one per context)
+
+	trace func(context, decision int) // replay.MQDecision when recording
 }
 
 // NewMQDecoder creates a new MQ decoder
@@ -39,6 +43,7 @@ func NewMQDecoder(data []byte, numContexts int) *MQDecoder {
 		c:        0,
 		ct:       0,
 		contexts: make([]uint8, numContexts),
+		trace:    replay.MQDecision,
 	}
 
 	// Initialize all contexts to state 0
@@ -113,6 +118,7 @@ func NewMQDecoderWithContexts(data []byte, prevContexts []uint8) *MQDecoder {
 		c:        0,
 		ct:       0,
 		contexts: make([]uint8, len(prevContexts)),
+		trace:    replay.MQDecision,
 	}
 
 	// Copy contexts from previous decoder
@@ -210,6 +216,9 @@ func (mqc *MQDecoder) Decode(contextID int) int {
 
 		if (mqc.a & 0x8000) != 0 {
 			d = mps
+			if mqc.trace != nil {
+				mqc.trace(contextID, d)
+			}
 			return d
 		}
 
@@ -228,6 +237,9 @@ func (mqc *MQDecoder) Decode(contextID int) int {
 		mqc.renormd()
 	}
 
+	if mqc.trace != nil {
+		mqc.trace(contextID, d)
+	}
 	return d
 }
 
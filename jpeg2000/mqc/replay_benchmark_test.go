@@ -0,0 +1,84 @@
+package mqc
+
+import (
+	"testing"
+
+	"github.com/cocosip/go-dicom-codecs/internal/replay"
+)
+
+// mqReplayContexts is the number of Tier-1 contexts the corpus was recorded
+// with.
+const mqReplayContexts = 19
+
+// mqReplay is one recorded decision stream; see cmd/replay-record.
+type mqReplay struct {
+	states    []byte // initial state of each context
+	contexts  []byte
+	decisions []byte // packed MSB first
+	payload   []byte
+}
+
+func loadMQReplay(tb testing.TB) []mqReplay {
+	tb.Helper()
+	records, err := replay.Read("testdata/replay/mq.gz")
+	if err != nil {
+		tb.Fatalf("load corpus: %v", err)
+	}
+	streams := make([]mqReplay, len(records))
+	for i, r := range records {
+		n, payloadLen := int(r.Params[0]), int(r.Params[1])
+		packed := (n + 7) / 8
+		if len(r.Data) != mqReplayContexts+n+packed+payloadLen {
+			tb.Fatalf("record %d: data length %d, want %d", i, len(r.Data), mqReplayContexts+n+packed+payloadLen)
+		}
+		data := r.Data[mqReplayContexts:]
+		streams[i] = mqReplay{states: r.Data[:mqReplayContexts], contexts: data[:n], decisions: data[n : n+packed], payload: data[n+packed:]}
+	}
+	return streams
+}
+
+// newDecoder starts an MQ decoder in the state the Tier-1 decoder was in.
+func (s *mqReplay) newDecoder() *MQDecoder {
+	dec := NewMQDecoder(s.payload, mqReplayContexts)
+	for ctx, state := range s.states {
+		dec.SetContextState(ctx, state)
+	}
+	return dec
+}
+
+func TestReplayCorpus(t *testing.T) {
+	for i, s := range loadMQReplay(t) {
+		dec := s.newDecoder()
+		for j, ctx := range s.contexts {
+			want := int(s.decisions[j/8]>>(7-j%8)) & 1
+			if got := dec.Decode(int(ctx)); got != want {
+				t.Fatalf("stream %d: decision %d = %d, want %d", i, j, got, want)
+			}
+		}
+	}
+}
+
+// BenchmarkReplayMQDecoder replays the MQ decisions the Tier-1 decoder makes
+// on the wavelet code-blocks of real images; throughput is in payload bytes.
+func BenchmarkReplayMQDecoder(b *testing.B) {
+	streams := loadMQReplay(b)
+	var payload, decisions int
+	for _, s := range streams {
+		payload += len(s.payload)
+		decisions += len(s.contexts)
+	}
+	b.SetBytes(int64(payload))
+	b.ReportAllocs()
+	b.ResetTimer()
+	sink := 0
+	for i := 0; i < b.N; i++ {
+		for _, s := range streams {
+			dec := s.newDecoder()
+			for _, ctx := range s.contexts {
+				sink += dec.Decode(int(ctx))
+			}
+		}
+	}
+	b.ReportMetric(float64(b.Elapsed().Nanoseconds())/float64(b.N*decisions), "ns/decision")
+	_ = sink
+}
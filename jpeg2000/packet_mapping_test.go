@@ -34,7 +34,7 @@ func TestPacketCodeBlockOrderMatchesDecoderGeometry(t *testing.T) {
 		coeffs[0][i] = int32(i + 1)
 	}
 
-	packetEnc, allBlocks := enc.buildTilePacketEncoder(coeffs, params.Width, params.Height)
+	packetEnc, allBlocks := enc.buildTilePacketEncoder(coeffs, 0, 0, params.Width, params.Height)
 	owners := make(map[string]int)
 	for _, block := range allBlocks {
 		owners[string(block.Data)] = block.Index
@@ -80,7 +80,7 @@ func TestHTJ2KPacketCodeBlocksUseCleanupPassOnly(t *testing.T) {
 		coeffs[0][i] = int32(i + 1)
 	}
 
-	_, blocks := enc.buildTilePacketEncoder(coeffs, params.Width, params.Height)
+	_, blocks := enc.buildTilePacketEncoder(coeffs, 0, 0, params.Width, params.Height)
 	if len(blocks) == 0 {
 		t.Fatal("expected HTJ2K code-blocks")
 	}
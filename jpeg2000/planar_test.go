@@ -0,0 +1,107 @@
+package jpeg2000
+
+import (
+	"bytes"
+	"testing"
+)
+
+func planarTestImage(width, height int) (interleaved, planar []byte) {
+	numPixels := width * height
+	interleaved = make([]byte, numPixels*3)
+	planar = make([]byte, numPixels*3)
+	for i := 0; i < numPixels; i++ {
+		x, y := i%width, i/width
+		px := [3]byte{byte(x * 5), byte(y * 7), byte(128 + (x-y)*2)}
+		for c, v := range px {
+			interleaved[i*3+c] = v
+			planar[c*numPixels+i] = v
+		}
+	}
+	return interleaved, planar
+}
+
+// TestPlanarInputOutput checks that planar input codes identically to
+// interleaved input and that planar output matches the interleaved samples.
+func TestPlanarInputOutput(t *testing.T) {
+	width, height := 48, 40
+	interleaved, planar := planarTestImage(width, height)
+
+	params := DefaultEncodeParams(width, height, 3, 8, false)
+	params.NumLevels = 3
+	want, err := NewEncoder(params).Encode(interleaved)
+	if err != nil {
+		t.Fatalf("Encode failed: %v", err)
+	}
+	planarParams := *params
+	planarParams.PlanarInput = true
+	got, err := NewEncoder(&planarParams).Encode(planar)
+	if err != nil {
+		t.Fatalf("planar Encode failed: %v", err)
+	}
+	if !bytes.Equal(got, want) {
+		t.Fatalf("planar input produced a different codestream")
+	}
+	if _, err := NewStreamEncoder(&bytes.Buffer{}, &planarParams); err == nil {
+		t.Fatalf("stream encoder should reject planar input")
+	}
+
+	dec := NewDecoder()
+	dec.SetPlanarOutput(true)
+	if err := dec.Decode(want); err != nil {
+		t.Fatalf("Decode failed: %v", err)
+	}
+	if !bytes.Equal(dec.GetPixelData(), planar) {
+		t.Fatalf("planar output does not match the source planes")
+	}
+}
+
+// TestSkipInverseICT checks that lossy colour images can be returned as
+// YCbCr while lossless (RCT) images are always converted back to RGB.
+func TestSkipInverseICT(t *testing.T) {
+	width, height := 48, 40
+	interleaved, _ := planarTestImage(width, height)
+
+	params := DefaultEncodeParams(width, height, 3, 8, false)
+	params.NumLevels = 3
+	params.Lossless = false
+	params.Quality = 98
+	lossy, err := NewEncoder(params).Encode(interleaved)
+	if err != nil {
+		t.Fatalf("lossy Encode failed: %v", err)
+	}
+
+	dec := NewDecoder()
+	dec.SetSkipInverseICT(true)
+	if err := dec.Decode(lossy); err != nil {
+		t.Fatalf("Decode failed: %v", err)
+	}
+	if !dec.InverseICTSkipped() {
+		t.Fatalf("InverseICTSkipped = false for an ICT codestream")
+	}
+	ycc := dec.GetPixelData()
+	maxErr := 0
+	for i := 0; i < width*height; i++ {
+		r, g, b := float64(interleaved[i*3]), float64(interleaved[i*3+1]), float64(interleaved[i*3+2])
+		luma := int(0.299*r + 0.587*g + 0.114*b + 0.5)
+		diff := int(ycc[i*3]) - luma
+		maxErr = max(maxErr, diff, -diff)
+	}
+	if maxErr > 6 {
+		t.Fatalf("Y component max error %d against source luma", maxErr)
+	}
+
+	params.Lossless = true
+	lossless, err := NewEncoder(params).Encode(interleaved)
+	if err != nil {
+		t.Fatalf("lossless Encode failed: %v", err)
+	}
+	if err := dec.Decode(lossless); err != nil {
+		t.Fatalf("lossless Decode failed: %v", err)
+	}
+	if dec.InverseICTSkipped() {
+		t.Fatalf("InverseICTSkipped = true for an RCT codestream")
+	}
+	if !bytes.Equal(dec.GetPixelData(), interleaved) {
+		t.Fatalf("lossless decode with SetSkipInverseICT is not RGB")
+	}
+}
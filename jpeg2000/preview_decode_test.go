@@ -0,0 +1,91 @@
+package jpeg2000
+
+import (
+	"math"
+	"testing"
+)
+
+// TestPreviewDecodePassCap decodes a single-layer codestream with an
+// increasing bit-plane cap and checks that quality improves monotonically
+// and that an unlimited cap is still lossless.
+func TestPreviewDecodePassCap(t *testing.T) {
+	width, height := 128, 128
+	pixelData := make([]byte, width*height)
+	for y := 0; y < height; y++ {
+		for x := 0; x < width; x++ {
+			val := 128 + int(60*math.Sin(float64(x)*0.09)) + int(40*math.Cos(float64(y)*0.13))
+			pixelData[y*width+x] = byte(val)
+		}
+	}
+
+	for _, lossless := range []bool{true, false} {
+		params := DefaultEncodeParams(width, height, 1, 8, false)
+		params.NumLayers = 1
+		params.Lossless = lossless
+		params.NumLevels = 3
+		if !lossless {
+			params.Quality = 95
+		}
+
+		encoded, err := NewEncoder(params).Encode(pixelData)
+		if err != nil {
+			t.Fatalf("lossless=%v: encode failed: %v", lossless, err)
+		}
+
+		full := NewDecoder()
+		if err := full.Decode(encoded); err != nil {
+			t.Fatalf("lossless=%v: full decode failed: %v", lossless, err)
+		}
+		fullPSNR := calculatePSNR(pixelData, full.GetPixelData())
+		if lossless {
+			if maxErr, _ := calculateError(pixelData, full.GetPixelData()); maxErr != 0 {
+				t.Fatalf("full lossless decode max error = %d, want 0", maxErr)
+			}
+		}
+
+		prevPSNR := 0.0
+		for _, planes := range []int{2, 4, 6} {
+			dec := NewDecoder()
+			dec.SetMaxBitplanes(planes)
+			if dec.MaxCodingPasses() != CodingPassesForBitplanes(planes) {
+				t.Fatalf("MaxCodingPasses = %d, want %d", dec.MaxCodingPasses(), CodingPassesForBitplanes(planes))
+			}
+			if err := dec.Decode(encoded); err != nil {
+				t.Fatalf("lossless=%v planes=%d: decode failed: %v", lossless, planes, err)
+			}
+			psnr := calculatePSNR(pixelData, dec.GetPixelData())
+			t.Logf("lossless=%v planes=%d: PSNR=%.2f dB (full %.2f dB)", lossless, planes, psnr, fullPSNR)
+			if psnr+0.01 < prevPSNR {
+				t.Errorf("lossless=%v planes=%d: PSNR %.2f dropped below previous cap %.2f", lossless, planes, psnr, prevPSNR)
+			}
+			prevPSNR = psnr
+		}
+		if prevPSNR < 20 {
+			t.Errorf("lossless=%v: 6-plane preview PSNR %.2f dB too low", lossless, prevPSNR)
+		}
+
+		unlimited := NewDecoder()
+		unlimited.SetMaxCodingPasses(1 << 10)
+		if err := unlimited.Decode(encoded); err != nil {
+			t.Fatalf("lossless=%v: capped decode failed: %v", lossless, err)
+		}
+		got := unlimited.GetPixelData()
+		want := full.GetPixelData()
+		for i := range want {
+			if got[i] != want[i] {
+				t.Fatalf("lossless=%v: cap above pass count changed pixel %d: %d vs %d", lossless, i, got[i], want[i])
+			}
+		}
+	}
+}
+
+func TestCodingPassesForBitplanes(t *testing.T) {
+	tests := []struct{ planes, passes int }{
+		{0, 0}, {-1, 0}, {1, 1}, {2, 4}, {5, 13},
+	}
+	for _, tt := range tests {
+		if got := CodingPassesForBitplanes(tt.planes); got != tt.passes {
+			t.Errorf("CodingPassesForBitplanes(%d) = %d, want %d", tt.planes, got, tt.passes)
+		}
+	}
+}
@@ -1,6 +1,7 @@
 package jpeg2000
 
 import (
+	"bytes"
 	"testing"
 )
 
@@ -353,3 +354,50 @@ func TestProgressionOrderComparison(t *testing.T) {
 		}
 	}
 }
+
+// TestConvertProgression checks that reordering packets between every pair of
+// progression orders reproduces the codestream the encoder writes for the
+// target order directly, without touching the code-block data.
+func TestConvertProgression(t *testing.T) {
+	width, height := 80, 72
+	pixels := streamTestImage(width, height, 3)
+	encode := func(order uint8) []byte {
+		t.Helper()
+		params := DefaultEncodeParams(width, height, 3, 8, false)
+		params.NumLevels = 3
+		params.NumLayers = 2
+		params.Lossless = false
+		params.TargetRatio = 3
+		params.PrecinctWidth = 32
+		params.PrecinctHeight = 32
+		params.TileWidth = 48
+		params.TileHeight = 48
+		params.ProgressionOrder = order
+		encoded, err := NewEncoder(params).Encode(pixels)
+		if err != nil {
+			t.Fatalf("Encode order %d failed: %v", order, err)
+		}
+		return encoded
+	}
+
+	var streams [5][]byte
+	for order := range streams {
+		streams[order] = encode(uint8(order))
+	}
+	for from := range streams {
+		for to := range streams {
+			converted, err := ConvertProgression(streams[from], uint8(to))
+			if err != nil {
+				t.Fatalf("%d -> %d: ConvertProgression failed: %v", from, to, err)
+			}
+			if !bytes.Equal(converted, streams[to]) {
+				t.Fatalf("%d -> %d: converted codestream differs from direct encode (%d vs %d bytes)",
+					from, to, len(converted), len(streams[to]))
+			}
+		}
+	}
+
+	if _, err := ConvertProgression(streams[0], 5); err == nil {
+		t.Fatalf("invalid progression order should fail")
+	}
+}
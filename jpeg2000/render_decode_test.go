@@ -0,0 +1,141 @@
+package jpeg2000
+
+import (
+	"math"
+	"testing"
+
+	"github.com/cocosip/go-dicom-codecs/codec/voi"
+	"github.com/cocosip/go-dicom-codecs/jpeg2000/wavelet"
+)
+
+func renderTestImage(width, height int) ([]byte, []int32) {
+	samples := make([]int32, width*height)
+	data := make([]byte, width*height*2)
+	for y := 0; y < height; y++ {
+		for x := 0; x < width; x++ {
+			v := 2048 + int(900*math.Sin(float64(x)*0.07)) + int(700*math.Cos(float64(y)*0.05))
+			samples[y*width+x] = int32(v)
+			data[(y*width+x)*2] = byte(v)
+			data[(y*width+x)*2+1] = byte(v >> 8)
+		}
+	}
+	return data, samples
+}
+
+// TestReducedResolutionDecode checks dimensions, that a reversible single-tile
+// decode returns exactly the forward-DWT LL band, and that every reduced image
+// stays close to a box-filtered full-resolution image.
+func TestReducedResolutionDecode(t *testing.T) {
+	width, height := 97, 80
+	data, samples := renderTestImage(width, height)
+
+	for _, tt := range []struct {
+		name     string
+		lossless bool
+		tile     int
+	}{
+		{"lossless", true, 0},
+		{"lossy", false, 0},
+		{"lossless tiled", true, 32},
+	} {
+		t.Run(tt.name, func(t *testing.T) {
+			params := DefaultEncodeParams(width, height, 1, 12, false)
+			params.NumLevels = 3
+			params.Lossless = tt.lossless
+			params.TileWidth = tt.tile
+			params.TileHeight = tt.tile
+			encoded, err := NewEncoder(params).Encode(data)
+			if err != nil {
+				t.Fatalf("Encode failed: %v", err)
+			}
+
+			for _, reduce := range []int{1, 2, 5} {
+				levels := min(reduce, params.NumLevels)
+				scale := 1 << levels
+				dec := NewDecoder()
+				dec.SetReduceResolution(reduce)
+				if err := dec.Decode(encoded); err != nil {
+					t.Fatalf("reduce=%d: decode failed: %v", reduce, err)
+				}
+				wantW := (width + scale - 1) / scale
+				wantH := (height + scale - 1) / scale
+				if dec.Width() != wantW || dec.Height() != wantH {
+					t.Fatalf("reduce=%d: size %dx%d, want %dx%d", reduce, dec.Width(), dec.Height(), wantW, wantH)
+				}
+
+				got := dec.GetImageData()[0]
+				if tt.lossless && tt.tile == 0 {
+					ll := make([]int32, len(samples))
+					for i, v := range samples {
+						ll[i] = v - 2048
+					}
+					wavelet.ForwardMultilevel(ll, width, height, levels)
+					for y := 0; y < wantH; y++ {
+						for x := 0; x < wantW; x++ {
+							if want := ll[y*width+x] + 2048; got[y*wantW+x] != want {
+								t.Fatalf("reduce=%d (%d,%d): got %d, want LL %d", reduce, x, y, got[y*wantW+x], want)
+							}
+						}
+					}
+				}
+
+				var sumErr float64
+				for y := 0; y < wantH; y++ {
+					for x := 0; x < wantW; x++ {
+						var sum, n float64
+						for dy := 0; dy < scale && y*scale+dy < height; dy++ {
+							for dx := 0; dx < scale && x*scale+dx < width; dx++ {
+								sum += float64(samples[(y*scale+dy)*width+x*scale+dx])
+								n++
+							}
+						}
+						sumErr += math.Abs(float64(got[y*wantW+x]) - sum/n)
+					}
+				}
+				if mae := sumErr / float64(wantW*wantH); mae > float64(25*scale) {
+					t.Errorf("reduce=%d: mean abs error vs box filter %.1f too high", reduce, mae)
+				}
+			}
+		})
+	}
+}
+
+// TestRenderedPixelData verifies that the renderer replaces the stored
+// representation with one display byte per sample.
+func TestRenderedPixelData(t *testing.T) {
+	width, height := 64, 48
+	data, samples := renderTestImage(width, height)
+	params := DefaultEncodeParams(width, height, 1, 12, false)
+	params.NumLevels = 3
+	encoded, err := NewEncoder(params).Encode(data)
+	if err != nil {
+		t.Fatalf("Encode failed: %v", err)
+	}
+
+	r, err := voi.NewRenderer(voi.Options{RescaleIntercept: -1024, WindowCenter: 1000, WindowWidth: 1500}, 12, false)
+	if err != nil {
+		t.Fatalf("NewRenderer failed: %v", err)
+	}
+	dec := NewDecoder()
+	dec.SetRenderer(r)
+	if err := dec.Decode(encoded); err != nil {
+		t.Fatalf("Decode failed: %v", err)
+	}
+	if got, _ := dec.RendererFor(r, voi.Options{}); got != r {
+		t.Fatalf("RendererFor rebuilt a matching renderer")
+	}
+	out := dec.GetPixelData()
+	if len(out) != width*height {
+		t.Fatalf("rendered length %d, want %d", len(out), width*height)
+	}
+	for i, v := range samples {
+		if out[i] != r.Map(v) {
+			t.Fatalf("pixel %d: got %d, want %d", i, out[i], r.Map(v))
+		}
+	}
+
+	dec.SetRenderer(nil)
+	if len(dec.GetPixelData()) != width*height*2 {
+		t.Fatalf("clearing the renderer must restore 16-bit output")
+	}
+}
@@ -1,9 +1,13 @@
 package jpeg2000
 
 import (
+	"bytes"
 	"fmt"
 	"strings"
 	"testing"
+
+	"github.com/cocosip/go-dicom-codecs/codec/stats"
+	"github.com/cocosip/go-dicom-codecs/jpeg2000/wavelet"
 )
 
 // TestEncoderDecoderRoundTrip tests complete encode-decode round trip
@@ -291,3 +295,174 @@ func TestEncoderDecoderRoundTripLarger(t *testing.T) {
 		})
 	}
 }
+
+// TestConstantTransform53MatchesTransform checks that the constant-component
+// shortcut produces the coefficients of the full 5/3 decomposition.
+func TestConstantTransform53MatchesTransform(t *testing.T) {
+	for _, g := range []struct{ width, height, levels, x0, y0 int }{
+		{64, 64, 5, 0, 0}, {37, 21, 3, 0, 0}, {37, 21, 3, 64, 128},
+		{150, 130, 4, 1, 0}, {9, 9, 2, 3, 5}, {16, 8, 3, 0, 0},
+	} {
+		for _, value := range []int32{0, -2048, 1234, 65535} {
+			data := make([]int32, g.width*g.height)
+			for i := range data {
+				data[i] = value
+			}
+			got, ok := constantTransform53(value, len(data), g.width, g.height, g.levels, g.x0, g.y0)
+			if !ok {
+				continue
+			}
+			want := append([]int32(nil), data...)
+			wavelet.ForwardMultilevelWithParity(want, g.width, g.height, g.levels, g.x0, g.y0)
+			for i := range want {
+				if got[i] != want[i] {
+					t.Fatalf("%+v value %d: coefficient %d = %d, want %d", g, value, i, got[i], want[i])
+				}
+			}
+		}
+	}
+	e := NewEncoder(DefaultEncodeParams(2, 2, 1, 8, false))
+	if _, ok := e.constantTileComponent(0, []int32{1, 2, 1, 1}, 2, 2); ok {
+		t.Error("non-constant data took the constant path")
+	}
+}
+
+// TestFrameStatsEncodeMatches checks that encodes given the frame statistics
+// produce the same codestream as encodes that scan for constant components.
+func TestFrameStatsEncodeMatches(t *testing.T) {
+	tests := []struct {
+		name          string
+		width, height int
+		components    int
+		tile          int
+		fill          func(i int) byte
+	}{
+		{"constant", 64, 48, 1, 0, func(int) byte { return 90 }},
+		{"varying", 64, 48, 1, 0, func(i int) byte { return byte(i * 7) }},
+		{"rgb constant", 40, 40, 3, 0, func(i int) byte { return byte(10 + i%3) }},
+		{"rgb one flat channel", 40, 40, 3, 0, func(i int) byte { return byte(i % 3 * (i / 3)) }},
+		{"tiled blank rows", 96, 96, 1, 32, func(i int) byte { return byte(max(i-96*64, 0)) }},
+	}
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			pixels := make([]byte, tt.width*tt.height*tt.components)
+			for i := range pixels {
+				pixels[i] = tt.fill(i)
+			}
+			p := DefaultEncodeParams(tt.width, tt.height, tt.components, 8, false)
+			p.TileWidth, p.TileHeight = tt.tile, tt.tile
+			want, err := NewEncoder(p).Encode(pixels)
+			if err != nil {
+				t.Fatalf("encode: %v", err)
+			}
+
+			frameStats, err := stats.Compute(stats.Frame{
+				Data: pixels, Width: tt.width, Height: tt.height,
+				Components: tt.components, BitsAllocated: 8,
+			})
+			if err != nil {
+				t.Fatalf("stats: %v", err)
+			}
+			withStats := *p
+			withStats.FrameStats = frameStats
+			got, err := NewEncoder(&withStats).Encode(pixels)
+			if err != nil {
+				t.Fatalf("encode with stats: %v", err)
+			}
+			if !bytes.Equal(got, want) {
+				t.Fatal("codestream differs when frame statistics are given")
+			}
+		})
+	}
+}
+
+// TestConstantFrameRoundTrip covers blank and uniform frames, which take the
+// constant-component paths of the encoder and the tile decoder.
+func TestConstantFrameRoundTrip(t *testing.T) {
+	tests := []struct {
+		name          string
+		width, height int
+		components    int
+		bits          int
+		signed        bool
+		tile          int
+		value         int
+	}{
+		{"blank 8-bit", 64, 64, 1, 8, false, 0, 0},
+		{"mid 12-bit", 128, 96, 1, 12, false, 0, 2048},
+		{"max 16-bit", 64, 48, 1, 16, false, 0, 65535},
+		{"signed 16-bit", 40, 40, 1, 16, true, 0, -1000},
+		{"odd size", 37, 21, 1, 8, false, 0, 200},
+		{"rgb", 48, 32, 3, 8, false, 0, 77},
+		{"tiled", 150, 130, 1, 12, false, 64, 4095},
+	}
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			bytesPerSample := (tt.bits + 7) / 8
+			samples := tt.width * tt.height * tt.components
+			pixels := make([]byte, samples*bytesPerSample)
+			for i := 0; i < samples; i++ {
+				if bytesPerSample == 1 {
+					pixels[i] = byte(tt.value)
+				} else {
+					pixels[2*i], pixels[2*i+1] = byte(tt.value), byte(tt.value>>8)
+				}
+			}
+			p := DefaultEncodeParams(tt.width, tt.height, tt.components, tt.bits, tt.signed)
+			p.TileWidth, p.TileHeight = tt.tile, tt.tile
+			encoded, err := NewEncoder(p).Encode(pixels)
+			if err != nil {
+				t.Fatalf("encode: %v", err)
+			}
+			decoder := NewDecoder()
+			if err := decoder.Decode(encoded); err != nil {
+				t.Fatalf("decode: %v", err)
+			}
+			if !bytes.Equal(decoder.GetPixelData(), pixels) {
+				t.Fatal("lossless round trip differs")
+			}
+		})
+	}
+}
+
+// TestUnalignedTileRoundTrip covers tiles whose origin is not a multiple of
+// 2^NumLevels, where the subband sizes depend on the tile position and not
+// only on the tile size.
+func TestUnalignedTileRoundTrip(t *testing.T) {
+	tests := []struct {
+		name          string
+		width, height int
+		components    int
+		tile          int
+		levels        int
+		precinct      int
+		progression   uint8
+	}{
+		{"300x300 L3 P32", 300, 300, 1, 100, 3, 32, 0},
+		{"250x190 L5 P64", 250, 190, 1, 100, 5, 64, 0},
+		{"250x190 L5 P64 PCRL", 250, 190, 1, 100, 5, 64, 3},
+		{"rgb 130x90 L4", 130, 90, 3, 36, 4, 0, 0},
+	}
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			pixels := streamTestImage(tt.width, tt.height, tt.components)
+			p := DefaultEncodeParams(tt.width, tt.height, tt.components, 8, false)
+			p.TileWidth, p.TileHeight = tt.tile, tt.tile
+			p.NumLevels = tt.levels
+			p.PrecinctWidth, p.PrecinctHeight = tt.precinct, tt.precinct
+			p.ProgressionOrder = tt.progression
+
+			var encoded bytes.Buffer
+			if err := EncodeStream(&encoded, bytes.NewReader(pixels), p); err != nil {
+				t.Fatalf("EncodeStream failed: %v", err)
+			}
+			decoder := NewDecoder()
+			if err := decoder.Decode(encoded.Bytes()); err != nil {
+				t.Fatalf("decode: %v", err)
+			}
+			if !bytes.Equal(decoder.GetPixelData(), pixels) {
+				t.Fatal("lossless round trip differs")
+			}
+		})
+	}
+}
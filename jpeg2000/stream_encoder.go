@@ -0,0 +1,359 @@
+package jpeg2000
+
+import (
+	"bytes"
+	"encoding/binary"
+	"errors"
+	"fmt"
+	"io"
+
+	"github.com/cocosip/go-dicom-codecs/jpeg2000/codestream"
+	"github.com/cocosip/go-dicom-codecs/jpeg2000/colorspace"
+)
+
+// DefaultStreamTileSize is the tile edge used by StreamEncoder when the
+// parameters leave TileWidth or TileHeight at 0 (single tile).
+const DefaultStreamTileSize = 1024
+
+// RowSource fills row with the interleaved samples of image row y
+// (same layout as Encoder.Encode input).
+type RowSource func(y int, row []byte) error
+
+// StreamEncoder encodes an image incrementally, one tile row at a time.
+//
+// Rows are supplied through Write (io.Writer semantics, any chunking) and are
+// unpacked straight into component planes that hold a single tile row. As soon
+// as a tile row is complete its tiles are transformed, coded and written to the
+// destination, so working memory is bounded by Width*TileHeight samples rather
+// than the full image. Close writes EOC.
+//
+// When the destination implements io.WriteSeeker a TLM segment is reserved in
+// the main header and patched with the tile-part lengths on Close; otherwise
+// TLM is omitted since the lengths are unknown when the header is written.
+//
+// Rate control (NumLayers > 1 or TargetRatio) is applied per tile using the
+// tile area; global PCRD across tiles and LayerRates with multiple tiles need
+// the whole image and are not available. Custom MCT matrices and bindings are
+// not supported; the default RCT/ICT is. Rows must be interleaved, so
+// PlanarInput is rejected.
+type StreamEncoder struct {
+	enc    *Encoder
+	w      io.Writer
+	seeker io.WriteSeeker
+
+	rowBytes   int
+	tileWidth  int
+	tileHeight int
+	numTilesX  int
+	numTilesY  int
+
+	strip     [][]int32 // component planes for the current tile row
+	stripRows int       // rows unpacked into strip
+	row       int       // next image row expected
+	partial   []byte    // incomplete row carried between Write calls
+
+	tlmOffset  int64
+	tlmEntries []tlmEntry
+	err        error
+	closed     bool
+}
+
+// NewStreamEncoder validates params, writes the main header to w and returns
+// an encoder ready to accept rows. params is copied; tile sizes of 0 are
+// replaced by DefaultStreamTileSize (clamped to the image).
+func NewStreamEncoder(w io.Writer, params *EncodeParams) (*StreamEncoder, error) {
+	if params == nil {
+		return nil, fmt.Errorf("encode parameters are required")
+	}
+	p := *params
+	if p.TileWidth == 0 {
+		p.TileWidth = min(DefaultStreamTileSize, p.Width)
+	}
+	if p.TileHeight == 0 {
+		p.TileHeight = min(DefaultStreamTileSize, p.Height)
+	}
+
+	enc := NewEncoder(&p)
+	if err := enc.validateParams(); err != nil {
+		return nil, fmt.Errorf("invalid encoding parameters: %w", err)
+	}
+	if p.TileWidth < 0 || p.TileHeight < 0 {
+		return nil, fmt.Errorf("invalid tile size: %dx%d", p.TileWidth, p.TileHeight)
+	}
+	if p.EnableMCT && (len(p.MCTBindings) > 0 || p.MCTMatrix != nil) {
+		return nil, fmt.Errorf("custom MCT is not supported by the streaming encoder")
+	}
+	if p.PlanarInput && p.Components > 1 {
+		return nil, fmt.Errorf("planar input is not supported by the streaming encoder")
+	}
+
+	s := &StreamEncoder{
+		enc:        enc,
+		w:          w,
+		rowBytes:   p.Width * p.Components * ((p.BitDepth + 7) / 8),
+		tileWidth:  p.TileWidth,
+		tileHeight: p.TileHeight,
+		numTilesX:  (p.Width + p.TileWidth - 1) / p.TileWidth,
+		numTilesY:  (p.Height + p.TileHeight - 1) / p.TileHeight,
+	}
+	numTiles := s.numTilesX * s.numTilesY
+	if numTiles > 0xFFFF {
+		return nil, fmt.Errorf("too many tiles: %d (Isot is 16-bit)", numTiles)
+	}
+	if numTiles > 1 && len(p.LayerRates) > 0 {
+		return nil, fmt.Errorf("layer rates need global rate control and cannot be streamed across %d tiles", numTiles)
+	}
+	enc.openJPEGNumTiles = numTiles
+
+	if err := enc.resolveROI(); err != nil {
+		return nil, fmt.Errorf("failed to resolve ROI: %w", err)
+	}
+
+	header := &bytes.Buffer{}
+	if err := enc.writeMainHeader(header); err != nil {
+		return nil, err
+	}
+	if ws, ok := w.(io.WriteSeeker); ok {
+		start, err := ws.Seek(0, io.SeekCurrent)
+		if err == nil {
+			s.seeker = ws
+			s.tlmOffset = start + int64(header.Len())
+			if err := writeTLMEntries(header, s.reservedTLMEntries()); err != nil {
+				return nil, fmt.Errorf("failed to reserve TLM: %w", err)
+			}
+		}
+	}
+	if _, err := w.Write(header.Bytes()); err != nil {
+		return nil, err
+	}
+
+	s.strip = make([][]int32, p.Components)
+	for c := range s.strip {
+		s.strip[c] = make([]int32, p.Width*p.TileHeight)
+	}
+	return s, nil
+}
+
+// reservedTLMEntries returns placeholder entries in tile-part order.
+func (s *StreamEncoder) reservedTLMEntries() []tlmEntry {
+	partsPerTile := 1
+	if s.enc.params.HTJ2KMode {
+		partsPerTile = s.enc.params.NumLevels + 1
+	}
+	numTiles := s.numTilesX * s.numTilesY
+	entries := make([]tlmEntry, 0, numTiles*partsPerTile)
+	for tile := 0; tile < numTiles; tile++ {
+		for part := 0; part < partsPerTile; part++ {
+			entries = append(entries, tlmEntry{tileIndex: uint16(tile)})
+		}
+	}
+	return entries
+}
+
+// Write accepts interleaved pixel bytes in raster order. Rows may be split
+// across calls arbitrarily.
+func (s *StreamEncoder) Write(p []byte) (int, error) {
+	if s.err != nil {
+		return 0, s.err
+	}
+	if s.closed {
+		return 0, fmt.Errorf("write to closed stream encoder")
+	}
+	written := 0
+	if len(s.partial) > 0 {
+		n := min(s.rowBytes-len(s.partial), len(p))
+		s.partial = append(s.partial, p[:n]...)
+		p = p[n:]
+		written += n
+		if len(s.partial) < s.rowBytes {
+			return written, nil
+		}
+		if err := s.addRows(s.partial); err != nil {
+			return written, err
+		}
+		s.partial = s.partial[:0]
+	}
+	whole := len(p) / s.rowBytes * s.rowBytes
+	if whole > 0 {
+		if err := s.addRows(p[:whole]); err != nil {
+			return written, err
+		}
+		written += whole
+	}
+	if rest := p[whole:]; len(rest) > 0 {
+		if s.row >= s.enc.params.Height {
+			return written, fmt.Errorf("pixel data exceeds image height %d", s.enc.params.Height)
+		}
+		s.partial = append(s.partial, rest...)
+		written += len(rest)
+	}
+	return written, nil
+}
+
+// ReadFrom reads pixel rows from r until EOF.
+func (s *StreamEncoder) ReadFrom(r io.Reader) (int64, error) {
+	buf := make([]byte, s.rowBytes*max(1, min(s.tileHeight, 64)))
+	var total int64
+	for {
+		n, err := r.Read(buf)
+		if n > 0 {
+			if _, werr := s.Write(buf[:n]); werr != nil {
+				return total, werr
+			}
+			total += int64(n)
+		}
+		if errors.Is(err, io.EOF) {
+			return total, nil
+		}
+		if err != nil {
+			return total, err
+		}
+	}
+}
+
+// addRows unpacks whole rows into the strip, flushing each completed tile row.
+func (s *StreamEncoder) addRows(rows []byte) error {
+	p := s.enc.params
+	for len(rows) > 0 {
+		if s.row >= p.Height {
+			return fmt.Errorf("pixel data exceeds image height %d", p.Height)
+		}
+		s.enc.unpackSamples(s.strip, s.stripRows*p.Width, rows[:s.rowBytes], p.Width)
+		rows = rows[s.rowBytes:]
+		s.stripRows++
+		s.row++
+		if s.stripRows == s.tileHeight || s.row == p.Height {
+			if err := s.flushTileRow(); err != nil {
+				s.err = err
+				return err
+			}
+		}
+	}
+	return nil
+}
+
+// flushTileRow codes every tile of the buffered tile row and writes its tile-parts.
+func (s *StreamEncoder) flushTileRow() error {
+	e := s.enc
+	p := e.params
+	n := s.stripRows * p.Width
+	tileRow := (s.row - 1) / s.tileHeight
+
+	e.data = make([][]int32, p.Components)
+	for c := range e.data {
+		e.data[c] = s.strip[c][:n]
+	}
+	e.stripY0 = tileRow * s.tileHeight
+	e.applyDCLevelShift()
+	e.irreversibleMCTData = nil
+	if p.EnableMCT && p.Components == 3 {
+		if p.Lossless {
+			y, cb, cr := e.data[0], e.data[1], e.data[2]
+			for i := 0; i < n; i++ {
+				y[i], cb[i], cr[i] = colorspace.RCTForward(y[i], cb[i], cr[i])
+			}
+		} else {
+			e.irreversibleMCTData = e.applyOpenJPEGIrreversibleMCT()
+		}
+	}
+
+	buf := &bytes.Buffer{}
+	for tx := 0; tx < s.numTilesX; tx++ {
+		tileIdx := tileRow*s.numTilesX + tx
+		if err := e.writeTile(buf, tileIdx, s.tileWidth, s.tileHeight, s.numTilesX); err != nil {
+			return fmt.Errorf("failed to write tile %d: %w", tileIdx, err)
+		}
+	}
+	if s.seeker != nil {
+		entries, err := tilePartLengths(buf.Bytes())
+		if err != nil {
+			return err
+		}
+		s.tlmEntries = append(s.tlmEntries, entries...)
+	}
+	if _, err := s.w.Write(buf.Bytes()); err != nil {
+		return err
+	}
+
+	e.data = nil
+	e.irreversibleMCTData = nil
+	s.stripRows = 0
+	return nil
+}
+
+// Close verifies that every row was supplied, writes EOC and patches the
+// reserved TLM segment when the destination is seekable.
+func (s *StreamEncoder) Close() error {
+	if s.closed {
+		return s.err
+	}
+	s.closed = true
+	if s.err != nil {
+		return s.err
+	}
+	if s.row != s.enc.params.Height || len(s.partial) > 0 {
+		s.err = fmt.Errorf("incomplete image: got %d of %d rows", s.row, s.enc.params.Height)
+		return s.err
+	}
+	if err := binary.Write(s.w, binary.BigEndian, codestream.MarkerEOC); err != nil {
+		s.err = err
+		return err
+	}
+	if s.seeker != nil {
+		s.err = s.patchTLM()
+	}
+	return s.err
+}
+
+func (s *StreamEncoder) patchTLM() error {
+	if len(s.tlmEntries) != len(s.reservedTLMEntries()) {
+		return fmt.Errorf("tile-part count %d does not match reserved TLM entries", len(s.tlmEntries))
+	}
+	tlm := &bytes.Buffer{}
+	if err := writeTLMEntries(tlm, s.tlmEntries); err != nil {
+		return err
+	}
+	end, err := s.seeker.Seek(0, io.SeekCurrent)
+	if err != nil {
+		return err
+	}
+	if _, err := s.seeker.Seek(s.tlmOffset, io.SeekStart); err != nil {
+		return err
+	}
+	if _, err := s.seeker.Write(tlm.Bytes()); err != nil {
+		return err
+	}
+	_, err = s.seeker.Seek(end, io.SeekStart)
+	return err
+}
+
+// EncodeStream encodes the raster read from r into w without holding the
+// whole image in memory.
+func EncodeStream(w io.Writer, r io.Reader, params *EncodeParams) error {
+	s, err := NewStreamEncoder(w, params)
+	if err != nil {
+		return err
+	}
+	if _, err := s.ReadFrom(r); err != nil {
+		return err
+	}
+	return s.Close()
+}
+
+// EncodeRows encodes an image whose rows are produced on demand by next.
+func EncodeRows(w io.Writer, params *EncodeParams, next RowSource) error {
+	s, err := NewStreamEncoder(w, params)
+	if err != nil {
+		return err
+	}
+	row := make([]byte, s.rowBytes)
+	for y := 0; y < params.Height; y++ {
+		if err := next(y, row); err != nil {
+			return fmt.Errorf("row %d: %w", y, err)
+		}
+		if err := s.addRows(row); err != nil {
+			return err
+		}
+	}
+	return s.Close()
+}
@@ -0,0 +1,226 @@
+package jpeg2000
+
+import (
+	"bytes"
+	"encoding/binary"
+	"errors"
+	"io"
+	"testing"
+
+	"github.com/cocosip/go-dicom-codecs/jpeg2000/codestream"
+)
+
+// seekBuffer is an in-memory io.WriteSeeker for TLM patching tests.
+type seekBuffer struct {
+	data []byte
+	pos  int
+}
+
+func (b *seekBuffer) Write(p []byte) (int, error) {
+	if need := b.pos + len(p); need > len(b.data) {
+		b.data = append(b.data, make([]byte, need-len(b.data))...)
+	}
+	copy(b.data[b.pos:], p)
+	b.pos += len(p)
+	return len(p), nil
+}
+
+func (b *seekBuffer) Seek(offset int64, whence int) (int64, error) {
+	switch whence {
+	case io.SeekStart:
+		b.pos = int(offset)
+	case io.SeekCurrent:
+		b.pos += int(offset)
+	case io.SeekEnd:
+		b.pos = len(b.data) + int(offset)
+	}
+	return int64(b.pos), nil
+}
+
+// chunkReader returns data in small uneven chunks to exercise partial rows.
+type chunkReader struct {
+	data []byte
+	step int
+}
+
+func (r *chunkReader) Read(p []byte) (int, error) {
+	if len(r.data) == 0 {
+		return 0, io.EOF
+	}
+	n := min(len(p), r.step, len(r.data))
+	copy(p, r.data[:n])
+	r.data = r.data[n:]
+	r.step = r.step%29 + 7
+	return n, nil
+}
+
+func streamTestImage(width, height, components int) []byte {
+	data := make([]byte, width*height*components)
+	for y := 0; y < height; y++ {
+		for x := 0; x < width; x++ {
+			for c := 0; c < components; c++ {
+				data[(y*width+x)*components+c] = byte((x*3 + y*5 + c*40 + (x*y)%17) & 0xFF)
+			}
+		}
+	}
+	return data
+}
+
+// TestStreamEncoderMatchesEncoder checks that streaming rows produces the same
+// codestream as encoding the whole image with the same tiling.
+func TestStreamEncoderMatchesEncoder(t *testing.T) {
+	tests := []struct {
+		name       string
+		width      int
+		height     int
+		components int
+		tileSize   int
+		lossless   bool
+	}{
+		{"gray lossless", 100, 75, 1, 32, true},
+		{"rgb lossless", 70, 90, 3, 32, true},
+		{"rgb lossy", 64, 80, 3, 32, false},
+		{"gray lossless wide tiles", 300, 200, 1, 128, true},
+	}
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			pixels := streamTestImage(tt.width, tt.height, tt.components)
+			params := DefaultEncodeParams(tt.width, tt.height, tt.components, 8, false)
+			params.TileWidth = tt.tileSize
+			params.TileHeight = tt.tileSize
+			params.NumLevels = 3
+			params.Lossless = tt.lossless
+
+			want, err := NewEncoder(params).Encode(pixels)
+			if err != nil {
+				t.Fatalf("Encode failed: %v", err)
+			}
+
+			var got bytes.Buffer
+			if err := EncodeStream(&got, &chunkReader{data: pixels, step: 11}, params); err != nil {
+				t.Fatalf("EncodeStream failed: %v", err)
+			}
+			if !bytes.Equal(got.Bytes(), want) {
+				t.Fatalf("streamed codestream differs: %d bytes vs %d", got.Len(), len(want))
+			}
+
+			rowBytes := tt.width * tt.components
+			var viaRows bytes.Buffer
+			err = EncodeRows(&viaRows, params, func(y int, row []byte) error {
+				copy(row, pixels[y*rowBytes:(y+1)*rowBytes])
+				return nil
+			})
+			if err != nil {
+				t.Fatalf("EncodeRows failed: %v", err)
+			}
+			if !bytes.Equal(viaRows.Bytes(), want) {
+				t.Fatalf("row-callback codestream differs from Encode output")
+			}
+
+			if tt.lossless {
+				dec := NewDecoder()
+				if err := dec.Decode(want); err != nil {
+					t.Fatalf("Decode failed: %v", err)
+				}
+				if !bytes.Equal(dec.GetPixelData(), pixels) {
+					t.Fatalf("multi-tile lossless round trip mismatch")
+				}
+			}
+		})
+	}
+}
+
+// TestStreamEncoderTLM verifies that seekable destinations receive a patched
+// TLM segment whose lengths match the tile-parts, and that the result decodes.
+func TestStreamEncoderTLM(t *testing.T) {
+	width, height := 96, 70
+	pixels := streamTestImage(width, height, 1)
+	params := DefaultEncodeParams(width, height, 1, 8, false)
+	params.TileWidth = 40
+	params.TileHeight = 24
+	params.NumLevels = 2
+
+	out := &seekBuffer{}
+	if err := EncodeStream(out, bytes.NewReader(pixels), params); err != nil {
+		t.Fatalf("EncodeStream failed: %v", err)
+	}
+	data := out.data
+
+	tlmAt := bytes.Index(data, []byte{0xFF, 0x55})
+	sotAt := bytes.Index(data, []byte{0xFF, 0x90})
+	if tlmAt < 0 || sotAt < 0 || tlmAt > sotAt {
+		t.Fatalf("TLM not found in main header (tlm=%d sot=%d)", tlmAt, sotAt)
+	}
+	entries, err := tilePartLengths(data[sotAt : len(data)-2])
+	if err != nil {
+		t.Fatalf("tile-part walk failed: %v", err)
+	}
+	if len(entries) != 9 {
+		t.Fatalf("got %d tile-parts, want 9", len(entries))
+	}
+	ltlm := int(binary.BigEndian.Uint16(data[tlmAt+2:]))
+	if ltlm != 4+6*len(entries) {
+		t.Fatalf("Ltlm = %d, want %d", ltlm, 4+6*len(entries))
+	}
+	for i, entry := range entries {
+		off := tlmAt + 6 + i*6
+		if idx := binary.BigEndian.Uint16(data[off:]); idx != entry.tileIndex {
+			t.Errorf("entry %d: Ttlm = %d, want %d", i, idx, entry.tileIndex)
+		}
+		if length := binary.BigEndian.Uint32(data[off+2:]); length != entry.length {
+			t.Errorf("entry %d: Ptlm = %d, want %d", i, length, entry.length)
+		}
+	}
+	if binary.BigEndian.Uint16(data[len(data)-2:]) != codestream.MarkerEOC {
+		t.Fatalf("codestream does not end with EOC")
+	}
+
+	dec := NewDecoder()
+	if err := dec.Decode(data); err != nil {
+		t.Fatalf("Decode failed: %v", err)
+	}
+	if !bytes.Equal(dec.GetPixelData(), pixels) {
+		t.Fatalf("lossless streamed decode mismatch")
+	}
+}
+
+func TestStreamEncoderErrors(t *testing.T) {
+	params := DefaultEncodeParams(16, 16, 1, 8, false)
+	params.NumLevels = 1
+
+	s, err := NewStreamEncoder(io.Discard, params)
+	if err != nil {
+		t.Fatalf("NewStreamEncoder failed: %v", err)
+	}
+	if _, err := s.Write(make([]byte, 16*8+3)); err != nil {
+		t.Fatalf("Write failed: %v", err)
+	}
+	if err := s.Close(); err == nil {
+		t.Fatalf("Close accepted an incomplete image")
+	}
+
+	s, err = NewStreamEncoder(io.Discard, params)
+	if err != nil {
+		t.Fatalf("NewStreamEncoder failed: %v", err)
+	}
+	if _, err := s.Write(make([]byte, 16*17)); err == nil {
+		t.Fatalf("Write accepted rows past the image height")
+	}
+
+	failing := errors.New("source failed")
+	err = EncodeRows(io.Discard, params, func(y int, row []byte) error {
+		if y == 5 {
+			return failing
+		}
+		return nil
+	})
+	if !errors.Is(err, failing) {
+		t.Fatalf("EncodeRows error = %v, want wrapped source error", err)
+	}
+
+	custom := DefaultEncodeParams(16, 16, 3, 8, false)
+	custom.MCTMatrix = identityMatrix(3)
+	if _, err := NewStreamEncoder(io.Discard, custom); err == nil {
+		t.Fatalf("custom MCT should be rejected")
+	}
+}
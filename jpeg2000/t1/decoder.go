@@ -37,6 +37,7 @@ type Decoder struct {
 	termall                bool // Terminate all passes
 	segmentation           bool // Use segmentation symbols
 	openJPEGReconstruction bool // Use OpenJPEG T1 decode reconstruction centers
+	maxPasses              int  // Preview cap on decoded coding passes (0 = unlimited)
 }
 
 // NewT1Decoder creates a new Tier-1 decoder
@@ -73,6 +74,26 @@ func (t1 *Decoder) SetOpenJPEGReconstruction(enabled bool) {
 	t1.openJPEGReconstruction = enabled
 }
 
+// SetMaxPasses caps the number of coding passes decoded per code-block.
+// Passes beyond the cap are skipped and the remaining magnitudes are
+// reconstructed at the mid-point of the last decoded bit-plane, which gives
+// a fast preview of full-quality single-layer codestreams. n <= 0 disables
+// the cap.
+func (t1 *Decoder) SetMaxPasses(n int) {
+	if n < 0 {
+		n = 0
+	}
+	t1.maxPasses = n
+}
+
+// capPasses limits numPasses to the configured preview cap.
+func (t1 *Decoder) capPasses(numPasses int) int {
+	if t1.maxPasses > 0 && numPasses > t1.maxPasses {
+		return t1.maxPasses
+	}
+	return numPasses
+}
+
 // DecodeWithBitplane decodes a code-block starting from a specific bitplane
 // This is used when the max bitplane is known (e.g., from packet header in T2)
 func (t1 *Decoder) DecodeWithBitplane(data []byte, numPasses int, maxBitplane int, roishift int) error {
@@ -112,7 +133,9 @@ func (t1 *Decoder) DecodeLayeredWithMode(data []byte, passLengths []int, maxBitp
 	// Note: In TERMALL mode, each pass is flushed independently, so we need
 	// to create a new MQC decoder for each pass's data, but contexts are preserved
 	t1.roishift = roishift
-	numPasses := len(passLengths)
+	numPasses := t1.capPasses(len(passLengths))
+	truncated := numPasses < len(passLengths)
+	lastPassType, lastBitplane := -1, -1
 
 	passIdx := 0
 	prevEnd := 0
@@ -180,6 +203,7 @@ func (t1 *Decoder) DecodeLayeredWithMode(data []byte, passLengths []int, maxBitp
 			prevContexts = t1.mqc.GetContexts()
 		}
 
+		lastPassType, lastBitplane = passType, t1.bitplane
 		passIdx++
 		if passType == 2 {
 			passType = 0
@@ -189,6 +213,10 @@ func (t1 *Decoder) DecodeLayeredWithMode(data []byte, passLengths []int, maxBitp
 		}
 	}
 
+	if truncated {
+		t1.applyTruncationMidpoint(lastPassType, lastBitplane)
+	}
+
 	return nil
 }
 
@@ -205,6 +233,10 @@ func (t1 *Decoder) DecodeWithOptions(data []byte, numPasses int, maxBitplane int
 	}
 
 	t1.roishift = roishift
+	cappedPasses := t1.capPasses(numPasses)
+	truncated := cappedPasses < numPasses
+	numPasses = cappedPasses
+	lastPassType, lastBitplane := -1, -1
 
 	// Initialize MQ decoder with OpenJPEG default context states
 	t1.mqc = mqc.NewMQDecoder(data, NUMCONTEXTS)
@@ -247,6 +279,7 @@ func (t1 *Decoder) DecodeWithOptions(data []byte, numPasses int, maxBitplane int
 				}
 			}
 		}
+		lastPassType, lastBitplane = passType, t1.bitplane
 		passIdx++
 
 		// In TERMALL mode, reinitialize MQC decoder state and reset contexts after each pass
@@ -275,6 +308,10 @@ func (t1 *Decoder) DecodeWithOptions(data []byte, numPasses int, maxBitplane int
 		}
 	}
 
+	if truncated {
+		t1.applyTruncationMidpoint(lastPassType, lastBitplane)
+	}
+
 	return nil
 }
 
@@ -302,6 +339,11 @@ func (t1 *Decoder) Decode(data []byte, numPasses int, roishift int) error {
 	t1.mqc.SetContextState(CTXRL, 3)
 	t1.mqc.SetContextState(CTXZCSTART, 4)
 
+	// The starting bit-plane depends on the full pass count; the preview cap
+	// only limits how many of those passes are decoded.
+	decodePasses := t1.capPasses(numPasses)
+	lastPassType, lastBitplane := -1, -1
+
 	// Determine starting bit-plane from number of passes
 	// OpenJPEG sequencing: numBitplanes = (numPasses + 2) / 3
 	numBitplanes := (numPasses + 2) / 3
@@ -315,7 +357,7 @@ func (t1 *Decoder) Decode(data []byte, numPasses int, roishift int) error {
 	// Decode passes using OpenJPEG sequencing.
 	passIdx := 0
 	passType := 2
-	for t1.bitplane = startBitplane; t1.bitplane >= 0 && passIdx < numPasses; {
+	for t1.bitplane = startBitplane; t1.bitplane >= 0 && passIdx < decodePasses; {
 		startBitplanePass := passType == 0 || (passType == 2 && passIdx == 0)
 		if startBitplanePass {
 			// Clear VISIT flags at start of each bitplane
@@ -347,10 +389,11 @@ func (t1 *Decoder) Decode(data []byte, numPasses int, roishift int) error {
 				}
 			}
 		}
+		lastPassType, lastBitplane = passType, t1.bitplane
 		passIdx++
 
 		// Reset context if required
-		if t1.resetctx && passIdx < numPasses && !raw {
+		if t1.resetctx && passIdx < decodePasses && !raw {
 			t1.mqc.ResetContexts()
 			t1.mqc.SetContextState(CTXUNI, 46)
 			t1.mqc.SetContextState(CTXRL, 3)
@@ -365,9 +408,49 @@ func (t1 *Decoder) Decode(data []byte, numPasses int, roishift int) error {
 		}
 	}
 
+	if decodePasses < numPasses {
+		t1.applyTruncationMidpoint(lastPassType, lastBitplane)
+	}
+
 	return nil
 }
 
+// applyTruncationMidpoint moves every significant coefficient to the
+// mid-point of its uncertainty interval after decoding stopped early.
+// A coefficient is known down to the bit-plane of the last pass that touched
+// it; the undecoded lower bits are replaced by half of that bit-plane.
+// OpenJPEG reconstruction already places values at interval mid-points, so
+// only the plain reconstruction needs the adjustment.
+func (t1 *Decoder) applyTruncationMidpoint(lastPassType, lastBitplane int) {
+	if t1.openJPEGReconstruction || lastPassType < 0 {
+		return
+	}
+	paddedWidth := t1.width + 2
+	for y := 0; y < t1.height; y++ {
+		row := (y + 1) * paddedWidth
+		for x := 0; x < t1.width; x++ {
+			idx := row + x + 1
+			flags := t1.flags[idx]
+			if flags&T1Sig == 0 {
+				continue
+			}
+			known := lastBitplane
+			// After a significance propagation pass only the samples it
+			// visited are known at this bit-plane; older significant samples
+			// still wait for their magnitude refinement.
+			if lastPassType == 0 && flags&T1Visit == 0 {
+				known++
+			}
+			half := (int32(1) << uint(known)) >> 1
+			if t1.data[idx] < 0 {
+				t1.data[idx] -= half
+			} else {
+				t1.data[idx] += half
+			}
+		}
+	}
+}
+
 // GetData returns the decoded coefficients (without padding)
 // Note: Does NOT apply T1_NMSEDEC_FRACBITS inverse scaling - that should be done by the caller (tile decoder)
 func (t1 *Decoder) GetData() []int32 {
@@ -0,0 +1,107 @@
+package t1
+
+import "testing"
+
+func previewTestBlock(width, height int) []int32 {
+	data := make([]int32, width*height)
+	for i := range data {
+		v := int32((i*37+11)%401) - 200
+		data[i] = v
+	}
+	return data
+}
+
+// TestDecoderMaxPassesMidpoint checks that decoding only the leading cleanup
+// passes reconstructs magnitudes at the mid-point of the last decoded plane.
+func TestDecoderMaxPassesMidpoint(t *testing.T) {
+	const width, height = 16, 16
+	data := previewTestBlock(width, height)
+
+	enc := NewT1Encoder(width, height, 0)
+	maxBitplane := CalculateMaxBitplane(data)
+	totalPasses := maxBitplane*3 + 1
+	encoded, err := enc.Encode(data, totalPasses, 0)
+	if err != nil {
+		t.Fatalf("Encode failed: %v", err)
+	}
+
+	for planes := 1; planes <= maxBitplane+1; planes++ {
+		passes := 3*planes - 2
+		lastPlane := maxBitplane - planes + 1
+
+		dec := NewT1Decoder(width, height, 0)
+		dec.SetMaxPasses(passes)
+		if err := dec.DecodeWithBitplane(encoded, totalPasses, maxBitplane, 0); err != nil {
+			t.Fatalf("planes=%d: decode failed: %v", planes, err)
+		}
+		decoded := dec.GetData()
+
+		threshold := int32(1) << uint(lastPlane)
+		for i, want := range data {
+			got := decoded[i]
+			mag := want
+			if mag < 0 {
+				mag = -mag
+			}
+			if mag < threshold {
+				if got != 0 {
+					t.Fatalf("planes=%d idx=%d: got %d, want 0 below plane %d", planes, i, got, lastPlane)
+				}
+				continue
+			}
+			diff := got - want
+			if diff < 0 {
+				diff = -diff
+			}
+			if diff > threshold/2 {
+				t.Fatalf("planes=%d idx=%d: got %d, want %d (+/-%d)", planes, i, got, want, threshold/2)
+			}
+		}
+	}
+}
+
+// TestDecoderMaxPassesBeyondTotalIsExact verifies a cap above the pass count
+// leaves lossless decoding untouched, including mid-bitplane caps.
+func TestDecoderMaxPassesBeyondTotalIsExact(t *testing.T) {
+	const width, height = 8, 8
+	data := previewTestBlock(width, height)
+
+	enc := NewT1Encoder(width, height, 0)
+	maxBitplane := CalculateMaxBitplane(data)
+	totalPasses := maxBitplane*3 + 1
+	encoded, err := enc.Encode(data, totalPasses, 0)
+	if err != nil {
+		t.Fatalf("Encode failed: %v", err)
+	}
+
+	dec := NewT1Decoder(width, height, 0)
+	dec.SetMaxPasses(totalPasses + 5)
+	if err := dec.DecodeWithBitplane(encoded, totalPasses, maxBitplane, 0); err != nil {
+		t.Fatalf("decode failed: %v", err)
+	}
+	for i, got := range dec.GetData() {
+		if got != data[i] {
+			t.Fatalf("idx=%d: got %d, want %d", i, got, data[i])
+		}
+	}
+
+	// Caps ending on SPP or MRP passes must stay within one bit-plane.
+	for _, passes := range []int{2, 3, 5, 6} {
+		dec := NewT1Decoder(width, height, 0)
+		dec.SetMaxPasses(passes)
+		if err := dec.DecodeWithBitplane(encoded, totalPasses, maxBitplane, 0); err != nil {
+			t.Fatalf("passes=%d: decode failed: %v", passes, err)
+		}
+		plane := maxBitplane - (passes+1)/3
+		bound := int32(1) << uint(plane+1)
+		for i, got := range dec.GetData() {
+			diff := got - data[i]
+			if diff < 0 {
+				diff = -diff
+			}
+			if diff >= bound {
+				t.Fatalf("passes=%d idx=%d: got %d, want %d (bound %d)", passes, i, got, data[i], bound)
+			}
+		}
+	}
+}
@@ -25,6 +25,9 @@ type Encoder struct {
 	// MQ encoder
 	mqe *mqc.MQEncoder
 
+	// Optional shared output buffer (see SetOutputArena)
+	arena *[]byte
+
 	// Current bit-plane being encoded
 	bitplane int
 
@@ -38,6 +41,7 @@ type Encoder struct {
 	termall            bool // Terminate all passes
 	segmentation       bool // Use segmentation symbols
 	nmseDecFracBits    int  // Number of T1_NMSEDEC_FRACBITS already present in data
+	trackDistortion    bool // Accumulate per-pass nmsedec (layered encoding only)
 	distortionWeight   float64
 	openJPEGDistortion struct {
 		enabled  bool
@@ -104,6 +108,39 @@ func (t1 *Encoder) SetOrientation(orient int) {
 	t1.orientation = orient
 }
 
+// SetOutputArena makes the encoder append its MQ output to *arena instead of
+// a private buffer. The returned streams are sub-slices of the arena, and
+// *arena is advanced past each one, so a tile's code-blocks share one
+// growable allocation.
+func (t1 *Encoder) SetOutputArena(arena *[]byte) {
+	t1.arena = arena
+}
+
+// emptyBlockData is the stream Encode produces for an all-zero code-block:
+// a flushed MQ encoder that coded no symbols.
+var emptyBlockData = mqc.NewMQEncoder(NUMCONTEXTS).Flush()
+
+// EmptyBlockData returns a copy of the stream Encode produces for an all-zero
+// code-block, so callers can skip creating an encoder for one.
+func EmptyBlockData() []byte {
+	return append([]byte(nil), emptyBlockData...)
+}
+
+// newMQEncoder returns an MQ encoder writing into the arena when one is set.
+func (t1 *Encoder) newMQEncoder() *mqc.MQEncoder {
+	if t1.arena != nil {
+		return mqc.NewMQEncoderAppend(*t1.arena, NUMCONTEXTS)
+	}
+	return mqc.NewMQEncoder(NUMCONTEXTS)
+}
+
+// releaseArena hands the grown arena back to its owner after a flush.
+func (t1 *Encoder) releaseArena() {
+	if t1.arena != nil {
+		*t1.arena = t1.mqe.Bytes()
+	}
+}
+
 // SetNMSEDecFractionalBits records how many OpenJPEG fractional NMSE bits are
 // already present in the coefficient data supplied to the encoder.
 func (t1 *Encoder) SetNMSEDecFractionalBits(bits int) {
@@ -156,6 +193,7 @@ func (t1 *Encoder) SetOpenJPEGDistortionParameters(mctNorm, dwtNorm, stepSize fl
 // - Context modeling using 8-neighbor flags (cached for speed)
 // - MQ encoding is the inner loop bottleneck
 // - Typical workload: 32x32 block = 1024 coefficients × 12-16 bit-planes
+// - No per-pass nmsedec is accumulated; only EncodeLayered needs distortion
 func (t1 *Encoder) Encode(data []int32, numPasses int, roishift int) ([]byte, error) {
 	if len(data) != t1.width*t1.height {
 		return nil, fmt.Errorf("data size mismatch: expected %d, got %d",
@@ -163,6 +201,7 @@ func (t1 *Encoder) Encode(data []int32, numPasses int, roishift int) ([]byte, er
 	}
 
 	t1.roishift = roishift
+	t1.trackDistortion = false
 
 	// Copy data with padding
 	t1.data = make([]int32, (t1.width+2)*(t1.height+2))
@@ -179,8 +218,10 @@ func (t1 *Encoder) Encode(data []int32, numPasses int, roishift int) ([]byte, er
 
 	if maxBitplane < 0 {
 		// Preserve the single-layer encoder's established empty-block stream.
-		t1.mqe = mqc.NewMQEncoder(NUMCONTEXTS)
-		return t1.mqe.Flush(), nil
+		t1.mqe = t1.newMQEncoder()
+		result := t1.mqe.Flush()
+		t1.releaseArena()
+		return result, nil
 	}
 	if maxBitplane < t1.nmseDecFracBits {
 		// OpenJPEG stores T1 coefficients with NMSEDEC fractional bits. A block
@@ -189,7 +230,7 @@ func (t1 *Encoder) Encode(data []int32, numPasses int, roishift int) ([]byte, er
 	}
 
 	// Initialize MQ encoder with OpenJPEG default context states
-	t1.mqe = mqc.NewMQEncoder(NUMCONTEXTS)
+	t1.mqe = t1.newMQEncoder()
 	t1.mqe.SetContextState(CTXUNI, 46)
 	t1.mqe.SetContextState(CTXRL, 3)
 	t1.mqe.SetContextState(CTXZCSTART, 4)
@@ -275,6 +316,7 @@ func (t1 *Encoder) Encode(data []int32, numPasses int, roishift int) ([]byte, er
 	} else {
 		result = t1.mqe.Flush()
 	}
+	t1.releaseArena()
 
 	return result, nil
 }
@@ -354,7 +396,9 @@ func (t1 *Encoder) encodeSigPropPass(raw bool) int {
 				t1.flags[idx] |= T1Visit
 
 				if isSig != 0 {
-					nmsedec += t1.getNMSEDecSig(absVal)
+					if t1.trackDistortion {
+						nmsedec += t1.getNMSEDecSig(absVal)
+					}
 
 					// Coefficient becomes significant
 					// Encode sign bit with prediction
@@ -415,7 +459,9 @@ func (t1 *Encoder) encodeMagRefPass(raw bool) int {
 
 				// Encode refinement bit
 				ctx := getMagRefinementContext(flags)
-				nmsedec += t1.getNMSEDecRef(absVal)
+				if t1.trackDistortion {
+					nmsedec += t1.getNMSEDecRef(absVal)
+				}
 				if raw {
 					t1.mqe.BypassEncode(int(refBit))
 				} else {
@@ -524,11 +570,13 @@ func (t1 *Encoder) encodeCleanupPass() int {
 						}
 
 						if isSig != 0 {
-							absVal := t1.data[idx]
-							if absVal < 0 {
-								absVal = -absVal
+							if t1.trackDistortion {
+								absVal := t1.data[idx]
+								if absVal < 0 {
+									absVal = -absVal
+								}
+								nmsedec += t1.getNMSEDecSig(absVal)
 							}
-							nmsedec += t1.getNMSEDecSig(absVal)
 
 							// Encode sign bit with prediction (same as OpenJPEG clnpass)
 							signBit := 0
@@ -579,7 +627,9 @@ func (t1 *Encoder) encodeCleanupPass() int {
 				t1.mqe.Encode(isSig, int(ctx))
 
 				if isSig != 0 {
-					nmsedec += t1.getNMSEDecSig(absVal)
+					if t1.trackDistortion {
+						nmsedec += t1.getNMSEDecSig(absVal)
+					}
 
 					// Encode sign bit with prediction (same as OpenJPEG clnpass)
 					signBit := 0
@@ -0,0 +1,55 @@
+package t1
+
+import (
+	"bytes"
+	"testing"
+)
+
+// TestEncodeOutputArena checks that blocks coded into a shared arena match
+// privately buffered output and are sub-slices of the arena.
+func TestEncodeOutputArena(t *testing.T) {
+	const width, height = 16, 16
+	blocks := [][]int32{
+		previewTestBlock(width, height),
+		make([]int32, width*height),
+		previewTestBlock(width, height)[:width*height],
+	}
+	for i := range blocks[2] {
+		blocks[2][i] = blocks[2][i]*3 + 1
+	}
+
+	// Stale bytes in reused capacity must not leak into the coded streams.
+	arena := bytes.Repeat([]byte{0xFF}, 64)[:0]
+	var got [][]byte
+	for i, data := range blocks {
+		numPasses := CalculateMaxBitplane(data)*3 + 1
+
+		want, err := NewT1Encoder(width, height, 0).Encode(data, numPasses, 0)
+		if err != nil {
+			t.Fatalf("block %d: private encode failed: %v", i, err)
+		}
+
+		enc := NewT1Encoder(width, height, 0)
+		enc.SetOutputArena(&arena)
+		out, err := enc.Encode(data, numPasses, 0)
+		if err != nil {
+			t.Fatalf("block %d: arena encode failed: %v", i, err)
+		}
+		if !bytes.Equal(out, want) {
+			t.Fatalf("block %d: arena output differs from private output", i)
+		}
+		if len(out) > 0 && &arena[len(arena)-len(out)] != &out[0] {
+			t.Fatalf("block %d: output is not the tail of the arena", i)
+		}
+		got = append(got, out)
+	}
+
+	// Earlier streams stay intact while later blocks grow the arena.
+	for i, data := range blocks {
+		numPasses := CalculateMaxBitplane(data)*3 + 1
+		want, _ := NewT1Encoder(width, height, 0).Encode(data, numPasses, 0)
+		if !bytes.Equal(got[i], want) {
+			t.Fatalf("block %d: stream changed after later blocks were coded", i)
+		}
+	}
+}
@@ -0,0 +1,39 @@
+package t1
+
+import (
+	"bytes"
+	"testing"
+)
+
+// TestEncodeNativeMagnitudesMatchFractionalBits checks that coding native
+// integer magnitudes produces the same bytes as coding them with the
+// OpenJPEG NMSEDEC fractional bits, which the lossless fast path relies on.
+func TestEncodeNativeMagnitudesMatchFractionalBits(t *testing.T) {
+	for _, size := range [][2]int{{8, 8}, {16, 16}, {13, 7}, {32, 32}} {
+		width, height := size[0], size[1]
+		data := make([]int32, width*height)
+		for i := range data {
+			data[i] = int32((i*131+17)%511) - 255
+		}
+		numPasses := CalculateMaxBitplane(data)*3 + 1
+
+		native, err := NewT1Encoder(width, height, 0).Encode(data, numPasses, 0)
+		if err != nil {
+			t.Fatalf("%dx%d: native encode failed: %v", width, height, err)
+		}
+
+		scaled := make([]int32, len(data))
+		for i, v := range data {
+			scaled[i] = v << t1NMSEDecFracBits
+		}
+		enc := NewT1Encoder(width, height, 0)
+		enc.SetNMSEDecFractionalBits(t1NMSEDecFracBits)
+		want, err := enc.Encode(scaled, numPasses, 0)
+		if err != nil {
+			t.Fatalf("%dx%d: scaled encode failed: %v", width, height, err)
+		}
+		if !bytes.Equal(native, want) {
+			t.Fatalf("%dx%d: native magnitudes coded %d bytes, fractional bits %d bytes", width, height, len(native), len(want))
+		}
+	}
+}
@@ -1,10 +1,6 @@
 package t1
 
-import (
-	"fmt"
-
-	"github.com/cocosip/go-dicom-codecs/jpeg2000/mqc"
-)
+import "fmt"
 
 // PassData represents encoded data for a single coding pass
 // Following OpenJPEG's design: rate is cumulative bytes, len is incremental
@@ -42,6 +38,7 @@ func (t1 *Encoder) EncodeLayered(data []int32, numPasses int, roishift int, _ []
 
 	t1.cblkstyle = int(cblksty)
 	t1.roishift = roishift
+	t1.trackDistortion = true
 
 	// Copy data with padding
 	t1.data = make([]int32, (t1.width+2)*(t1.height+2))
@@ -60,7 +57,7 @@ func (t1 *Encoder) EncodeLayered(data []int32, numPasses int, roishift int, _ []
 	}
 
 	// Initialize MQ encoder
-	t1.mqe = mqc.NewMQEncoder(NUMCONTEXTS)
+	t1.mqe = t1.newMQEncoder()
 
 	// Set initial context states (match OpenJPEG's opj_mqc_setstate calls)
 	// These initial states optimize encoding by providing better probability estimates
@@ -186,6 +183,7 @@ func (t1 *Encoder) EncodeLayered(data []int32, numPasses int, roishift int, _ []
 	} else {
 		fullMQData = t1.mqe.Flush()
 	}
+	t1.releaseArena()
 
 	normalizePassRates(passes, fullMQData)
 
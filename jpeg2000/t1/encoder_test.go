@@ -1,6 +1,7 @@
 package t1
 
 import (
+	"bytes"
 	"testing"
 )
 
@@ -217,3 +218,21 @@ func makeTestData(width, height int, values []int32) []int32 {
 func makeZeroData(width, height int) []int32 {
 	return make([]int32, width*height)
 }
+
+// TestEmptyBlockData checks that EmptyBlockData is the stream Encode
+// produces for all-zero code-blocks.
+func TestEmptyBlockData(t *testing.T) {
+	for _, size := range [][2]int{{4, 4}, {64, 64}, {32, 8}, {1, 1}} {
+		for _, fracBits := range []int{0, 6} {
+			enc := NewT1Encoder(size[0], size[1], 0)
+			enc.SetNMSEDecFractionalBits(fracBits)
+			got, err := enc.Encode(make([]int32, size[0]*size[1]), 1, 0)
+			if err != nil {
+				t.Fatalf("%dx%d: Encode failed: %v", size[0], size[1], err)
+			}
+			if !bytes.Equal(got, EmptyBlockData()) {
+				t.Errorf("%dx%d fracBits %d: Encode = %x, EmptyBlockData = %x", size[0], size[1], fracBits, got, EmptyBlockData())
+			}
+		}
+	}
+}
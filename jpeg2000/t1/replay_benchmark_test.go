@@ -0,0 +1,68 @@
+package t1
+
+import (
+	"testing"
+
+	"github.com/cocosip/go-dicom-codecs/internal/replay"
+)
+
+// t1Replay is one recorded EBCOT code-block; see cmd/replay-record.
+type t1Replay struct {
+	width, height, orientation int
+	numPasses, maxBitplane     int
+	checksum                   int64
+	data                       []byte
+}
+
+func loadT1Replay(tb testing.TB) []t1Replay {
+	tb.Helper()
+	records, err := replay.Read("testdata/replay/t1.gz")
+	if err != nil {
+		tb.Fatalf("load corpus: %v", err)
+	}
+	blocks := make([]t1Replay, len(records))
+	for i, r := range records {
+		p := r.Params
+		blocks[i] = t1Replay{int(p[0]), int(p[1]), int(p[2]), int(p[3]), int(p[4]), p[5], r.Data}
+	}
+	return blocks
+}
+
+func TestReplayCorpus(t *testing.T) {
+	for i, cb := range loadT1Replay(t) {
+		dec := NewT1Decoder(cb.width, cb.height, 0)
+		dec.SetOrientation(cb.orientation)
+		if err := dec.DecodeWithBitplane(cb.data, cb.numPasses, cb.maxBitplane, 0); err != nil {
+			t.Fatalf("code-block %d: %v", i, err)
+		}
+		if replay.Checksum(dec.GetData()) != cb.checksum {
+			t.Fatalf("code-block %d (%dx%d, orientation %d): coefficients differ from the recording", i, cb.width, cb.height, cb.orientation)
+		}
+	}
+}
+
+// BenchmarkReplayT1Decode runs all coding passes of code-blocks recorded from
+// the 5/3 wavelet bands of real CT, MR and XR images; throughput is in
+// code-block bytes.
+func BenchmarkReplayT1Decode(b *testing.B) {
+	blocks := loadT1Replay(b)
+	decoders := make([]*Decoder, len(blocks))
+	var total, coefficients int
+	for i, cb := range blocks {
+		decoders[i] = NewT1Decoder(cb.width, cb.height, 0)
+		decoders[i].SetOrientation(cb.orientation)
+		total += len(cb.data)
+		coefficients += cb.width * cb.height
+	}
+	b.SetBytes(int64(total))
+	b.ReportAllocs()
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		for j, cb := range blocks {
+			if err := decoders[j].DecodeWithBitplane(cb.data, cb.numPasses, cb.maxBitplane, 0); err != nil {
+				b.Fatal(err)
+			}
+		}
+	}
+	b.ReportMetric(float64(b.Elapsed().Nanoseconds())/float64(b.N*coefficients), "ns/coefficient")
+}
@@ -274,130 +274,152 @@ func (pd *PacketDecoder) decodeComplete(pkts []Packet, err error) ([]Packet, err
 
 // decodeLRCP decodes packets in Layer-Resolution-Component-Position order
 func (pd *PacketDecoder) decodeLRCP() ([]Packet, error) {
-	for layer := 0; layer < pd.numLayers; layer++ {
-		for res := 0; res < pd.numResolutions; res++ {
-			for comp := 0; comp < pd.numComponents; comp++ {
-				precincts := pd.precinctIndicesForResolution(comp, res)
-				for _, precinctIdx := range precincts {
-					packet, err := pd.decodePacket(layer, res, comp, precinctIdx)
-					if err != nil {
-						return nil, fmt.Errorf("failed to decode packet (L=%d,R=%d,C=%d,P=%d): %w",
-							layer, res, comp, precinctIdx, err)
-					}
-					pd.packets = append(pd.packets, packet)
-				}
-			}
-		}
-	}
-
-	return pd.packets, nil
+	return pd.decodeInOrder(ProgressionLRCP)
 }
 
 // decodeRLCP decodes packets in Resolution-Layer-Component-Position order
 func (pd *PacketDecoder) decodeRLCP() ([]Packet, error) {
-	for res := 0; res < pd.numResolutions; res++ {
-		for layer := 0; layer < pd.numLayers; layer++ {
-			for comp := 0; comp < pd.numComponents; comp++ {
-				precincts := pd.precinctIndicesForResolution(comp, res)
-				for _, precinctIdx := range precincts {
-					packet, err := pd.decodePacket(layer, res, comp, precinctIdx)
-					if err != nil {
-						return nil, fmt.Errorf("failed to decode packet (R=%d,L=%d,C=%d,P=%d): %w",
-							res, layer, comp, precinctIdx, err)
-					}
-					pd.packets = append(pd.packets, packet)
-				}
-			}
-		}
-	}
-
-	return pd.packets, nil
+	return pd.decodeInOrder(ProgressionRLCP)
 }
 
 // decodeRPCL decodes packets in Resolution-Position-Component-Layer order
 func (pd *PacketDecoder) decodeRPCL() ([]Packet, error) {
-	posMaps := pd.buildPositionMaps()
-	for res := 0; res < pd.numResolutions; res++ {
-		positions := posMaps.byRes[res]
-		for _, pos := range positions {
-			for comp := 0; comp < pd.numComponents; comp++ {
-				resMap := posMaps.byCompRes[comp][res]
-				if resMap == nil {
-					continue
-				}
-				precinctIdx, ok := resMap[pos]
-				if !ok {
-					continue
-				}
-				for layer := 0; layer < pd.numLayers; layer++ {
-					packet, err := pd.decodePacket(layer, res, comp, precinctIdx)
-					if err != nil {
-						return nil, fmt.Errorf("failed to decode packet (R=%d,P=%d,C=%d,L=%d): %w",
-							res, precinctIdx, comp, layer, err)
-					}
-					pd.packets = append(pd.packets, packet)
-				}
-			}
+	return pd.decodeInOrder(ProgressionRPCL)
+}
+
+// decodePCRL decodes packets in Position-Component-Resolution-Layer order
+func (pd *PacketDecoder) decodePCRL() ([]Packet, error) {
+	return pd.decodeInOrder(ProgressionPCRL)
+}
+
+// decodeCPRL decodes packets in Component-Position-Resolution-Layer order
+func (pd *PacketDecoder) decodeCPRL() ([]Packet, error) {
+	return pd.decodeInOrder(ProgressionCPRL)
+}
+
+// decodeInOrder decodes every packet of the tile in the given progression order.
+func (pd *PacketDecoder) decodeInOrder(progression ProgressionOrder) ([]Packet, error) {
+	err := pd.visitPackets(progression, func(layer, res, comp, precinctIdx int) error {
+		packet, err := pd.decodePacket(layer, res, comp, precinctIdx)
+		if err != nil {
+			return fmt.Errorf("failed to decode packet (L=%d,R=%d,C=%d,P=%d): %w",
+				layer, res, comp, precinctIdx, err)
 		}
+		pd.packets = append(pd.packets, packet)
+		return nil
+	})
+	if err != nil {
+		return nil, err
 	}
 	return pd.packets, nil
 }
 
-// decodePCRL decodes packets in Position-Component-Resolution-Layer order
-func (pd *PacketDecoder) decodePCRL() ([]Packet, error) {
-	posMaps := pd.buildPositionMaps()
-	for _, pos := range posMaps.all {
-		for comp := 0; comp < pd.numComponents; comp++ {
+// visitPackets calls visit for every (layer, resolution, component, precinct)
+// of the tile in the given progression order. buildPrecinctOrder must have run.
+func (pd *PacketDecoder) visitPackets(progression ProgressionOrder, visit func(layer, res, comp, precinctIdx int) error) error {
+	switch progression {
+	case ProgressionLRCP:
+		for layer := 0; layer < pd.numLayers; layer++ {
 			for res := 0; res < pd.numResolutions; res++ {
-				resMap := posMaps.byCompRes[comp][res]
-				if resMap == nil {
-					continue
+				if err := pd.visitComponentPrecincts(layer, res, visit); err != nil {
+					return err
+				}
+			}
+		}
+	case ProgressionRLCP:
+		for res := 0; res < pd.numResolutions; res++ {
+			for layer := 0; layer < pd.numLayers; layer++ {
+				if err := pd.visitComponentPrecincts(layer, res, visit); err != nil {
+					return err
+				}
+			}
+		}
+	case ProgressionRPCL:
+		posMaps := pd.buildPositionMaps()
+		for res := 0; res < pd.numResolutions; res++ {
+			for _, pos := range posMaps.byRes[res] {
+				for comp := 0; comp < pd.numComponents; comp++ {
+					if err := pd.visitLayers(posMaps, pos, res, comp, visit); err != nil {
+						return err
+					}
 				}
-				precinctIdx, ok := resMap[pos]
-				if !ok {
-					continue
+			}
+		}
+	case ProgressionPCRL:
+		posMaps := pd.buildPositionMaps()
+		for _, pos := range posMaps.all {
+			for comp := 0; comp < pd.numComponents; comp++ {
+				for res := 0; res < pd.numResolutions; res++ {
+					if err := pd.visitLayers(posMaps, pos, res, comp, visit); err != nil {
+						return err
+					}
 				}
-				for layer := 0; layer < pd.numLayers; layer++ {
-					packet, err := pd.decodePacket(layer, res, comp, precinctIdx)
-					if err != nil {
-						return nil, fmt.Errorf("failed to decode packet (P=%d,C=%d,R=%d,L=%d): %w",
-							precinctIdx, comp, res, layer, err)
+			}
+		}
+	case ProgressionCPRL:
+		posMaps := pd.buildPositionMaps()
+		for comp := 0; comp < pd.numComponents; comp++ {
+			for _, pos := range posMaps.byComp[comp] {
+				for res := 0; res < pd.numResolutions; res++ {
+					if err := pd.visitLayers(posMaps, pos, res, comp, visit); err != nil {
+						return err
 					}
-					pd.packets = append(pd.packets, packet)
 				}
 			}
 		}
+	default:
+		return fmt.Errorf("unsupported progression order: %v", progression)
 	}
-	return pd.packets, nil
+	return nil
 }
 
-// decodeCPRL decodes packets in Component-Position-Resolution-Layer order
-func (pd *PacketDecoder) decodeCPRL() ([]Packet, error) {
-	posMaps := pd.buildPositionMaps()
+// visitComponentPrecincts visits the packets of one layer and resolution for
+// every component and precinct (the innermost CP of LRCP and RLCP).
+func (pd *PacketDecoder) visitComponentPrecincts(layer, res int, visit func(layer, res, comp, precinctIdx int) error) error {
 	for comp := 0; comp < pd.numComponents; comp++ {
-		positions := posMaps.byComp[comp]
-		for _, pos := range positions {
-			for res := 0; res < pd.numResolutions; res++ {
-				resMap := posMaps.byCompRes[comp][res]
-				if resMap == nil {
-					continue
-				}
-				precinctIdx, ok := resMap[pos]
-				if !ok {
-					continue
-				}
-				for layer := 0; layer < pd.numLayers; layer++ {
-					packet, err := pd.decodePacket(layer, res, comp, precinctIdx)
-					if err != nil {
-						return nil, fmt.Errorf("failed to decode packet (C=%d,P=%d,R=%d,L=%d): %w",
-							comp, precinctIdx, res, layer, err)
-					}
-					pd.packets = append(pd.packets, packet)
-				}
+		for _, precinctIdx := range pd.precinctIndicesForResolution(comp, res) {
+			if err := visit(layer, res, comp, precinctIdx); err != nil {
+				return err
 			}
 		}
 	}
-	return pd.packets, nil
+	return nil
+}
+
+// visitLayers visits every layer of the precinct at pos, if the component has
+// one there (the innermost L of the position-driven orders).
+func (pd *PacketDecoder) visitLayers(posMaps *positionMaps, pos positionKey, res, comp int, visit func(layer, res, comp, precinctIdx int) error) error {
+	resMap := posMaps.byCompRes[comp][res]
+	if resMap == nil {
+		return nil
+	}
+	precinctIdx, ok := resMap[pos]
+	if !ok {
+		return nil
+	}
+	for layer := 0; layer < pd.numLayers; layer++ {
+		if err := visit(layer, res, comp, precinctIdx); err != nil {
+			return err
+		}
+	}
+	return nil
+}
+
+// PacketOrder returns the packets' (layer, resolution, component, precinct)
+// coordinates in the given progression order, without reading packet data.
+func (pd *PacketDecoder) PacketOrder(progression ProgressionOrder) ([]Packet, error) {
+	pd.buildPrecinctOrder()
+	var order []Packet
+	err := pd.visitPackets(progression, func(layer, res, comp, precinctIdx int) error {
+		order = append(order, Packet{
+			LayerIndex:      layer,
+			ResolutionLevel: res,
+			ComponentIndex:  comp,
+			PrecinctIndex:   precinctIdx,
+		})
+		return nil
+	})
+	return order, err
 }
 
 // decodePacket decodes a single packet
@@ -412,8 +434,10 @@ func (pd *PacketDecoder) decodePacket(layer, resolution, component, precinctIdx
 	// Check if we've reached end of data
 	if pd.offset >= len(pd.data) {
 		packet.HeaderPresent = false
+		packet.Offset = len(pd.data)
 		return packet, nil
 	}
+	packet.Offset = pd.offset
 
 	bands := pd.bandsForResolution(resolution)
 	bandStates := make([]*packetHeaderBand, 0, len(bands))
@@ -453,6 +477,7 @@ func (pd *PacketDecoder) decodePacket(layer, resolution, component, precinctIdx
 	packet.HeaderPresent = headerPresent
 	if !packet.HeaderPresent {
 		pd.offset += bytesRead
+		packet.Length = pd.offset - packet.Offset
 		return packet, nil
 	}
 
@@ -547,6 +572,7 @@ func (pd *PacketDecoder) decodePacket(layer, resolution, component, precinctIdx
 	}
 	packet.Body = body.Bytes()
 	packet.PartialBuffer = partialBuffer
+	packet.Length = pd.offset - packet.Offset
 
 	return packet, nil
 }
@@ -659,8 +685,10 @@ func (pd *PacketDecoder) collectCodeBlockEntries(bands []bandInfo, cbw, cbh, res
 				px := (absResX0 - startX) / pw
 				py := (absResY0 - startY) / ph
 				pIdx := py*numPrecinctX + px
-				localX := absResX0 - (startX + px*pw)
-				localY := absResY0 - (startY + py*ph)
+				// Code-block indices inside a precinct start at the first code-block of
+				// the precinct clipped to the tile-resolution (non-zero tile origins).
+				localX := absResX0 - max(startX+px*pw, resX0)
+				localY := absResY0 - max(startY+py*ph, resY0)
 				cbxLocal := localX / cbw
 				cbyLocal := localY / cbh
 
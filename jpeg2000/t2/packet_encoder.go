@@ -457,15 +457,29 @@ func (pe *PacketEncoder) encodePacket(layer, resolution, component, precinctIdx
 	packet.CodeBlockIncls = cbIncls
 	packet.HeaderPresent = len(header) > 0
 
-	// Encode packet body (code-block contributions for this layer)
-	body := &bytes.Buffer{}
+	// Encode packet body (code-block contributions for this layer). A single
+	// contribution is referenced in place; otherwise the body is sized once.
+	var single []byte
+	bodyLen, parts := 0, 0
 	for i := range cbIncls {
-		cbIncl := &cbIncls[i]
-		if cbIncl.Included {
-			body.Write(cbIncl.Data)
+		if cbIncls[i].Included && len(cbIncls[i].Data) > 0 {
+			single = cbIncls[i].Data
+			bodyLen += len(single)
+			parts++
 		}
 	}
-	packet.Body = body.Bytes()
+	switch {
+	case parts == 1:
+		packet.Body = single[:len(single):len(single)]
+	case parts > 1:
+		body := make([]byte, 0, bodyLen)
+		for i := range cbIncls {
+			if cbIncls[i].Included {
+				body = append(body, cbIncls[i].Data...)
+			}
+		}
+		packet.Body = body
+	}
 
 	return packet, nil
 }
@@ -5,6 +5,8 @@ import (
 	"math"
 	"sort"
 
+	"github.com/cocosip/go-dicom-codecs/codec/limits"
+	"github.com/cocosip/go-dicom-codecs/jpeg2000/arena"
 	"github.com/cocosip/go-dicom-codecs/jpeg2000/codestream"
 	"github.com/cocosip/go-dicom-codecs/jpeg2000/t1"
 	"github.com/cocosip/go-dicom-codecs/jpeg2000/wavelet"
@@ -51,6 +53,20 @@ type TileDecoder struct {
 	// Error resilience
 	resilient bool // Enable error resilience mode
 	strict    bool // Strict mode: fail on any error
+
+	// Preview decoding: cap on coding passes per code-block (0 = all)
+	maxPasses int
+
+	// Reduced-resolution decoding: number of highest resolution levels discarded
+	reduce int
+
+	// Coding passes the packet headers may signal (<0 = unlimited), and the
+	// number they signalled in the last Decode
+	passLimit    int64
+	codingPasses int64
+
+	// Scratch allocator for the tile's transient buffers (nil = make)
+	arena *arena.Arena
 }
 
 // ComponentDecoder decodes a single component within a tile
@@ -102,7 +118,7 @@ type CodeBlockDecoder struct {
 	data      []byte // Compressed data
 	numPasses int
 	t1Decoder BlockDecoder // Can be EBCOT T1 or HTJ2K decoder
-	coeffs    []int32      // Decoded coefficients
+	coeffs    []int32      // Decoded coefficients; nil for a code-block that is all zero
 }
 
 // cbInfo holds per-code-block accumulation state from packets.
@@ -307,6 +323,7 @@ func NewTileDecoder(
 		tileY1:              tileY1,
 		resilient:           false,
 		strict:              false,
+		passLimit:           -1,
 	}
 
 	return td
@@ -325,9 +342,148 @@ func (td *TileDecoder) SetStrict(strict bool) {
 	}
 }
 
+// SetMaxPasses caps the number of coding passes decoded per code-block.
+// Block decoders that do not support a cap (e.g. HTJ2K) decode all passes.
+func (td *TileDecoder) SetMaxPasses(n int) {
+	if n < 0 {
+		n = 0
+	}
+	td.maxPasses = n
+}
+
+// SetReduce discards the n highest resolution levels: their code-blocks are
+// not decoded and the IDWT stops early, so each component is returned at
+// ceil(size/2^n). n is clamped to the number of decomposition levels.
+func (td *TileDecoder) SetReduce(n int) {
+	if n < 0 {
+		n = 0
+	}
+	td.reduce = n
+}
+
+// SetCodingPassLimit makes Decode fail with limits.ErrExceeded, before any
+// code-block is decoded, when the tile's packet headers signal more than n
+// coding passes in total. n < 0 removes the limit (default).
+func (td *TileDecoder) SetCodingPassLimit(n int64) {
+	td.passLimit = n
+}
+
+// CodingPasses returns the number of coding passes signalled by the packet
+// headers of the last Decode.
+func (td *TileDecoder) CodingPasses() int64 {
+	return td.codingPasses
+}
+
+// SetArena makes Decode carve its code-block data, coefficient planes and
+// IDWT buffers from a. The component planes returned by Decode are then
+// owned by a and must be consumed before a is Reset.
+func (td *TileDecoder) SetArena(a *arena.Arena) {
+	td.arena = a
+}
+
+// reduceLevels returns the effective reduction for a component.
+func (td *TileDecoder) reduceLevels(comp *ComponentDecoder) int {
+	return min(td.reduce, comp.numLevels)
+}
+
+// Packets parses the tile's packet headers in progression order without
+// decoding any code-block. Each packet records its byte range in the tile
+// data, so callers can copy or drop whole packets.
+func (td *TileDecoder) Packets() ([]Packet, error) {
+	td.initComponents()
+	packets, err := td.newPacketDecoder().DecodePackets()
+	if err != nil {
+		return nil, fmt.Errorf("failed to decode packets: %w", err)
+	}
+	return packets, nil
+}
+
+// ReorderPackets returns packets, as returned by Packets, rearranged into the
+// given progression order. Packet contents are not copied; each packet's
+// header state depends only on earlier layers of its own precinct, which every
+// progression order visits first, so the packets stay valid verbatim.
+func (td *TileDecoder) ReorderPackets(packets []Packet, progression ProgressionOrder) ([]Packet, error) {
+	type packetKey struct{ layer, res, comp, precinct int }
+	byKey := make(map[packetKey]int, len(packets))
+	for i, p := range packets {
+		byKey[packetKey{p.LayerIndex, p.ResolutionLevel, p.ComponentIndex, p.PrecinctIndex}] = i
+	}
+	td.initComponents()
+	order, err := td.newPacketDecoder().PacketOrder(progression)
+	if err != nil {
+		return nil, err
+	}
+	reordered := make([]Packet, 0, len(order))
+	for _, o := range order {
+		i, ok := byKey[packetKey{o.LayerIndex, o.ResolutionLevel, o.ComponentIndex, o.PrecinctIndex}]
+		if !ok {
+			return nil, fmt.Errorf("packet (L=%d,R=%d,C=%d,P=%d) not found",
+				o.LayerIndex, o.ResolutionLevel, o.ComponentIndex, o.PrecinctIndex)
+		}
+		reordered = append(reordered, packets[i])
+	}
+	return reordered, nil
+}
+
 // Decode decodes the tile and returns the pixel data for each component
 func (td *TileDecoder) Decode() ([][]int32, error) {
-	// Initialize component decoders
+	numComponents := int(td.siz.Csiz)
+	td.initComponents()
+
+	// Parse packets ONCE for all components
+	packets, err := td.newPacketDecoder().DecodePackets()
+	if err != nil {
+		return nil, fmt.Errorf("failed to decode packets: %w", err)
+	}
+	td.codingPasses = 0
+	for i := range packets {
+		for _, cb := range packets[i].CodeBlockIncls {
+			td.codingPasses += int64(cb.NumPasses)
+		}
+	}
+	if td.passLimit >= 0 && td.codingPasses > td.passLimit {
+		return nil, fmt.Errorf("%w: tile %d signals %d coding passes, %d allowed", limits.ErrExceeded, td.tile.Index, td.codingPasses, td.passLimit)
+	}
+
+	td.decodeAllCodeBlocks(packets)
+
+	// Process each component
+	for i := 0; i < numComponents; i++ {
+		comp := td.components[i]
+
+		if value, ok := td.constantComponent(comp); ok {
+			// Blank or uniform tile-component: fill it instead of
+			// assembling the subbands and running the inverse transform.
+			comp.samples = td.arena.Int32s(comp.width * comp.height)
+			if value != 0 {
+				for j := range comp.samples {
+					comp.samples[j] = value
+				}
+			}
+			td.decodedData[i] = comp.samples
+			continue
+		}
+
+		// Assemble subbands
+		td.assembleSubbands(comp)
+
+		// Apply IDWT
+		if err := td.applyIDWT(comp); err != nil {
+			return nil, fmt.Errorf("IDWT failed for component %d: %w", i, err)
+		}
+
+		// Level shift - DISABLED: DC shift should be applied at codec level (decoder.go), not here
+		// to match OpenJPEG pipeline: T1^-1 -> DWT^-1 -> MCT^-1 -> DC shift^-1
+		// td.levelShift(comp)
+
+		td.decodedData[i] = comp.samples
+	}
+
+	return td.decodedData, nil
+}
+
+// initComponents sets up the tile-component geometry.
+func (td *TileDecoder) initComponents() {
 	numComponents := int(td.siz.Csiz)
 	td.components = make([]*ComponentDecoder, numComponents)
 	td.decodedData = make([][]int32, numComponents)
@@ -364,8 +520,11 @@ func (td *TileDecoder) Decode() ([][]int32, error) {
 
 		td.components[i] = comp
 	}
+}
 
-	// Parse packets ONCE for all components
+// newPacketDecoder configures a packet decoder for the tile's geometry.
+func (td *TileDecoder) newPacketDecoder() *PacketDecoder {
+	numComponents := len(td.components)
 	packetDec := NewPacketDecoder(
 		td.tile.Data,
 		int(td.siz.Csiz),
@@ -403,33 +562,7 @@ func (td *TileDecoder) Decode() ([][]int32, error) {
 		packetDec.SetPrecinctSizes(widths, heights)
 	}
 
-	packets, err := packetDec.DecodePackets()
-	if err != nil {
-		return nil, fmt.Errorf("failed to decode packets: %w", err)
-	}
-
-	td.decodeAllCodeBlocks(packets)
-
-	// Process each component
-	for i := 0; i < numComponents; i++ {
-		comp := td.components[i]
-
-		// Assemble subbands
-		td.assembleSubbands(comp)
-
-		// Apply IDWT
-		if err := td.applyIDWT(comp); err != nil {
-			return nil, fmt.Errorf("IDWT failed for component %d: %w", i, err)
-		}
-
-		// Level shift - DISABLED: DC shift should be applied at codec level (decoder.go), not here
-		// to match OpenJPEG pipeline: T1^-1 -> DWT^-1 -> MCT^-1 -> DC shift^-1
-		// td.levelShift(comp)
-
-		td.decodedData[i] = comp.samples
-	}
-
-	return td.decodedData, nil
+	return packetDec
 }
 
 // decodeAllCodeBlocks decodes code-blocks for all components from packets
@@ -477,7 +610,7 @@ func (td *TileDecoder) gatherCBData(comp *ComponentDecoder, precinctOrder map[in
 			actualCBIdx := cbOrder[cbIdx]
 			var cbData []byte
 			if cbIncl.DataLength > 0 && dataOffset+cbIncl.DataLength <= len(packet.Body) {
-				cbData = make([]byte, cbIncl.DataLength)
+				cbData = td.arena.Bytes(cbIncl.DataLength)
 				copy(cbData, packet.Body[dataOffset:dataOffset+cbIncl.DataLength])
 			} else {
 				cbData = []byte{}
@@ -528,7 +661,8 @@ func (td *TileDecoder) gatherCBData(comp *ComponentDecoder, precinctOrder map[in
 func (td *TileDecoder) buildAndDecodeCodeBlocks(comp *ComponentDecoder, cbWidth, cbHeight int, cbDataMap map[string]cbInfo) []*CodeBlockDecoder {
 	codeBlocks := make([]*CodeBlockDecoder, 0)
 	globalCBIdx := 0
-	for res := 0; res <= comp.numLevels; res++ {
+	maxRes := comp.numLevels - td.reduceLevels(comp)
+	for res := 0; res <= maxRes; res++ {
 		_, _, _, _, bands := bandInfosForResolution(comp.width, comp.height, comp.x0, comp.y0, comp.numLevels, res)
 		for _, bandInfo := range bands {
 			if bandInfo.width <= 0 || bandInfo.height <= 0 {
@@ -586,18 +720,30 @@ func (td *TileDecoder) buildAndDecodeCodeBlocks(comp *ComponentDecoder, cbWidth,
 						band:      band,
 						data:      info.data,
 						numPasses: numPasses,
-						t1Decoder: func() BlockDecoder {
-							if td.isHTJ2K && td.blockDecoderFactory != nil {
-								return td.blockDecoderFactory(actualWidth, actualHeight, int(td.cod.CodeBlockStyle))
-							}
-							dec := t1.NewT1Decoder(actualWidth, actualHeight, int(td.cod.CodeBlockStyle))
-							dec.SetOpenJPEGReconstruction(true)
-							return dec
-						}(),
 					}
+					if !td.shouldDecode(info) {
+						// Code-blocks without coded passes (most of a mostly
+						// blank image) are zero: they need neither a block
+						// decoder nor coefficient storage.
+						codeBlocks = append(codeBlocks, cbd)
+						continue
+					}
+					cbd.t1Decoder = func() BlockDecoder {
+						if td.isHTJ2K && td.blockDecoderFactory != nil {
+							return td.blockDecoderFactory(actualWidth, actualHeight, int(td.cod.CodeBlockStyle))
+						}
+						dec := t1.NewT1Decoder(actualWidth, actualHeight, int(td.cod.CodeBlockStyle))
+						dec.SetOpenJPEGReconstruction(true)
+						return dec
+					}()
 					if orientSetter, ok := cbd.t1Decoder.(interface{ SetOrientation(int) }); ok {
 						orientSetter.SetOrientation(band)
 					}
+					if td.maxPasses > 0 {
+						if passLimiter, ok := cbd.t1Decoder.(interface{ SetMaxPasses(int) }); ok {
+							passLimiter.SetMaxPasses(td.maxPasses)
+						}
+					}
 					if td.isHTJ2K {
 						if contextSetter, ok := cbd.t1Decoder.(interface {
 							SetCodingContext(bandNumbps int, zeroBitplanes int)
@@ -607,11 +753,7 @@ func (td *TileDecoder) buildAndDecodeCodeBlocks(comp *ComponentDecoder, cbWidth,
 							}
 						}
 					}
-					if td.shouldDecode(info) {
-						td.decodeCodeBlock(comp, cbd, info, actualWidth, actualHeight)
-					} else {
-						cbd.coeffs = make([]int32, actualWidth*actualHeight)
-					}
+					td.decodeCodeBlock(comp, cbd, info, actualWidth, actualHeight)
 					codeBlocks = append(codeBlocks, cbd)
 				}
 			}
@@ -716,7 +858,7 @@ func (td *TileDecoder) decodeCodeBlock(comp *ComponentDecoder, cbd *CodeBlockDec
 		err = cbd.t1Decoder.DecodeWithBitplane(info.data, cbd.numPasses, info.maxBitplane, 0)
 	}
 	if err != nil {
-		cbd.coeffs = make([]int32, actualWidth*actualHeight)
+		cbd.coeffs = td.arena.Int32s(actualWidth * actualHeight)
 		return
 	}
 	cbd.coeffs = cbd.t1Decoder.GetData()
@@ -790,8 +932,10 @@ func (td *TileDecoder) buildPrecinctOrder(comp *ComponentDecoder, cbWidth, cbHei
 					px := (absResX0 - startX) / pw
 					py := (absResY0 - startY) / ph
 					pIdx := py*numPrecinctX + px
-					localX := absResX0 - (startX + px*pw)
-					localY := absResY0 - (startY + py*ph)
+					// Code-block indices inside a precinct start at the first code-block of
+					// the precinct clipped to the tile-resolution (non-zero tile origins).
+					localX := absResX0 - max(startX+px*pw, resX0)
+					localY := absResY0 - max(startY+py*ph, resY0)
 					cbxLocal := localX / cbWidth
 					cbyLocal := localY / cbHeight
 					addEntry(pIdx, bandInfo.band, cbxLocal, cbyLocal, globalCBIdx)
@@ -839,7 +983,7 @@ func (td *TileDecoder) precinctSizeForResolution(resolution int) (int, int) {
 // assembleSubbands assembles code-block coefficients into subband arrays
 func (td *TileDecoder) assembleSubbands(comp *ComponentDecoder) {
 	// Initialize the full coefficient array
-	comp.coefficients = make([]int32, comp.width*comp.height)
+	comp.coefficients = td.arena.Int32s(comp.width * comp.height)
 
 	if len(comp.codeBlocks) == 0 {
 		// No code-blocks decoded - use zeros
@@ -861,6 +1005,10 @@ func (td *TileDecoder) assembleSubbands(comp *ComponentDecoder) {
 	// Simply copy all code-blocks at their x0,y0 positions
 	// The encoder has already set the correct x0,y0 for each code-block
 	for _, cb := range comp.codeBlocks {
+		if cb.coeffs == nil {
+			// All-zero code-block; the array is already zero.
+			continue
+		}
 		x0 := cb.x0
 		y0 := cb.y0
 		x1 := cb.x1
@@ -882,8 +1030,47 @@ func (td *TileDecoder) assembleSubbands(comp *ComponentDecoder) {
 	}
 }
 
+// constantComponent reports whether a reversible tile-component decodes to
+// a single value: its LL code-blocks all hold that value, every other
+// code-block is zero, and the geometry lets the inverse 5/3 transform
+// reproduce the value exactly (see wavelet.ConstantLowpass53).
+func (td *TileDecoder) constantComponent(comp *ComponentDecoder) (int32, bool) {
+	if td.cod.Transformation != 1 || td.reduceLevels(comp) > 0 || len(comp.codeBlocks) == 0 {
+		return 0, false
+	}
+	if _, _, ok := wavelet.ConstantLowpass53(comp.width, comp.height, comp.numLevels, comp.x0, comp.y0); !ok {
+		return 0, false
+	}
+	first := comp.codeBlocks[0]
+	if first.band != 0 {
+		return 0, false
+	}
+	value := int32(0)
+	if len(first.coeffs) > 0 {
+		value = first.coeffs[0]
+	}
+	for _, cb := range comp.codeBlocks {
+		want := int32(0)
+		if cb.band == 0 {
+			want = value
+		}
+		if cb.coeffs == nil && want != 0 {
+			return 0, false
+		}
+		for _, v := range cb.coeffs {
+			if v != want {
+				return 0, false
+			}
+		}
+	}
+	return value, true
+}
+
 // applyIDWT applies the inverse discrete wavelet transform
 func (td *TileDecoder) applyIDWT(comp *ComponentDecoder) error {
+	if reduce := td.reduceLevels(comp); reduce > 0 {
+		return td.applyReducedIDWT(comp, reduce)
+	}
 	if comp.numLevels == 0 {
 		// No wavelet transform - coefficients are samples
 		comp.samples = comp.coefficients
@@ -893,7 +1080,7 @@ func (td *TileDecoder) applyIDWT(comp *ComponentDecoder) error {
 	switch td.cod.Transformation {
 	case 1:
 		// 5/3 reversible wavelet (lossless)
-		comp.samples = make([]int32, len(comp.coefficients))
+		comp.samples = td.arena.Int32s(len(comp.coefficients))
 		copy(comp.samples, comp.coefficients)
 		wavelet.InverseMultilevelWithParity(comp.samples, comp.width, comp.height, comp.numLevels, comp.x0, comp.y0)
 	case 0:
@@ -907,10 +1094,10 @@ func (td *TileDecoder) applyIDWT(comp *ComponentDecoder) error {
 			bitDepth := td.siz.Components[comp.componentIdx].BitDepth()
 			floatCoeffs = td.applyDequantizationBySubbandFloat(comp.coefficients, comp.width, comp.height, comp.numLevels, bitDepth, comp.x0, comp.y0)
 		} else {
-			floatCoeffs = wavelet.ConvertInt32ToFloat32(comp.coefficients)
+			floatCoeffs = td.float32Plane(comp.coefficients)
 		}
 		wavelet.InverseMultilevel97OpenJPEGWithParity(floatCoeffs, comp.width, comp.height, comp.numLevels, comp.x0, comp.y0)
-		comp.samples = wavelet.ConvertFloat32ToInt32OpenJPEG(floatCoeffs)
+		comp.samples = wavelet.ConvertFloat32ToInt32OpenJPEGInto(td.arena.Int32s(len(floatCoeffs)), floatCoeffs)
 	default:
 		return fmt.Errorf("unsupported wavelet transformation type: %d", td.cod.Transformation)
 	}
@@ -918,6 +1105,50 @@ func (td *TileDecoder) applyIDWT(comp *ComponentDecoder) error {
 	return nil
 }
 
+// applyReducedIDWT reconstructs resolution numLevels-reduce only. The LL
+// region of that resolution is copied out of the subband layout and the
+// remaining levels are inverted on the compact copy, using the reduced
+// origin so that the lifting parity matches a full decode.
+func (td *TileDecoder) applyReducedIDWT(comp *ComponentDecoder, reduce int) error {
+	levels := comp.numLevels - reduce
+	resW, resH, resX0, resY0, _ := bandInfosForResolution(comp.width, comp.height, comp.x0, comp.y0, comp.numLevels, levels)
+
+	switch td.cod.Transformation {
+	case 1:
+		samples := td.arena.Int32s(resW * resH)
+		for y := 0; y < resH; y++ {
+			copy(samples[y*resW:(y+1)*resW], comp.coefficients[y*comp.width:y*comp.width+resW])
+		}
+		if levels > 0 {
+			wavelet.InverseMultilevelWithParity(samples, resW, resH, levels, resX0, resY0)
+		}
+		comp.samples = samples
+	case 0:
+		var floatCoeffs []float32
+		qType := 0
+		if td.qcd != nil {
+			qType = td.qcd.QuantizationType()
+		}
+		if qType == 1 || qType == 2 {
+			bitDepth := td.siz.Components[comp.componentIdx].BitDepth()
+			floatCoeffs = td.applyDequantizationBySubbandFloat(comp.coefficients, comp.width, comp.height, comp.numLevels, bitDepth, comp.x0, comp.y0)
+		} else {
+			floatCoeffs = td.float32Plane(comp.coefficients)
+		}
+		region := td.arena.Float32s(resW * resH)
+		for y := 0; y < resH; y++ {
+			copy(region[y*resW:(y+1)*resW], floatCoeffs[y*comp.width:y*comp.width+resW])
+		}
+		if levels > 0 {
+			wavelet.InverseMultilevel97OpenJPEGWithParity(region, resW, resH, levels, resX0, resY0)
+		}
+		comp.samples = wavelet.ConvertFloat32ToInt32OpenJPEGInto(td.arena.Int32s(len(region)), region)
+	default:
+		return fmt.Errorf("unsupported wavelet transformation type: %d", td.cod.Transformation)
+	}
+	return nil
+}
+
 // applyDequantizationBySubbandFloat applies dequantization to each subband separately.
 // coeffs: quantized wavelet coefficients in subband layout
 // width, height: dimensions of the full image
@@ -925,15 +1156,15 @@ func (td *TileDecoder) applyIDWT(comp *ComponentDecoder) error {
 func (td *TileDecoder) applyDequantizationBySubbandFloat(coeffs []int32, width, height, numLevels, bitDepth, x0, y0 int) []float32 {
 	if td.qcd == nil || len(td.qcd.SPqcd) == 0 {
 		// No dequantization
-		return wavelet.ConvertInt32ToFloat32(coeffs)
+		return td.float32Plane(coeffs)
 	}
 
 	stepSizes := td.decodeQuantizationSteps(numLevels, bitDepth)
 	if len(stepSizes) == 0 {
-		return wavelet.ConvertInt32ToFloat32(coeffs)
+		return td.float32Plane(coeffs)
 	}
 
-	floatCoeffs := wavelet.ConvertInt32ToFloat32(coeffs)
+	floatCoeffs := td.float32Plane(coeffs)
 
 	subbandIdx := 0
 
@@ -961,6 +1192,12 @@ func (td *TileDecoder) applyDequantizationBySubbandFloat(coeffs []int32, width,
 	return floatCoeffs
 }
 
+// float32Plane converts a coefficient plane to the 9/7 sample type in a
+// buffer carved from the tile's arena.
+func (td *TileDecoder) float32Plane(coeffs []int32) []float32 {
+	return wavelet.ConvertInt32ToFloat32Into(td.arena.Float32s(len(coeffs)), coeffs)
+}
+
 // dequantizeSubbandFloat dequantizes a single subband.
 // data: full coefficient array (float domain)
 // x0, y0: top-left corner of subband
@@ -25,6 +25,10 @@ type Packet struct {
 
 	// Error resilience
 	PartialBuffer bool // Insufficient data to complete packet
+
+	// Location in the tile data (set by PacketDecoder)
+	Offset int // Byte offset of the packet header
+	Length int // Header plus body bytes consumed (0 when past the end of data)
 }
 
 // CodeBlockIncl represents code-block inclusion and contribution information
@@ -27,6 +27,9 @@ type TileLayout struct {
 	// Tile offsets
 	tileOffsetX int
 	tileOffsetY int
+
+	// Discarded resolution levels; bounds are divided by 2^reduce (rounded up)
+	reduce int
 }
 
 // NewTileLayout creates a tile layout from SIZ segment
@@ -55,6 +58,23 @@ func NewTileLayout(siz *codestream.SIZSegment) *TileLayout {
 	return layout
 }
 
+// NewReducedTileLayout creates a tile layout whose image and tile bounds are
+// scaled down by 2^reduce, matching tiles decoded with reduce levels discarded.
+func NewReducedTileLayout(siz *codestream.SIZSegment, reduce int) *TileLayout {
+	layout := NewTileLayout(siz)
+	if reduce > 0 {
+		layout.reduce = reduce
+		layout.imageWidth = layout.reduceCoord(layout.imageX1) - layout.reduceCoord(layout.imageX0)
+		layout.imageHeight = layout.reduceCoord(layout.imageY1) - layout.reduceCoord(layout.imageY0)
+	}
+	return layout
+}
+
+// reduceCoord maps a reference-grid coordinate to the reduced resolution.
+func (tl *TileLayout) reduceCoord(v int) int {
+	return ceilDiv(v, 1<<tl.reduce)
+}
+
 // GetTileCount returns the total number of tiles
 func (tl *TileLayout) GetTileCount() int {
 	return tl.numTilesX * tl.numTilesY
@@ -97,6 +117,15 @@ func (tl *TileLayout) GetTileBounds(tileIdx int) (x0, y0, x1, y1 int) {
 	x1 = gridX1 - tl.imageX0
 	y1 = gridY1 - tl.imageY0
 
+	if tl.reduce > 0 {
+		originX := tl.reduceCoord(tl.imageX0)
+		originY := tl.reduceCoord(tl.imageY0)
+		x0 = tl.reduceCoord(gridX0) - originX
+		y0 = tl.reduceCoord(gridY0) - originY
+		x1 = tl.reduceCoord(gridX1) - originX
+		y1 = tl.reduceCoord(gridY1) - originY
+	}
+
 	return
 }
 
@@ -115,7 +144,13 @@ type TileAssembler struct {
 
 // NewTileAssembler creates a new tile assembler
 func NewTileAssembler(siz *codestream.SIZSegment) *TileAssembler {
-	layout := NewTileLayout(siz)
+	return NewReducedTileAssembler(siz, 0)
+}
+
+// NewReducedTileAssembler creates a tile assembler for tiles decoded with
+// reduce resolution levels discarded.
+func NewReducedTileAssembler(siz *codestream.SIZSegment, reduce int) *TileAssembler {
+	layout := NewReducedTileLayout(siz, reduce)
 
 	ta := &TileAssembler{
 		layout:     layout,
@@ -0,0 +1,447 @@
+package jpeg2000
+
+import (
+	"bytes"
+	"encoding/binary"
+	"fmt"
+
+	"github.com/cocosip/go-dicom-codecs/jpeg2000/codestream"
+	"github.com/cocosip/go-dicom-codecs/jpeg2000/t2"
+)
+
+// TruncateOptions selects what TruncateCodestream keeps.
+type TruncateOptions struct {
+	// MaxLayers keeps only the first MaxLayers quality layers (0 keeps all).
+	MaxLayers int
+	// DiscardLevels removes this many of the highest resolution levels, halving
+	// the image size per level (0 keeps full resolution).
+	DiscardLevels int
+}
+
+// TruncateCodestream derives a new codestream from data by dropping trailing
+// quality layers and/or the highest resolution levels at packet granularity.
+//
+// No code-block is decoded or re-encoded: packet headers are parsed to find
+// packet boundaries, the kept packets are copied verbatim and SIZ, COD/COC,
+// QCD/QCC, SOT and TLM are rewritten to match. Each tile is written as a
+// single tile-part. PLM/PLT are dropped. Codestreams with POC, PPM/PPT or
+// SOP/EPH markers are rejected, as are multi-tile images whose tile size is not
+// a multiple of 2^DiscardLevels.
+func TruncateCodestream(data []byte, opts TruncateOptions) ([]byte, error) {
+	if opts.MaxLayers < 0 || opts.DiscardLevels < 0 {
+		return nil, fmt.Errorf("invalid truncation: layers=%d discard=%d", opts.MaxLayers, opts.DiscardLevels)
+	}
+	return rewriteCodestream(data, &codestreamRewriter{
+		discard:     opts.DiscardLevels,
+		layers:      opts.MaxLayers,
+		progression: -1,
+	})
+}
+
+// ConvertProgression rewrites data so that every tile's packets follow the
+// given progression order (0=LRCP, 1=RLCP, 2=RPCL, 3=PCRL, 4=CPRL, as in
+// EncodeParams.ProgressionOrder).
+//
+// Packet boundaries are found by parsing packet headers; the packets are then
+// emitted in the new order byte for byte, so no code-block is decoded or
+// re-encoded and the decoded image is unchanged. The progression order in
+// COD is updated and each tile is written as a single tile-part; the same
+// marker restrictions as TruncateCodestream apply.
+func ConvertProgression(data []byte, progression uint8) ([]byte, error) {
+	if t2.ProgressionOrder(progression) > t2.ProgressionCPRL {
+		return nil, fmt.Errorf("invalid progression order: %d", progression)
+	}
+	return rewriteCodestream(data, &codestreamRewriter{progression: int(progression)})
+}
+
+// rewriteCodestream applies rw to every header segment and tile of data.
+func rewriteCodestream(data []byte, rw *codestreamRewriter) ([]byte, error) {
+	cs, err := codestream.NewParser(data).Parse()
+	if err != nil {
+		return nil, fmt.Errorf("failed to parse codestream: %w", err)
+	}
+	if cs.SIZ == nil || cs.COD == nil {
+		return nil, fmt.Errorf("codestream is missing SIZ or COD")
+	}
+	if len(cs.POC) > 0 {
+		return nil, fmt.Errorf("progression order changes (POC) are not supported")
+	}
+
+	rw.cs = cs
+	if err := rw.checkCOD(cs.COD); err != nil {
+		return nil, err
+	}
+	if err := rw.reduceSIZ(); err != nil {
+		return nil, err
+	}
+
+	mainSegs, pos, err := readHeaderSegments(data, 2)
+	if err != nil {
+		return nil, err
+	}
+	tileSegs, err := readTilePartHeaders(data, pos)
+	if err != nil {
+		return nil, err
+	}
+
+	tiles := make([]rewrittenTile, 0, len(cs.Tiles))
+	for _, tile := range cs.Tiles {
+		t, err := rw.rewriteTile(tile, tileSegs[tile.Index])
+		if err != nil {
+			return nil, fmt.Errorf("tile %d: %w", tile.Index, err)
+		}
+		tiles = append(tiles, t)
+	}
+
+	header := &bytes.Buffer{}
+	_ = binary.Write(header, binary.BigEndian, codestream.MarkerSOC)
+	wroteTLM := false
+	for _, seg := range mainSegs {
+		if seg.marker == codestream.MarkerTLM {
+			if !wroteTLM {
+				entries := make([]tlmEntry, len(tiles))
+				for i, t := range tiles {
+					entries[i] = tlmEntry{tileIndex: uint16(t.index), length: uint32(t.length())}
+				}
+				if err := writeTLMEntries(header, entries); err != nil {
+					return nil, fmt.Errorf("failed to write TLM: %w", err)
+				}
+				wroteTLM = true
+			}
+			continue
+		}
+		body, keep, err := rw.rewriteSegment(seg)
+		if err != nil {
+			return nil, err
+		}
+		if keep {
+			writeRawSegment(header, seg.marker, body)
+		}
+	}
+
+	size := header.Len() + 2
+	for i := range tiles {
+		size += tiles[i].length()
+	}
+	out := make([]byte, 0, size)
+	out = append(out, header.Bytes()...)
+	for i := range tiles {
+		out = tiles[i].appendTo(out)
+	}
+	return binary.BigEndian.AppendUint16(out, codestream.MarkerEOC), nil
+}
+
+// rawSegment is a marker segment as stored in the codestream.
+type rawSegment struct {
+	marker uint16
+	body   []byte // bytes following the length field
+}
+
+// readHeaderSegments reads marker segments starting at pos up to the next SOT
+// or SOD marker and returns them with the position of that marker.
+func readHeaderSegments(data []byte, pos int) ([]rawSegment, int, error) {
+	var segs []rawSegment
+	for {
+		if pos+2 > len(data) {
+			return nil, pos, fmt.Errorf("unexpected end of header at offset %d", pos)
+		}
+		marker := binary.BigEndian.Uint16(data[pos:])
+		if marker == codestream.MarkerSOT || marker == codestream.MarkerSOD {
+			return segs, pos, nil
+		}
+		if pos+4 > len(data) {
+			return nil, pos, fmt.Errorf("truncated marker 0x%04X at offset %d", marker, pos)
+		}
+		length := int(binary.BigEndian.Uint16(data[pos+2:]))
+		if length < 2 || pos+2+length > len(data) {
+			return nil, pos, fmt.Errorf("invalid length %d for marker 0x%04X at offset %d", length, marker, pos)
+		}
+		segs = append(segs, rawSegment{marker: marker, body: data[pos+4 : pos+2+length]})
+		pos += 2 + length
+	}
+}
+
+// readTilePartHeaders collects the tile-part header segments of every tile,
+// in tile-part order, starting at the first SOT.
+func readTilePartHeaders(data []byte, pos int) (map[int][]rawSegment, error) {
+	headers := make(map[int][]rawSegment)
+	for pos+2 <= len(data) && binary.BigEndian.Uint16(data[pos:]) == codestream.MarkerSOT {
+		if pos+12 > len(data) {
+			return nil, fmt.Errorf("truncated SOT at offset %d", pos)
+		}
+		tileIdx := int(binary.BigEndian.Uint16(data[pos+4:]))
+		psot := int(binary.BigEndian.Uint32(data[pos+6:]))
+		segs, _, err := readHeaderSegments(data, pos+12)
+		if err != nil {
+			return nil, err
+		}
+		headers[tileIdx] = append(headers[tileIdx], segs...)
+		if psot == 0 {
+			break // last tile-part runs to EOC
+		}
+		pos += psot
+	}
+	return headers, nil
+}
+
+func writeRawSegment(buf *bytes.Buffer, marker uint16, body []byte) {
+	_ = binary.Write(buf, binary.BigEndian, marker)
+	_ = binary.Write(buf, binary.BigEndian, uint16(len(body)+2))
+	buf.Write(body)
+}
+
+// codestreamRewriter holds the rewrite state shared by all segments.
+type codestreamRewriter struct {
+	cs          *codestream.Codestream
+	discard     int // resolution levels removed
+	layers      int // quality layers kept (0 = all)
+	progression int // new progression order (-1 = unchanged)
+	siz         [8]uint32
+}
+
+// checkCOD verifies that a coding style can be truncated.
+func (rw *codestreamRewriter) checkCOD(cod *codestream.CODSegment) error {
+	if cod.Scod&0x06 != 0 {
+		return fmt.Errorf("SOP/EPH packet markers are not supported")
+	}
+	if int(cod.NumberOfDecompositionLevels) < rw.discard {
+		return fmt.Errorf("cannot discard %d resolution levels from %d decomposition levels",
+			rw.discard, cod.NumberOfDecompositionLevels)
+	}
+	return nil
+}
+
+// reduceSIZ computes the reference grid after discarding resolution levels.
+func (rw *codestreamRewriter) reduceSIZ() error {
+	siz := rw.cs.SIZ
+	if siz.XTsiz == 0 || siz.YTsiz == 0 {
+		return fmt.Errorf("invalid tile size %dx%d", siz.XTsiz, siz.YTsiz)
+	}
+	r := rw.discard
+	reduce := func(v uint32) uint32 { return uint32(ceilDivPow2(int(v), r)) }
+	xtOsiz, ytOsiz := reduce(siz.XTOsiz), reduce(siz.YTOsiz)
+	rw.siz = [8]uint32{
+		reduce(siz.Xsiz), reduce(siz.Ysiz), reduce(siz.XOsiz), reduce(siz.YOsiz),
+		reduce(siz.XTOsiz+siz.XTsiz) - xtOsiz, reduce(siz.YTOsiz+siz.YTsiz) - ytOsiz,
+		xtOsiz, ytOsiz,
+	}
+	if r == 0 {
+		return nil
+	}
+
+	numTilesX := ceilDivUint32(siz.Xsiz-siz.XTOsiz, siz.XTsiz)
+	numTilesY := ceilDivUint32(siz.Ysiz-siz.YTOsiz, siz.YTsiz)
+	if (numTilesX > 1 && siz.XTsiz%(1<<r) != 0) || (numTilesY > 1 && siz.YTsiz%(1<<r) != 0) {
+		return fmt.Errorf("tile size %dx%d is not a multiple of %d", siz.XTsiz, siz.YTsiz, 1<<r)
+	}
+	xsiz, ysiz, xosiz, yosiz := rw.siz[0], rw.siz[1], rw.siz[2], rw.siz[3]
+	xtsiz, ytsiz := rw.siz[4], rw.siz[5]
+	if ceilDivUint32(xsiz-xtOsiz, xtsiz) != numTilesX || ceilDivUint32(ysiz-ytOsiz, ytsiz) != numTilesY ||
+		xosiz >= xtOsiz+xtsiz || yosiz >= ytOsiz+ytsiz || xosiz >= xsiz || yosiz >= ysiz {
+		return fmt.Errorf("discarding %d levels would leave empty tiles", r)
+	}
+	return nil
+}
+
+func ceilDivUint32(a, b uint32) uint32 {
+	return (a + b - 1) / b
+}
+
+// rewriteSegment returns the new body of a main or tile-part header segment
+// and whether it is kept.
+func (rw *codestreamRewriter) rewriteSegment(seg rawSegment) ([]byte, bool, error) {
+	switch seg.marker {
+	case codestream.MarkerSIZ:
+		return rw.rewriteSIZ(seg.body)
+	case codestream.MarkerCOD:
+		return rw.rewriteCodingStyle(seg.body, 0)
+	case codestream.MarkerCOC:
+		return rw.rewriteCodingStyle(seg.body, rw.componentIndexSize())
+	case codestream.MarkerQCD:
+		return rw.rewriteQuantization(seg.body, 0)
+	case codestream.MarkerQCC:
+		return rw.rewriteQuantization(seg.body, rw.componentIndexSize())
+	case codestream.MarkerTLM, codestream.MarkerPLM, codestream.MarkerPLT:
+		return nil, false, nil
+	case codestream.MarkerPOC:
+		return nil, false, fmt.Errorf("progression order changes (POC) are not supported")
+	case codestream.MarkerPPM, codestream.MarkerPPT:
+		return nil, false, fmt.Errorf("packed packet headers (PPM/PPT) are not supported")
+	default:
+		return seg.body, true, nil
+	}
+}
+
+func (rw *codestreamRewriter) componentIndexSize() int {
+	if rw.cs.SIZ.Csiz < 257 {
+		return 1
+	}
+	return 2
+}
+
+func (rw *codestreamRewriter) rewriteSIZ(body []byte) ([]byte, bool, error) {
+	if len(body) < 36 {
+		return nil, false, fmt.Errorf("SIZ segment too short: %d bytes", len(body))
+	}
+	out := append([]byte(nil), body...)
+	for i, v := range rw.siz {
+		binary.BigEndian.PutUint32(out[2+4*i:], v)
+	}
+	return out, true, nil
+}
+
+// rewriteCodingStyle updates COD (offset 0) or COC (offset = Ccoc size):
+// the layer count, the number of decomposition levels and the precinct list.
+func (rw *codestreamRewriter) rewriteCodingStyle(body []byte, offset int) ([]byte, bool, error) {
+	out := append([]byte(nil), body...)
+	scod := 0
+	if offset == 0 {
+		// Scod, progression order, layers and MCT precede SPcod.
+		if len(out) < 10 {
+			return nil, false, fmt.Errorf("COD segment too short: %d bytes", len(out))
+		}
+		if out[0]&0x06 != 0 {
+			return nil, false, fmt.Errorf("SOP/EPH packet markers are not supported")
+		}
+		if layers := int(binary.BigEndian.Uint16(out[2:])); rw.layers > 0 && rw.layers < layers {
+			binary.BigEndian.PutUint16(out[2:], uint16(rw.layers))
+		}
+		if rw.progression >= 0 {
+			out[1] = byte(rw.progression)
+		}
+		scod = int(out[0])
+		offset = 5
+	} else {
+		if len(out) < offset+6 {
+			return nil, false, fmt.Errorf("COC segment too short: %d bytes", len(out))
+		}
+		scod = int(out[offset])
+		offset++
+	}
+
+	levels := int(out[offset])
+	if levels < rw.discard {
+		return nil, false, fmt.Errorf("cannot discard %d resolution levels from %d decomposition levels", rw.discard, levels)
+	}
+	out[offset] = byte(levels - rw.discard)
+	if scod&0x01 != 0 {
+		// One precinct size byte per resolution, lowest first.
+		end := offset + 5 + levels - rw.discard + 1
+		if len(out) < offset+5+levels+1 {
+			return nil, false, fmt.Errorf("coding style precinct list too short")
+		}
+		out = out[:end]
+	}
+	return out, true, nil
+}
+
+// rewriteQuantization drops the step sizes of discarded subbands from QCD
+// (offset 0) or QCC (offset = Cqcc size). Derived quantization signals only
+// the LL step and needs no change.
+func (rw *codestreamRewriter) rewriteQuantization(body []byte, offset int) ([]byte, bool, error) {
+	if len(body) < offset+1 {
+		return nil, false, fmt.Errorf("quantization segment too short: %d bytes", len(body))
+	}
+	style := body[offset] & 0x1F
+	if rw.discard == 0 || style == 1 {
+		return body, true, nil
+	}
+	perBand := 2
+	if style == 0 {
+		perBand = 1
+	}
+	bands := (len(body) - offset - 1) / perBand
+	keep := bands - 3*rw.discard
+	if keep < 1 {
+		return nil, false, fmt.Errorf("quantization segment has %d subbands, cannot discard %d levels", bands, rw.discard)
+	}
+	return body[:offset+1+keep*perBand], true, nil
+}
+
+// rewrittenTile is a tile written back as a single tile-part.
+type rewrittenTile struct {
+	index   int
+	header  []byte   // tile-part header segments
+	packets [][]byte // kept packets, aliasing the source tile data
+	dataLen int
+}
+
+func (t *rewrittenTile) length() int {
+	return 12 + len(t.header) + 2 + t.dataLen
+}
+
+func (t *rewrittenTile) appendTo(dst []byte) []byte {
+	dst = binary.BigEndian.AppendUint16(dst, codestream.MarkerSOT)
+	dst = binary.BigEndian.AppendUint16(dst, 10)
+	dst = binary.BigEndian.AppendUint16(dst, uint16(t.index))
+	dst = binary.BigEndian.AppendUint32(dst, uint32(t.length()))
+	dst = append(dst, 0, 1) // TPsot, TNsot
+	dst = append(dst, t.header...)
+	dst = binary.BigEndian.AppendUint16(dst, codestream.MarkerSOD)
+	for _, p := range t.packets {
+		dst = append(dst, p...)
+	}
+	return dst
+}
+
+// rewriteTile parses the tile's packet headers and keeps the packets of the
+// retained layers and resolutions.
+func (rw *codestreamRewriter) rewriteTile(tile *codestream.Tile, segs []rawSegment) (rewrittenTile, error) {
+	out := rewrittenTile{index: tile.Index}
+	if len(tile.POC) > 0 {
+		return out, fmt.Errorf("progression order changes (POC) are not supported")
+	}
+	cod := rw.cs.TileCOD(tile)
+	qcd := rw.cs.TileQCD(tile)
+	if rw.cs.SIZ.Csiz == 1 {
+		// Mirror the decoder, which applies COC/QCC overrides to single-component images.
+		if resolved := rw.cs.ComponentCOD(tile, 0); resolved != nil {
+			cod = resolved
+		}
+		if resolved := rw.cs.ComponentQCD(tile, 0); resolved != nil {
+			qcd = resolved
+		}
+	}
+	if err := rw.checkCOD(cod); err != nil {
+		return out, err
+	}
+
+	header := &bytes.Buffer{}
+	for _, seg := range segs {
+		body, keep, err := rw.rewriteSegment(seg)
+		if err != nil {
+			return out, err
+		}
+		if keep {
+			writeRawSegment(header, seg.marker, body)
+		}
+	}
+	out.header = header.Bytes()
+
+	isHTJ2K := cod.CodeBlockStyle&0x40 != 0
+	td := t2.NewTileDecoder(tile, rw.cs.SIZ, cod, qcd, nil, isHTJ2K, nil)
+	packets, err := td.Packets()
+	if err != nil {
+		return out, err
+	}
+	if rw.progression >= 0 {
+		for _, p := range packets {
+			if p.Length == 0 {
+				return out, fmt.Errorf("tile data ends before packet (L=%d,R=%d,C=%d,P=%d)",
+					p.LayerIndex, p.ResolutionLevel, p.ComponentIndex, p.PrecinctIndex)
+			}
+		}
+		if packets, err = td.ReorderPackets(packets, t2.ProgressionOrder(rw.progression)); err != nil {
+			return out, err
+		}
+	}
+	maxRes := int(cod.NumberOfDecompositionLevels) - rw.discard
+	for _, p := range packets {
+		if p.Length == 0 || p.ResolutionLevel > maxRes || (rw.layers > 0 && p.LayerIndex >= rw.layers) {
+			continue
+		}
+		out.packets = append(out.packets, tile.Data[p.Offset:p.Offset+p.Length])
+		out.dataLen += p.Length
+	}
+	return out, nil
+}
@@ -0,0 +1,122 @@
+package jpeg2000
+
+import (
+	"bytes"
+	"testing"
+)
+
+// TestTruncateDiscardLevels checks that dropping resolution levels at packet
+// level yields a codestream that decodes like a reduced-resolution decode.
+func TestTruncateDiscardLevels(t *testing.T) {
+	tests := []struct {
+		name       string
+		width      int
+		height     int
+		components int
+		tileSize   int
+		lossless   bool
+		layers     int
+	}{
+		{"gray lossless", 101, 77, 1, 0, true, 1},
+		{"rgb lossless tiled", 96, 80, 3, 32, true, 1},
+		{"gray lossy layered", 90, 64, 1, 0, false, 3},
+	}
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			pixels := streamTestImage(tt.width, tt.height, tt.components)
+			params := DefaultEncodeParams(tt.width, tt.height, tt.components, 8, false)
+			params.TileWidth = tt.tileSize
+			params.TileHeight = tt.tileSize
+			params.NumLevels = 3
+			params.NumLayers = tt.layers
+			params.Lossless = tt.lossless
+			encoded, err := NewEncoder(params).Encode(pixels)
+			if err != nil {
+				t.Fatalf("Encode failed: %v", err)
+			}
+
+			for discard := 1; discard <= 2; discard++ {
+				want := NewDecoder()
+				want.SetReduceResolution(discard)
+				if err := want.Decode(encoded); err != nil {
+					t.Fatalf("reduced decode failed: %v", err)
+				}
+
+				truncated, err := TruncateCodestream(encoded, TruncateOptions{DiscardLevels: discard})
+				if err != nil {
+					t.Fatalf("discard=%d: TruncateCodestream failed: %v", discard, err)
+				}
+				if len(truncated) >= len(encoded) {
+					t.Fatalf("discard=%d: truncated size %d not below %d", discard, len(truncated), len(encoded))
+				}
+				got := NewDecoder()
+				if err := got.Decode(truncated); err != nil {
+					t.Fatalf("discard=%d: decode of truncated stream failed: %v", discard, err)
+				}
+				if got.Width() != want.Width() || got.Height() != want.Height() {
+					t.Fatalf("discard=%d: size %dx%d, want %dx%d", discard, got.Width(), got.Height(), want.Width(), want.Height())
+				}
+				if !bytes.Equal(got.GetPixelData(), want.GetPixelData()) {
+					t.Fatalf("discard=%d: pixels differ from reduced-resolution decode", discard)
+				}
+			}
+		})
+	}
+}
+
+// TestTruncateLayers checks that dropping trailing layers lowers quality
+// monotonically and that keeping every layer preserves the decoded image.
+func TestTruncateLayers(t *testing.T) {
+	width, height := 96, 96
+	pixels := streamTestImage(width, height, 3)
+	params := DefaultEncodeParams(width, height, 3, 8, false)
+	params.NumLevels = 3
+	params.NumLayers = 3
+	params.Lossless = false
+	params.TargetRatio = 4
+	encoded, err := NewEncoder(params).Encode(pixels)
+	if err != nil {
+		t.Fatalf("Encode failed: %v", err)
+	}
+	full := NewDecoder()
+	if err := full.Decode(encoded); err != nil {
+		t.Fatalf("Decode failed: %v", err)
+	}
+
+	prevSize, prevPSNR := 0, 0.0
+	for layers := 1; layers <= 3; layers++ {
+		truncated, err := TruncateCodestream(encoded, TruncateOptions{MaxLayers: layers})
+		if err != nil {
+			t.Fatalf("layers=%d: TruncateCodestream failed: %v", layers, err)
+		}
+		dec := NewDecoder()
+		if err := dec.Decode(truncated); err != nil {
+			t.Fatalf("layers=%d: decode failed: %v", layers, err)
+		}
+		psnr := calculatePSNR(pixels, dec.GetPixelData())
+		t.Logf("layers=%d: %d bytes, PSNR %.2f dB", layers, len(truncated), psnr)
+		if len(truncated) <= prevSize || psnr+0.01 < prevPSNR {
+			t.Fatalf("layers=%d: size %d / PSNR %.2f did not improve on %d / %.2f", layers, len(truncated), psnr, prevSize, prevPSNR)
+		}
+		prevSize, prevPSNR = len(truncated), psnr
+		if layers == 3 && !bytes.Equal(dec.GetPixelData(), full.GetPixelData()) {
+			t.Fatalf("keeping all layers changed the decoded image")
+		}
+	}
+
+	both, err := TruncateCodestream(encoded, TruncateOptions{MaxLayers: 1, DiscardLevels: 1})
+	if err != nil {
+		t.Fatalf("combined truncation failed: %v", err)
+	}
+	dec := NewDecoder()
+	if err := dec.Decode(both); err != nil {
+		t.Fatalf("combined decode failed: %v", err)
+	}
+	if dec.Width() != width/2 || dec.Height() != height/2 {
+		t.Fatalf("combined truncation size %dx%d, want %dx%d", dec.Width(), dec.Height(), width/2, height/2)
+	}
+
+	if _, err := TruncateCodestream(encoded, TruncateOptions{DiscardLevels: 4}); err == nil {
+		t.Fatalf("discarding more levels than present should fail")
+	}
+}
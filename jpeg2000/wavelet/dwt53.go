@@ -266,8 +266,14 @@ func Forward53_2DWithParity(data []int32, width, height, stride int, evenRow, ev
 		col := make([]int32, height)
 		for x := 0; x < width; x++ {
 			// Extract column (use stride for row indexing)
+			var nonzero int32
 			for y := 0; y < height; y++ {
 				col[y] = data[y*stride+x]
+				nonzero |= col[y]
+			}
+			if nonzero == 0 {
+				// The transform of an all-zero column is zero.
+				continue
 			}
 
 			// Transform column with evenCol parity (from y0)
@@ -285,8 +291,13 @@ func Forward53_2DWithParity(data []int32, width, height, stride int, evenRow, ev
 		row := make([]int32, width)
 		for y := 0; y < height; y++ {
 			// Extract row (use stride for indexing)
+			var nonzero int32
 			for x := 0; x < width; x++ {
 				row[x] = data[y*stride+x]
+				nonzero |= row[x]
+			}
+			if nonzero == 0 {
+				continue
 			}
 
 			// Transform row with evenRow parity (from x0)
@@ -320,8 +331,14 @@ func Inverse53_2DWithParity(data []int32, width, height, stride int, evenRow, ev
 		row := make([]int32, width)
 		for y := 0; y < height; y++ {
 			// Extract row (use stride for indexing)
+			var nonzero int32
 			for x := 0; x < width; x++ {
 				row[x] = data[y*stride+x]
+				nonzero |= row[x]
+			}
+			if nonzero == 0 {
+				// The inverse transform of an all-zero row is zero.
+				continue
 			}
 
 			// Inverse transform row with evenRow parity
@@ -339,8 +356,13 @@ func Inverse53_2DWithParity(data []int32, width, height, stride int, evenRow, ev
 		col := make([]int32, height)
 		for x := 0; x < width; x++ {
 			// Extract column (use stride for row indexing)
+			var nonzero int32
 			for y := 0; y < height; y++ {
 				col[y] = data[y*stride+x]
+				nonzero |= col[y]
+			}
+			if nonzero == 0 {
+				continue
 			}
 
 			// Inverse transform column with evenCol parity
@@ -493,3 +493,73 @@ func BenchmarkForward53_2D(b *testing.B) {
 		})
 	}
 }
+
+// TestZeroSpans covers images with all-zero rows and columns, which the 2D
+// transforms skip: the 5/3 transform must still round trip and the 9/7 one
+// must match a transform that does not skip them.
+func TestZeroSpans(t *testing.T) {
+	const width, height = 45, 38
+	original := make([]int32, width*height)
+	for y := 10; y < height; y++ {
+		for x := 0; x < 20; x++ {
+			original[y*width+x] = int32((x*13+y*7)%200 - 60)
+		}
+	}
+	for _, origin := range [][2]int{{0, 0}, {3, 1}} {
+		data := append([]int32(nil), original...)
+		ForwardMultilevelWithParity(data, width, height, 3, origin[0], origin[1])
+		InverseMultilevelWithParity(data, width, height, 3, origin[0], origin[1])
+		for i := range data {
+			if data[i] != original[i] {
+				t.Fatalf("origin %v: sample %d = %d, want %d", origin, i, data[i], original[i])
+			}
+		}
+
+		for _, inverse := range []bool{false, true} {
+			got := ConvertInt32ToFloat32(original)
+			want := ConvertInt32ToFloat32(original)
+			evenRow, evenCol := origin[0]%2 == 0, origin[1]%2 == 0
+			if inverse {
+				Inverse97_2DOpenJPEGWithParity(got, width, height, width, evenRow, evenCol)
+				reference97(want, width, height, Inverse97_1DOpenJPEGWithParity, evenRow, evenCol, true)
+			} else {
+				Forward97_2DFloat32WithParity(got, width, height, width, evenRow, evenCol)
+				reference97(want, width, height, Forward97_1DFloat32WithParity, evenRow, evenCol, false)
+			}
+			for i := range got {
+				if got[i] != want[i] {
+					t.Fatalf("origin %v inverse %v: 9/7 coefficient %d = %v, want %v", origin, inverse, i, got[i], want[i])
+				}
+			}
+		}
+	}
+}
+
+// reference97 applies a 1D 9/7 transform to every column and row of data,
+// rows first when rowsFirst is set, without skipping zero spans.
+func reference97(data []float32, width, height int, transform func([]float32, bool), evenRow, evenCol, rowsFirst bool) {
+	rows := func() {
+		for y := 0; y < height; y++ {
+			transform(data[y*width:(y+1)*width], evenRow)
+		}
+	}
+	cols := func() {
+		col := make([]float32, height)
+		for x := 0; x < width; x++ {
+			for y := range col {
+				col[y] = data[y*width+x]
+			}
+			transform(col, evenCol)
+			for y := range col {
+				data[y*width+x] = col[y]
+			}
+		}
+	}
+	if rowsFirst {
+		rows()
+		cols()
+	} else {
+		cols()
+		rows()
+	}
+}
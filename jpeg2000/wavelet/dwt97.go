@@ -287,6 +287,7 @@ func decodeStep2OpenJPEG97Float32(data []float32, flStart, fwStart, end, m int32
 }
 
 // Forward97_2DFloat32WithParity performs OpenJPEG's forward 9/7 transform on float32 data.
+// All-zero rows and columns transform to zero and are skipped.
 func Forward97_2DFloat32WithParity(data []float32, width, height, stride int, evenRow, evenCol bool) {
 	if width <= 1 && height <= 1 {
 		return
@@ -296,8 +297,13 @@ func Forward97_2DFloat32WithParity(data []float32, width, height, stride int, ev
 	if height > 1 {
 		col := make([]float32, height)
 		for x := 0; x < width; x++ {
+			nonzero := false
 			for y := 0; y < height; y++ {
 				col[y] = data[y*stride+x]
+				nonzero = nonzero || col[y] != 0
+			}
+			if !nonzero {
+				continue
 			}
 			Forward97_1DFloat32WithParity(col, evenCol)
 			for y := 0; y < height; y++ {
@@ -310,8 +316,13 @@ func Forward97_2DFloat32WithParity(data []float32, width, height, stride int, ev
 	if width > 1 {
 		row := make([]float32, width)
 		for y := 0; y < height; y++ {
+			nonzero := false
 			for x := 0; x < width; x++ {
 				row[x] = data[y*stride+x]
+				nonzero = nonzero || row[x] != 0
+			}
+			if !nonzero {
+				continue
 			}
 			Forward97_1DFloat32WithParity(row, evenRow)
 			for x := 0; x < width; x++ {
@@ -351,7 +362,8 @@ func ForwardMultilevel97WithParity(data []float64, width, height, levels int, x0
 }
 
 // Inverse97_2DOpenJPEGWithParity matches OpenJPEG's opj_dwt_decode_tile_97
-// order: horizontal rows first, then vertical columns.
+// order: horizontal rows first, then vertical columns. All-zero rows and
+// columns are skipped.
 func Inverse97_2DOpenJPEGWithParity(data []float32, width, height, stride int, evenRow, evenCol bool) {
 	if width <= 1 && height <= 1 {
 		return
@@ -360,8 +372,13 @@ func Inverse97_2DOpenJPEGWithParity(data []float32, width, height, stride int, e
 	if width > 1 {
 		row := make([]float32, width)
 		for y := 0; y < height; y++ {
+			nonzero := false
 			for x := 0; x < width; x++ {
 				row[x] = data[y*stride+x]
+				nonzero = nonzero || row[x] != 0
+			}
+			if !nonzero {
+				continue
 			}
 			Inverse97_1DOpenJPEGWithParity(row, evenRow)
 			for x := 0; x < width; x++ {
@@ -373,8 +390,13 @@ func Inverse97_2DOpenJPEGWithParity(data []float32, width, height, stride int, e
 	if height > 1 {
 		col := make([]float32, height)
 		for x := 0; x < width; x++ {
+			nonzero := false
 			for y := 0; y < height; y++ {
 				col[y] = data[y*stride+x]
+				nonzero = nonzero || col[y] != 0
+			}
+			if !nonzero {
+				continue
 			}
 			Inverse97_1DOpenJPEGWithParity(col, evenCol)
 			for y := 0; y < height; y++ {
@@ -461,21 +483,33 @@ func ConvertInt32ToFloat64(data []int32) []float64 {
 
 // ConvertInt32ToFloat32 converts a slice of int32 to OpenJPEG's irreversible sample type.
 func ConvertInt32ToFloat32(data []int32) []float32 {
-	result := make([]float32, len(data))
+	return ConvertInt32ToFloat32Into(make([]float32, len(data)), data)
+}
+
+// ConvertInt32ToFloat32Into is ConvertInt32ToFloat32 writing into dst, which
+// must be at least len(data) long. It returns dst[:len(data)].
+func ConvertInt32ToFloat32Into(dst []float32, data []int32) []float32 {
+	dst = dst[:len(data)]
 	for i, v := range data {
-		result[i] = float32(v)
+		dst[i] = float32(v)
 	}
-	return result
+	return dst
 }
 
 // ConvertFloat32ToInt32OpenJPEG rounds like OpenJPEG's opj_lrintf-based
 // irreversible decode finalization.
 func ConvertFloat32ToInt32OpenJPEG(data []float32) []int32 {
-	result := make([]int32, len(data))
+	return ConvertFloat32ToInt32OpenJPEGInto(make([]int32, len(data)), data)
+}
+
+// ConvertFloat32ToInt32OpenJPEGInto is ConvertFloat32ToInt32OpenJPEG writing
+// into dst, which must be at least len(data) long. It returns dst[:len(data)].
+func ConvertFloat32ToInt32OpenJPEGInto(dst []int32, data []float32) []int32 {
+	dst = dst[:len(data)]
 	for i, v := range data {
-		result[i] = int32(roundFloat32ToNearestEven(v))
+		dst[i] = int32(roundFloat32ToNearestEven(v))
 	}
-	return result
+	return dst
 }
 
 func roundFloat32ToNearestEven(v float32) int64 {
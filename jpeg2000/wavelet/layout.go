@@ -42,3 +42,19 @@ func nextLowpassWindow(width, height, x0, y0 int) (nextWidth, nextHeight, nextX0
 	nextY0 = nextCoord(y0)
 	return
 }
+
+// ConstantLowpass53 reports whether the 5/3 decomposition of a constant
+// width x height tile at (x0,y0) is that constant throughout the final LL
+// subband and zero in every other subband, and returns the LL dimensions.
+// This holds when every decomposed level is at least two samples wide and
+// high; a lone sample at an odd coordinate becomes a high-pass coefficient.
+// Encoders and decoders use it to skip the transform of constant tiles.
+func ConstantLowpass53(width, height, levels, x0, y0 int) (llWidth, llHeight int, ok bool) {
+	for level := 0; level < levels; level++ {
+		if width < 2 || height < 2 {
+			return 0, 0, false
+		}
+		width, height, x0, y0 = nextLowpassWindow(width, height, x0, y0)
+	}
+	return width, height, width > 0 && height > 0
+}
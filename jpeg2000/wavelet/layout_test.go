@@ -54,3 +54,50 @@ func TestLLDimensionsWithParity(t *testing.T) {
 		})
 	}
 }
+
+func TestConstantLowpass53(t *testing.T) {
+	const value = -37
+	for _, size := range [][2]int{{64, 64}, {37, 23}, {5, 9}, {2, 2}, {3, 1}, {1, 6}} {
+		for _, origin := range [][2]int{{0, 0}, {1, 0}, {3, 5}} {
+			for levels := 0; levels <= 4; levels++ {
+				w, h, x0, y0 := size[0], size[1], origin[0], origin[1]
+				llW, llH, ok := ConstantLowpass53(w, h, levels, x0, y0)
+				data := make([]int32, w*h)
+				for i := range data {
+					data[i] = value
+				}
+				ForwardMultilevelWithParity(data, w, h, levels, x0, y0)
+				exact := true
+				for y := 0; y < h; y++ {
+					for x := 0; x < w; x++ {
+						want := int32(0)
+						if x < llW && y < llH {
+							want = value
+						}
+						if data[y*w+x] != want {
+							exact = false
+						}
+					}
+				}
+				if ok && !exact {
+					t.Errorf("%dx%d at (%d,%d), %d levels: forward transform is not the constant LL", w, h, x0, y0, levels)
+				}
+				if !ok {
+					continue
+				}
+				InverseMultilevelWithParity(data, w, h, levels, x0, y0)
+				for i, v := range data {
+					if v != value {
+						t.Fatalf("%dx%d at (%d,%d), %d levels: inverse sample %d = %d", w, h, x0, y0, levels, i, v)
+					}
+				}
+			}
+		}
+	}
+	if _, _, ok := ConstantLowpass53(64, 64, 3, 0, 0); !ok {
+		t.Error("64x64 with 3 levels should have a constant LL")
+	}
+	if _, _, ok := ConstantLowpass53(1, 8, 1, 1, 0); ok {
+		t.Error("a single odd column should not qualify")
+	}
+}
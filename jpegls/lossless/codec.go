@@ -4,6 +4,9 @@ package lossless
 import (
 	"fmt"
 
+	"github.com/cocosip/go-dicom-codecs/codec/layout"
+	"github.com/cocosip/go-dicom-codecs/codec/limits"
+	"github.com/cocosip/go-dicom-codecs/codec/voi"
 	"github.com/cocosip/go-dicom/pkg/dicom/transfer"
 	"github.com/cocosip/go-dicom/pkg/imaging/codec"
 	"github.com/cocosip/go-dicom/pkg/imaging/imagetypes"
@@ -75,8 +78,13 @@ func (c *JPEGLSLosslessCodec) Encode(oldPixelData imagetypes.PixelData, newPixel
 		// both signed and unsigned data without needing pixel value shifting.
 		// DO NOT shift pixel data for lossless encoding.
 
-		// Encode using the JPEG-LS encoder
-		jpegData, err := Encode(
+		// Encode using the JPEG-LS encoder; planar frames get one scan per
+		// component.
+		encode := Encode
+		if frameInfo.PlanarConfiguration == 1 {
+			encode = EncodePlanar
+		}
+		jpegData, err := encode(
 			frameData, // No adjustment needed
 			int(frameInfo.Width),
 			int(frameInfo.Height),
@@ -97,7 +105,7 @@ func (c *JPEGLSLosslessCodec) Encode(oldPixelData imagetypes.PixelData, newPixel
 }
 
 // Decode decodes JPEG-LS Lossless data to uncompressed pixel data
-func (c *JPEGLSLosslessCodec) Decode(oldPixelData imagetypes.PixelData, newPixelData imagetypes.PixelData, _ codec.Parameters) error {
+func (c *JPEGLSLosslessCodec) Decode(oldPixelData imagetypes.PixelData, newPixelData imagetypes.PixelData, parameters codec.Parameters) error {
 	if oldPixelData == nil || newPixelData == nil {
 		return fmt.Errorf("source and destination PixelData cannot be nil")
 	}
@@ -113,6 +121,12 @@ func (c *JPEGLSLosslessCodec) Decode(oldPixelData imagetypes.PixelData, newPixel
 	if frameCount == 0 {
 		return fmt.Errorf("source pixel data is empty (no frames)")
 	}
+	renderer, err := voi.RendererFromParameters(parameters, int(frameInfo.BitsStored), frameInfo.PixelRepresentation == 1)
+	if err != nil {
+		return err
+	}
+	decoder := NewDecoder()
+	decoder.SetLimits(limits.FromParameters(parameters))
 	for frameIndex := 0; frameIndex < frameCount; frameIndex++ {
 		// Get encoded frame data
 		frameData, err := oldPixelData.GetFrame(frameIndex)
@@ -125,7 +139,7 @@ func (c *JPEGLSLosslessCodec) Decode(oldPixelData imagetypes.PixelData, newPixel
 		}
 
 		// Decode using the JPEG-LS decoder
-		pixelData, width, height, _, _, err := Decode(frameData)
+		pixelData, width, height, _, _, err := decoder.DecodeRendered(frameData, renderer)
 		if err != nil {
 			return fmt.Errorf("JPEG-LS Lossless decode failed for frame %d: %w", frameIndex, err)
 		}
@@ -147,6 +161,9 @@ func (c *JPEGLSLosslessCodec) Decode(oldPixelData imagetypes.PixelData, newPixel
 		}
 	}
 
+	if renderer != nil {
+		layout.ReportRendered(parameters)
+	}
 	return nil
 }
 
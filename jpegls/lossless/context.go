@@ -121,6 +121,14 @@ type ContextTable struct {
 
 // NewContextTable creates a new context table.
 func NewContextTable(maxVal, near, reset int) *ContextTable {
+	ct := &ContextTable{}
+	ct.Reset(maxVal, near, reset)
+	return ct
+}
+
+// Reset returns every context to its initial state for the given parameters,
+// reusing the contexts already allocated by the table.
+func (ct *ContextTable) Reset(maxVal, near, reset int) {
 	// CharLS uses 365 contexts after sign symmetry (|ID| <= 364)
 	numContexts := 365
 	rangeVal := maxVal + 1
@@ -128,22 +136,26 @@ func NewContextTable(maxVal, near, reset int) *ContextTable {
 		rangeVal = (maxVal+2*near)/(2*near+1) + 1
 	}
 
-	contexts := make([]*Context, numContexts)
-	for i := range contexts {
-		contexts[i] = NewContext(rangeVal)
+	if len(ct.contexts) != numContexts {
+		ct.contexts = make([]*Context, numContexts)
+		for i := range ct.contexts {
+			ct.contexts[i] = NewContext(rangeVal)
+		}
+	} else {
+		initial := NewContext(rangeVal)
+		for _, ctx := range ct.contexts {
+			*ctx = *initial
+		}
 	}
 
 	if reset == 0 {
 		reset = 64
 	}
 
-	return &ContextTable{
-		contexts: contexts,
-		maxVal:   maxVal,
-		rangeVal: rangeVal,
-		near:     near,
-		reset:    reset,
-	}
+	ct.maxVal = maxVal
+	ct.rangeVal = rangeVal
+	ct.near = near
+	ct.reset = reset
 }
 
 // GetContext returns the context for given (q1, q2, q3)
@@ -4,7 +4,12 @@ import (
 	"bytes"
 	"fmt"
 	"io"
+	"math/bits"
+	"sync"
 
+	"github.com/cocosip/go-dicom-codecs/codec/limits"
+	"github.com/cocosip/go-dicom-codecs/codec/voi"
+	"github.com/cocosip/go-dicom-codecs/internal/replay"
 	"github.com/cocosip/go-dicom-codecs/jpeg/standard"
 	"github.com/cocosip/go-dicom-codecs/jpegls/runmode"
 )
@@ -19,29 +24,91 @@ type Decoder struct {
 	interleave int
 	traits     Traits
 
+	componentIDs  [3]int  // component identifiers declared by SOF55
+	scanComponent int     // component of an ILV=0 scan, -1 for all
+	scanned       [3]bool // components decoded by the scans so far
+
 	contextTable   *ContextTable
 	quantizer      *GradientQuantizer
 	runModeScanner *RunModeScanner
+
+	renderer *voi.Renderer // optional display rendering of the output
+	limits   limits.DecodeLimits
+
+	// Scan and sample buffers, reused across codestreams.
+	scanData bytes.Buffer
+	golomb   GolombReader
+	pixels   []int
 }
 
-// NewDecoder creates a new JPEG-LS decoder
+// NewDecoder creates a new JPEG-LS decoder. A decoder may be reused for any
+// number of codestreams; each Decode starts with a Reset.
 func NewDecoder() *Decoder {
 	return &Decoder{}
 }
 
-// computeErrorValue mirrors encoder compute_error_value: for Near=0 use unsigned wrap.
+// SetLimits sets the limits the frame declared by SOF55 must satisfy before
+// the sample buffer is allocated. The zero value applies the defaults.
+func (dec *Decoder) SetLimits(l limits.DecodeLimits) {
+	dec.limits = l
+}
+
+// Reset clears the codestream state of dec while keeping its context table,
+// scan buffer and sample buffer for the next Decode.
+func (dec *Decoder) Reset() {
+	dec.width, dec.height, dec.components, dec.bitDepth = 0, 0, 0, 0
+	dec.maxVal, dec.interleave = 0, 0
+	dec.scanComponent, dec.scanned = 0, [3]bool{}
+	dec.traits = Traits{}
+	dec.quantizer = nil
+	dec.runModeScanner = nil
+	dec.renderer = nil
+	dec.scanData.Reset()
+	dec.golomb.Reset(nil)
+}
+
+// decoderPool keeps decoders with their context tables, scan bytes and
+// sample buffers.
+var decoderPool = sync.Pool{New: func() any { return NewDecoder() }}
+
+// computeErrorValue mirrors encoder compute_error_value: sign-extend from the
+// sample precision.
 func (dec *Decoder) computeErrorValue(delta int) int {
-	if dec.bitDepth <= 8 {
-		return int(int8(delta))
-	}
-	return int(int16(delta))
+	shift := bits.UintSize - dec.bitDepth
+	return delta << shift >> shift
 }
 
 // Decode decodes JPEG-LS compressed data
 // Returns: pixelData, width, height, components, bitDepth, error
 func Decode(jpegLSData []byte) ([]byte, int, int, int, int, error) {
-	decoder := NewDecoder()
-	return decoder.decode(jpegLSData)
+	decoder := decoderPool.Get().(*Decoder)
+	defer decoderPool.Put(decoder)
+	return decoder.Decode(jpegLSData)
+}
+
+// DecodeRendered decodes JPEG-LS data and maps every sample through renderer,
+// returning one 8-bit display value per sample instead of the stored
+// representation. The returned bit depth is that of the codestream.
+func DecodeRendered(jpegLSData []byte, renderer *voi.Renderer) ([]byte, int, int, int, int, error) {
+	decoder := decoderPool.Get().(*Decoder)
+	defer decoderPool.Put(decoder)
+	return decoder.DecodeRendered(jpegLSData, renderer)
+}
+
+// Decode resets dec and decodes one codestream. The returned pixel data is
+// newly allocated and not retained by dec.
+func (dec *Decoder) Decode(jpegLSData []byte) ([]byte, int, int, int, int, error) {
+	dec.Reset()
+	return dec.decode(jpegLSData)
+}
+
+// DecodeRendered is Decode with display rendering, as the package-level
+// DecodeRendered.
+func (dec *Decoder) DecodeRendered(jpegLSData []byte, renderer *voi.Renderer) ([]byte, int, int, int, int, error) {
+	dec.Reset()
+	dec.renderer = renderer
+	defer func() { dec.renderer = nil }()
+	return dec.decode(jpegLSData)
 }
 
 // decode performs the actual decoding
@@ -80,17 +147,29 @@ func (dec *Decoder) decode(jpegLSData []byte) ([]byte, int, int, int, int, error
 			}
 
 		case standard.MarkerSOS:
-			if err := dec.parseSOS(reader); err != nil {
-				return nil, 0, 0, 0, 0, err
-			}
+			// A sample-interleaved scan holds every component; ILV=0 images
+			// follow their first scan with one per remaining component.
+			for scans := 1; ; scans++ {
+				if err := dec.parseSOS(reader); err != nil {
+					return nil, 0, 0, 0, 0, err
+				}
 
-			// Decode scan data
-			pixelData, err := dec.decodeScan(reader)
-			if err != nil {
-				return nil, 0, 0, 0, 0, err
+				// Decode scan data
+				next, err := dec.decodeScan(reader)
+				if err != nil {
+					return nil, 0, 0, 0, 0, err
+				}
+				if dec.scanComponent < 0 || scans == dec.components {
+					break
+				}
+				if next != standard.MarkerSOS {
+					return nil, 0, 0, 0, 0, fmt.Errorf("JPEG-LS data ends after %d of %d component scans", scans, dec.components)
+				}
+				dec.resetContexts()
 			}
 
-			return pixelData, dec.width, dec.height, dec.components, dec.bitDepth, nil
+			totalPixels := dec.width * dec.height * dec.components
+			return dec.integersToPixels(dec.pixels[:totalPixels]), dec.width, dec.height, dec.components, dec.bitDepth, nil
 
 		case standard.MarkerEOI:
 			return nil, 0, 0, 0, 0, fmt.Errorf("unexpected EOI before scan data")
@@ -132,6 +211,18 @@ func (dec *Decoder) parseSOF55(reader *standard.Reader) error {
 	if dec.components != 1 && dec.components != 3 {
 		return standard.ErrInvalidComponents
 	}
+	if len(data) < 6+dec.components*3 {
+		return standard.ErrInvalidSOF
+	}
+	for i := 0; i < dec.components; i++ {
+		dec.componentIDs[i] = int(data[6+i*3])
+	}
+
+	// Samples are decoded into one int per sample before packing.
+	samples := int64(dec.width) * int64(dec.height) * int64(dec.components)
+	if err := dec.limits.CheckFrame(dec.width, dec.height, dec.components, samples*(8+2)); err != nil {
+		return err
+	}
 
 	dec.maxVal = (1 << uint(dec.bitDepth)) - 1
 	dec.traits = NewTraits(dec.maxVal, 0, 64)
@@ -149,7 +240,11 @@ func (dec *Decoder) initCodingParameters(t1, t2, t3 int) {
 
 	dec.traits = NewTraits(dec.maxVal, 0, params.Reset)
 	dec.quantizer = NewGradientQuantizer(t1, t2, t3, dec.traits.Near)
-	dec.contextTable = NewContextTable(dec.maxVal, 0, dec.traits.Reset)
+	if dec.contextTable == nil {
+		dec.contextTable = NewContextTable(dec.maxVal, 0, dec.traits.Reset)
+	} else {
+		dec.contextTable.Reset(dec.maxVal, 0, dec.traits.Reset)
+	}
 	dec.runModeScanner = NewRunModeScanner(dec.traits)
 }
 
@@ -207,31 +302,57 @@ func (dec *Decoder) parseSOS(reader *standard.Reader) error {
 	}
 
 	numComponents := int(data[0])
-	if numComponents != dec.components {
-		return fmt.Errorf("SOS component count mismatch")
-	}
 	dec.interleave = int(data[len(data)-2])
-	if dec.components == 1 && dec.interleave != 0 {
-		return fmt.Errorf("invalid JPEG-LS interleave mode %d for grayscale scan", dec.interleave)
-	}
-	if dec.components > 1 && dec.interleave != 2 {
-		return fmt.Errorf("unsupported JPEG-LS interleave mode %d for RGB scan", dec.interleave)
+	switch {
+	case numComponents == dec.components && dec.components == 1:
+		if dec.interleave != 0 {
+			return fmt.Errorf("invalid JPEG-LS interleave mode %d for grayscale scan", dec.interleave)
+		}
+		dec.scanComponent = 0
+	case numComponents == dec.components:
+		if dec.interleave != 2 {
+			return fmt.Errorf("unsupported JPEG-LS interleave mode %d for RGB scan", dec.interleave)
+		}
+		dec.scanComponent = -1
+	case numComponents == 1 && dec.interleave == 0:
+		// One component of an ILV=0 image
+		dec.scanComponent = -1
+		for i := 0; i < dec.components; i++ {
+			if dec.componentIDs[i] == int(data[1]) {
+				dec.scanComponent = i
+			}
+		}
+		if dec.scanComponent < 0 || dec.scanned[dec.scanComponent] {
+			return fmt.Errorf("invalid JPEG-LS scan component %d", data[1])
+		}
+	default:
+		return fmt.Errorf("SOS component count mismatch")
 	}
 
 	return nil
 }
 
-// decodeScan decodes the scan data
-func (dec *Decoder) decodeScan(reader *standard.Reader) ([]byte, error) {
-	// Read all remaining data until EOI
-	var scanData bytes.Buffer
+// resetContexts returns the contexts and run state to their initial values
+// for the next scan.
+func (dec *Decoder) resetContexts() {
+	dec.contextTable.Reset(dec.maxVal, 0, dec.traits.Reset)
+	dec.runModeScanner = NewRunModeScanner(dec.traits)
+}
+
+// decodeScan decodes the scan data into dec.pixels and returns the marker
+// that ends the scan, or 0 at the end of the data.
+func (dec *Decoder) decodeScan(reader *standard.Reader) (uint16, error) {
+	// Read all remaining data until the next marker
+	scanData := &dec.scanData
+	scanData.Reset()
+	var next uint16
 	for {
 		b, err := reader.ReadByte()
 		if err != nil {
 			if err == io.EOF {
 				break
 			}
-			return nil, err
+			return 0, err
 		}
 
 		if b == 0xFF {
@@ -241,7 +362,7 @@ func (dec *Decoder) decodeScan(reader *standard.Reader) ([]byte, error) {
 					scanData.WriteByte(b)
 					break
 				}
-				return nil, err
+				return 0, err
 			}
 
 			// JPEG-LS byte stuffing: after 0xFF, next byte has high bit = 0 (stuffed bit)
@@ -253,34 +374,42 @@ func (dec *Decoder) decodeScan(reader *standard.Reader) ([]byte, error) {
 				scanData.WriteByte(b2)
 				continue
 			}
-			if b2 == 0xD9 {
-				break
+			if b2 >= 0xD0 && b2 <= 0xD7 {
+				// restart markers: ignore marker, continue decoding data after it
+				continue
 			}
-			// restart markers: ignore marker, continue decoding data after it
-			continue
+			next = 0xFF00 | uint16(b2)
+			break
 		}
 		scanData.WriteByte(b)
 	}
 
-	// Create Golomb reader
-	gr := NewGolombReader(bytes.NewReader(scanData.Bytes()))
+	gr := &dec.golomb
+	gr.Reset(scanData.Bytes())
 
-	// Allocate pixel array
+	// Reuse the sample buffer of a previous codestream when it is large
+	// enough; the first scan of an image clears it.
 	totalPixels := dec.width * dec.height * dec.components
-	pixels := make([]int, totalPixels)
+	if cap(dec.pixels) < totalPixels {
+		dec.pixels = make([]int, totalPixels)
+	}
+	pixels := dec.pixels[:totalPixels]
+	if dec.scanned == [3]bool{} {
+		clear(pixels)
+	}
 
-	if dec.components > 1 {
-		if err := dec.decodeSampleInterleaved(gr, pixels); err != nil {
-			return nil, err
+	if dec.scanComponent >= 0 {
+		if err := dec.decodeComponent(gr, pixels, dec.scanComponent); err != nil {
+			return 0, err
 		}
+		dec.scanned[dec.scanComponent] = true
 	} else {
-		if err := dec.decodeComponent(gr, pixels, 0); err != nil {
-			return nil, err
+		if err := dec.decodeSampleInterleaved(gr, pixels); err != nil {
+			return 0, err
 		}
 	}
 
-	// Convert integers to bytes
-	return dec.integersToPixels(pixels), nil
+	return next, nil
 }
 
 func (dec *Decoder) decodeSampleInterleaved(gr *GolombReader, pixels []int) error {
@@ -333,6 +462,9 @@ func (dec *Decoder) decodeRegularSample(gr *GolombReader, pixels []int, x, y, co
 	if err != nil {
 		return fmt.Errorf("decode regular at x=%d y=%d comp=%d (bits=%d): %w", x, y, comp, gr.bitsRead, err)
 	}
+	if replay.GolombValue != nil {
+		replay.GolombValue(k, mappedError)
+	}
 	errorValue := UnmapErrorValue(mappedError)
 	if k == 0 {
 		errorValue ^= ctx.GetErrorCorrection(k, 0)
@@ -472,6 +604,9 @@ func (dec *Decoder) decodeComponent(gr *GolombReader, pixels []int, comp int) er
 				if err != nil {
 					return fmt.Errorf("decode regular at x=%d y=%d comp=%d (bits=%d): %w", x, y, comp, gr.bitsRead, err)
 				}
+				if replay.GolombValue != nil {
+					replay.GolombValue(k, mappedError)
+				}
 
 				// Unmap error (before sign)
 				errorValue := UnmapErrorValue(mappedError)
@@ -635,6 +770,20 @@ func (dec *Decoder) getNeighbors(pixels []int, x, y, comp int) (int, int, int, i
 
 // integersToPixels converts integer array to pixel bytes
 func (dec *Decoder) integersToPixels(pixels []int) []byte {
+	if dec.renderer != nil {
+		// Display output: one byte per sample through the VOI renderer
+		pixelData := make([]byte, len(pixels))
+		for i, val := range pixels {
+			if val < 0 {
+				val = 0
+			} else if val > dec.maxVal {
+				val = dec.maxVal
+			}
+			pixelData[i] = dec.renderer.MapStored(val)
+		}
+		return pixelData
+	}
+
 	if dec.bitDepth <= 8 {
 		// 8-bit: one byte per sample
 		pixelData := make([]byte, len(pixels))
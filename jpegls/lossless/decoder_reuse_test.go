@@ -0,0 +1,141 @@
+package lossless
+
+import (
+	"bytes"
+	"runtime"
+	"testing"
+)
+
+// allocatedPerRun returns the average number of bytes allocated by f.
+func allocatedPerRun(runs int, f func()) uint64 {
+	var before, after runtime.MemStats
+	runtime.ReadMemStats(&before)
+	for i := 0; i < runs; i++ {
+		f()
+	}
+	runtime.ReadMemStats(&after)
+	return (after.TotalAlloc - before.TotalAlloc) / uint64(runs)
+}
+
+func TestDecoderReuse(t *testing.T) {
+	type image struct {
+		width, height, components, bitDepth int
+	}
+	images := []image{{64, 48, 1, 8}, {33, 17, 3, 8}, {40, 40, 1, 12}, {16, 16, 1, 8}}
+	var streams, originals [][]byte
+	for i, img := range images {
+		bytesPerSample := (img.bitDepth + 7) / 8
+		pixels := make([]byte, img.width*img.height*img.components*bytesPerSample)
+		for p := range pixels {
+			pixels[p] = byte(p*7 + i*31)
+			if bytesPerSample == 2 && p%2 == 1 {
+				pixels[p] &= 0x0F
+			}
+		}
+		encoded, err := Encode(pixels, img.width, img.height, img.components, img.bitDepth)
+		if err != nil {
+			t.Fatalf("Encode image %d: %v", i, err)
+		}
+		streams = append(streams, encoded)
+		originals = append(originals, pixels)
+	}
+
+	dec := NewDecoder()
+	for pass := 0; pass < 2; pass++ {
+		for i, stream := range streams {
+			decoded, w, h, c, bd, err := dec.Decode(stream)
+			if err != nil {
+				t.Fatalf("pass %d image %d: %v", pass, i, err)
+			}
+			img := images[i]
+			if w != img.width || h != img.height || c != img.components || bd != img.bitDepth {
+				t.Fatalf("pass %d image %d: got %dx%dx%d %d-bit", pass, i, w, h, c, bd)
+			}
+			if !bytes.Equal(decoded, originals[i]) {
+				t.Fatalf("pass %d image %d: reused decoder output differs from the original", pass, i)
+			}
+		}
+	}
+}
+
+func TestDecoderReuseAllocatesOutputOnly(t *testing.T) {
+	const width, height = 256, 256
+	pixels := make([]byte, width*height)
+	for i := range pixels {
+		pixels[i] = byte(i % 251)
+	}
+	encoded, err := Encode(pixels, width, height, 1, 8)
+	if err != nil {
+		t.Fatalf("Encode: %v", err)
+	}
+
+	dec := NewDecoder()
+	decode := func() {
+		if _, _, _, _, _, err := dec.Decode(encoded); err != nil {
+			t.Fatalf("Decode: %v", err)
+		}
+	}
+	decode() // sizes the scratch
+	perFrame := allocatedPerRun(10, decode)
+	// The output frame plus small per-codestream state; the sample buffer
+	// alone would be 8x the output if it were allocated per frame.
+	if limit := uint64(len(pixels) + 16<<10); perFrame > limit {
+		t.Fatalf("reused decoder allocated %d bytes per frame, want at most %d", perFrame, limit)
+	}
+}
+
+func TestEncoderReuse(t *testing.T) {
+	type image struct {
+		width, height, components, bitDepth int
+	}
+	images := []image{{64, 48, 1, 8}, {33, 17, 3, 8}, {40, 40, 1, 12}, {64, 48, 1, 8}}
+	enc := NewEncoder(1, 1, 1, 8)
+	for i, img := range images {
+		bytesPerSample := (img.bitDepth + 7) / 8
+		pixels := make([]byte, img.width*img.height*img.components*bytesPerSample)
+		for p := range pixels {
+			pixels[p] = byte(p*7 + i*31)
+			if bytesPerSample == 2 && p%2 == 1 {
+				pixels[p] &= 0x0F
+			}
+		}
+		want, err := NewEncoder(img.width, img.height, img.components, img.bitDepth).Encode(pixels)
+		if err != nil {
+			t.Fatalf("fresh Encode image %d: %v", i, err)
+		}
+		enc.Reset(img.width, img.height, img.components, img.bitDepth)
+		for pass := 0; pass < 2; pass++ {
+			got, err := enc.Encode(pixels)
+			if err != nil {
+				t.Fatalf("pass %d image %d: %v", pass, i, err)
+			}
+			if !bytes.Equal(got, want) {
+				t.Fatalf("pass %d image %d: reused encoder output differs from a fresh encode", pass, i)
+			}
+		}
+	}
+}
+
+func TestEncoderReuseAllocatesOutputOnly(t *testing.T) {
+	const width, height = 256, 256
+	pixels := make([]byte, width*height)
+	for i := range pixels {
+		pixels[i] = byte(i % 251)
+	}
+
+	enc := NewEncoder(width, height, 1, 8)
+	var stream []byte
+	encode := func() {
+		var err error
+		if stream, err = enc.Encode(pixels); err != nil {
+			t.Fatalf("Encode: %v", err)
+		}
+	}
+	encode() // sizes the scratch
+	perFrame := allocatedPerRun(10, encode)
+	// The output stream plus small per-frame state; the sample buffer alone
+	// would be 8x the input if it were allocated per frame.
+	if limit := uint64(len(stream) + 16<<10); perFrame > limit {
+		t.Fatalf("reused encoder allocated %d bytes per frame, want at most %d", perFrame, limit)
+	}
+}
@@ -3,6 +3,8 @@ package lossless
 import (
 	"bytes"
 	"fmt"
+	"math/bits"
+	"sync"
 
 	"github.com/cocosip/go-dicom-codecs/jpeg/standard"
 	"github.com/cocosip/go-dicom-codecs/jpegls/runmode"
@@ -20,30 +22,65 @@ type Encoder struct {
 	contextTable   *ContextTable
 	quantizer      *GradientQuantizer
 	runModeScanner *RunModeScanner // Manages run mode state and operations
+
+	// Reset keeps these buffers.
+	pixels  []int
+	golomb  GolombWriter
+	scanBuf bytes.Buffer
+	out     bytes.Buffer
 }
 
-// NewEncoder creates a new JPEG-LS encoder
+// NewEncoder creates a new JPEG-LS encoder. An encoder may be reused for
+// frames of other geometries by calling Reset.
 func NewEncoder(width, height, components, bitDepth int) *Encoder {
+	enc := &Encoder{}
+	enc.Reset(width, height, components, bitDepth)
+	return enc
+}
+
+// Reset prepares enc for a frame of the given geometry, returning every
+// context to its initial state while keeping the context table, sample
+// buffer and output buffers for the next Encode.
+func (enc *Encoder) Reset(width, height, components, bitDepth int) {
 	maxVal := (1 << uint(bitDepth)) - 1
 	traits := NewTraits(maxVal, 0, 64)
 
-	return &Encoder{
-		width:          width,
-		height:         height,
-		components:     components,
-		bitDepth:       bitDepth,
-		maxVal:         maxVal,
-		traits:         traits,
-		contextTable:   NewContextTable(maxVal, 0, traits.Reset),
-		quantizer:      NewGradientQuantizer(traits.T1, traits.T2, traits.T3, traits.Near),
-		runModeScanner: NewRunModeScanner(traits),
+	enc.width = width
+	enc.height = height
+	enc.components = components
+	enc.bitDepth = bitDepth
+	enc.maxVal = maxVal
+	enc.traits = traits
+	if enc.contextTable == nil {
+		enc.contextTable = NewContextTable(maxVal, 0, traits.Reset)
+	} else {
+		enc.contextTable.Reset(maxVal, 0, traits.Reset)
 	}
+	enc.quantizer = NewGradientQuantizer(traits.T1, traits.T2, traits.T3, traits.Near)
+	enc.runModeScanner = NewRunModeScanner(traits)
+	enc.golomb.Reset(nil)
+	enc.scanBuf.Reset()
+	enc.out.Reset()
 }
 
+// encoderPool keeps encoders whose context table and sample buffer Reset
+// reinitializes in place.
+var encoderPool = sync.Pool{New: func() any { return &Encoder{} }}
+
 // Encode encodes pixel data to JPEG-LS format
 // pixelData: raw pixel values (interleaved for multi-component)
 // Returns: JPEG-LS compressed data
 func Encode(pixelData []byte, width, height, components, bitDepth int) ([]byte, error) {
+	return encodeFrame(pixelData, width, height, components, bitDepth, false)
+}
+
+// EncodePlanar encodes pixel data holding one plane per component (DICOM
+// PlanarConfiguration=1) as one JPEG-LS scan per component (ILV=0).
+func EncodePlanar(pixelData []byte, width, height, components, bitDepth int) ([]byte, error) {
+	return encodeFrame(pixelData, width, height, components, bitDepth, true)
+}
+
+func encodeFrame(pixelData []byte, width, height, components, bitDepth int, planar bool) ([]byte, error) {
 	if width <= 0 || height <= 0 {
 		return nil, standard.ErrInvalidDimensions
 	}
@@ -56,22 +93,38 @@ func Encode(pixelData []byte, width, height, components, bitDepth int) ([]byte,
 		return nil, fmt.Errorf("invalid bit depth: %d (must be 2-16)", bitDepth)
 	}
 
-	encoder := NewEncoder(width, height, components, bitDepth)
-	return encoder.encode(pixelData)
+	encoder := encoderPool.Get().(*Encoder)
+	defer encoderPool.Put(encoder)
+	encoder.Reset(width, height, components, bitDepth)
+	return encoder.encode(pixelData, planar)
+}
+
+// Encode encodes one frame with the geometry enc was created or last Reset
+// with, starting from freshly reset contexts, so one encoder can encode a
+// series of frames. The returned stream is newly allocated and not retained
+// by enc.
+func (enc *Encoder) Encode(pixelData []byte) ([]byte, error) {
+	enc.Reset(enc.width, enc.height, enc.components, enc.bitDepth)
+	return enc.encode(pixelData, false)
+}
+
+// EncodePlanar is Encode for planar pixel data, as the package-level
+// EncodePlanar.
+func (enc *Encoder) EncodePlanar(pixelData []byte) ([]byte, error) {
+	enc.Reset(enc.width, enc.height, enc.components, enc.bitDepth)
+	return enc.encode(pixelData, true)
 }
 
-// computeErrorValue implements CharLS compute_error_value: narrow to sample precision.
+// computeErrorValue implements CharLS compute_error_value: sign-extend from
+// the sample precision, reducing the error modulo 2^bitDepth.
 func (enc *Encoder) computeErrorValue(delta int) int {
-	if enc.bitDepth <= 8 {
-		return int(int8(delta))
-	}
-	return int(int16(delta))
+	shift := bits.UintSize - enc.bitDepth
+	return delta << shift >> shift
 }
 
 // encode performs the actual encoding
-func (enc *Encoder) encode(pixelData []byte) ([]byte, error) {
-	var buf bytes.Buffer
-	writer := standard.NewWriter(&buf)
+func (enc *Encoder) encode(pixelData []byte, planar bool) ([]byte, error) {
+	writer := standard.NewWriter(&enc.out)
 
 	// Write SOI marker
 	if err := writer.WriteMarker(standard.MarkerSOI); err != nil {
@@ -83,14 +136,33 @@ func (enc *Encoder) encode(pixelData []byte) ([]byte, error) {
 		return nil, err
 	}
 
-	// Write SOS marker
-	if err := enc.writeSOS(writer); err != nil {
-		return nil, err
-	}
+	if planar && enc.components > 1 {
+		// One scan per component; every scan starts from initial contexts.
+		pixels, err := enc.planesToIntegers(pixelData)
+		if err != nil {
+			return nil, err
+		}
+		for comp := 0; comp < enc.components; comp++ {
+			if comp > 0 {
+				enc.resetContexts()
+			}
+			if err := enc.writeSOS(writer, comp); err != nil {
+				return nil, err
+			}
+			if err := enc.encodeScan(writer, pixels, comp); err != nil {
+				return nil, err
+			}
+		}
+	} else {
+		// Write SOS marker
+		if err := enc.writeSOS(writer, -1); err != nil {
+			return nil, err
+		}
 
-	// Encode scan data
-	if err := enc.encodeScan(writer, pixelData); err != nil {
-		return nil, err
+		// Encode scan data
+		if err := enc.encodeScan(writer, enc.pixelsToIntegers(pixelData), -1); err != nil {
+			return nil, err
+		}
 	}
 
 	// Write EOI marker
@@ -98,7 +170,14 @@ func (enc *Encoder) encode(pixelData []byte) ([]byte, error) {
 		return nil, err
 	}
 
-	return buf.Bytes(), nil
+	return bytes.Clone(enc.out.Bytes()), nil
+}
+
+// resetContexts returns the contexts and run state to their initial values
+// for the next scan.
+func (enc *Encoder) resetContexts() {
+	enc.contextTable.Reset(enc.maxVal, 0, enc.traits.Reset)
+	enc.runModeScanner = NewRunModeScanner(enc.traits)
 }
 
 // writeSOF55 writes Start of Frame marker for JPEG-LS
@@ -127,26 +206,35 @@ func (enc *Encoder) writeSOF55(writer *standard.Writer) error {
 	return writer.WriteSegment(0xFFF7, data)
 }
 
-// writeSOS writes Start of Scan marker
-func (enc *Encoder) writeSOS(writer *standard.Writer) error {
-	length := 4 + enc.components*2
+// writeSOS writes Start of Scan marker: a scan of every component, or of
+// component comp alone (ILV=0) when comp >= 0.
+func (enc *Encoder) writeSOS(writer *standard.Writer, comp int) error {
+	scanComponents := enc.components
+	if comp >= 0 {
+		scanComponents = 1
+	}
+	length := 4 + scanComponents*2
 	data := make([]byte, length)
 
-	data[0] = byte(enc.components) // Number of components
+	data[0] = byte(scanComponents) // Number of components
 
 	// Component selectors
-	for i := 0; i < enc.components; i++ {
+	for i := 0; i < scanComponents; i++ {
+		id := i + 1
+		if comp >= 0 {
+			id = comp + 1
+		}
 		offset := 1 + i*2
-		data[offset] = byte(i + 1) // Component ID
-		data[offset+1] = 0         // No AC/DC tables in JPEG-LS
+		data[offset] = byte(id) // Component ID
+		data[offset+1] = 0      // No AC/DC tables in JPEG-LS
 	}
 
 	// NEAR parameter (0 for lossless)
 	data[length-3] = 0
 
-	// DICOM RGB frames are interleaved (RGBRGB...), so emit a sample-interleaved
-	// JPEG-LS scan. A multi-component scan with ILV=0 is not a valid substitute.
-	if enc.components > 1 {
+	// Interleaved DICOM RGB frames (RGBRGB...) get a sample-interleaved scan;
+	// planar frames get one ILV=0 scan per component.
+	if scanComponents > 1 {
 		data[length-2] = 2
 	}
 
@@ -156,25 +244,22 @@ func (enc *Encoder) writeSOS(writer *standard.Writer) error {
 	return writer.WriteSegment(standard.MarkerSOS, data)
 }
 
-// encodeScan encodes the scan data
-func (enc *Encoder) encodeScan(writer *standard.Writer, pixelData []byte) error {
+// encodeScan encodes the scan data of every component, or of component comp
+// alone when comp >= 0
+func (enc *Encoder) encodeScan(writer *standard.Writer, pixels []int, comp int) error {
 	// Create Golomb writer for entropy coding
-	var scanBuf bytes.Buffer
-	gw := NewGolombWriter(&scanBuf)
-
-	// Convert pixel data to integers
-	pixels := enc.pixelsToIntegers(pixelData)
-	if enc.components > 1 {
-		if err := enc.encodeSampleInterleaved(gw, pixels); err != nil {
+	scanBuf := &enc.scanBuf
+	scanBuf.Reset()
+	gw := &enc.golomb
+	gw.Reset(scanBuf)
+
+	if comp >= 0 || enc.components == 1 {
+		// A single component is encoded line by line.
+		if err := enc.encodeComponent(gw, pixels, max(comp, 0)); err != nil {
 			return err
 		}
-	} else {
-		// Grayscale has one component and is encoded as a single scan.
-		for comp := 0; comp < enc.components; comp++ {
-			if err := enc.encodeComponent(gw, pixels, comp); err != nil {
-				return err
-			}
-		}
+	} else if err := enc.encodeSampleInterleaved(gw, pixels); err != nil {
+		return err
 	}
 
 	// Flush remaining bits
@@ -596,7 +681,7 @@ func (enc *Encoder) getNeighbors(pixels []int, x, y, comp int) (int, int, int, i
 func (enc *Encoder) pixelsToIntegers(pixelData []byte) []int {
 	if enc.bitDepth <= 8 {
 		// 8-bit or less: one byte per sample
-		pixels := make([]int, len(pixelData))
+		pixels := enc.pixelBuffer(len(pixelData))
 		for i, b := range pixelData {
 			pixels[i] = int(b)
 		}
@@ -606,7 +691,7 @@ func (enc *Encoder) pixelsToIntegers(pixelData []byte) []int {
 	// 9-16 bit: two bytes per sample (little-endian)
 	// Read as int16 to properly handle signed data, then convert to unsigned range
 	numPixels := len(pixelData) / 2
-	pixels := make([]int, numPixels)
+	pixels := enc.pixelBuffer(numPixels)
 	for i := 0; i < numPixels; i++ {
 		idx := i * 2
 		// Read as little-endian uint16 first
@@ -619,3 +704,38 @@ func (enc *Encoder) pixelsToIntegers(pixelData []byte) []int {
 	}
 	return pixels
 }
+
+// planesToIntegers converts planar pixel bytes (one plane per component) to
+// the sample-interleaved integer layout the scan coders index.
+func (enc *Encoder) planesToIntegers(pixelData []byte) ([]int, error) {
+	planeSize := enc.width * enc.height
+	sampleBytes := 1
+	if enc.bitDepth > 8 {
+		sampleBytes = 2
+	}
+	if len(pixelData) < planeSize*enc.components*sampleBytes {
+		return nil, standard.ErrBufferTooSmall
+	}
+
+	pixels := enc.pixelBuffer(planeSize * enc.components)
+	for comp := 0; comp < enc.components; comp++ {
+		plane := pixelData[comp*planeSize*sampleBytes:]
+		for i := 0; i < planeSize; i++ {
+			val := int(plane[i*sampleBytes])
+			if sampleBytes == 2 {
+				val |= int(plane[i*2+1]) << 8
+			}
+			pixels[i*enc.components+comp] = val
+		}
+	}
+	return pixels, nil
+}
+
+// pixelBuffer returns n samples backed by the encoder's scratch. Callers
+// overwrite every sample, so reused storage needs no clearing.
+func (enc *Encoder) pixelBuffer(n int) []int {
+	if cap(enc.pixels) < n {
+		enc.pixels = make([]int, n)
+	}
+	return enc.pixels[:n]
+}
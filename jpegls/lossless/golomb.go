@@ -12,11 +12,20 @@ type GolombWriter struct {
 	freeBitCount int    // number of free bits in buffer (32 initially)
 	isFFWritten  bool   // true if last byte written was 0xFF
 	bytesWritten int    // total bytes written
+	out          [1]byte
 }
 
 // NewGolombWriter creates a new Golomb-Rice writer
 func NewGolombWriter(w io.Writer) *GolombWriter {
-	return &GolombWriter{
+	gw := &GolombWriter{}
+	gw.Reset(w)
+	return gw
+}
+
+// Reset makes gw write to w from an empty bit buffer, so an encoder can keep
+// one writer for a series of frames.
+func (gw *GolombWriter) Reset(w io.Writer) {
+	*gw = GolombWriter{
 		w:            w,
 		freeBitCount: 32, // Start with 32 free bits
 	}
@@ -101,7 +110,8 @@ func (gw *GolombWriter) flush() error {
 			gw.freeBitCount += 8
 		}
 
-		if _, err := gw.w.Write([]byte{b}); err != nil {
+		gw.out[0] = b
+		if _, err := gw.w.Write(gw.out[:]); err != nil {
 			return err
 		}
 		gw.isFFWritten = (b == 0xFF)
@@ -265,17 +275,21 @@ func NewGolombReader(r io.Reader) *GolombReader {
 		}
 	}
 
-	gr := &GolombReader{
+	gr := &GolombReader{}
+	gr.Reset(data)
+	return gr
+}
+
+// Reset makes gr read data from the beginning. data is used in place, so a
+// decoder can keep one reader and scan buffer for a series of codestreams.
+func (gr *GolombReader) Reset(data []byte) {
+	*gr = GolombReader{
 		data:        data,
-		position:    0,
 		endPosition: len(data),
-		validBits:   0,
 	}
 
 	// Initialize positionFF to first 0xFF or end
 	gr.findJPEGMarkerStartByte()
-
-	return gr
 }
 
 // DecodeValue reads a Golomb-encoded value with limit handling
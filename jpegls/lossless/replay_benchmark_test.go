@@ -0,0 +1,75 @@
+package lossless
+
+import (
+	"testing"
+
+	"github.com/cocosip/go-dicom-codecs/internal/replay"
+)
+
+// golombReplay is one recorded regular-mode bitstream; see
+// cmd/replay-record.
+type golombReplay struct {
+	limit, qbpp int
+	checksum    int64
+	k           []byte // Golomb parameter of each value
+	stream      []byte
+}
+
+func loadGolombReplay(tb testing.TB) []golombReplay {
+	tb.Helper()
+	records, err := replay.Read("testdata/replay/golomb.gz")
+	if err != nil {
+		tb.Fatalf("load corpus: %v", err)
+	}
+	streams := make([]golombReplay, len(records))
+	for i, r := range records {
+		n := int(r.Params[2])
+		streams[i] = golombReplay{limit: int(r.Params[0]), qbpp: int(r.Params[1]), checksum: r.Params[3], k: r.Data[:n], stream: r.Data[n:]}
+	}
+	return streams
+}
+
+func TestReplayCorpus(t *testing.T) {
+	var gr GolombReader
+	for i, s := range loadGolombReplay(t) {
+		gr.Reset(s.stream)
+		values := make([]int32, len(s.k))
+		for j, k := range s.k {
+			v, err := gr.DecodeValue(int(k), s.limit, s.qbpp)
+			if err != nil {
+				t.Fatalf("stream %d: value %d: %v", i, j, err)
+			}
+			values[j] = int32(v)
+		}
+		if replay.Checksum(values) != s.checksum {
+			t.Fatalf("stream %d: decoded values differ from the recording", i)
+		}
+	}
+}
+
+// BenchmarkReplayGolombReader decodes the regular-mode Golomb values the
+// decoder reads from real 8-, 12- and 16-bit images, without prediction or
+// context updates; throughput is in bitstream bytes.
+func BenchmarkReplayGolombReader(b *testing.B) {
+	streams := loadGolombReplay(b)
+	var total, values int
+	for _, s := range streams {
+		total += len(s.stream)
+		values += len(s.k)
+	}
+	b.SetBytes(int64(total))
+	b.ReportAllocs()
+	b.ResetTimer()
+	var gr GolombReader
+	for i := 0; i < b.N; i++ {
+		for _, s := range streams {
+			gr.Reset(s.stream)
+			for _, k := range s.k {
+				if _, err := gr.DecodeValue(int(k), s.limit, s.qbpp); err != nil {
+					b.Fatal(err)
+				}
+			}
+		}
+	}
+	b.ReportMetric(float64(b.Elapsed().Nanoseconds())/float64(b.N*values), "ns/value")
+}
@@ -94,3 +94,39 @@ func TestRunInterruptionSymmetry(t *testing.T) {
 		}
 	}
 }
+
+// TestRunInterruptionLargeStep checks that a run interrupted by a step of more
+// than half the sample range is reduced modulo 2^bitDepth at precisions other
+// than 8 and 16 bits.
+func TestRunInterruptionLargeStep(t *testing.T) {
+	for _, bitDepth := range []int{6, 10, 12, 14} {
+		width, height := 64, 64
+		maxVal := 1<<bitDepth - 1
+		bytesPerSample := (bitDepth + 7) / 8
+		pixelData := make([]byte, width*height*bytesPerSample)
+		for y := 0; y < height; y++ {
+			for x := 0; x < width; x++ {
+				v := maxVal / 50
+				if x > 20 && x < 30 && y > 10 {
+					v = maxVal * 3 / 4
+				}
+				i := (y*width + x) * bytesPerSample
+				pixelData[i] = byte(v)
+				if bytesPerSample == 2 {
+					pixelData[i+1] = byte(v >> 8)
+				}
+			}
+		}
+		encoded, err := Encode(pixelData, width, height, 1, bitDepth)
+		if err != nil {
+			t.Fatalf("%d-bit: Encode failed: %v", bitDepth, err)
+		}
+		decoded, _, _, _, _, err := Decode(encoded)
+		if err != nil {
+			t.Fatalf("%d-bit: Decode failed: %v", bitDepth, err)
+		}
+		if !bytes.Equal(decoded, pixelData) {
+			t.Fatalf("%d-bit: decoded pixels differ", bitDepth)
+		}
+	}
+}
@@ -4,6 +4,10 @@ package nearlossless
 import (
 	"fmt"
 
+	"github.com/cocosip/go-dicom-codecs/codec/layout"
+	"github.com/cocosip/go-dicom-codecs/codec/limits"
+	"github.com/cocosip/go-dicom-codecs/codec/voi"
+	"github.com/cocosip/go-dicom-codecs/jpeg/standard"
 	"github.com/cocosip/go-dicom/pkg/dicom/transfer"
 	"github.com/cocosip/go-dicom/pkg/imaging/codec"
 	"github.com/cocosip/go-dicom/pkg/imaging/imagetypes"
@@ -77,6 +81,12 @@ func (c *JPEGLSNearLosslessCodec) Encode(oldPixelData imagetypes.PixelData, newP
 					nearLosslessParams.NEAR = nInt
 				}
 			}
+			if v, ok := parameters.GetParameter(paramTargetSize).(int); ok {
+				nearLosslessParams.TargetSize = v
+			}
+			if v, ok := targetRatioValue(parameters.GetParameter(paramTargetRatio)); ok {
+				nearLosslessParams.TargetRatio = v
+			}
 		}
 	} else {
 		// Use codec defaults
@@ -89,6 +99,7 @@ func (c *JPEGLSNearLosslessCodec) Encode(oldPixelData imagetypes.PixelData, newP
 		return fmt.Errorf("invalid JPEG-LS Near-Lossless parameters: %w", err)
 	}
 	near := nearLosslessParams.NEAR
+	maxNear := 0
 
 	// Process all frames
 	frameCount := oldPixelData.FrameCount()
@@ -107,17 +118,31 @@ func (c *JPEGLSNearLosslessCodec) Encode(oldPixelData imagetypes.PixelData, newP
 		}
 
 		// Encode using the JPEG-LS near-lossless encoder
-		jpegData, err := Encode(
-			frameData,
-			int(frameInfo.Width),
-			int(frameInfo.Height),
-			int(frameInfo.SamplesPerPixel),
-			int(frameInfo.BitsStored),
-			near,
-		)
+		width, height := int(frameInfo.Width), int(frameInfo.Height)
+		components, bitDepth := int(frameInfo.SamplesPerPixel), int(frameInfo.BitsStored)
+		planar := frameInfo.PlanarConfiguration == 1 && components > 1
+		if planar && (nearLosslessParams.TargetSize > 0 || nearLosslessParams.TargetRatio > 0) {
+			// The size estimates sample rows of interleaved frames.
+			if frameData, err = interleavePlanes(frameData, width*height, components, bytesPerSample(bitDepth)); err != nil {
+				return fmt.Errorf("JPEG-LS Near-Lossless encode failed for frame %d: %w", frameIndex, err)
+			}
+			planar = false
+		}
+		var jpegData []byte
+		switch {
+		case planar:
+			jpegData, err = EncodePlanar(frameData, width, height, components, bitDepth, near)
+		case nearLosslessParams.TargetSize > 0:
+			jpegData, near, err = EncodeToSize(frameData, width, height, components, bitDepth, nearLosslessParams.TargetSize)
+		case nearLosslessParams.TargetRatio > 0:
+			jpegData, near, err = EncodeToRatio(frameData, width, height, components, bitDepth, nearLosslessParams.TargetRatio)
+		default:
+			jpegData, err = Encode(frameData, width, height, components, bitDepth, near)
+		}
 		if err != nil {
 			return fmt.Errorf("JPEG-LS Near-Lossless encode failed for frame %d: %w", frameIndex, err)
 		}
+		maxNear = max(maxNear, near)
 
 		// Add encoded frame to destination
 		if err := newPixelData.AddFrame(jpegData); err != nil {
@@ -125,6 +150,13 @@ func (c *JPEGLSNearLosslessCodec) Encode(oldPixelData imagetypes.PixelData, newP
 		}
 	}
 
+	// In target-size mode report the largest NEAR chosen, i.e. the error bound
+	// that holds for every frame.
+	targeted := nearLosslessParams.TargetSize > 0 || nearLosslessParams.TargetRatio > 0
+	if targeted && parameters != nil {
+		parameters.SetParameter(paramNear, maxNear)
+	}
+
 	return nil
 }
 
@@ -145,6 +177,12 @@ func (c *JPEGLSNearLosslessCodec) Decode(oldPixelData imagetypes.PixelData, newP
 	if frameCount == 0 {
 		return fmt.Errorf("source pixel data is empty (no frames)")
 	}
+	renderer, err := voi.RendererFromParameters(parameters, int(frameInfo.BitsStored), frameInfo.PixelRepresentation == 1)
+	if err != nil {
+		return err
+	}
+	decoder := NewDecoder()
+	decoder.SetLimits(limits.FromParameters(parameters))
 	for frameIndex := 0; frameIndex < frameCount; frameIndex++ {
 		// Get encoded frame data
 		frameData, err := oldPixelData.GetFrame(frameIndex)
@@ -157,7 +195,7 @@ func (c *JPEGLSNearLosslessCodec) Decode(oldPixelData imagetypes.PixelData, newP
 		}
 
 		// Decode using the JPEG-LS near-lossless decoder
-		pixelData, width, height, _, _, near, err := Decode(frameData)
+		pixelData, width, height, _, _, near, err := decoder.DecodeRendered(frameData, renderer)
 		if err != nil {
 			return fmt.Errorf("JPEG-LS Near-Lossless decode failed for frame %d: %w", frameIndex, err)
 		}
@@ -181,9 +219,28 @@ func (c *JPEGLSNearLosslessCodec) Decode(oldPixelData imagetypes.PixelData, newP
 		}
 	}
 
+	if renderer != nil {
+		layout.ReportRendered(parameters)
+	}
 	return nil
 }
 
+// interleavePlanes returns planar frame data (one plane per component) in
+// sample-interleaved order.
+func interleavePlanes(frame []byte, planeSize, components, sampleBytes int) ([]byte, error) {
+	if len(frame) < planeSize*components*sampleBytes {
+		return nil, standard.ErrBufferTooSmall
+	}
+	out := make([]byte, planeSize*components*sampleBytes)
+	for comp := 0; comp < components; comp++ {
+		plane := frame[comp*planeSize*sampleBytes:]
+		for i := 0; i < planeSize; i++ {
+			copy(out[(i*components+comp)*sampleBytes:], plane[i*sampleBytes:(i+1)*sampleBytes])
+		}
+	}
+	return out, nil
+}
+
 // RegisterJPEGLSNearLosslessCodec registers the JPEG-LS Near-Lossless codec with the global registry
 func RegisterJPEGLSNearLosslessCodec(defaultNEAR int) {
 	registry := codec.GetGlobalRegistry()
@@ -59,6 +59,85 @@ func TestCodecRGBUsesSampleInterleave(t *testing.T) {
 	}
 }
 
+// TestCodecPlanar checks that planar frames decode, interleaved, within NEAR
+// of the source: fixed-NEAR encodes as one ILV=0 scan per component, and the
+// targeted encodes from interleaved samples.
+func TestCodecPlanar(t *testing.T) {
+	const (
+		width  = 17
+		height = 13
+		near   = 2
+	)
+
+	planeSize := width * height
+	planar := make([]byte, planeSize*3)
+	want := make([]byte, len(planar))
+	for comp := 0; comp < 3; comp++ {
+		for i := 0; i < planeSize; i++ {
+			v := byte(i*(comp+3) + comp*40)
+			planar[comp*planeSize+i] = v
+			want[i*3+comp] = v
+		}
+	}
+	frameInfo := &imagetypes.FrameInfo{
+		Width:                     width,
+		Height:                    height,
+		BitsAllocated:             8,
+		BitsStored:                8,
+		HighBit:                   7,
+		SamplesPerPixel:           3,
+		PlanarConfiguration:       1,
+		PhotometricInterpretation: "RGB",
+	}
+	src := codecHelpers.NewTestPixelData(frameInfo)
+	if err := src.AddFrame(planar); err != nil {
+		t.Fatalf("AddFrame failed: %v", err)
+	}
+
+	for _, tc := range []struct {
+		name  string
+		param string
+		value interface{}
+		scans int
+	}{
+		{"near", "near", near, 3},
+		{"targetSize", paramTargetSize, len(planar) / 3, 1},
+	} {
+		params := codec.NewBaseParameters()
+		params.SetParameter(tc.param, tc.value)
+		c := NewJPEGLSNearLosslessCodec(near)
+		encoded := codecHelpers.NewTestPixelData(frameInfo)
+		if err := c.Encode(src, encoded, params); err != nil {
+			t.Fatalf("%s: Encode failed: %v", tc.name, err)
+		}
+		frame, err := encoded.GetFrame(0)
+		if err != nil {
+			t.Fatalf("GetFrame failed: %v", err)
+		}
+		if got := bytes.Count(frame, []byte{0xFF, 0xDA}); got != tc.scans {
+			t.Errorf("%s: %d scans, want %d", tc.name, got, tc.scans)
+		}
+
+		decoded := codecHelpers.NewTestPixelData(frameInfo)
+		if err := c.Decode(encoded, decoded, nil); err != nil {
+			t.Fatalf("%s: Decode failed: %v", tc.name, err)
+		}
+		got, err := decoded.GetFrame(0)
+		if err != nil {
+			t.Fatalf("GetFrame failed: %v", err)
+		}
+		_, _, _, _, _, frameNear, err := Decode(frame)
+		if err != nil {
+			t.Fatalf("%s: Decode failed: %v", tc.name, err)
+		}
+		for i := range want {
+			if d := int(got[i]) - int(want[i]); d > frameNear || d < -frameNear {
+				t.Fatalf("%s: sample %d = %d, want %d within NEAR %d", tc.name, i, got[i], want[i], frameNear)
+			}
+		}
+	}
+}
+
 func TestDefaultEncodeOmitsLSEPresetParameters(t *testing.T) {
 	encoded, err := Encode(make([]byte, 8*8), 8, 8, 1, 8, 3)
 	if err != nil {
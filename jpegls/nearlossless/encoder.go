@@ -3,6 +3,7 @@ package nearlossless
 import (
 	"bytes"
 	"fmt"
+	"sync"
 
 	"github.com/cocosip/go-dicom-codecs/jpeg/standard"
 	"github.com/cocosip/go-dicom-codecs/jpegls/lossless"
@@ -22,29 +23,64 @@ type Encoder struct {
 	contextTable   *lossless.ContextTable
 	quantizer      *lossless.GradientQuantizer
 	runModeScanner *lossless.RunModeScanner
+
+	// Sample and output buffers; Reset empties but keeps them.
+	pixels  []int
+	golomb  lossless.GolombWriter
+	scanBuf bytes.Buffer
+	out     bytes.Buffer
 }
 
-// NewEncoder creates a new JPEG-LS near-lossless encoder
+// NewEncoder creates a new JPEG-LS near-lossless encoder. An encoder may be
+// reused for frames of other geometries or NEAR values by calling Reset.
 func NewEncoder(width, height, components, bitDepth, near int) *Encoder {
+	enc := &Encoder{}
+	enc.Reset(width, height, components, bitDepth, near)
+	return enc
+}
+
+// Reset prepares enc for a frame of the given geometry and NEAR, returning
+// every context to its initial state while keeping the context table, sample
+// buffer and output buffers for the next Encode.
+func (enc *Encoder) Reset(width, height, components, bitDepth, near int) {
 	maxVal := (1 << uint(bitDepth)) - 1
 	traits := lossless.NewTraits(maxVal, near, 64)
 
-	return &Encoder{
-		width:          width,
-		height:         height,
-		components:     components,
-		bitDepth:       bitDepth,
-		maxVal:         maxVal,
-		near:           near,
-		traits:         traits,
-		contextTable:   lossless.NewContextTable(maxVal, near, traits.Reset),
-		quantizer:      lossless.NewGradientQuantizer(traits.T1, traits.T2, traits.T3, near),
-		runModeScanner: lossless.NewRunModeScanner(traits),
+	enc.width = width
+	enc.height = height
+	enc.components = components
+	enc.bitDepth = bitDepth
+	enc.maxVal = maxVal
+	enc.near = near
+	enc.traits = traits
+	if enc.contextTable == nil {
+		enc.contextTable = lossless.NewContextTable(maxVal, near, traits.Reset)
+	} else {
+		enc.contextTable.Reset(maxVal, near, traits.Reset)
 	}
+	enc.quantizer = lossless.NewGradientQuantizer(traits.T1, traits.T2, traits.T3, near)
+	enc.runModeScanner = lossless.NewRunModeScanner(traits)
+	enc.golomb.Reset(nil)
+	enc.scanBuf.Reset()
+	enc.out.Reset()
 }
 
+// encoderPool holds the encoders of Encode, EncodePlanar and the EncodeToSize
+// estimates, each with a sample buffer sized by its largest frame.
+var encoderPool = sync.Pool{New: func() any { return &Encoder{} }}
+
 // Encode encodes pixel data to JPEG-LS near-lossless format
 func Encode(pixelData []byte, width, height, components, bitDepth, near int) ([]byte, error) {
+	return encodeFrame(pixelData, width, height, components, bitDepth, near, false)
+}
+
+// EncodePlanar encodes pixel data holding one plane per component (DICOM
+// PlanarConfiguration=1) as one JPEG-LS scan per component (ILV=0).
+func EncodePlanar(pixelData []byte, width, height, components, bitDepth, near int) ([]byte, error) {
+	return encodeFrame(pixelData, width, height, components, bitDepth, near, true)
+}
+
+func encodeFrame(pixelData []byte, width, height, components, bitDepth, near int, planar bool) ([]byte, error) {
 	if width <= 0 || height <= 0 {
 		return nil, standard.ErrInvalidDimensions
 	}
@@ -61,14 +97,31 @@ func Encode(pixelData []byte, width, height, components, bitDepth, near int) ([]
 		return nil, fmt.Errorf("invalid NEAR parameter: %d (must be 0-255)", near)
 	}
 
-	encoder := NewEncoder(width, height, components, bitDepth, near)
-	return encoder.encode(pixelData)
+	encoder := encoderPool.Get().(*Encoder)
+	defer encoderPool.Put(encoder)
+	encoder.Reset(width, height, components, bitDepth, near)
+	return encoder.encode(pixelData, planar)
+}
+
+// Encode encodes one frame with the geometry and NEAR enc was created or last
+// Reset with, starting from freshly reset contexts, so one encoder can encode
+// a series of frames. The returned stream is newly allocated and not retained
+// by enc.
+func (enc *Encoder) Encode(pixelData []byte) ([]byte, error) {
+	enc.Reset(enc.width, enc.height, enc.components, enc.bitDepth, enc.near)
+	return enc.encode(pixelData, false)
+}
+
+// EncodePlanar is Encode for planar pixel data, as the package-level
+// EncodePlanar.
+func (enc *Encoder) EncodePlanar(pixelData []byte) ([]byte, error) {
+	enc.Reset(enc.width, enc.height, enc.components, enc.bitDepth, enc.near)
+	return enc.encode(pixelData, true)
 }
 
 // encode performs the actual encoding
-func (enc *Encoder) encode(pixelData []byte) ([]byte, error) {
-	var buf bytes.Buffer
-	writer := standard.NewWriter(&buf)
+func (enc *Encoder) encode(pixelData []byte, planar bool) ([]byte, error) {
+	writer := standard.NewWriter(&enc.out)
 
 	// Write SOI marker
 	if err := writer.WriteMarker(standard.MarkerSOI); err != nil {
@@ -80,14 +133,36 @@ func (enc *Encoder) encode(pixelData []byte) ([]byte, error) {
 		return nil, err
 	}
 
-	// Write SOS marker with NEAR parameter
-	if err := enc.writeSOS(writer); err != nil {
-		return nil, err
-	}
+	// Convert pixel data to integers. The buffer is the encoder's own, so the
+	// reconstructed values written during near-lossless encoding never reach
+	// the caller's data.
+	if planar && enc.components > 1 {
+		// One scan per component; every scan starts from initial contexts.
+		pixels, err := enc.planesToIntegers(pixelData)
+		if err != nil {
+			return nil, err
+		}
+		for comp := 0; comp < enc.components; comp++ {
+			if comp > 0 {
+				enc.resetContexts()
+			}
+			if err := enc.writeSOS(writer, comp); err != nil {
+				return nil, err
+			}
+			if err := enc.encodeScan(writer, pixels, comp); err != nil {
+				return nil, err
+			}
+		}
+	} else {
+		// Write SOS marker with NEAR parameter
+		if err := enc.writeSOS(writer, -1); err != nil {
+			return nil, err
+		}
 
-	// Encode scan data
-	if err := enc.encodeScan(writer, pixelData); err != nil {
-		return nil, err
+		// Encode scan data
+		if err := enc.encodeScan(writer, enc.pixelsToIntegers(pixelData), -1); err != nil {
+			return nil, err
+		}
 	}
 
 	// Write EOI marker
@@ -95,7 +170,14 @@ func (enc *Encoder) encode(pixelData []byte) ([]byte, error) {
 		return nil, err
 	}
 
-	return buf.Bytes(), nil
+	return bytes.Clone(enc.out.Bytes()), nil
+}
+
+// resetContexts returns the contexts and run state to their initial values
+// for the next scan.
+func (enc *Encoder) resetContexts() {
+	enc.contextTable.Reset(enc.maxVal, enc.near, enc.traits.Reset)
+	enc.runModeScanner = lossless.NewRunModeScanner(enc.traits)
 }
 
 // writeSOF55 writes Start of Frame marker for JPEG-LS
@@ -123,25 +205,34 @@ func (enc *Encoder) writeSOF55(writer *standard.Writer) error {
 	return writer.WriteSegment(0xFFF7, data)
 }
 
-// writeSOS writes Start of Scan marker with NEAR parameter
-func (enc *Encoder) writeSOS(writer *standard.Writer) error {
-	length := 4 + enc.components*2
+// writeSOS writes Start of Scan marker with NEAR parameter: a scan of every
+// component, or of component comp alone (ILV=0) when comp >= 0.
+func (enc *Encoder) writeSOS(writer *standard.Writer, comp int) error {
+	scanComponents := enc.components
+	if comp >= 0 {
+		scanComponents = 1
+	}
+	length := 4 + scanComponents*2
 	data := make([]byte, length)
 
-	data[0] = byte(enc.components)
+	data[0] = byte(scanComponents)
 
-	for i := 0; i < enc.components; i++ {
+	for i := 0; i < scanComponents; i++ {
+		id := i + 1
+		if comp >= 0 {
+			id = comp + 1
+		}
 		offset := 1 + i*2
-		data[offset] = byte(i + 1)
+		data[offset] = byte(id)
 		data[offset+1] = 0
 	}
 
 	// NEAR parameter (key difference from lossless!)
 	data[length-3] = byte(enc.near)
 
-	// DICOM RGB frames are interleaved (RGBRGB...), so emit a sample-interleaved
-	// JPEG-LS scan rather than a multi-component ILV=0 scan.
-	if enc.components > 1 {
+	// Interleaved DICOM RGB frames (RGBRGB...) get a sample-interleaved scan;
+	// planar frames get one ILV=0 scan per component.
+	if scanComponents > 1 {
 		data[length-2] = 2
 	}
 
@@ -151,28 +242,20 @@ func (enc *Encoder) writeSOS(writer *standard.Writer) error {
 	return writer.WriteSegment(standard.MarkerSOS, data)
 }
 
-// encodeScan encodes the scan data
-func (enc *Encoder) encodeScan(writer *standard.Writer, pixelData []byte) error {
-	var scanBuf bytes.Buffer
-	gw := lossless.NewGolombWriter(&scanBuf)
+// encodeScan encodes the scan data of every component, or of component comp
+// alone when comp >= 0
+func (enc *Encoder) encodeScan(writer *standard.Writer, pixels []int, comp int) error {
+	scanBuf := &enc.scanBuf
+	scanBuf.Reset()
+	gw := &enc.golomb
+	gw.Reset(scanBuf)
 
-	// Convert pixel data to integers
-	pixels := enc.pixelsToIntegers(pixelData)
-
-	// Make a copy for encoding (encoder modifies pixels array during near-lossless encoding)
-	encodingPixels := make([]int, len(pixels))
-	copy(encodingPixels, pixels)
-
-	if enc.components > 1 {
-		if err := enc.encodeSampleInterleaved(gw, encodingPixels); err != nil {
+	if comp >= 0 || enc.components == 1 {
+		if err := enc.encodeComponent(gw, pixels, max(comp, 0)); err != nil {
 			return err
 		}
-	} else {
-		for comp := 0; comp < enc.components; comp++ {
-			if err := enc.encodeComponent(gw, encodingPixels, comp); err != nil {
-				return err
-			}
-		}
+	} else if err := enc.encodeSampleInterleaved(gw, pixels); err != nil {
+		return err
 	}
 
 	if err := gw.Flush(); err != nil {
@@ -497,7 +580,7 @@ func (enc *Encoder) getNeighbors(pixels []int, x, y, comp int) (int, int, int, i
 // pixelsToIntegers converts pixel bytes to integer array
 func (enc *Encoder) pixelsToIntegers(pixelData []byte) []int {
 	if enc.bitDepth <= 8 {
-		pixels := make([]int, len(pixelData))
+		pixels := enc.pixelBuffer(len(pixelData))
 		for i, b := range pixelData {
 			pixels[i] = int(b)
 		}
@@ -505,7 +588,7 @@ func (enc *Encoder) pixelsToIntegers(pixelData []byte) []int {
 	}
 
 	numPixels := len(pixelData) / 2
-	pixels := make([]int, numPixels)
+	pixels := enc.pixelBuffer(numPixels)
 	for i := 0; i < numPixels; i++ {
 		idx := i * 2
 		val := int(pixelData[idx]) | (int(pixelData[idx+1]) << 8)
@@ -514,6 +597,38 @@ func (enc *Encoder) pixelsToIntegers(pixelData []byte) []int {
 	return pixels
 }
 
+// planesToIntegers converts planar pixel bytes (one plane per component) to
+// the sample-interleaved integer layout the scan coders index.
+func (enc *Encoder) planesToIntegers(pixelData []byte) ([]int, error) {
+	planeSize := enc.width * enc.height
+	sampleBytes := bytesPerSample(enc.bitDepth)
+	if len(pixelData) < planeSize*enc.components*sampleBytes {
+		return nil, standard.ErrBufferTooSmall
+	}
+
+	pixels := enc.pixelBuffer(planeSize * enc.components)
+	for comp := 0; comp < enc.components; comp++ {
+		plane := pixelData[comp*planeSize*sampleBytes:]
+		for i := 0; i < planeSize; i++ {
+			val := int(plane[i*sampleBytes])
+			if sampleBytes == 2 {
+				val |= int(plane[i*2+1]) << 8
+			}
+			pixels[i*enc.components+comp] = val
+		}
+	}
+	return pixels, nil
+}
+
+// pixelBuffer returns n samples backed by the encoder's scratch. Callers
+// overwrite every sample, so reused storage needs no clearing.
+func (enc *Encoder) pixelBuffer(n int) []int {
+	if cap(enc.pixels) < n {
+		enc.pixels = make([]int, n)
+	}
+	return enc.pixels[:n]
+}
+
 // doRunMode handles encoding in run mode (when qs == 0) for near-lossless
 func (enc *Encoder) doRunMode(gw *lossless.GolombWriter, pixels []int, x, y, comp int, ra int) (int, error) {
 	stride := enc.components
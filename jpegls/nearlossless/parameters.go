@@ -7,7 +7,11 @@ import (
 // Ensure JPEGLSNearLosslessParameters implements codec.Parameters
 var _ codec.Parameters = (*JPEGLSNearLosslessParameters)(nil)
 
-const paramNear = "near"
+const (
+	paramNear        = "near"
+	paramTargetSize  = "targetSize"
+	paramTargetRatio = "targetRatio"
+)
 
 // JPEGLSNearLosslessParameters contains parameters for JPEG-LS Near-Lossless compression
 type JPEGLSNearLosslessParameters struct {
@@ -20,6 +24,14 @@ type JPEGLSNearLosslessParameters struct {
 	// - 20+: High error, maximum compression
 	NEAR int
 
+	// TargetSize, when > 0, selects per frame the smallest NEAR whose encoded
+	// frame fits in this many bytes (see EncodeToSize); NEAR is then ignored.
+	TargetSize int
+
+	// TargetRatio, when > 0 and TargetSize is unset, expresses the target as
+	// a compression ratio (uncompressed / compressed frame size).
+	TargetRatio float64
+
 	// internal storage for compatibility with generic parameter interface
 	params map[string]interface{}
 }
@@ -37,6 +49,10 @@ func (p *JPEGLSNearLosslessParameters) GetParameter(name string) interface{} {
 	switch name {
 	case paramNear:
 		return p.NEAR
+	case paramTargetSize:
+		return p.TargetSize
+	case paramTargetRatio:
+		return p.TargetRatio
 	default:
 		// Check custom parameters
 		return p.params[name]
@@ -50,18 +66,46 @@ func (p *JPEGLSNearLosslessParameters) SetParameter(name string, value interface
 		if v, ok := value.(int); ok {
 			p.NEAR = v
 		}
+	case paramTargetSize:
+		if v, ok := value.(int); ok {
+			p.TargetSize = v
+		}
+	case paramTargetRatio:
+		if v, ok := targetRatioValue(value); ok {
+			p.TargetRatio = v
+		}
 	default:
 		// Store as custom parameter
 		p.params[name] = value
 	}
 }
 
+// targetRatioValue reads a targetRatio given as float64, float32 or int, the
+// same types the JPEG 2000 codecs accept.
+func targetRatioValue(value interface{}) (float64, bool) {
+	switch v := value.(type) {
+	case float64:
+		return v, true
+	case float32:
+		return float64(v), true
+	case int:
+		return float64(v), true
+	}
+	return 0, false
+}
+
 // Validate checks if the parameters are valid and adjusts them if needed
 func (p *JPEGLSNearLosslessParameters) Validate() error {
 	// NEAR must be in range 0-255
 	if p.NEAR < 0 || p.NEAR > 255 {
 		p.NEAR = 3 // Reset to default
 	}
+	if p.TargetSize < 0 {
+		p.TargetSize = 0
+	}
+	if p.TargetRatio < 1 {
+		p.TargetRatio = 0
+	}
 	return nil
 }
 
@@ -70,3 +114,17 @@ func (p *JPEGLSNearLosslessParameters) WithNEAR(near int) *JPEGLSNearLosslessPar
 	p.NEAR = near
 	return p
 }
+
+// WithTargetSize sets the per-frame target size in bytes and returns the
+// parameters for chaining
+func (p *JPEGLSNearLosslessParameters) WithTargetSize(size int) *JPEGLSNearLosslessParameters {
+	p.TargetSize = size
+	return p
+}
+
+// WithTargetRatio sets the per-frame target compression ratio and returns the
+// parameters for chaining
+func (p *JPEGLSNearLosslessParameters) WithTargetRatio(ratio float64) *JPEGLSNearLosslessParameters {
+	p.TargetRatio = ratio
+	return p
+}
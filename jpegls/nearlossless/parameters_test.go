@@ -49,6 +49,15 @@ func TestNearLosslessParameters_SetParameter(t *testing.T) {
 		t.Errorf("After SetParameter(near, 10), NEAR = %d, want 10", params.NEAR)
 	}
 
+	// targetRatio accepts the same numeric types as the JPEG 2000 codecs
+	for _, v := range []interface{}{8, float32(8), 8.0} {
+		params.TargetRatio = 0
+		params.SetParameter("targetRatio", v)
+		if params.TargetRatio != 8 {
+			t.Errorf("After SetParameter(targetRatio, %T), TargetRatio = %g, want 8", v, params.TargetRatio)
+		}
+	}
+
 	// Test custom parameter
 	params.SetParameter("custom", "value")
 	if params.params["custom"] != "value" {
@@ -0,0 +1,213 @@
+package nearlossless
+
+import (
+	"fmt"
+
+	"github.com/cocosip/go-dicom-codecs/jpeg/standard"
+)
+
+// Sampling used by EncodeToSize to estimate the coded size for a NEAR value.
+const (
+	targetBandLines    = 16  // consecutive lines (or columns) per sampled band
+	targetLinesPerBand = 128 // one band per this many lines (or columns) of the frame
+	targetRetryMargin  = 50  // the retry aims 1/50 under the target, about the spread of the corrected estimate
+)
+
+// EncodeToSize encodes pixelData with the smallest NEAR whose output fits in
+// targetBytes and returns the codestream together with that NEAR.
+//
+// Candidate NEAR values are evaluated by encoding about one eighth of the
+// frame (see sampleImage) with the regular encoder, so the estimate follows
+// the real context modelling and Golomb coding. The search doubles NEAR until
+// the scaled sample fits and then bisects. The frame is then encoded at that
+// NEAR; the sample's scale is corrected from the actual size and, if the
+// corrected estimate points to a different NEAR, one more full encode
+// refines the choice, so the frame is encoded at most twice. When neither
+// encoding fits, the one at the larger NEAR is returned.
+func EncodeToSize(pixelData []byte, width, height, components, bitDepth, targetBytes int) ([]byte, int, error) {
+	if targetBytes <= 0 {
+		return nil, 0, fmt.Errorf("invalid target size: %d", targetBytes)
+	}
+	if width <= 0 || height <= 0 {
+		return nil, 0, standard.ErrInvalidDimensions
+	}
+	if components != 1 && components != 3 {
+		return nil, 0, standard.ErrInvalidComponents
+	}
+	if bitDepth < 2 || bitDepth > 16 {
+		return nil, 0, fmt.Errorf("invalid bit depth: %d (must be 2-16)", bitDepth)
+	}
+	rowBytes := width * components * bytesPerSample(bitDepth)
+	if len(pixelData) < rowBytes*height {
+		return nil, 0, fmt.Errorf("pixel data too short: %d bytes, need %d", len(pixelData), rowBytes*height)
+	}
+
+	pixelBytes := components * bytesPerSample(bitDepth)
+	sample, sampleWidth, sampleHeight := sampleImage(pixelData, width, height, pixelBytes)
+	scale := float64(width*height) / float64(sampleWidth*sampleHeight)
+	maxNear := min(255, ((1<<bitDepth)-1)/2)
+	sampleSizes := map[int]int{}
+	enc := encoderPool.Get().(*Encoder)
+	defer encoderPool.Put(enc)
+	estimate := func(near int) (int, error) {
+		size, ok := sampleSizes[near]
+		if !ok {
+			enc.Reset(sampleWidth, sampleHeight, components, bitDepth, near)
+			data, err := enc.encode(sample, false)
+			if err != nil {
+				return 0, err
+			}
+			size = len(data)
+			sampleSizes[near] = size
+		}
+		return int(float64(size) * scale), nil
+	}
+
+	// lo..hi is the NEAR range not yet settled by a full encode.
+	lo, hi := 0, maxNear
+	near, found, err := smallestFittingNear(estimate, targetBytes, lo, hi)
+	if err != nil {
+		return nil, 0, err
+	}
+	if !found {
+		near = maxNear
+	}
+	data, err := Encode(pixelData, width, height, components, bitDepth, near)
+	if err != nil {
+		return nil, 0, err
+	}
+	fits := len(data) <= targetBytes
+	if fits {
+		hi = near - 1
+	} else {
+		lo = near + 1
+	}
+	if lo > hi {
+		return data, near, nil
+	}
+
+	// Correct the sample's scale by the observed error and look once more
+	// inside the unsettled range. The retry is the last full encode, so it
+	// aims a little under the target rather than risk landing just above it.
+	est, err := estimate(near)
+	if err != nil {
+		return nil, 0, err
+	}
+	if est > 0 {
+		scale *= float64(len(data)) / float64(est)
+	}
+	next, found, err := smallestFittingNear(estimate, targetBytes-targetBytes/targetRetryMargin, lo, hi)
+	if err != nil {
+		return nil, 0, err
+	}
+	if !found {
+		if fits {
+			return data, near, nil // nothing below the fitting NEAR is expected to fit
+		}
+		next = hi
+	}
+	retry, err := Encode(pixelData, width, height, components, bitDepth, next)
+	if err != nil {
+		return nil, 0, err
+	}
+	if fits && len(retry) > targetBytes {
+		return data, near, nil
+	}
+	return retry, next, nil
+}
+
+// EncodeToRatio is EncodeToSize with the target expressed as a compression
+// ratio of the uncompressed frame size.
+func EncodeToRatio(pixelData []byte, width, height, components, bitDepth int, ratio float64) ([]byte, int, error) {
+	if ratio < 1 {
+		return nil, 0, fmt.Errorf("invalid target ratio: %g", ratio)
+	}
+	raw := width * height * components * bytesPerSample(bitDepth)
+	return EncodeToSize(pixelData, width, height, components, bitDepth, max(1, int(float64(raw)/ratio)))
+}
+
+// smallestFittingNear returns the smallest NEAR in [lo, hi] whose estimated
+// size fits target, assuming the size does not grow with NEAR, and whether
+// one was found. It probes lo, then doubles the step until a fit is found and
+// bisects.
+func smallestFittingNear(estimate func(int) (int, error), target, lo, hi int) (int, bool, error) {
+	fits := func(near int) (bool, error) {
+		size, err := estimate(near)
+		return size <= target, err
+	}
+	ok, err := fits(lo)
+	if ok || err != nil || lo >= hi {
+		return lo, ok, err
+	}
+	// Invariant: lo does not fit.
+	step := 1
+	for {
+		next := min(lo+step, hi)
+		if ok, err = fits(next); err != nil {
+			return 0, false, err
+		}
+		if ok {
+			hi = next
+			break
+		}
+		if next == hi {
+			return hi, false, nil
+		}
+		lo, step = next, step*2
+	}
+	for hi-lo > 1 {
+		mid := (lo + hi) / 2
+		if ok, err = fits(mid); err != nil {
+			return 0, false, err
+		}
+		if ok {
+			hi = mid
+		} else {
+			lo = mid
+		}
+	}
+	return hi, true, nil
+}
+
+// sampleImage gathers about one eighth of the frame into a contiguous image
+// and returns it with its width and height. Tall frames contribute evenly
+// spaced bands of whole lines and short but wide frames evenly spaced bands
+// of columns, so most sampled pixels keep their real neighbours; frames too
+// small for either keep every eighth line.
+func sampleImage(pixelData []byte, width, height, pixelBytes int) ([]byte, int, int) {
+	rowBytes := width * pixelBytes
+	if bands := height / targetLinesPerBand; bands >= 2 && bands*targetBandLines < height {
+		sample := make([]byte, 0, bands*targetBandLines*rowBytes)
+		for i := 0; i < bands; i++ {
+			y := (2*i+1)*height/(2*bands) - targetBandLines/2
+			sample = append(sample, pixelData[y*rowBytes:(y+targetBandLines)*rowBytes]...)
+		}
+		return sample, width, bands * targetBandLines
+	}
+	if bands := width / targetLinesPerBand; bands >= 2 && bands*targetBandLines < width {
+		bandBytes := targetBandLines * pixelBytes
+		sample := make([]byte, 0, bands*bandBytes*height)
+		for y := 0; y < height; y++ {
+			row := pixelData[y*rowBytes : (y+1)*rowBytes]
+			for i := 0; i < bands; i++ {
+				x := (2*i+1)*width/(2*bands) - targetBandLines/2
+				sample = append(sample, row[x*pixelBytes:x*pixelBytes+bandBytes]...)
+			}
+		}
+		return sample, bands * targetBandLines, height
+	}
+	stride := targetLinesPerBand / targetBandLines
+	lines := (height + stride - 1) / stride
+	sample := make([]byte, 0, lines*rowBytes)
+	for y := 0; y < height; y += stride {
+		sample = append(sample, pixelData[y*rowBytes:(y+1)*rowBytes]...)
+	}
+	return sample, width, lines
+}
+
+func bytesPerSample(bitDepth int) int {
+	if bitDepth <= 8 {
+		return 1
+	}
+	return 2
+}
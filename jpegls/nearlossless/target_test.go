@@ -0,0 +1,132 @@
+package nearlossless
+
+import (
+	"math/rand"
+	"testing"
+
+	codecHelpers "github.com/cocosip/go-dicom-codecs/codec"
+	"github.com/cocosip/go-dicom-codecs/jpegls/runmode"
+	"github.com/cocosip/go-dicom/pkg/imaging/imagetypes"
+)
+
+// targetTestImage builds a 12-bit frame with smooth structure and noise, so
+// that the coded size falls steadily as NEAR grows.
+func targetTestImage(width, height int) []byte {
+	r := rand.New(rand.NewSource(7))
+	data := make([]byte, 2*width*height)
+	for y := 0; y < height; y++ {
+		for x := 0; x < width; x++ {
+			v := 1500 + (x*x+y*3)%900 + r.Intn(60)
+			data[2*(y*width+x)] = byte(v)
+			data[2*(y*width+x)+1] = byte(v >> 8)
+		}
+	}
+	return data
+}
+
+// TestEncodeToSize checks that the chosen NEAR meets the target, that one
+// less would not have, and that the error bound holds.
+func TestEncodeToSize(t *testing.T) {
+	const width, height, bitDepth = 320, 512, 12
+	pixels := targetTestImage(width, height)
+	lossless, err := Encode(pixels, width, height, 1, bitDepth, 0)
+	if err != nil {
+		t.Fatalf("lossless Encode failed: %v", err)
+	}
+
+	for _, fraction := range []float64{0.8, 0.5, 0.3} {
+		target := int(float64(len(lossless)) * fraction)
+		encoded, near, err := EncodeToSize(pixels, width, height, 1, bitDepth, target)
+		if err != nil {
+			t.Fatalf("target %d: EncodeToSize failed: %v", target, err)
+		}
+		t.Logf("target %d: NEAR=%d, %d bytes", target, near, len(encoded))
+		if len(encoded) > target {
+			t.Errorf("target %d: encoded %d bytes with NEAR=%d", target, len(encoded), near)
+		}
+		if near > 0 {
+			smaller, err := Encode(pixels, width, height, 1, bitDepth, near-1)
+			if err != nil {
+				t.Fatalf("Encode NEAR=%d failed: %v", near-1, err)
+			}
+			if len(smaller) <= target {
+				t.Errorf("target %d: NEAR=%d already fits (%d bytes), chose %d", target, near-1, len(smaller), near)
+			}
+		}
+
+		decoded, _, _, _, _, gotNear, err := Decode(encoded)
+		if err != nil {
+			t.Fatalf("Decode failed: %v", err)
+		}
+		if gotNear != near {
+			t.Errorf("decoded NEAR %d, want %d", gotNear, near)
+		}
+		for i := 0; i < len(pixels); i += 2 {
+			want := int(pixels[i]) | int(pixels[i+1])<<8
+			got := int(decoded[i]) | int(decoded[i+1])<<8
+			if runmode.Abs(got-want) > near {
+				t.Fatalf("sample %d: error %d exceeds NEAR=%d", i/2, runmode.Abs(got-want), near)
+			}
+		}
+	}
+
+	if _, _, err := EncodeToSize(pixels, width, height, 1, bitDepth, 0); err == nil {
+		t.Errorf("zero target size should fail")
+	}
+}
+
+// TestEncodeToSizeShortFrames checks that frames too short for line bands
+// are still sized from a sample rather than from the whole frame.
+func TestEncodeToSizeShortFrames(t *testing.T) {
+	const bitDepth = 12
+	for _, size := range [][2]int{{640, 100}, {120, 90}, {300, 1}} {
+		width, height := size[0], size[1]
+		pixels := targetTestImage(width, height)
+		_, sw, sh := sampleImage(pixels, width, height, 2)
+		if sw*sh*4 > width*height && width*height > 1000 {
+			t.Errorf("%dx%d: sample %dx%d covers more than a quarter of the frame", width, height, sw, sh)
+		}
+
+		lossless, err := Encode(pixels, width, height, 1, bitDepth, 0)
+		if err != nil {
+			t.Fatalf("%dx%d: lossless Encode failed: %v", width, height, err)
+		}
+		target := len(lossless) / 2
+		encoded, near, err := EncodeToSize(pixels, width, height, 1, bitDepth, target)
+		if err != nil {
+			t.Fatalf("%dx%d: EncodeToSize failed: %v", width, height, err)
+		}
+		if len(encoded) > target && near < 255 {
+			t.Errorf("%dx%d: encoded %d bytes with NEAR=%d, target %d", width, height, len(encoded), near, target)
+		}
+	}
+}
+
+// TestCodecTargetRatio checks the codec parameters and the NEAR reported back.
+func TestCodecTargetRatio(t *testing.T) {
+	const width, height = 96, 80
+	frameInfo := &imagetypes.FrameInfo{
+		Width: width, Height: height, BitsAllocated: 16, BitsStored: 12, HighBit: 11,
+		SamplesPerPixel: 1, PhotometricInterpretation: "MONOCHROME2",
+	}
+	src := codecHelpers.NewTestPixelData(frameInfo)
+	if err := src.AddFrame(targetTestImage(width, height)); err != nil {
+		t.Fatalf("AddFrame failed: %v", err)
+	}
+	params := NewNearLosslessParameters().WithTargetRatio(4)
+	dst := codecHelpers.NewTestPixelData(frameInfo)
+	if err := NewJPEGLSNearLosslessCodec(3).Encode(src, dst, params); err != nil {
+		t.Fatalf("Encode failed: %v", err)
+	}
+	frame, _ := dst.GetFrame(0)
+	if limit := width * height * 2 / 4; len(frame) > limit {
+		t.Errorf("encoded %d bytes, want at most %d", len(frame), limit)
+	}
+	_, _, _, _, _, near, err := Decode(frame)
+	if err != nil {
+		t.Fatalf("Decode failed: %v", err)
+	}
+	if params.NEAR != near || near == 0 {
+		t.Errorf("reported NEAR %d, stream NEAR %d", params.NEAR, near)
+	}
+}
@@ -4,6 +4,8 @@ import (
 	"bytes"
 	"testing"
 
+	"github.com/cocosip/go-dicom-codecs/codec/stats"
+	"github.com/cocosip/go-dicom/pkg/imaging/codec"
 	"github.com/cocosip/go-dicom/pkg/imaging/imagetypes"
 )
 
@@ -55,6 +57,65 @@ func TestRLECodecRoundTripPixelLayouts(t *testing.T) {
 	}
 }
 
+// TestRLECodecSharedStats checks that segments written as runs from shared
+// frame statistics match the segments of a regular encode.
+func TestRLECodecSharedStats(t *testing.T) {
+	narrow := make([]byte, 2*37*9) // 16-bit samples whose high byte is 0
+	for i := 0; i < len(narrow); i += 2 {
+		narrow[i] = byte(i * 7)
+	}
+	tests := []struct {
+		name string
+		info *imagetypes.FrameInfo
+		data []byte
+	}{
+		{
+			name: "16-bit narrow values",
+			info: &imagetypes.FrameInfo{
+				Width: 37, Height: 9, BitsAllocated: 16, BitsStored: 12, HighBit: 11,
+				SamplesPerPixel: 1, PhotometricInterpretation: photometricMonochrome2,
+			},
+			data: narrow,
+		},
+		{
+			name: "16-bit blank",
+			info: &imagetypes.FrameInfo{
+				Width: 129, Height: 3, BitsAllocated: 16, BitsStored: 16, HighBit: 15,
+				SamplesPerPixel: 1, PhotometricInterpretation: photometricMonochrome2,
+			},
+			data: bytes.Repeat([]byte{0x18, 0xFC}, 129*3),
+		},
+		{
+			name: "8-bit RGB planar with a constant plane",
+			info: &imagetypes.FrameInfo{
+				Width: 8, Height: 8, BitsAllocated: 8, BitsStored: 8, HighBit: 7,
+				SamplesPerPixel: 3, PlanarConfiguration: 1, PhotometricInterpretation: photometricRGB,
+			},
+			data: append(append(patternedBytes(64, 3), bytes.Repeat([]byte{0x80}, 64)...), patternedBytes(64, 5)...),
+		},
+	}
+
+	for _, test := range tests {
+		t.Run(test.name, func(t *testing.T) {
+			want := encodeFrame(t, NewRLECodec(), test.info, test.data)
+
+			source := newTestPixelData(test.info)
+			_ = source.AddFrame(test.data)
+			destination := newTestPixelData(test.info)
+			params := codec.NewBaseParameters()
+			params.SetParameter(stats.ParameterName, stats.NewCache())
+			if err := NewRLECodec().Encode(source, destination, params); err != nil {
+				t.Fatalf("Encode() error = %v", err)
+			}
+			got, _ := destination.GetFrame(0)
+			if !bytes.Equal(got, want) {
+				t.Fatalf("encode with shared stats differs: %d bytes, want %d", len(got), len(want))
+			}
+			assertDecodedFrame(t, NewRLECodec(), test.info, got, test.data)
+		})
+	}
+}
+
 func patternedBytes(length, factor int) []byte {
 	result := make([]byte, length)
 	for i := range result {
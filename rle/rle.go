@@ -9,7 +9,13 @@ import (
 	"encoding/binary"
 	"fmt"
 	"io"
+	"sync"
 
+	"github.com/cocosip/go-dicom-codecs/codec/layout"
+	"github.com/cocosip/go-dicom-codecs/codec/limits"
+	"github.com/cocosip/go-dicom-codecs/codec/sched"
+	"github.com/cocosip/go-dicom-codecs/codec/stats"
+	"github.com/cocosip/go-dicom-codecs/codec/voi"
 	"github.com/cocosip/go-dicom/pkg/dicom/transfer"
 	"github.com/cocosip/go-dicom/pkg/imaging/codec"
 	"github.com/cocosip/go-dicom/pkg/imaging/imagetypes"
@@ -40,22 +46,16 @@ func (c *Codec) Encode(oldPixelData imagetypes.PixelData, newPixelData imagetype
 	}
 
 	frameInfo := oldPixelData.GetFrameInfo()
-	frameCount := oldPixelData.FrameCount()
-	for i := 0; i < frameCount; i++ {
-		srcFrame, err := oldPixelData.GetFrame(i)
-		if err != nil {
-			return fmt.Errorf("failed to get frame %d: %w", i, err)
-		}
-
-		var dstFrame []byte
-		if err := c.encodeFrame(srcFrame, &dstFrame, frameInfo, parameters); err != nil {
-			return fmt.Errorf("failed to encode frame %d: %w", i, err)
-		}
-		if err := newPixelData.AddFrame(dstFrame); err != nil {
-			return fmt.Errorf("failed to add frame %d: %w", i, err)
-		}
-	}
-	return nil
+	return sched.Frames(sched.PriorityFromParameters(parameters), oldPixelData.FrameCount(),
+		sched.FrameReader(oldPixelData),
+		func(i int, srcFrame []byte) ([]byte, error) {
+			var dstFrame []byte
+			if err := c.encodeFrame(srcFrame, &dstFrame, frameInfo, parameters); err != nil {
+				return nil, fmt.Errorf("failed to encode frame %d: %w", i, err)
+			}
+			return dstFrame, nil
+		},
+		sched.FrameWriter(newPixelData))
 }
 
 // Decode decodes pixel data from oldPixelData to newPixelData.
@@ -65,25 +65,35 @@ func (c *Codec) Decode(oldPixelData imagetypes.PixelData, newPixelData imagetype
 	}
 
 	frameInfo := oldPixelData.GetFrameInfo()
-	frameCount := oldPixelData.FrameCount()
-	for i := 0; i < frameCount; i++ {
-		srcFrame, err := oldPixelData.GetFrame(i)
+	var renderer *voi.Renderer
+	if frameInfo != nil {
+		var err error
+		renderer, err = voi.RendererFromParameters(parameters, int(frameInfo.BitsStored), frameInfo.PixelRepresentation == 1)
 		if err != nil {
-			return fmt.Errorf("failed to get frame %d: %w", i, err)
-		}
-
-		var dstFrame []byte
-		if err := c.decodeFrame(srcFrame, &dstFrame, frameInfo, parameters); err != nil {
-			return fmt.Errorf("failed to decode frame %d: %w", i, err)
-		}
-		if err := newPixelData.AddFrame(dstFrame); err != nil {
-			return fmt.Errorf("failed to add frame %d: %w", i, err)
+			return err
 		}
 	}
+	decodeLimits := limits.FromParameters(parameters)
+	err := sched.Frames(sched.PriorityFromParameters(parameters), oldPixelData.FrameCount(),
+		sched.FrameReader(oldPixelData),
+		func(i int, srcFrame []byte) ([]byte, error) {
+			var dstFrame []byte
+			if err := c.decodeFrame(srcFrame, &dstFrame, frameInfo, renderer, decodeLimits); err != nil {
+				return nil, fmt.Errorf("failed to decode frame %d: %w", i, err)
+			}
+			return dstFrame, nil
+		},
+		sched.FrameWriter(newPixelData))
+	if err != nil {
+		return err
+	}
+	if renderer != nil {
+		layout.ReportRendered(parameters)
+	}
 	return nil
 }
 
-func (c *Codec) encodeFrame(src []byte, dst *[]byte, info *imagetypes.FrameInfo, _ codec.Parameters) error {
+func (c *Codec) encodeFrame(src []byte, dst *[]byte, info *imagetypes.FrameInfo, parameters codec.Parameters) error {
 	if len(src) == 0 {
 		return fmt.Errorf("source frame data must not be empty")
 	}
@@ -95,13 +105,28 @@ func (c *Codec) encodeFrame(src []byte, dst *[]byte, info *imagetypes.FrameInfo,
 	bytesAllocated := int((info.BitsAllocated-1)/8 + 1)
 	numberOfSegments := bytesAllocated * int(info.SamplesPerPixel)
 	isInterleaved := info.PlanarConfiguration == 0
-	encoder := newRLEEncoder()
+	encoder := encoderPool.Get().(*rleEncoder)
+	defer encoderPool.Put(encoder)
+	encoder.Reset()
+	// Shared frame statistics, when the caller supplies them, identify byte
+	// planes that hold a single value; those segments are written as runs
+	// without reading the plane.
+	frameStats := stats.FromParameters(parameters, stats.FrameOf(info, src))
 
 	for s := 0; s < numberOfSegments; s++ {
 		encoder.NextSegment()
 		sample := s / bytesAllocated
 		sabyte := s % bytesAllocated
 
+		if frameStats != nil {
+			comp := &frameStats.Components[sample]
+			shift := 8 * (bytesAllocated - sabyte - 1)
+			if (comp.Varying>>shift)&0xFF == 0 {
+				encoder.EncodeRun(byte(comp.First>>shift), pixelCount)
+				continue
+			}
+		}
+
 		var pos, offset int
 		if isInterleaved {
 			pos = sample * bytesAllocated
@@ -123,11 +148,15 @@ func (c *Codec) encodeFrame(src []byte, dst *[]byte, info *imagetypes.FrameInfo,
 	}
 
 	encoder.MakeEvenLength()
-	*dst = encoder.GetBuffer()
+	// The encoder keeps its buffer for the next frame, so hand out a copy.
+	*dst = bytes.Clone(encoder.GetBuffer())
 	return nil
 }
 
-func (c *Codec) decodeFrame(src []byte, dst *[]byte, info *imagetypes.FrameInfo, _ codec.Parameters) error {
+// decodeFrame decodes one RLE frame. When renderer is set the scattered
+// samples are mapped in place to one 8-bit display value each. The frame
+// described by info is checked against l before the output is allocated.
+func (c *Codec) decodeFrame(src []byte, dst *[]byte, info *imagetypes.FrameInfo, renderer *voi.Renderer, l limits.DecodeLimits) error {
 	if len(src) == 0 {
 		return fmt.Errorf("source frame data must not be empty")
 	}
@@ -141,13 +170,16 @@ func (c *Codec) decodeFrame(src []byte, dst *[]byte, info *imagetypes.FrameInfo,
 	isInterleaved := info.PlanarConfiguration == 0
 
 	frameSize := bytesAllocated * int(info.SamplesPerPixel) * int(info.Width) * int(info.Height)
+	if err := l.CheckFrame(int(info.Width), int(info.Height), int(info.SamplesPerPixel), int64(frameSize)); err != nil {
+		return err
+	}
 	if (frameSize & 1) == 1 {
 		frameSize++
 	}
 	frameData := make([]byte, frameSize)
 
-	decoder, err := newRLEDecoder(src)
-	if err != nil {
+	var decoder rleDecoder
+	if err := decoder.Reset(src); err != nil {
 		return fmt.Errorf("failed to create RLE decoder: %w", err)
 	}
 	if decoder.NumberOfSegments != numberOfSegments {
@@ -173,10 +205,30 @@ func (c *Codec) decodeFrame(src []byte, dst *[]byte, info *imagetypes.FrameInfo,
 		}
 	}
 
+	if renderer != nil {
+		frameData = renderSamples(frameData, pixelCount*int(info.SamplesPerPixel), bytesAllocated, renderer)
+	}
+
 	*dst = frameData
 	return nil
 }
 
+// renderSamples maps little-endian samples of bytesAllocated bytes to display
+// values, compacting them to the front of data (sample i is read at
+// i*bytesAllocated before byte i is written, so the pass is safe in place).
+func renderSamples(data []byte, numSamples, bytesAllocated int, renderer *voi.Renderer) []byte {
+	for i := 0; i < numSamples; i++ {
+		v := 0
+		for b := bytesAllocated - 1; b >= 0; b-- {
+			v = v<<8 | int(data[i*bytesAllocated+b])
+		}
+		data[i] = renderer.MapStored(v)
+	}
+	size := numSamples + numSamples&1
+	clear(data[numSamples:size])
+	return data[:size]
+}
+
 type rleEncoder struct {
 	count      int
 	offsets    [15]uint32
@@ -188,14 +240,25 @@ type rleEncoder struct {
 }
 
 func newRLEEncoder() *rleEncoder {
-	enc := &rleEncoder{prevByte: -1}
-	_ = binary.Write(&enc.buffer, binary.LittleEndian, uint32(enc.count))
-	for i := 0; i < 15; i++ {
-		_ = binary.Write(&enc.buffer, binary.LittleEndian, enc.offsets[i])
-	}
+	enc := &rleEncoder{}
+	enc.Reset()
 	return enc
 }
 
+// encoderPool holds encoders whose output buffers have grown to frame size,
+// so encoding a multi-frame image does not regrow a buffer per frame.
+var encoderPool = sync.Pool{New: func() any { return newRLEEncoder() }}
+
+// Reset starts a new frame, keeping the capacity of the output buffer.
+func (e *rleEncoder) Reset() {
+	e.count = 0
+	e.offsets = [15]uint32{}
+	e.prevByte, e.repeatCnt, e.bufferPos = -1, 0, 0
+	e.buffer.Reset()
+	var header [64]byte // segment count and offsets, filled in by GetBuffer
+	e.buffer.Write(header[:])
+}
+
 func (e *rleEncoder) NextSegment() {
 	e.Flush()
 	if (e.buffer.Len() & 1) == 1 {
@@ -255,6 +318,23 @@ func (e *rleEncoder) Encode(b byte) {
 	}
 }
 
+// EncodeRun writes n copies of b at the start of a segment, producing the
+// same bytes as n calls to Encode.
+func (e *rleEncoder) EncodeRun(b byte, n int) {
+	for ; n > 128; n -= 128 {
+		e.buffer.WriteByte(byte(257 - 128))
+		e.buffer.WriteByte(b)
+	}
+	switch {
+	case n == 1:
+		e.buffer.WriteByte(0)
+		e.buffer.WriteByte(b)
+	case n > 1:
+		e.buffer.WriteByte(byte(257 - n))
+		e.buffer.WriteByte(b)
+	}
+}
+
 func (e *rleEncoder) Flush() {
 	if e.repeatCnt < 2 {
 		for e.repeatCnt > 0 {
@@ -292,10 +372,9 @@ func (e *rleEncoder) MakeEvenLength() {
 func (e *rleEncoder) GetBuffer() []byte {
 	e.Flush()
 	result := e.buffer.Bytes()
-	buf := bytes.NewBuffer(result[:0])
-	_ = binary.Write(buf, binary.LittleEndian, uint32(e.count))
-	for i := 0; i < 15; i++ {
-		_ = binary.Write(buf, binary.LittleEndian, e.offsets[i])
+	binary.LittleEndian.PutUint32(result, uint32(e.count))
+	for i, offset := range e.offsets {
+		binary.LittleEndian.PutUint32(result[4+4*i:], offset)
 	}
 	return result
 }
@@ -307,30 +386,32 @@ type rleDecoder struct {
 }
 
 func newRLEDecoder(data []byte) (*rleDecoder, error) {
-	if len(data) < 64 {
-		return nil, fmt.Errorf("RLE data too short: need at least 64 bytes, got %d", len(data))
+	dec := &rleDecoder{}
+	if err := dec.Reset(data); err != nil {
+		return nil, err
 	}
-	dec := &rleDecoder{data: data}
-	reader := bytes.NewReader(data)
-	var numSegments uint32
-	if err := binary.Read(reader, binary.LittleEndian, &numSegments); err != nil {
-		return nil, fmt.Errorf("failed to read number of segments: %w", err)
+	return dec, nil
+}
+
+// Reset parses the header of data, the RLE frame to decode next.
+func (d *rleDecoder) Reset(data []byte) error {
+	if len(data) < 64 {
+		return fmt.Errorf("RLE data too short: need at least 64 bytes, got %d", len(data))
 	}
+	numSegments := binary.LittleEndian.Uint32(data)
 	if numSegments < 1 || numSegments > 15 {
-		return nil, fmt.Errorf("invalid number of RLE segments: %d (must be 1-15)", numSegments)
+		return fmt.Errorf("invalid number of RLE segments: %d (must be 1-15)", numSegments)
 	}
-	dec.NumberOfSegments = int(numSegments)
-	for i := 0; i < 15; i++ {
-		var offset uint32
-		if err := binary.Read(reader, binary.LittleEndian, &offset); err != nil {
-			return nil, fmt.Errorf("failed to read offset %d: %w", i, err)
-		}
+	d.data = data
+	d.NumberOfSegments = int(numSegments)
+	for i := range d.offsets {
+		offset := binary.LittleEndian.Uint32(data[4+4*i:])
 		if i < int(numSegments) && int(offset) > len(data) {
-			return nil, fmt.Errorf("RLE segment %d offset %d exceeds data length %d", i, offset, len(data))
+			return fmt.Errorf("RLE segment %d offset %d exceeds data length %d", i, offset, len(data))
 		}
-		dec.offsets[i] = int(offset)
+		d.offsets[i] = int(offset)
 	}
-	return dec, nil
+	return nil
 }
 
 func (d *rleDecoder) DecodeSegment(segment int, buffer []byte, start int, sampleOffset int) error {
@@ -5,6 +5,9 @@ import (
 	"encoding/binary"
 	"testing"
 
+	"github.com/cocosip/go-dicom-codecs/codec/layout"
+	"github.com/cocosip/go-dicom-codecs/codec/voi"
+	"github.com/cocosip/go-dicom/pkg/imaging/codec"
 	"github.com/cocosip/go-dicom/pkg/imaging/imagetypes"
 )
 
@@ -192,6 +195,63 @@ func TestRLECodec_Encode16Bit(t *testing.T) {
 	}
 }
 
+func TestRLECodec_DecodeRendered(t *testing.T) {
+	rleCodec := NewRLECodec()
+
+	width, height := uint16(9), uint16(7)
+	values := make([]int16, int(width)*int(height))
+	pixelData := make([]byte, len(values)*2)
+	for i := range values {
+		values[i] = int16(i*37%2048 - 1024)
+		binary.LittleEndian.PutUint16(pixelData[i*2:], uint16(values[i]))
+	}
+	frameInfo := &imagetypes.FrameInfo{
+		Width:                     width,
+		Height:                    height,
+		BitsAllocated:             16,
+		BitsStored:                12,
+		HighBit:                   11,
+		SamplesPerPixel:           1,
+		PixelRepresentation:       1,
+		PhotometricInterpretation: photometricMonochrome2,
+	}
+
+	src := newTestPixelData(frameInfo)
+	_ = src.AddFrame(pixelData)
+	encoded := newTestPixelData(frameInfo)
+	if err := rleCodec.Encode(src, encoded, nil); err != nil {
+		t.Fatalf("Encode() error = %v", err)
+	}
+
+	opts := &voi.Options{RescaleSlope: 1, WindowCenter: 0, WindowWidth: 1200}
+	params := codec.NewBaseParameters()
+	params.SetParameter(voi.ParameterName, opts)
+	decoded := newTestPixelData(frameInfo)
+	if err := rleCodec.Decode(encoded, decoded, params); err != nil {
+		t.Fatalf("Decode() error = %v", err)
+	}
+	if params.GetParameter(layout.BitsAllocatedParameter) != 8 || params.GetParameter(layout.BitsStoredParameter) != 8 ||
+		params.GetParameter(layout.HighBitParameter) != 7 || params.GetParameter(layout.PixelRepresentationParameter) != 0 {
+		t.Errorf("reported sample format %v/%v/%v/%v, want 8/8/7/0",
+			params.GetParameter(layout.BitsAllocatedParameter), params.GetParameter(layout.BitsStoredParameter),
+			params.GetParameter(layout.HighBitParameter), params.GetParameter(layout.PixelRepresentationParameter))
+	}
+	rendered, _ := decoded.GetFrame(0)
+
+	r, err := voi.NewRenderer(*opts, 12, true)
+	if err != nil {
+		t.Fatalf("NewRenderer() error = %v", err)
+	}
+	if len(rendered) != len(values)+len(values)%2 {
+		t.Fatalf("rendered length = %d, want %d", len(rendered), len(values)+len(values)%2)
+	}
+	for i, v := range values {
+		if want := r.Map(int32(v)); rendered[i] != want {
+			t.Fatalf("pixel %d (%d): got %d, want %d", i, v, rendered[i], want)
+		}
+	}
+}
+
 func TestRLEEncoder_AllSameValue(t *testing.T) {
 	encoder := newRLEEncoder()
 	encoder.NextSegment()
@@ -223,6 +283,30 @@ func TestRLEEncoder_NoRepetition(t *testing.T) {
 	}
 }
 
+func TestRLEEncoder_Reset(t *testing.T) {
+	encodeSegments := func(encoder *rleEncoder, segments [][]byte) []byte {
+		for _, segment := range segments {
+			encoder.NextSegment()
+			for _, b := range segment {
+				encoder.Encode(b)
+			}
+		}
+		encoder.MakeEvenLength()
+		return bytes.Clone(encoder.GetBuffer())
+	}
+	long := [][]byte{bytes.Repeat([]byte{1, 2, 3, 3, 3, 3}, 50), bytes.Repeat([]byte{9}, 300)}
+	short := [][]byte{{5, 6, 7}}
+
+	reused := newRLEEncoder()
+	encodeSegments(reused, long)
+	reused.Reset()
+	got := encodeSegments(reused, short)
+	want := encodeSegments(newRLEEncoder(), short)
+	if !bytes.Equal(got, want) {
+		t.Fatalf("reset encoder produced %v, want %v", got, want)
+	}
+}
+
 func TestRLECodec_TransferSyntax(t *testing.T) {
 	codec := NewRLECodec()
 	ts := codec.TransferSyntax()